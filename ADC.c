@@ -8,6 +8,23 @@
 #include "WS2812.h"
 #include "led_cube.h"
 
+// Filtered pot value in 12.4 fixed point, updated by the SS3 interrupt
+static uint16_t potFiltered = 0;
+// Published pot value after hysteresis
+static volatile uint16_t potLevel = 0;
+
+// Timer2A periodic trigger for sequencer 3
+static void ADC_TriggerTimerInit(void) {
+    SYSCTL->RCGCTIMER |= (1U << 2);              // Enable Timer2
+    while ((SYSCTL->PRTIMER & (1U << 2)) == 0);  // Wait until ready
+
+    TIMER2->CTL = 0;                             // Disable during setup
+    TIMER2->CFG = 0x0;                           // 32-bit mode
+    TIMER2->TAMR = 0x2;                          // Periodic mode
+    TIMER2->TAILR = SYS_CLOCK / ADC_POT_SAMPLE_HZ - 1;
+    TIMER2->CTL = (1U << 5) | (1U << 0);         // TAOTE (ADC trigger) + TAEN
+}
+
 // Function to set up ADC for potentiometer reading
 void ADC_Init(void) {
     // Enable clock for ADC0
@@ -30,6 +47,45 @@ void ADC_Init(void) {
     ADC0->SSMUX0 = 0;         // Set channel to AIN0 (PE3)
     ADC0->SSCTL0 = 0x06;      // Take one sample, set flag at end
     ADC0->ACTSS |= 0x0001;    // Enable SS0
+
+    // Configure SS3 for background pot sampling
+    ADC0->ACTSS &= ~0x0008;   // Disable SS3 during configuration
+    ADC0->EMUX = (ADC0->EMUX & ~0xF000) | 0x5000;  // SS3 triggered by timer
+    ADC0->SSMUX3 = 0;         // AIN0 (PE3)
+    ADC0->SSCTL3 = 0x06;      // One sample, interrupt at end
+    ADC0->SAC = ADC_POT_HW_AVERAGE;  // Hardware oversampling
+    ADC0->ISC = 0x08;         // Clear stale SS3 flag
+    ADC0->IM |= 0x08;         // Interrupt on SS3 completion
+    ADC0->ACTSS |= 0x0008;    // Enable SS3
+    NVIC_EnableIRQ(ADC0SS3_IRQn);
+
+    ADC_TriggerTimerInit();
+}
+
+// SS3 completion: low-pass filter the pot and publish it with hysteresis
+void ADC0SS3_Handler(void) {
+    uint16_t raw = ADC0->SSFIFO3 & 0xFFF;
+    ADC0->ISC = 0x08;
+
+    // First-order IIR in 12.4 fixed point. The step and the result are
+    // rounded, not truncated, so the filter settles within half a count of
+    // a steady input and the ends of the travel read exactly 0 and 4095
+    int32_t target = (int32_t)raw << 4;
+    int32_t step = (target - (int32_t)potFiltered + (1 << (ADC_POT_FILTER_SHIFT - 1))) >> ADC_POT_FILTER_SHIFT;
+    potFiltered = (uint16_t)(potFiltered + step);
+
+    uint16_t value = (uint16_t)((potFiltered + 8U) >> 4);
+    uint16_t level = potLevel;
+    uint16_t delta = (value > level) ? (value - level) : (level - value);
+
+    // Ignore jitter, but still let the ends of the travel reach 0 and 4095
+    if (delta >= ADC_POT_HYSTERESIS || value == 0 || value == 4095) {
+        potLevel = value;
+    }
+}
+
+uint16_t ADC_GetPotLevel(void) {
+    return potLevel;
 }
 
 // Function to read ADC value
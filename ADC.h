@@ -6,8 +6,17 @@
 #define ADC_H
 #include <stdint.h>
 
+// Background sampling of the pot (AIN0) on sequencer 3
+#define ADC_POT_SAMPLE_HZ    1000U   // Timer2A trigger rate
+#define ADC_POT_HW_AVERAGE   6U      // SAC setting: 2^6 = 64x hardware averaging
+#define ADC_POT_FILTER_SHIFT 3U      // IIR weight of a new sample = 1/8
+#define ADC_POT_HYSTERESIS   12U     // Counts the filtered value must move to register
+
 /**
  * @brief Initialize ADC0 sample sequencer 0 for AIN0.
+ *
+ * Also starts sequencer 3 converting AIN0 continuously, triggered by
+ * Timer2A with hardware oversampling; its interrupt filters the result.
  */
 void ADC_Init(void);
 
@@ -18,4 +27,12 @@ void ADC_Init(void);
  */
 uint16_t ADC0_ReadChannel(uint8_t channel);
 
+/**
+ * @brief Latest filtered pot reading with hysteresis applied.
+ *
+ * Never waits on a conversion; safe to call from the render path.
+ * @return 12-bit value (0..4095).
+ */
+uint16_t ADC_GetPotLevel(void);
+
 #endif // ADC_H
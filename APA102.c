@@ -0,0 +1,163 @@
+/**
+ * @file APA102.c
+ * @brief APA102 / SK9822 SPI driver with timeout protection.
+ */
+
+#include "TM4C123GH6PM.h"
+#include "APA102.h"
+#include "board.h"
+#include "output.h"
+#include "frame_source.h"
+#include <stddef.h>  // For NULL definition
+
+#define MAX_WAIT     1000       // maximum loop iterations to prevent lockup
+#define LED_HEADER   0xE0U      // Top bits of each LED's first byte
+#define START_BYTES  4          // Zero start frame
+#define RESET_BYTES  4          // SK9822 latches on 32 zero bits after the data
+
+// Masks from SSI0.c (bit 1 = TNF/empty, bit 4 = BSY)
+#define SSI_SSE      (1U<<1)    // CR1, SSE bit
+#define SSI_SR_TNF   (1U<<1)    // SR, Transmit FIFO not full
+#define SSI_SR_BSY   (1U<<4)    // SR, Busy flag
+
+static led_output_stats_t stats;
+
+// Even CPSDVSR closest to SYS_CLOCK/APA102_SPI_FREQ
+static uint32_t spiPrescale(void) {
+    uint32_t ps = (SYS_CLOCK + APA102_SPI_FREQ/2) / APA102_SPI_FREQ;
+    if (ps < 2) ps = 2;
+    if (ps > 254) ps = 254;
+    if (ps & 1) ps++;
+    return ps;
+}
+
+// Write one byte to the TX FIFO. Return 1 if successful, 0 if timed out
+static inline int pushByte(uint8_t byte) {
+    // Wait for TX FIFO not full with timeout
+    volatile uint32_t timeout = MAX_WAIT;
+    while (!(SSI0->SR & SSI_SR_TNF) && --timeout > 0);
+    if (timeout == 0) {
+        // Reset SSI if it's stuck
+        SSI0->CR1 &= ~SSI_SSE;  // Disable
+        SSI0->CR1 |= SSI_SSE;   // Re-enable
+        return 0;
+    }
+    SSI0->DR = byte;
+    return 1;
+}
+
+static int pushZeros(int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        if (!pushByte(0)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Send one frame. The chain is clocked, so a stall while the output chain
+// works on an LED only pauses the bus. Return 1 if successful, 0 if timed out
+static int showFrame(const frame_source_t *src, int count) {
+    uint8_t post = Output_Stages() != 0;
+    uint8_t header = LED_HEADER | APA102_LEVELS;
+    if (post) {
+        Output_BeginFrame(src, count);
+        header = LED_HEADER | Output_HardwareLevel();
+    }
+
+    int ok = pushZeros(START_BYTES);
+    for (int led = 0; led < count && ok; ++led) {
+        uint8_t mixed[3];
+        uint8_t processed[3];
+        const uint8_t *grb = FrameSource_Led(src, led, mixed);
+        if (post) {
+            processed[0] = grb[0];
+            processed[1] = grb[1];
+            processed[2] = grb[2];
+            Output_ProcessLed(led, processed);
+            grb = processed;
+        }
+        ok = pushByte(header) && pushByte(grb[2]) && pushByte(grb[0]) && pushByte(grb[1]);
+    }
+
+    if (post) {
+        Output_EndFrame();
+    }
+
+    // Each LED delays the clock it passes on by half a cycle, so the last
+    // one needs a further bit per two LEDs
+    if (!ok || !pushZeros(RESET_BYTES + (count + 15) / 16)) {
+        return 0;  // Return error
+    }
+
+    // Wait until SSI no longer busy with timeout
+    volatile uint32_t timeout = MAX_WAIT;
+    while ((SSI0->SR & SSI_SR_BSY) && --timeout > 0);
+    if (timeout == 0) {
+        // Reset SSI if it's stuck
+        SSI0->CR1 &= ~SSI_SSE;  // Disable
+        SSI0->CR1 |= SSI_SSE;   // Re-enable
+        return 0;  // Return error
+    }
+    return 1;  // Success
+}
+
+static void apa102Init(void) {
+    // Enable clocks for SSI0 and GPIOA
+    SYSCTL->RCGCSSI  |= (1U<<0);
+    SYSCTL->RCGCGPIO |= (1U<<0);
+    __NOP();
+    __NOP(); // Additional NOPs to ensure clock is stable
+
+    // Configure PA2 as SSI0Clk and PA5 as SSI0TX
+    GPIOA->AFSEL |= APA102_CLK_PIN | APA102_DATA_PIN;
+    GPIOA->PCTL  = (GPIOA->PCTL & ~0x00F00F00) | (2U<<8) | (2U<<20);
+    GPIOA->DEN  |= APA102_CLK_PIN | APA102_DATA_PIN;
+
+    // Disable SSI0 before config (clear SSE)
+    SSI0->CR1 &= ~SSI_SSE;
+
+    // Set prescale: even CPSDVSR = SYS_CLOCK/APA102_SPI_FREQ
+    SSI0->CPSR = spiPrescale();
+
+    // Configure CR0: SCR=0, SPH=0, SPO=0 (LEDs sample on the rising edge), FRF=0, DSS=7 (8-bit)
+    SSI0->CR0 = (0<<8)|(0<<7)|(0<<6)|(0<<4)|(0x7);
+    SSI0->DMACTL = 0;
+
+    // Re-enable SSI0 (set SSE)
+    SSI0->CR1 |= SSI_SSE;
+
+    // Dim coarsely in the LEDs and finely in the channels
+    Output_SetHardwareLevels(APA102_LEVELS);
+    Output_SetStages(Output_Stages() | OUTPUT_STAGE_BRIGHTNESS);
+}
+
+static void apa102BeginFrame(void) {
+}
+
+static int apa102Submit(const frame_source_t *src, int count) {
+    stats.frames++;
+    if (!showFrame(src, count)) {
+        stats.errors++;
+        return LED_OUTPUT_ERROR;
+    }
+    stats.sent++;
+    return LED_OUTPUT_SENT;
+}
+
+// Frames are finished inside submit and need no latch time
+static int apa102Wait(void) {
+    return 1;
+}
+
+static void apa102Stats(led_output_stats_t *out) {
+    // Start frame, LEDs and end frame for a full chain
+    uint32_t bytes = START_BYTES + NUM_LEDS * 4U + RESET_BYTES + (NUM_LEDS + 15) / 16;
+    uint32_t bitsPerUs = SYS_CLOCK / spiPrescale() / 1000000U;
+    *out = stats;
+    out->frameUs = (bytes * 8U + bitsPerUs - 1) / bitsPerUs;
+}
+
+const led_output_device_t apa102Device = {
+    "apa102", apa102Init, apa102BeginFrame, apa102Submit, apa102Wait, apa102Stats, 1
+};
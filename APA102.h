@@ -0,0 +1,35 @@
+/**
+ * @file APA102.h
+ * @brief APA102 / SK9822 clocked LED driver on SSI0 (clock + data).
+ *
+ * These LEDs shift in plain bytes on their own clock line, so there is no
+ * symbol encoding or pulse timing: each LED's bytes go to the SPI FIFO as
+ * soon as the output chain has produced them. A frame is a zero start
+ * frame, one 0xE0 | level, B, G, R group per LED, and an end frame of
+ * zeros long enough to clock the data through the chain (the SK9822 also
+ * latches on it).
+ *
+ * Frames are never skipped: a whole chain goes out in well under a
+ * millisecond. The clock stops while a computed frame's next layer is
+ * worked out, so those frames go out as they are computed. The 5-bit level field dims in the LEDs themselves. The
+ * driver hands it to OUTPUT_STAGE_BRIGHTNESS (see Output_SetHardwareLevels),
+ * which rounds the brightness up to a hardware level and scales the
+ * channels by what is left, so dim frames keep their full color resolution.
+ */
+#ifndef APA102_H
+#define APA102_H
+#include <stdint.h>
+#include "led_output.h"
+
+// Bus clock. The LEDs take well over this; the SSI master tops out at 25 MHz
+// and long chains may need less for clean edges.
+#ifndef APA102_SPI_FREQ
+#define APA102_SPI_FREQ 20000000U
+#endif
+
+#define APA102_LEVELS 31   // Steps of the per-LED global brightness field
+
+// Sends each frame from the CPU; at 20 MHz a 7x7x7 frame takes ~0.6 ms
+extern const led_output_device_t apa102Device;
+
+#endif // APA102_H
@@ -1,10 +1,37 @@
 /**
  * @file gpio.c
  * @brief Button and potentiometer pin configuration.
+ *
+ * Buttons are read from Port F edge interrupts. Each edge is debounced
+ * against the SysTick millisecond clock and turned into timestamped events
+ * in a small queue that the main loop drains without blocking.
  */
 #include "TM4C123GH6PM.h"
 #include "GPIO.h"
 #include "board.h"
+#include "SysTick_Delay.h"
+
+#define BUTTON_COUNT  2
+
+typedef struct {
+    uint8_t  pin;            // Port F pin mask
+    uint8_t  pressed;        // Debounced state
+    uint8_t  longSent;       // Long press already reported for this hold
+    uint8_t  clickArmed;     // Last press may start a double click
+    uint32_t lastChangeMs;   // Time of the last accepted state change
+    uint32_t lastPressMs;    // Time of the last accepted press
+} button_state_t;
+
+static volatile button_state_t buttons[BUTTON_COUNT] = {
+    {BUTTON1_PIN, 0, 0, 0, 0, 0},
+    {BUTTON2_PIN, 0, 0, 0, 0, 0},
+};
+
+// Event ring buffer (written by the ISR, read by the main loop)
+static volatile button_event_t eventQueue[BUTTON_QUEUE_SIZE];
+static volatile uint8_t queueHead = 0;
+static volatile uint8_t queueTail = 0;
+static volatile uint32_t eventsDropped = 0;
 
 void GPIO_Init_ButtonsAndPot(void) {
     //Enable GPIOF (buttons) and GPIOE (pot)
@@ -23,6 +50,14 @@ void GPIO_Init_ButtonsAndPot(void) {
     GPIOF->PUR   |=  (BUTTON1_PIN | BUTTON2_PIN);
     GPIOF->DEN   |=  (BUTTON1_PIN | BUTTON2_PIN);
 
+    //Interrupt on both edges of PF4, PF0
+    GPIOF->IM    &= ~(BUTTON1_PIN | BUTTON2_PIN);  // Mask while configuring
+    GPIOF->IS    &= ~(BUTTON1_PIN | BUTTON2_PIN);  // Edge sensitive
+    GPIOF->IBE   |=  (BUTTON1_PIN | BUTTON2_PIN);  // Both edges
+    GPIOF->ICR    =  (BUTTON1_PIN | BUTTON2_PIN);  // Clear stale flags
+    GPIOF->IM    |=  (BUTTON1_PIN | BUTTON2_PIN);
+    NVIC_EnableIRQ(GPIOF_IRQn);
+
     //Configure PE3 as analog input for pot
     GPIOE->DIR   &= ~POT_PIN;
     GPIOE->AFSEL |=  POT_PIN;
@@ -39,3 +74,96 @@ bool GPIO_Button2Pressed(void)
 {
     return !(GPIOF->DATA & BUTTON2_PIN);
 }
+
+// Add an event, dropping it if the queue is full
+static void pushEvent(uint8_t button, uint8_t type, uint32_t timeMs) {
+    uint8_t next = (queueHead + 1) & (BUTTON_QUEUE_SIZE - 1);
+    if (next == queueTail) {
+        eventsDropped++;
+        return;
+    }
+    eventQueue[queueHead].button = button;
+    eventQueue[queueHead].type = type;
+    eventQueue[queueHead].timeMs = timeMs;
+    queueHead = next;
+}
+
+// Accept a debounced state change and report it
+static void acceptChange(uint8_t id, uint8_t pressed, uint32_t now) {
+    volatile button_state_t *b = &buttons[id];
+
+    b->pressed = pressed;
+    b->lastChangeMs = now;
+
+    if (!pressed) {
+        pushEvent(id, BUTTON_EVENT_RELEASE, now);
+        return;
+    }
+
+    pushEvent(id, BUTTON_EVENT_PRESS, now);
+    if (b->clickArmed && (now - b->lastPressMs) <= BUTTON_DOUBLE_CLICK_MS) {
+        pushEvent(id, BUTTON_EVENT_DOUBLE_CLICK, now);
+        b->clickArmed = 0;
+    } else {
+        b->clickArmed = 1;
+    }
+    b->lastPressMs = now;
+    b->longSent = 0;
+}
+
+// Compare the pin level with the debounced state, ignoring bounces
+static void sampleButton(uint8_t id, uint32_t now) {
+    uint8_t level = !(GPIOF->DATA & buttons[id].pin);
+    if (level != buttons[id].pressed &&
+        (now - buttons[id].lastChangeMs) >= BUTTON_DEBOUNCE_MS) {
+        acceptChange(id, level, now);
+    }
+}
+
+void GPIOF_Handler(void) {
+    uint32_t flags = GPIOF->MIS & (BUTTON1_PIN | BUTTON2_PIN);
+    uint32_t now = SysTick_GetMs();
+
+    GPIOF->ICR = flags;
+
+    for (uint8_t id = 0; id < BUTTON_COUNT; id++) {
+        if (flags & buttons[id].pin) {
+            sampleButton(id, now);
+        }
+    }
+}
+
+bool GPIO_GetButtonEvent(button_event_t *event) {
+    uint32_t now = SysTick_GetMs();
+    bool found = false;
+
+    NVIC_DisableIRQ(GPIOF_IRQn);
+
+    for (uint8_t id = 0; id < BUTTON_COUNT; id++) {
+        // Catch a final edge that arrived inside the debounce window
+        sampleButton(id, now);
+
+        // Report buttons held past the long-press time once per hold
+        if (buttons[id].pressed && !buttons[id].longSent &&
+            (now - buttons[id].lastPressMs) >= BUTTON_LONG_PRESS_MS) {
+            buttons[id].longSent = 1;
+            buttons[id].clickArmed = 0;
+            pushEvent(id, BUTTON_EVENT_LONG_PRESS, now);
+        }
+    }
+
+    if (queueTail != queueHead) {
+        event->button = eventQueue[queueTail].button;
+        event->type = eventQueue[queueTail].type;
+        event->timeMs = eventQueue[queueTail].timeMs;
+        queueTail = (queueTail + 1) & (BUTTON_QUEUE_SIZE - 1);
+        found = true;
+    }
+
+    NVIC_EnableIRQ(GPIOF_IRQn);
+    return found;
+}
+
+uint32_t GPIO_ButtonEventsDropped(void) {
+    return eventsDropped;
+}
@@ -7,8 +7,34 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Button identifiers
+#define BUTTON_SW1             0
+#define BUTTON_SW2             1
+
+// Button event types
+#define BUTTON_EVENT_PRESS         1
+#define BUTTON_EVENT_RELEASE       2
+#define BUTTON_EVENT_LONG_PRESS    3  // Held for BUTTON_LONG_PRESS_MS
+#define BUTTON_EVENT_DOUBLE_CLICK  4  // Second press within BUTTON_DOUBLE_CLICK_MS
+
+// Button timing (ms)
+#define BUTTON_DEBOUNCE_MS      20
+#define BUTTON_LONG_PRESS_MS    800
+#define BUTTON_DOUBLE_CLICK_MS  350
+
+// Event queue length (power of two)
+#define BUTTON_QUEUE_SIZE       16
+
+typedef struct {
+    uint8_t  button;   // BUTTON_SW1 or BUTTON_SW2
+    uint8_t  type;     // BUTTON_EVENT_*
+    uint32_t timeMs;   // SysTick_GetMs() timestamp of the event
+} button_event_t;
+
 /**
  * @brief Initialize user buttons (PF4, PF0) and POT pin (PE3).
+ *
+ * Both buttons raise Port F edge interrupts that feed the event queue.
  */
 void GPIO_Init_ButtonsAndPot(void);
 
@@ -24,4 +50,18 @@ bool GPIO_Button1Pressed(void);
  */
 bool GPIO_Button2Pressed(void);
 
+/**
+ * @brief Take the oldest debounced button event without blocking.
+ *
+ * Also generates long-press events for buttons that are still held.
+ * @param event Filled in when an event is available.
+ * @return true if an event was returned, false if the queue is empty.
+ */
+bool GPIO_GetButtonEvent(button_event_t *event);
+
+/**
+ * @brief Number of events dropped because the queue was full.
+ */
+uint32_t GPIO_ButtonEventsDropped(void);
+
 #endif // GPIO_H
@@ -1,19 +1,42 @@
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
 
+static volatile uint32_t msTicks = 0;
+
 void SysTick_Init(void) {
     SysTick->CTRL = 0;                 // Disable SysTick during setup
-    SysTick->LOAD = 0x00FFFFFF;        // Maximum reload value
+    SysTick->LOAD = SYSTICK_RELOAD;    // 1 ms period
     SysTick->VAL = 0;                  // Clear current value
-    SysTick->CTRL = 0x00000005;        // Enable SysTick with core clock
+    SysTick->CTRL = 0x00000007;        // Enable SysTick with core clock and interrupt
+}
+
+void SysTick_Handler(void) {
+    msTicks++;
+}
+
+uint32_t SysTick_GetMs(void) {
+    return msTicks;
 }
 
-// Wait function using busy-wait counting
+uint32_t SysTick_GetCycles(void) {
+    uint32_t ms, val;
+    // Re-read if the counter reloaded between the two reads
+    do {
+        ms = msTicks;
+        val = SysTick->VAL;
+    } while (ms != msTicks);
+    return ms * (SYSTICK_RELOAD + 1U) + (SYSTICK_RELOAD - val);
+}
+
+// Wait function using busy-wait counting (delay in core clock cycles)
 void SysTick_Wait(unsigned long delay) {
-    volatile unsigned long elapsedTime;
-    unsigned long startTime = SysTick->VAL;
+    unsigned long elapsedTime = 0;
+    unsigned long last = SysTick->VAL;
     do {
-        elapsedTime = (startTime - SysTick->VAL) & 0x00FFFFFF; // 24-bit counter
+        unsigned long now = SysTick->VAL;
+        // Counter runs down and reloads every 1 ms
+        elapsedTime += (last >= now) ? (last - now) : (last + SYSTICK_RELOAD + 1 - now);
+        last = now;
     } while (elapsedTime <= delay);
 }
 
@@ -31,4 +54,4 @@ void SimpleDelay(void) {
     for (i = 0; i < 800000; i++) {
         // Just burn cycles
     }
-}
\ No newline at end of file
+}
@@ -3,9 +3,17 @@
 
 #include <stdint.h>
 
+// SysTick reloads every 1 ms (80 MHz core clock)
+#define SYSTICK_RELOAD   (80000U - 1U)
+
 void SysTick_Init(void);
 
+// Milliseconds since SysTick_Init (wraps after ~49 days)
+uint32_t SysTick_GetMs(void);
 
+// Core clock cycles counted by SysTick, which keeps running during WFI
+// sleep (unlike the DWT counter); wraps every ~53 s, use differences
+uint32_t SysTick_GetCycles(void);
 
 
 // Wait function using busy-wait counting
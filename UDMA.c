@@ -0,0 +1,70 @@
+/**
+ * @file UDMA.c
+ * @brief Micro-DMA controller bring-up and basic transfers.
+ */
+#include "TM4C123GH6PM.h"
+#include "UDMA.h"
+
+// Control structure word offsets
+#define CTL_SRC_END   0
+#define CTL_DST_END   1
+#define CTL_CONTROL   2
+
+#define CTL_XFERSIZE_SHIFT  4
+
+// Primary control structures for all 32 channels; the controller
+// requires the table base to be 1024-byte aligned
+static volatile uint32_t controlTable[32 * 4] __attribute__((aligned(1024)));
+static uint8_t udmaReady = 0;
+
+void UDMA_Init(void) {
+    if (udmaReady) {
+        return;
+    }
+    SYSCTL->RCGCDMA |= 0x01;                 // Enable uDMA clock
+    while ((SYSCTL->PRDMA & 0x01) == 0);     // Wait until ready
+
+    UDMA->CFG = 0x01;                        // MASTEN
+    UDMA->CTLBASE = (uint32_t)(uintptr_t)controlTable;
+    udmaReady = 1;
+}
+
+void UDMA_StartTransfer(uint8_t channel, uint32_t control,
+                        const volatile void *src, volatile void *dst, uint16_t count) {
+    uint32_t bit = 1U << channel;
+    volatile uint32_t *entry = &controlTable[channel * 4];
+    uint32_t srcEnd = (uint32_t)(uintptr_t)src;
+    uint32_t dstEnd = (uint32_t)(uintptr_t)dst;
+
+    // End pointers address the last item of an incrementing side
+    if ((control & UDMA_SRC_INC_NONE) != UDMA_SRC_INC_NONE) {
+        srcEnd += count - 1;
+    }
+    if ((control & UDMA_DST_INC_NONE) != UDMA_DST_INC_NONE) {
+        dstEnd += count - 1;
+    }
+
+    entry[CTL_SRC_END] = srcEnd;
+    entry[CTL_DST_END] = dstEnd;
+    entry[CTL_CONTROL] = control | ((uint32_t)(count - 1) << CTL_XFERSIZE_SHIFT) | UDMA_MODE_BASIC;
+
+    UDMA->ALTCLR = bit;          // Use the primary structure
+    UDMA->USEBURSTCLR = bit;     // Accept single requests as well as bursts
+    UDMA->REQMASKCLR = bit;      // Let the peripheral request
+    UDMA->ENASET = bit;
+}
+
+uint8_t UDMA_TransferDone(uint8_t channel) {
+    uint32_t bit = 1U << channel;
+    if (UDMA->CHIS & bit) {
+        UDMA->CHIS = bit;        // Write 1 to clear
+        return 1;
+    }
+    return 0;
+}
+
+void UDMA_StopChannel(uint8_t channel) {
+    uint32_t bit = 1U << channel;
+    UDMA->ENACLR = bit;
+    UDMA->CHIS = bit;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file UDMA.h
+ * @brief Shared micro-DMA controller setup and basic-mode transfers.
+ */
+#ifndef UDMA_H
+#define UDMA_H
+#include <stdint.h>
+
+// Channel assignments (encoding 0 in DMACHMAPn)
+#define UDMA_CH_UART0RX      8
+#define UDMA_CH_UART0TX      9
+#define UDMA_CH_SSI0RX       10
+#define UDMA_CH_SSI0TX       11
+
+// Channel control word fields
+#define UDMA_DST_INC_8       (0U << 30)
+#define UDMA_DST_INC_NONE    (3U << 30)
+#define UDMA_DST_SIZE_8      (0U << 28)
+#define UDMA_SRC_INC_8       (0U << 26)
+#define UDMA_SRC_INC_NONE    (3U << 26)
+#define UDMA_SRC_SIZE_8      (0U << 24)
+#define UDMA_ARB_1           (0U << 14)
+#define UDMA_ARB_4           (2U << 14)
+#define UDMA_ARB_8           (3U << 14)
+#define UDMA_MODE_BASIC      1U
+
+#define UDMA_MAX_TRANSFER    1024U   // Items per transfer (XFERSIZE + 1)
+
+/**
+ * @brief Enable the uDMA controller and install the channel control table.
+ *
+ * Safe to call from every driver that uses DMA; only the first call does work.
+ */
+void UDMA_Init(void);
+
+/**
+ * @brief Start a basic-mode peripheral transfer on the primary control structure.
+ * @param channel uDMA channel number.
+ * @param control UDMA_DST_* | UDMA_SRC_* | UDMA_ARB_* flags (size and mode are added).
+ * @param src     First source byte (or the peripheral data register).
+ * @param dst     First destination byte (or the peripheral data register).
+ * @param count   Number of items, 1..UDMA_MAX_TRANSFER.
+ */
+void UDMA_StartTransfer(uint8_t channel, uint32_t control,
+                        const volatile void *src, volatile void *dst, uint16_t count);
+
+/**
+ * @brief Check and clear the completion flag of a channel.
+ * @return 1 if the channel finished a transfer since the last call.
+ */
+uint8_t UDMA_TransferDone(uint8_t channel);
+
+/**
+ * @brief Disable a channel, abandoning any transfer in progress.
+ */
+void UDMA_StopChannel(uint8_t channel);
+
+#endif // UDMA_H
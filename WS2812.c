@@ -8,35 +8,276 @@
 #include "board.h"
 #include "SysTick_Delay.h"
 #include "Timers.h"
+#include "profiler.h"
+#include "output.h"
+#include "frame_source.h"
+#if WS2812_DMA
+#include "UDMA.h"
+#endif
 #include <stddef.h>  // For NULL definition
+#if WS2812_VALIDATE
+#include <string.h>
+#endif
+
+#if WS2812_CHUNK_LEDS < 1 || WS2812_CHUNK_LEDS > 16
+#error "WS2812_CHUNK_LEDS must be 1..16"
+#endif
 
 #define SPI_FREQ    2400000U    // desired SPI clock
 #define RESET_US      60U       // reset pulse =50µs
 #define MAX_WAIT     1000       // maximum loop iterations to prevent lockup
+#define LATCH_CYCLES 12000U     // latch/reset low time after the last bit
+#define LATCH_US     (LATCH_CYCLES / (SYS_CLOCK / 1000000U))
+
+// FNV-1a over the output chain's input, to spot frames that match the last one
+#define FNV_OFFSET_BASIS  2166136261U
+#define FNV_PRIME         16777619U
 
 // Masks from SSI0.c (bit 1 = TNF/empty, bit 4 = BSY)
 #define SSI_SSE      (1U<<1)    // CR1, SSE bit
 #define SSI_SR_TNF   (1U<<1)    // SR, Transmit FIFO not full
 #define SSI_SR_BSY   (1U<<4)    // SR, Busy flag
+#define SSI_DMA_TXDMAE (1U<<1)  // DMACTL, transmit FIFO DMA requests
+
+// Each LED uses LED_PIXEL_CHANNELS bytes (G,R,B or G,R,B,W) and each of
+// their bits becomes a '110' (1) or '100' (0) pulse on the line. Padded,
+// every bit is one symbol byte followed by two zero bytes written while
+// transmitting; packed, the 3-bit codes are sent back to back, 3 SPI
+// bytes per data byte.
+#define LED_CHANNELS     LED_PIXEL_CHANNELS
+#define PACKED_LED_BYTES (LED_CHANNELS * 3)     // Packed bytes stored and sent per LED
+#if WS2812_PACKED_SYMBOLS
+#define LED_SPI_BYTES   PACKED_LED_BYTES
+#define LED_WIRE_BYTES  PACKED_LED_BYTES
+#else
+#define LED_SPI_BYTES   (LED_CHANNELS * 8)      // Symbol bytes stored per LED
+#define LED_WIRE_BYTES  (LED_CHANNELS * 24)     // Bytes sent per LED with the padding
+#endif
+
+// Symbols for the next few LEDs; encoded while the FIFO drains the last chunk
+static uint8_t chunkBuf[WS2812_CHUNK_LEDS * LED_SPI_BYTES];
+
+// What is known about a frame before it is sent
+typedef struct {
+    uint32_t hash;              // FNV-1a of the LEDs' values going into the output chain
+    uint8_t lit;                // OR of every input value (0 = all LEDs off)
+} frame_sig_t;
+
+// Sends one frame for showFrame(). Return 1 if sent (or sending), 0 if timed out
+typedef int (*transmit_fn_t)(const frame_source_t *src, int count);
+
+// Last frame that went out, for skipping unchanged frames
+static uint32_t keepAliveMs = WS2812_KEEPALIVE_MS;
+static uint32_t sentHash = 0;
+static int sentCount = 0;           // 0 = nothing valid sent (forces the next frame)
+static uint8_t sentBlank = 0;       // Last frame sent was all off
+static uint8_t wireLit = 0;         // OR of every value the last transmit put on the line
+static uint32_t sentMs = 0;
+static led_output_stats_t stats;    // Shared by both devices; only one is in use
+
+// End of the last transmission; the next one waits out the latch from here
+static uint32_t latchStart = 0;
+static uint8_t latchPending = 0;
 
-// Calculate buffer size based on number of LEDs and bytes per LED
-// Each LED uses 3 bytes (R,G,B), each byte uses 8 bits
-// Each bit expands to 3 SPI bytes 
-#define SPI_BUFFER_SIZE (NUM_LEDS * 3 * 8 * 3)
+#if WS2812_VALIDATE
+ws2812_validation_t ws2812Validation;
+static uint8_t decoded[NUM_LEDS * LED_CHANNELS];
+#endif
 
-// 3× expansion buffer: 1 LED-bit -> 3 SPI bits
-static uint8_t spiBuf[SPI_BUFFER_SIZE];
+// Even CPSDVSR closest to SYS_CLOCK/SPI_FREQ
+static uint32_t spiPrescale(void) {
+    uint32_t ps = (SYS_CLOCK + SPI_FREQ/2) / SPI_FREQ;
+    if (ps < 2) ps = 2;
+    if (ps > 254) ps = 254;
+    if (ps & 1) ps++;
+    return ps;
+}
+
+// Time a NUM_LEDS frame of bytesPerLed holds the line, latch included
+static uint32_t frameTimeUs(uint32_t bytesPerLed) {
+    uint32_t bitsPerMs = SYS_CLOCK / spiPrescale() / 1000U;
+    uint32_t bits = bytesPerLed * NUM_LEDS * 8U;
+    return (bits * 1000U + bitsPerMs - 1) / bitsPerMs + LATCH_US;
+}
+
+// Reset SSI if it's stuck
+static void resetSsi(void) {
+    SSI0->CR1 &= ~SSI_SSE;  // Disable
+    SSI0->CR1 |= SSI_SSE;   // Re-enable
+}
+
+// The chain latches while the line stays low, so the previous frame's
+// reset time is only waited for if this frame follows it closely
+static void waitLatch(void) {
+    if (latchPending) {
+        while (Profiler_Cycles() - latchStart < LATCH_CYCLES);
+        latchPending = 0;
+    }
+}
 
-static inline void encodeByte(uint8_t byte, uint8_t *dst) {
+// Wait until the last bits have left the shift register, then start the
+// latch (150μs at 80MHz), which runs while the caller gets on with the
+// next frame. Return 1 if successful, 0 if timed out
+static int finishFrame(void) {
+    // Wait until SSI no longer busy with timeout
+    volatile uint32_t timeout = MAX_WAIT;
+    while ((SSI0->SR & SSI_SR_BSY) && --timeout > 0);
+    if (timeout == 0) {
+        resetSsi();
+        return 0;
+    }
+    latchStart = Profiler_Cycles();
+    latchPending = 1;
+    return 1;
+}
+
+// '110' (1) or '100' (0) per bit, back to back: 3 SPI bytes per data byte
+static inline void packByte(uint8_t byte, uint8_t *dst) {
+    uint32_t bits = 0;
     for (int i = 7; i >= 0; --i) {
-        // '110' => 1, '100' => 0
-        *dst++ = (byte & (1<<i)) ? 0x6 : 0x4;
-        *dst++ = 0;
-        *dst++ = 0;
+        bits = (bits << 3) | ((byte & (1<<i)) ? 0x6 : 0x4);
+    }
+    dst[0] = (uint8_t)(bits >> 16);
+    dst[1] = (uint8_t)(bits >> 8);
+    dst[2] = (uint8_t)bits;
+}
+
+// The channel count is fixed at compile time, so these loops unroll
+static inline void packLed(const uint8_t *wire, uint8_t *dst) {
+    for (int c = 0; c < LED_CHANNELS; ++c) {
+        packByte(wire[c], dst + c * 3);
+    }
+}
+
+// Symbols in the FIFO format (LED_SPI_BYTES)
+static inline void encodeLed(const uint8_t *wire, uint8_t *dst) {
+#if WS2812_PACKED_SYMBOLS
+    packLed(wire, dst);
+#else
+    for (int c = 0; c < LED_CHANNELS; ++c) {
+        for (int i = 7; i >= 0; --i) {
+            // '110' => 1, '100' => 0
+            *dst++ = (wire[c] & (1<<i)) ? 0x6 : 0x4;
+        }
     }
+#endif
 }
 
-void WS2812_Init(void) {
+// OR of one LED's channels as sent
+static inline uint8_t ledLit(const uint8_t *wire) {
+    uint8_t lit = 0;
+    for (int c = 0; c < LED_CHANNELS; ++c) {
+        lit |= wire[c];
+    }
+    return lit;
+}
+
+// One LED's channels to send, in LED_PIXEL_FORMAT order: post-processed
+// when any output stage is on. scratch holds LED_CHANNELS bytes
+static inline const uint8_t *processLed(const frame_source_t *src, int led, uint8_t post, uint8_t *scratch) {
+    const uint8_t *grb = FrameSource_Led(src, led, scratch);
+    if (post) {
+        if (grb != scratch) {
+            scratch[0] = grb[0];
+            scratch[1] = grb[1];
+            scratch[2] = grb[2];
+        }
+        Output_ProcessLed((uint16_t)led, scratch);
+        grb = scratch;
+    }
+#if LED_PIXEL_FORMAT == LED_PIXEL_RGB
+    uint8_t g = grb[0];
+    scratch[0] = grb[1];
+    scratch[1] = g;
+    scratch[2] = grb[2];
+    return scratch;
+#elif LED_PIXEL_FORMAT == LED_PIXEL_GRBW
+    Output_ExtractWhite(grb, scratch);
+    return scratch;
+#else
+    return grb;
+#endif
+}
+
+// Write one byte to the TX FIFO. Return 1 if successful, 0 if timed out
+static inline int pushByte(uint8_t byte) {
+    // Wait for TX FIFO not full with timeout
+    volatile uint32_t timeout = MAX_WAIT;
+    while (!(SSI0->SR & SSI_SR_TNF) && --timeout > 0);
+    if (timeout == 0) {
+        resetSsi();
+        return 0;
+    }
+    SSI0->DR = byte;
+#if WS2812_VALIDATE
+    WS2812Decoder_PushByte(&ws2812Validation.last, byte);
+#endif
+    return 1;
+}
+
+// Push the encoded symbols of the first leds LEDs in chunkBuf. Return 1 if successful, 0 if timed out
+static int pushChunk(int leds) {
+    int bytes = leds * LED_SPI_BYTES;
+    for (int i = 0; i < bytes; ++i) {
+#if WS2812_PACKED_SYMBOLS
+        if (!pushByte(chunkBuf[i])) {
+#else
+        if (!pushByte(chunkBuf[i]) || !pushByte(0) || !pushByte(0)) {
+#endif
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Post-process, encode and send a frame a chunk at a time, then latch.
+// Each chunk is encoded while the FIFO still holds the end of the last
+// one, so no frame-sized symbol buffer is needed. Return 1 if successful,
+// 0 if timed out
+static int transmitFifo(const frame_source_t *src, int count) {
+    waitLatch();
+
+#if WS2812_VALIDATE
+    WS2812Decoder_Init(&ws2812Validation.last, SYS_CLOCK / spiPrescale(), decoded, sizeof(decoded));
+#endif
+
+    uint32_t frameStart = Profiler_Cycles();
+    uint8_t post = Output_Stages() != 0;
+    if (post) {
+        Output_BeginFrame(src, count);
+    }
+
+    uint32_t encodeCycles = 0;
+    uint8_t lit = 0;
+    int ok = 1;
+    for (int first = 0; first < count && ok; first += WS2812_CHUNK_LEDS) {
+        int leds = count - first;
+        if (leds > WS2812_CHUNK_LEDS) leds = WS2812_CHUNK_LEDS;
+
+        uint32_t encodeStart = Profiler_Cycles();
+        for (int i = 0; i < leds; ++i) {
+            uint8_t scratch[LED_CHANNELS];
+            const uint8_t *wire = processLed(src, first + i, post, scratch);
+            lit |= ledLit(wire);
+            encodeLed(wire, &chunkBuf[i * LED_SPI_BYTES]);
+        }
+        encodeCycles += Profiler_Cycles() - encodeStart;
+        if (first == 0) {
+            Profiler_Record(PROFILE_SLOT_FIRST_LIGHT, Profiler_Cycles() - frameStart);
+        }
+
+        ok = pushChunk(leds);
+    }
+
+    if (post) {
+        Output_EndFrame();
+    }
+    wireLit = lit;
+    Profiler_Record(PROFILE_SLOT_ENCODE, encodeCycles);
+    return ok && finishFrame();
+}
+
+static void ssiInit(void) {
     // Enable clocks for SSI0 and GPIOA
     SYSCTL->RCGCSSI  |= (1U<<0);
     SYSCTL->RCGCGPIO |= (1U<<0);
@@ -52,64 +293,278 @@ void WS2812_Init(void) {
     SSI0->CR1 &= ~SSI_SSE;  
 
     // Set prescale: even CPSDVSR = SYS_CLOCK/SPI_FREQ
-    {
-      uint32_t ps = (SYS_CLOCK + SPI_FREQ/2) / SPI_FREQ;
-      if (ps < 2) ps = 2;
-      if (ps > 254) ps = 254;
-      if (ps & 1) ps++;
-      SSI0->CPSR = ps;
-    }
+    SSI0->CPSR = spiPrescale();
 
     // Configure CR0: SCR=0, SPH=0, SPO=0, FRF=0, DSS=7 (8-bit)
     SSI0->CR0 = (0<<8)|(0<<7)|(0<<6)|(0<<4)|(0x7);
+    SSI0->DMACTL &= ~SSI_DMA_TXDMAE;  // CPU feeds the FIFO unless the DMA device says otherwise
 
     // Re-enable SSI0 (set SSE)
     SSI0->CR1 |= SSI_SSE;
 }
 
-// Return 1 if successful, 0 if timed out
-int WS2812_Show(const uint8_t *grb, int count) {
+#if WS2812_DMA
+// LEDs of a computed frame encoded before it starts going out: one layer,
+// which the encoder keeps ahead of the line from then on
+#define DMA_LEAD_LEDS  (CUBE_SIZE * CUBE_SIZE)
 
-    
-    if (count <= 0 || count > NUM_LEDS || grb == NULL) {
+// Packed symbols for a whole frame. A transfer moves at most
+// UDMA_MAX_TRANSFER bytes, so the frame goes out in segments, each
+// started from the interrupt that ends the one before. A segment never
+// runs past what has been encoded.
+static uint8_t dmaBuf[NUM_LEDS * PACKED_LED_BYTES];
+static volatile uint32_t dmaNext = 0;   // Offset of the next segment
+static volatile uint32_t dmaReady = 0;  // Bytes encoded so far
+static uint32_t dmaEnd = 0;             // Bytes in the frame
+static volatile uint8_t dmaBusy = 0;    // Segments still to move
+static volatile uint8_t dmaUnderrun = 0;// Line went idle before the encoder caught up
+static uint8_t dmaPending = 0;          // Frame started and not yet finished
+static uint32_t dmaDeadlineMs = 0;
+
+static void startSegment(void) {
+    uint32_t length = dmaReady - dmaNext;
+    if (length > UDMA_MAX_TRANSFER) {
+        length = UDMA_MAX_TRANSFER;
+    }
+    // The FIFO asks for more when half empty, so move 4 bytes per request
+    UDMA_StartTransfer(UDMA_CH_SSI0TX,
+                       UDMA_SRC_INC_8 | UDMA_SRC_SIZE_8 | UDMA_DST_INC_NONE | UDMA_DST_SIZE_8 | UDMA_ARB_4,
+                       &dmaBuf[dmaNext], &SSI0->DR, (uint16_t)length);
+    dmaNext += length;
+}
+
+// uDMA completion is signalled on the peripheral's interrupt
+void SSI0_Handler(void) {
+    if (UDMA_TransferDone(UDMA_CH_SSI0TX)) {
+        if (dmaNext < dmaReady) {
+            startSegment();
+        } else {
+            // The LEDs latch on the gap, so a short frame cannot be resumed
+            dmaUnderrun = (dmaNext < dmaEnd);
+            dmaBusy = 0;
+        }
+    }
+}
+
+// Wait for the frame in dmaBuf to leave the line. Return 1 if successful, 0 if timed out
+static int dmaWait(void) {
+    if (!dmaPending) {
+        return 1;
+    }
+    dmaPending = 0;
+    while (dmaBusy && (int32_t)(SysTick_GetMs() - dmaDeadlineMs) < 0);
+    if (dmaBusy || dmaUnderrun) {
+        UDMA_StopChannel(UDMA_CH_SSI0TX);
+        dmaBusy = 0;
+        resetSsi();
         return 0;
     }
+    return finishFrame();
+}
+
+static void dmaInit(void) {
+    ssiInit();
+    UDMA_Init();
+    SSI0->DMACTL |= SSI_DMA_TXDMAE;
+    NVIC_EnableIRQ(SSI0_IRQn);
+}
 
-    // Calculate actual bytes to send based on LED count
-    uint32_t bytesToSend = count * 3 * 8 * 3;
+static void dmaBeginFrame(void) {
+    if (!dmaWait()) {
+        sentCount = 0;  // The chain state is unknown, so resend next time
+        stats.errors++;
+    }
+}
 
-    // Build the SPI-encoded buffer
-    uint8_t *p = spiBuf;
-    for (int i = 0; i < count*3; ++i) {
-        encodeByte(grb[i], p);
-        p += 24;
+static int dmaWaitFrame(void) {
+    if (!dmaWait()) {
+        sentCount = 0;
+        stats.errors++;
+        return 0;
     }
+    return 1;
+}
 
-    // Push out every byte with timeout protection
-    for (uint32_t i = 0; i < bytesToSend; ++i) {
-        // Wait for TX FIFO not full with timeout
-        volatile uint32_t timeout = MAX_WAIT;
-        while (!(SSI0->SR & SSI_SR_TNF) && --timeout > 0);
-        if (timeout == 0) {
-            // Reset SSI if it's stuck
-            SSI0->CR1 &= ~SSI_SSE;  // Disable
-            SSI0->CR1 |= SSI_SSE;   // Re-enable
-            return 0;  // Return error
+static void startDma(void) {
+    dmaNext = 0;
+    dmaUnderrun = 0;
+    dmaBusy = 1;
+    dmaPending = 1;
+    dmaDeadlineMs = SysTick_GetMs() + frameTimeUs(PACKED_LED_BYTES) / 1000U + 10U;
+    startSegment();
+}
+
+// Encode the frame and start sending it, then return. A stored frame is
+// encoded completely first; a computed one starts going out after its
+// first layer and is encoded while the DMA follows behind. Return 1 if
+// the transfer started
+static int transmitDma(const frame_source_t *src, int count) {
+    dmaBeginFrame();  // dmaBuf must be free before it is overwritten
+    waitLatch();
+
+    uint32_t encodeStart = Profiler_Cycles();
+    int lead = (src->kind == FRAME_SOURCE_SLICES && count > DMA_LEAD_LEDS) ? DMA_LEAD_LEDS : count;
+    dmaEnd = (uint32_t)count * PACKED_LED_BYTES;
+    dmaReady = 0;
+    uint8_t lit = 0;
+    uint8_t post = Output_Stages() != 0;
+    if (post) {
+        Output_BeginFrame(src, count);
+    }
+    for (int led = 0; led < count; ++led) {
+        uint8_t scratch[LED_CHANNELS];
+        const uint8_t *wire = processLed(src, led, post, scratch);
+        lit |= ledLit(wire);
+        packLed(wire, &dmaBuf[led * PACKED_LED_BYTES]);
+        if (led + 1 >= lead) {
+            dmaReady = (uint32_t)(led + 1) * PACKED_LED_BYTES;
+            if (led + 1 == lead) {
+                startDma();
+                Profiler_Record(PROFILE_SLOT_FIRST_LIGHT, Profiler_Cycles() - encodeStart);
+            }
         }
-        SSI0->DR = spiBuf[i];
     }
-    
-    // Wait until SSI no longer busy with timeout
-    volatile uint32_t timeout = MAX_WAIT;
-    while ((SSI0->SR & SSI_SR_BSY) && --timeout > 0);
-    if (timeout == 0) {
-        // Reset SSI if it's stuck
-        SSI0->CR1 &= ~SSI_SSE;  // Disable
-        SSI0->CR1 |= SSI_SSE;   // Re-enable
-        return 0;  // Return error
+    if (post) {
+        Output_EndFrame();
+    }
+    wireLit = lit;
+    Profiler_Record(PROFILE_SLOT_ENCODE, Profiler_Cycles() - encodeStart);
+
+#if WS2812_VALIDATE
+    // The stream is fixed once encoded, so it can be checked while it goes out
+    WS2812Decoder_Init(&ws2812Validation.last, SYS_CLOCK / spiPrescale(), decoded, sizeof(decoded));
+    for (uint32_t i = 0; i < dmaEnd; ++i) {
+        WS2812Decoder_PushByte(&ws2812Validation.last, dmaBuf[i]);
+    }
+#endif
+    return 1;
+}
+#endif
+
+// Hash what the frame feeds into the output chain. Unless a stage carries
+// history from frame to frame, equal input and output settings give an
+// equal output, so this is known before anything is encoded
+static void signFrame(const frame_source_t *src, int count, frame_sig_t *sig) {
+    uint32_t hash = FNV_OFFSET_BASIS ^ Output_Generation();
+    uint8_t lit = 0;
+    for (int led = 0; led < count; ++led) {
+        uint8_t mixed[3];
+        const uint8_t *grb = FrameSource_Led(src, led, mixed);
+        hash = (hash ^ grb[0]) * FNV_PRIME;
+        hash = (hash ^ grb[1]) * FNV_PRIME;
+        hash = (hash ^ grb[2]) * FNV_PRIME;
+        lit |= grb[0] | grb[1] | grb[2];
+    }
+    sig->hash = hash;
+    sig->lit = lit;
+}
+
+#if WS2812_VALIDATE
+// Check the stream that was just sent; expected may be NULL to check timing only
+static void validateFrame(const uint8_t *expected, int count) {
+    uint32_t latchNs = (LATCH_CYCLES * 1000U) / (SYS_CLOCK / 1000000U);
+
+    ws2812Validation.frames++;
+    if (!WS2812Decoder_Finish(&ws2812Validation.last, latchNs)) {
+        ws2812Validation.timingFailures++;
+    }
+    if (expected != NULL &&
+        (ws2812Validation.last.outBytes != count * LED_CHANNELS ||
+         memcmp(decoded, expected, count * LED_CHANNELS) != 0)) {
+        ws2812Validation.dataMismatches++;
+    }
+}
+#endif
+
+// Whether the frame would only show the LEDs what they already show: an
+// all-off frame after an all-off one (held without keep-alives until
+// something lights up again), or, with no history in the output chain,
+// the frame last sent within the keep-alive interval. The input is
+// signed on the way, for the next call
+static int unchanged(const frame_source_t *src, int count, uint32_t now, frame_sig_t *sig) {
+    uint8_t stateful = Output_Stateful();
+    if (!stateful || sentBlank) {
+        signFrame(src, count, sig);
+    }
+    if (count != sentCount) {
+        return 0;
     }
+    if (sentBlank && Output_FrameBlank(sig->lit)) {
+        return 1;
+    }
+    return !stateful && sig->hash == sentHash && (now - sentMs) < keepAliveMs;
+}
+
+// Send a frame unless it is unchanged from the last one sent
+static int showFrame(const frame_source_t *src, int count, transmit_fn_t transmit) {
+    uint32_t now = SysTick_GetMs();
+    frame_sig_t sig = {0, 1};
+    stats.frames++;
+#if WS2812_SKIP_UNCHANGED
+    // A computed frame is not known until it is sent, so it is always sent
+    if (keepAliveMs != 0 && src->kind != FRAME_SOURCE_SLICES && unchanged(src, count, now, &sig)) {
+        stats.skipped++;
+        return LED_OUTPUT_SKIPPED;
+    }
+#endif
+    if (!transmit(src, count)) {
+        sentCount = 0;  // The chain state is unknown, so resend next time
+        stats.errors++;
+        return LED_OUTPUT_ERROR;
+    }
+    sentHash = sig.hash;
+    sentBlank = !wireLit;
+    sentCount = count;
+    sentMs = now;
+    stats.sent++;
+#if WS2812_VALIDATE
+    // A post-processed, mixed or reordered frame is not a source buffer, so only its timing is checked
+    validateFrame((LED_PIXEL_FORMAT == LED_PIXEL_GRB && src->kind == FRAME_SOURCE_GRB && Output_Stages() == 0) ?
+                  src->frame : NULL, count);
+#endif
+    return LED_OUTPUT_SENT;
+}
+
+void WS2812_SetKeepAlive(uint32_t ms) {
+    keepAliveMs = ms;
+}
+
+// ---- Blocking device ----
+
+static void fifoBeginFrame(void) {
+}
+
+static int fifoSubmit(const frame_source_t *src, int count) {
+    return showFrame(src, count, transmitFifo);
+}
+
+// Frames are finished inside submit; only the latch may still be running
+static int fifoWait(void) {
+    return 1;
+}
+
+static void fifoStats(led_output_stats_t *out) {
+    *out = stats;
+    out->frameUs = frameTimeUs(LED_WIRE_BYTES);
+}
+
+const led_output_device_t ws2812Device = {
+    "ws2812", ssiInit, fifoBeginFrame, fifoSubmit, fifoWait, fifoStats, 0
+};
+
+#if WS2812_DMA
+// ---- uDMA device ----
+
+static int dmaSubmit(const frame_source_t *src, int count) {
+    return showFrame(src, count, transmitDma);
+}
+
+static void dmaStats(led_output_stats_t *out) {
+    *out = stats;
+    out->frameUs = frameTimeUs(PACKED_LED_BYTES);
+}
 
-    // latch/reset - use a shorter delay
-    SysTick_Wait(12000); // 150μs at 80MHz (24000 cycles)
-    return 1;  // Success
-}
\ No newline at end of file
+const led_output_device_t ws2812DmaDevice = {
+    "ws2812-dma", dmaInit, dmaBeginFrame, dmaSubmit, dmaWaitFrame, dmaStats, 1
+};
+#endif
@@ -5,17 +5,86 @@
 #ifndef WS2812_H
 #define WS2812_H
 #include <stdint.h>
+#include "led_output.h"
 
-/**
- * @brief Initialize SSI0 for WS2812 timing.
- */
-void WS2812_Init(void);
+// Set to 1 to decode and time-check every frame as it is sent (debug builds)
+#ifndef WS2812_VALIDATE
+#define WS2812_VALIDATE 0
+#endif
+
+// Set to 0 to transmit every frame even when nothing changed
+#ifndef WS2812_SKIP_UNCHANGED
+#define WS2812_SKIP_UNCHANGED 1
+#endif
+
+// LEDs encoded per chunk. Symbols are built a few LEDs ahead of the SPI
+// FIFO instead of for the whole chain, so RAM does not grow with the cube;
+// a chunk must encode faster than the FIFO (8 bytes) drains.
+#ifndef WS2812_CHUNK_LEDS
+#define WS2812_CHUNK_LEDS 4
+#endif
+
+// Sizes below are for 3-channel LEDs; with LED_PIXEL_FORMAT == LED_PIXEL_GRBW
+// (board.h) every LED carries a fourth byte and takes 4/3 as long to send.
+
+// Set to 1 to send the 3-bit symbols back to back (9 SPI bytes per LED)
+// instead of one symbol per byte padded with two zero bytes (72 per LED).
+// Cuts a frame from ~84 ms to ~11 ms at 7x7x7, but the FIFO then holds
+// only ~27 us, so the encoder must keep up; check with WS2812_VALIDATE.
+#ifndef WS2812_PACKED_SYMBOLS
+#define WS2812_PACKED_SYMBOLS 0
+#endif
+
+// Set to 1 to build ws2812DmaDevice: frames are encoded as packed symbols
+// into a frame buffer (9 bytes per LED) that uDMA feeds to SSI0, so the
+// CPU is free while a frame goes out. Also makes it the default device.
+// Computed frames (chain_render.h) start going out after their first
+// layer, while the rest is computed; a layer that takes longer to compute
+// than the last one takes to send (~1.5 ms at 7x7) loses the frame.
+#ifndef WS2812_DMA
+#define WS2812_DMA 0
+#endif
+
+// Longest time an unchanged frame goes without being resent (0 = never skip)
+#define WS2812_KEEPALIVE_MS 1000U
+
+#if WS2812_VALIDATE
+#include "WS2812_Decoder.h"
+
+typedef struct {
+    uint32_t frames;          // Frames checked
+    uint32_t timingFailures;  // Frames with an out-of-spec pulse or short latch
+    uint32_t dataMismatches;  // Frames that did not decode back to the source GRB
+    ws2812_decoder_t last;    // Full results for the most recent frame
+} ws2812_validation_t;
+
+extern ws2812_validation_t ws2812Validation;
+#endif
+
+// Both devices run each LED through the output.h post-processing chain
+// (brightness, dithering, ...) while they build the SPI symbols. Before
+// that, the frame's input is hashed together with the chain's settings;
+// a frame that hashes the same as the last one sent is not transmitted
+// (submit returns LED_OUTPUT_SKIPPED) until the keep-alive interval has
+// passed, so a failed write cannot stick. Afterglow and dither change the
+// output from frame to frame, so with either on every frame is sent. An
+// all-off frame is the exception: once one is out, dark frames are not
+// resent at all until something lights up (e.g. pot turned to zero).
+
+// CPU writes the symbols to the SSI0 FIFO a few LEDs at a time (blocking).
+// The FIFO covers only microseconds, too short to compute a layer in, so
+// computed frames have to be resolved into a buffer first
+extern const led_output_device_t ws2812Device;
+
+#if WS2812_DMA
+// uDMA feeds packed symbols from a frame buffer to SSI0 (returns while sending)
+extern const led_output_device_t ws2812DmaDevice;
+#endif
 
 /**
- * @brief Send GRB buffer to WS2812 chain.
- * @param grb   Pointer to GRB byte array (length = count*3).
- * @param count Number of LEDs.
+ * @brief Set the keep-alive interval for unchanged frames.
+ * @param ms Longest gap between transmissions, 0 to send every frame.
  */
-int WS2812_Show(const uint8_t *grb, int count);
+void WS2812_SetKeepAlive(uint32_t ms);
 
 #endif // WS2812_H
@@ -0,0 +1,123 @@
+/**
+ * @file WS2812_Decoder.c
+ * @brief Bit-level WS2812 waveform reconstruction and timing checks.
+ */
+
+#include "WS2812_Decoder.h"
+#include <stddef.h>  // For NULL definition
+
+// High pulses longer than this are read as a 1 code when out of spec
+#define T1H_THRESHOLD_NS  ((WS2812_T0H_MAX_NS + WS2812_T1H_MIN_NS) / 2)
+
+static uint32_t runNs(const ws2812_decoder_t *dec, uint32_t bits) {
+    return (uint32_t)(((uint64_t)bits * dec->bitPs) / 1000U);
+}
+
+static void storeBit(ws2812_decoder_t *dec, uint8_t bit) {
+    dec->shift = (uint8_t)((dec->shift << 1) | bit);
+    dec->bits++;
+    if (++dec->bitCount < 8) {
+        return;
+    }
+    if (dec->out != NULL && dec->outBytes < dec->outCapacity) {
+        dec->out[dec->outBytes++] = dec->shift;
+    } else {
+        dec->overflow++;
+    }
+    dec->shift = 0;
+    dec->bitCount = 0;
+}
+
+// A high pulse is one data bit
+static void endHigh(ws2812_decoder_t *dec, uint32_t ns) {
+    uint8_t bit;
+
+    if (ns >= WS2812_T0H_MIN_NS && ns <= WS2812_T0H_MAX_NS) {
+        bit = 0;
+    } else if (ns >= WS2812_T1H_MIN_NS && ns <= WS2812_T1H_MAX_NS) {
+        bit = 1;
+    } else {
+        dec->highErrors++;
+        bit = (ns >= T1H_THRESHOLD_NS) ? 1 : 0;
+    }
+
+    if (ns < dec->minHighNs[bit]) dec->minHighNs[bit] = ns;
+    if (ns > dec->maxHighNs[bit]) dec->maxHighNs[bit] = ns;
+    dec->started = 1;
+    storeBit(dec, bit);
+}
+
+// A low gap between two pulses of the same frame
+static void endLow(ws2812_decoder_t *dec, uint32_t ns) {
+    if (!dec->started) {
+        return;  // Idle before the first bit
+    }
+    if (ns >= WS2812_RESET_MIN_NS) {
+        dec->midFrameResets++;
+    } else if (ns < WS2812_TL_MIN_NS) {
+        dec->lowErrors++;
+    } else if (ns > WS2812_TL_MAX_NS) {
+        dec->longLows++;
+    }
+    if (ns < dec->minLowNs) dec->minLowNs = ns;
+    if (ns > dec->maxLowNs) dec->maxLowNs = ns;
+}
+
+void WS2812Decoder_Init(ws2812_decoder_t *dec, uint32_t spiHz, uint8_t *out, uint16_t capacity) {
+    dec->bitPs = (uint32_t)(1000000000000ULL / spiHz);
+    dec->level = 0;
+    dec->run = 0;
+    dec->started = 0;
+
+    dec->out = out;
+    dec->outCapacity = capacity;
+    dec->outBytes = 0;
+    dec->shift = 0;
+    dec->bitCount = 0;
+
+    dec->bits = 0;
+    dec->highErrors = 0;
+    dec->lowErrors = 0;
+    dec->longLows = 0;
+    dec->midFrameResets = 0;
+    dec->overflow = 0;
+    dec->minHighNs[0] = dec->minHighNs[1] = UINT32_MAX;
+    dec->maxHighNs[0] = dec->maxHighNs[1] = 0;
+    dec->minLowNs = UINT32_MAX;
+    dec->maxLowNs = 0;
+    dec->resetNs = 0;
+}
+
+void WS2812Decoder_PushByte(ws2812_decoder_t *dec, uint8_t byte) {
+    // SSI shifts the most significant bit out first
+    for (int i = 7; i >= 0; --i) {
+        uint8_t level = (byte >> i) & 1U;
+        if (level != dec->level) {
+            uint32_t ns = runNs(dec, dec->run);
+            if (dec->level) {
+                endHigh(dec, ns);
+            } else {
+                endLow(dec, ns);
+            }
+            dec->level = level;
+            dec->run = 0;
+        }
+        dec->run++;
+    }
+}
+
+int WS2812Decoder_Finish(ws2812_decoder_t *dec, uint32_t idleNs) {
+    // Close a pulse that ran to the last SPI bit
+    if (dec->level) {
+        endHigh(dec, runNs(dec, dec->run));
+        dec->level = 0;
+        dec->run = 0;
+    }
+    dec->resetNs = runNs(dec, dec->run) + idleNs;
+    dec->run = 0;
+
+    // Long lows are legal in practice: the LEDs re-time on every rising edge
+    return dec->highErrors == 0 && dec->lowErrors == 0 && dec->midFrameResets == 0 &&
+           dec->overflow == 0 && dec->bitCount == 0 &&
+           dec->resetNs >= WS2812_RESET_MIN_NS;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file WS2812_Decoder.h
+ * @brief Decode and time-check the SPI byte stream sent to a WS2812 chain.
+ *
+ * The decoder is fed the bytes written to SSI0->DR, expands them MSB first
+ * into the line waveform at the given SPI clock, measures every high pulse
+ * and low gap against the WS2812B datasheet windows and turns the pulses
+ * back into GRB bytes. It does not touch any hardware, so it can also be
+ * built on a PC. The line is assumed to idle low and be clocked without
+ * gaps; a FIFO underrun on the target only lengthens a low gap.
+ */
+#ifndef WS2812_DECODER_H
+#define WS2812_DECODER_H
+
+#include <stdint.h>
+
+// WS2812B datasheet windows (ns)
+#define WS2812_T0H_MIN_NS     250U     // 0 code high: 0.40us +/- 150ns
+#define WS2812_T0H_MAX_NS     550U
+#define WS2812_T1H_MIN_NS     650U     // 1 code high: 0.80us +/- 150ns
+#define WS2812_T1H_MAX_NS     950U
+#define WS2812_TL_MIN_NS      300U     // Shortest low between bits
+#define WS2812_TL_MAX_NS      1000U    // Longest nominal low; longer still decodes
+#define WS2812_RESET_MIN_NS   50000U   // Low time that latches the frame
+
+typedef struct {
+    // Waveform state
+    uint32_t bitPs;          // SPI bit period in picoseconds
+    uint8_t level;           // Level of the run being measured
+    uint32_t run;            // Length of that run in SPI bits
+    uint8_t started;         // A data pulse has been seen in this frame
+
+    // Decoded GRB output
+    uint8_t *out;
+    uint16_t outCapacity;
+    uint16_t outBytes;
+    uint8_t shift;           // Bits collected for the current byte
+    uint8_t bitCount;
+
+    // Results
+    uint32_t bits;           // Data bits decoded
+    uint32_t highErrors;     // High pulses outside both T0H and T1H
+    uint32_t lowErrors;      // Gaps shorter than TL_MIN
+    uint32_t longLows;       // Gaps between TL_MAX and RESET_MIN
+    uint32_t midFrameResets; // Gaps long enough to latch before the frame ended
+    uint32_t overflow;       // Decoded bytes that did not fit in out
+    uint32_t minHighNs[2];   // Shortest/longest high pulse for 0 and 1 codes
+    uint32_t maxHighNs[2];
+    uint32_t minLowNs;
+    uint32_t maxLowNs;
+    uint32_t resetNs;        // Final latch time (set by WS2812Decoder_Finish)
+} ws2812_decoder_t;
+
+/**
+ * @brief Start decoding a frame.
+ * @param dec      Decoder state.
+ * @param spiHz    Actual SPI bit clock.
+ * @param out      Buffer for the decoded GRB bytes (may be NULL).
+ * @param capacity Size of @p out in bytes.
+ */
+void WS2812Decoder_Init(ws2812_decoder_t *dec, uint32_t spiHz, uint8_t *out, uint16_t capacity);
+
+/**
+ * @brief Feed one byte exactly as written to the SSI data register.
+ */
+void WS2812Decoder_PushByte(ws2812_decoder_t *dec, uint8_t byte);
+
+/**
+ * @brief End the frame after the line has idled low for idleNs more.
+ * @return 1 if every bit decoded cleanly and the frame latched, else 0.
+ *         Gaps over WS2812_TL_MAX_NS are counted but do not fail the frame.
+ */
+int WS2812Decoder_Finish(ws2812_decoder_t *dec, uint32_t idleNs);
+
+#endif // WS2812_DECODER_H
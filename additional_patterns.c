@@ -12,7 +12,7 @@
 #include "led_cube.h"
 #include "new_patterns.h"
 #include "common_functions.h"
-#include <stdlib.h>
+#include "rotation_tables.h"
 #include <math.h>
 
 // Pattern types (these would be added to your existing patterns in main.c)
@@ -57,6 +57,9 @@ typedef struct {
 #define MAX_RGB_DROPS 20
 static rgbdrop_t rgbDrops[MAX_RGB_DROPS];
 
+// Share of the last frame kept, so each drop leaves a fading trail
+#define RGB_RAIN_TRAIL_KEEP 128
+
 // Initialize RGB rain pattern
 void initRainRGBPattern(void) {
     for (int i = 0; i < MAX_RGB_DROPS; i++) {
@@ -75,6 +78,7 @@ typedef struct {
 } particle_t;
 
 #define MAX_PARTICLES 50
+#define FIREWORKS_BURST_Z (CUBE_SIZE * 4.0f / 7.0f)  // Rockets burst above this height
 static particle_t particles[MAX_PARTICLES];
 static uint8_t fireworksTimer = 0;
 
@@ -98,17 +102,18 @@ void updateFireworksPattern(uint8_t position, float brightness) {
         fireworksTimer = 0;
         
         // Start position at the bottom of the cube
-        float startX = 3.0f + (rand() % 100) / 100.0f - 0.5f;  // Center X with slight randomness
-        float startY = 3.0f + (rand() % 100) / 100.0f - 0.5f;  // Center Y with slight randomness
+        float startX = CUBE_CENTER + (patternRand() % 100) / 100.0f - 0.5f;  // Center X with slight randomness
+        float startY = CUBE_CENTER + (patternRand() % 100) / 100.0f - 0.5f;  // Center Y with slight randomness
         float startZ = 0.0f;
         
         // Random color for this firework
-        uint8_t r = rand() % 40 + 10;
-        uint8_t g = rand() % 40 + 10;
-        uint8_t b = rand() % 40 + 10;
+        uint8_t r = patternRand() % 40 + 10;
+        uint8_t g = patternRand() % 40 + 10;
+        uint8_t b = patternRand() % 40 + 10;
         
-        // Create explosion at random height
-        float targetZ = 2.0f + (rand() % 400) / 100.0f;  // Random height between 2 and 6
+        // The explosion height was never used; its draw stays so the
+        // random sequence (and the recorded goldens) are unchanged
+        (void)patternRand();
         
         // Launch particles upward from the starting point
         for (int i = 0; i < MAX_PARTICLES; i++) {
@@ -116,9 +121,9 @@ void updateFireworksPattern(uint8_t position, float brightness) {
                 particles[i].x = startX;
                 particles[i].y = startY;
                 particles[i].z = startZ;
-                particles[i].vz = 0.2f + (rand() % 10) / 100.0f;
-                particles[i].vx = (rand() % 100) / 500.0f - 0.1f; // Small random X velocity
-                particles[i].vy = (rand() % 100) / 500.0f - 0.1f; // Small random Y velocity
+                particles[i].vz = 0.2f + (patternRand() % 10) / 100.0f;
+                particles[i].vx = (patternRand() % 100) / 500.0f - 0.1f; // Small random X velocity
+                particles[i].vy = (patternRand() % 100) / 500.0f - 0.1f; // Small random Y velocity
                 particles[i].r = r;
                 particles[i].g = g;
                 particles[i].b = b;
@@ -144,7 +149,7 @@ void updateFireworksPattern(uint8_t position, float brightness) {
             particles[i].age++;
             
             // Check if particle reached explode height
-            if (particles[i].z >= 4.0f && particles[i].vz > 0) {
+            if (particles[i].z >= FIREWORKS_BURST_Z && particles[i].vz > 0) {
                 // Explode!
                 particles[i].active = 0;
                 
@@ -157,9 +162,9 @@ void updateFireworksPattern(uint8_t position, float brightness) {
                             particles[k].z = particles[i].z;
                             
                             // Random velocity in all directions
-                            float angle = (rand() % 628) / 100.0f; // 0 to 2π
-                            float elevation = (rand() % 314) / 100.0f - 1.57f; // -π/2 to π/2
-                            float speed = 0.1f + (rand() % 15) / 100.0f;
+                            float angle = (patternRand() % 628) / 100.0f; // 0 to 2π
+                            float elevation = (patternRand() % 314) / 100.0f - 1.57f; // -π/2 to π/2
+                            float speed = 0.1f + (patternRand() % 15) / 100.0f;
                             
                             particles[k].vx = speed * cosf(elevation) * cosf(angle);
                             particles[k].vy = speed * cosf(elevation) * sinf(angle);
@@ -251,44 +256,22 @@ void updateSpinningPlanePattern(uint8_t position, float brightness) {
     clearAllLeds();
     
     // Increment angle for rotation
-    planeAngle = (planeAngle + 1) % 72; // 5-degree increments (360/72 = 5)
-    
-    // Convert to radians
-    float angle = planeAngle * 0.0872665f; // 5 degrees in radians
+    planeAngle = (planeAngle + 1) % PLANE_STEPS; // 5-degree increments (360/72 = 5)
     
-    // Center of cube
-    float centerX = (CUBE_SIZE - 1) / 2.0f;
-    float centerY = (CUBE_SIZE - 1) / 2.0f;
-    float centerZ = (CUBE_SIZE - 1) / 2.0f;
+    // Color and lit columns for this angle come from the boot-time tables
+    rgb_t planeColor = scaleBrightness(RotationTables_PlaneColor(planeAngle), brightness);
     
-    // Calculate color based on angle
-    rgb_t planeColor;
-    float colorFactor = (float)planeAngle / 72.0f;
-    planeColor.r = (uint8_t)(40.0f * sinf(colorFactor * 6.28f));
-    planeColor.g = (uint8_t)(40.0f * sinf(colorFactor * 6.28f + 2.09f)); // 120° offset
-    planeColor.b = (uint8_t)(40.0f * sinf(colorFactor * 6.28f + 4.19f)); // 240° offset
-    
-    // Apply brightness scaling
-    planeColor = scaleBrightness(planeColor, brightness);
+    uint8_t columnCount;
+    const uint8_t *columns = RotationTables_PlaneColumns(planeAngle, &columnCount);
     
     // Draw a plane rotating around the Z axis
-    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
-        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
-            // Calculate position relative to center
-            float relX = x - centerX;
-            float relY = y - centerY;
-            
-            // Apply rotation matrix for z-axis rotation
-            float rotX = relX * cosf(angle) - relY * sinf(angle);
-            float rotY = relX * sinf(angle) + relY * cosf(angle);
-            
-            // If rotated Y is close to 0, it's on the plane
-            if (fabsf(rotY) < 0.5f) {
-                // Loop through all Z levels
-                for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-                    setVoxel(x, y, z, planeColor);
-                }
-            }
+    for (uint8_t i = 0; i < columnCount; i++) {
+        uint8_t x = ROTATION_POINT_X(columns[i]);
+        uint8_t y = ROTATION_POINT_Y(columns[i]);
+        
+        // Loop through all Z levels
+        for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+            setVoxel(x, y, z, planeColor);
         }
     }
 }
@@ -317,26 +300,26 @@ void initRainRGBPattern(void) {
 */
 // Update RGB rain pattern - colored raindrops falling from top to bottom
 void updateRainRGBPattern(uint8_t position, float brightness) {
-    clearAllLeds();
+    fadeAllLeds(RGB_RAIN_TRAIL_KEEP);
     
     // Create new drops randomly
     if (position % 5 == 0) {
         for (int i = 0; i < MAX_RGB_DROPS; i++) {
             if (!rgbDrops[i].active) {
                 // 30% chance to create a new drop
-                if ((rand() % 10) < 3) {
-                    rgbDrops[i].x = rand() % CUBE_SIZE;
-                    rgbDrops[i].y = rand() % CUBE_SIZE;
+                if ((patternRand() % 10) < 3) {
+                    rgbDrops[i].x = patternRand() % CUBE_SIZE;
+                    rgbDrops[i].y = patternRand() % CUBE_SIZE;
                     rgbDrops[i].z = CUBE_SIZE - 1; // Start at the top
                     
                     // Random RGB color
-                    rgbDrops[i].r = rand() % 40;
-                    rgbDrops[i].g = rand() % 40;
-                    rgbDrops[i].b = rand() % 40;
+                    rgbDrops[i].r = patternRand() % 40;
+                    rgbDrops[i].g = patternRand() % 40;
+                    rgbDrops[i].b = patternRand() % 40;
                     
                     // Ensure drop has some minimum brightness
                     if (rgbDrops[i].r + rgbDrops[i].g + rgbDrops[i].b < 20) {
-                        switch (rand() % 3) {
+                        switch (patternRand() % 3) {
                             case 0: rgbDrops[i].r = 40; break;
                             case 1: rgbDrops[i].g = 40; break;
                             case 2: rgbDrops[i].b = 40; break;
@@ -361,7 +344,7 @@ void updateRainRGBPattern(uint8_t position, float brightness) {
                 rgbDrops[i].z--;
             }
             
-            // Draw the active drops with their color
+            // Draw the head of each active drop; the fade leaves the trail
             if (rgbDrops[i].active) {
                 rgb_t dropColor;
                 
@@ -371,24 +354,6 @@ void updateRainRGBPattern(uint8_t position, float brightness) {
                 dropColor.b = rgbDrops[i].b;
                 dropColor = scaleBrightness(dropColor, brightness);
                 setVoxel(rgbDrops[i].x, rgbDrops[i].y, rgbDrops[i].z, dropColor);
-                
-                // Dimmer trail behind
-                if (rgbDrops[i].z < CUBE_SIZE - 1) {
-                    dropColor.r = rgbDrops[i].r / 2;
-                    dropColor.g = rgbDrops[i].g / 2;
-                    dropColor.b = rgbDrops[i].b / 2;
-                    dropColor = scaleBrightness(dropColor, brightness);
-                    setVoxel(rgbDrops[i].x, rgbDrops[i].y, rgbDrops[i].z + 1, dropColor);
-                }
-                
-                // Even dimmer second trail element
-                if (rgbDrops[i].z < CUBE_SIZE - 2) {
-                    dropColor.r = rgbDrops[i].r / 4;
-                    dropColor.g = rgbDrops[i].g / 4;
-                    dropColor.b = rgbDrops[i].b / 4;
-                    dropColor = scaleBrightness(dropColor, brightness);
-                    setVoxel(rgbDrops[i].x, rgbDrops[i].y, rgbDrops[i].z + 2, dropColor);
-                }
             }
         }
     }
@@ -7,8 +7,14 @@
 #include "led_cube.h"
 #include "new_patterns.h"
 #include "common_functions.h"
-#include <stdlib.h>
+#include "font5x7.h"
+#include "scene.h"
+#include "rotation_tables.h"
+#include "animation.h"
+#include "palette.h"
+#include "chain_render.h"
 #include <math.h>
+#include <stddef.h>  // For NULL definition
 
 // Pattern types (to be added to your existing patterns)
 #define PATTERN_DNA             11  // DNA double helix animation
@@ -43,65 +49,31 @@ void updateDNAPattern(uint8_t position, float brightness) {
     clearAllLeds();
     
     // Increment rotation
-    dnaRotation = (dnaRotation + 1) % 36;  // 10-degree increments
+    dnaRotation = (dnaRotation + 1) % HELIX_STEPS;  // 10-degree increments
     
-    // Parameters for double helix
-    float centerX = (CUBE_SIZE - 1) / 2.0f;
-    float centerY = (CUBE_SIZE - 1) / 2.0f;
-    float radius = 1.5f;  // Radius of the helix
-    float angleIncrement = 20.0f;  // Angular distance between each Z level
-    float startAngle = dnaRotation * 10.0f;  // Starting angle, animated
-    
-    // Height step between each base pair
-    float zStep = 0.5f;
+    // Colors for the two strands and the base pairs
+    rgb_t strandA = scaleBrightness((rgb_t){40, 0, 0}, brightness);
+    rgb_t strandB = scaleBrightness((rgb_t){0, 0, 40}, brightness);
+    rgb_t basePair = scaleBrightness((rgb_t){0, 40, 0}, brightness);
     
-    // Draw the double helix
-    for (float z = 0; z < CUBE_SIZE; z += zStep) {
-        // Calculate the angle for this height
-        float angle1 = startAngle + z * angleIncrement;
-        float angle2 = angle1 + 180.0f;  // Second strand is 180 degrees offset
+    // The helix twists 20 degrees per layer, so each half layer of height
+    // is one more 10-degree table step
+    for (uint8_t i = 0; i < CUBE_SIZE * 2; i++) {
+        const helix_step_t *step = RotationTables_Helix(dnaRotation + i);
+        uint8_t z = i / 2;
         
-        // Convert to radians
-        float rad1 = angle1 * 0.0174533f;
-        float rad2 = angle2 * 0.0174533f;
-        
-        // Calculate positions
-        int x1 = (int)(centerX + radius * cosf(rad1));
-        int y1 = (int)(centerY + radius * sinf(rad1));
-        
-        int x2 = (int)(centerX + radius * cosf(rad2));
-        int y2 = (int)(centerY + radius * sinf(rad2));
+        if (step->strandA == ROTATION_NO_POINT || step->strandB == ROTATION_NO_POINT) {
+            continue;
+        }
+        setVoxel(ROTATION_POINT_X(step->strandA), ROTATION_POINT_Y(step->strandA), z, strandA);
+        setVoxel(ROTATION_POINT_X(step->strandB), ROTATION_POINT_Y(step->strandB), z, strandB);
         
-        // Check bounds
-        if (x1 >= 0 && x1 < CUBE_SIZE && y1 >= 0 && y1 < CUBE_SIZE && 
-            x2 >= 0 && x2 < CUBE_SIZE && y2 >= 0 && y2 < CUBE_SIZE &&
-            (int)z >= 0 && (int)z < CUBE_SIZE) {
-            
-            // Colors for the two strands
-            rgb_t color1 = {40, 0, 0};  // Red for one strand
-            rgb_t color2 = {0, 0, 40};  // Blue for the other strand
-            
-            // Draw the two helix strands
-            color1 = scaleBrightness(color1, brightness);
-            color2 = scaleBrightness(color2, brightness);
-            
-            setVoxel(x1, y1, (int)z, color1);
-            setVoxel(x2, y2, (int)z, color2);
-            
-            // Draw base pair connection (green) every 2 z-steps
-            if (fmodf(z, 1.0f) < 0.1f) {
-                rgb_t baseColor = {0, 40, 0};  // Green for base pairs
-                baseColor = scaleBrightness(baseColor, brightness);
-                
-                // Calculate points along the base pair
-                for (float t = 0.1f; t < 0.9f; t += 0.2f) {
-                    int baseX = (int)(x1 * (1-t) + x2 * t);
-                    int baseY = (int)(y1 * (1-t) + y2 * t);
-                    
-                    // Check bounds again
-                    if (baseX >= 0 && baseX < CUBE_SIZE && baseY >= 0 && baseY < CUBE_SIZE) {
-                        setVoxel(baseX, baseY, (int)z, baseColor);
-                    }
+        // Base pairs connect the strands on every whole layer
+        if ((i & 1) == 0) {
+            for (uint8_t b = 0; b < HELIX_BASE_POINTS; b++) {
+                uint8_t p = step->basePairs[b];
+                if (p != ROTATION_NO_POINT) {
+                    setVoxel(ROTATION_POINT_X(p), ROTATION_POINT_Y(p), z, basePair);
                 }
             }
         }
@@ -119,7 +91,7 @@ void initGameOfLife3D(void) {
     for (uint8_t x = 0; x < CUBE_SIZE; x++) {
         for (uint8_t y = 0; y < CUBE_SIZE; y++) {
             for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-                cellGrid[x][y][z] = (rand() % 100 < 20) ? 1 : 0;
+                cellGrid[x][y][z] = (patternRand() % 100 < 20) ? 1 : 0;
             }
         }
     }
@@ -153,6 +125,8 @@ uint8_t countNeighbors3D(uint8_t x, uint8_t y, uint8_t z) {
 
 // Update 3D Game of Life pattern
 void updateGameOfLife3D(uint8_t position, float brightness) {
+    (void)brightness;  // Applied to the palette at output
+
     // Reset if needed
     if (gameOfLifeReset || position % 100 == 0) {
         initGameOfLife3D();
@@ -203,27 +177,27 @@ void updateGameOfLife3D(uint8_t position, float brightness) {
         }
     }
     
-    // Draw the current state
-    clearAllLeds();
+    // Draw the current state, one palette entry per neighbor count
+    Palette_BeginFrame();
+    
+    for (uint8_t neighbors = 0; neighbors <= 26; neighbors++) {
+        rgb_t cellColor;
+        
+        // Color gradient based on neighbors
+        cellColor.r = (neighbors < 13) ? 40 - (neighbors * 3) : 0;
+        cellColor.g = (neighbors >= 4 && neighbors <= 7) ? 40 : 0;
+        cellColor.b = (neighbors > 7) ? (neighbors - 7) * 5 : 0;
+        
+        // Brightness is applied to the entry at output
+        Palette_SetEntry(neighbors + 1, cellColor);
+    }
     
     for (uint8_t x = 0; x < CUBE_SIZE; x++) {
         for (uint8_t y = 0; y < CUBE_SIZE; y++) {
             for (uint8_t z = 0; z < CUBE_SIZE; z++) {
                 if (cellGrid[x][y][z]) {
-                    // Calculate color based on number of neighbors
-                    uint8_t neighbors = countNeighbors3D(x, y, z);
-                    rgb_t cellColor;
-                    
-                    // Color gradient based on neighbors
-                    cellColor.r = (neighbors < 13) ? 40 - (neighbors * 3) : 0;
-                    cellColor.g = (neighbors >= 4 && neighbors <= 7) ? 40 : 0;
-                    cellColor.b = (neighbors > 7) ? (neighbors - 7) * 5 : 0;
-                    
-                    // Apply brightness
-                    cellColor = scaleBrightness(cellColor, brightness);
-                    
-                    // Set the voxel
-                    setVoxel(x, y, z, cellColor);
+                    // Color depends on the number of neighbors
+                    Palette_SetVoxel(x, y, z, countNeighbors3D(x, y, z) + 1);
                 }
             }
         }
@@ -242,7 +216,7 @@ void updateCubeInCubePattern(uint8_t position, float brightness) {
     if (position % 5 == 0) {
         if (expandingCube) {
             cubeScale++;
-            if (cubeScale >= 10) { // Scale * 0.3 = max size
+            if (cubeScale >= 10) { // Scale * step = max size
                 expandingCube = 0;
             }
         } else {
@@ -254,8 +228,9 @@ void updateCubeInCubePattern(uint8_t position, float brightness) {
         }
     }
     
-    // Calculate current cube size (0.3 to 3.0)
-    float scale = 0.3f + (cubeScale * 0.3f);
+    // Calculate current cube size (one step up to just past the cube's half-width)
+    const float step = CUBE_CENTER / 10.0f;
+    float scale = step + (cubeScale * step);
     
     // Center of the cube
     float centerX = (CUBE_SIZE - 1) / 2.0f;
@@ -273,39 +248,15 @@ void updateCubeInCubePattern(uint8_t position, float brightness) {
     cubeColor.b = (uint8_t)(40.0f * sinf(colorScale * 3.14159f));
     cubeColor = scaleBrightness(cubeColor, brightness);
     
-    // Draw the cube edges
-    for (float t = 0; t <= 1.0f; t += 0.05f) {
-        // Eight corners of the cube
-        float corners[8][3] = {
-            {centerX - halfWidth, centerY - halfWidth, centerZ - halfWidth},
-            {centerX + halfWidth, centerY - halfWidth, centerZ - halfWidth},
-            {centerX - halfWidth, centerY + halfWidth, centerZ - halfWidth},
-            {centerX + halfWidth, centerY + halfWidth, centerZ - halfWidth},
-            {centerX - halfWidth, centerY - halfWidth, centerZ + halfWidth},
-            {centerX + halfWidth, centerY - halfWidth, centerZ + halfWidth},
-            {centerX - halfWidth, centerY + halfWidth, centerZ + halfWidth},
-            {centerX + halfWidth, centerY + halfWidth, centerZ + halfWidth}
-        };
-        
-        // Draw 12 edges of the cube
-        // Bottom face edges
-        drawLine3D(corners[0], corners[1], cubeColor);
-        drawLine3D(corners[1], corners[3], cubeColor);
-        drawLine3D(corners[3], corners[2], cubeColor);
-        drawLine3D(corners[2], corners[0], cubeColor);
-        
-        // Top face edges
-        drawLine3D(corners[4], corners[5], cubeColor);
-        drawLine3D(corners[5], corners[7], cubeColor);
-        drawLine3D(corners[7], corners[6], cubeColor);
-        drawLine3D(corners[6], corners[4], cubeColor);
-        
-        // Vertical edges
-        drawLine3D(corners[0], corners[4], cubeColor);
-        drawLine3D(corners[1], corners[5], cubeColor);
-        drawLine3D(corners[2], corners[6], cubeColor);
-        drawLine3D(corners[3], corners[7], cubeColor);
+    // Draw the cube edges (re-rasterized only when the scale changes)
+    static scene_handle_t cubeShape = -1;
+    if (cubeShape < 0) {
+        cubeShape = Scene_AddBox(SCENE_BOX_VOXELS);
     }
+    scene_transform_t cubeTransform = {centerX, centerY, centerZ, halfWidth, 0.0f};
+    Scene_SetTransform(cubeShape, &cubeTransform);
+    Scene_SetColor(cubeShape, 0, cubeColor);
+    Scene_Draw(cubeShape);
 }
 
 // Helper function to draw a 3D line
@@ -359,9 +310,9 @@ void initSnake3D(void) {
     
     // Make sure we have at least one non-zero direction
     while (dirX == 0 && dirY == 0 && dirZ == 0) {
-        dirX = (rand() % 3) - 1;
-        dirY = (rand() % 3) - 1;
-        dirZ = (rand() % 3) - 1;
+        dirX = (patternRand() % 3) - 1;
+        dirY = (patternRand() % 3) - 1;
+        dirZ = (patternRand() % 3) - 1;
     }
     
     // Create initial food position
@@ -373,9 +324,9 @@ void initSnake3D(void) {
 // Place food at a random empty location
 void placeFood(void) {
     // Start with a random position
-    foodX = rand() % CUBE_SIZE;
-    foodY = rand() % CUBE_SIZE;
-    foodZ = rand() % CUBE_SIZE;
+    foodX = patternRand() % CUBE_SIZE;
+    foodY = patternRand() % CUBE_SIZE;
+    foodZ = patternRand() % CUBE_SIZE;
     
     // Make sure it's not on the snake
     uint8_t collision = 1;
@@ -384,9 +335,9 @@ void placeFood(void) {
         for (int i = 0; i < snakeLength; i++) {
             if (foodX == snakeX[i] && foodY == snakeY[i] && foodZ == snakeZ[i]) {
                 collision = 1;
-                foodX = rand() % CUBE_SIZE;
-                foodY = rand() % CUBE_SIZE;
-                foodZ = rand() % CUBE_SIZE;
+                foodX = patternRand() % CUBE_SIZE;
+                foodY = patternRand() % CUBE_SIZE;
+                foodZ = patternRand() % CUBE_SIZE;
                 break;
             }
         }
@@ -403,9 +354,9 @@ void updateSnake3DPattern(uint8_t position, float brightness) {
     // Only update the snake movement every 15 frames
     if (position % 15 == 0) {
         // Randomly change direction occasionally (30% chance)
-        if (rand() % 100 < 30) {
+        if (patternRand() % 100 < 30) {
             // Pick a random direction
-            int newDir = rand() % 6;
+            int newDir = patternRand() % 6;
             switch (newDir) {
                 case 0: dirX = 1;  dirY = 0;  dirZ = 0;  break; // +X
                 case 1: dirX = -1; dirY = 0;  dirZ = 0;  break; // -X
@@ -483,155 +434,170 @@ void updateSnake3DPattern(uint8_t position, float brightness) {
 }
 
 // Text scroller state
+// The message is turned into a strip of column bitmasks (one glyph column
+// per byte, FONT_ADVANCE columns per character, then CUBE_SIZE blank columns
+// so the text fully leaves the cube before it wraps). Each column is looked
+// up once as it enters the visible window; drawing a frame only walks the
+// CUBE_SIZE masks in the window.
+#define TEXT_SCROLL_FRAMES 3   // frames per one-column scroll step
+#define TEXT_BASE_Z ((CUBE_SIZE > FONT_HEIGHT) ? (CUBE_SIZE - FONT_HEIGHT) / 2 : 0)  // Centers the glyphs vertically
+#define TEXT_INDEX         1   // palette entry of the text
+
 typedef struct {
-    const char *text;
-    uint8_t scrollOffset;
-    uint8_t textLength;
+    const char *text;           // message, any length, must stay valid
+    const char *nextChar;       // character currently being fed into the window
+    uint8_t nextCol;            // column of nextChar to feed next
+    uint8_t tailCols;           // blank columns fed after the end of the text
+    uint8_t frameCount;
+    uint8_t window[CUBE_SIZE];  // visible column masks, window[0] is x = 0
 } scroller_t;
 
-static scroller_t textScroller = {"HELLO", 0, 5};
-
-// Characters defined as 5x7 bitmaps (standard font layout)
-static const uint8_t charMap[128][7] = {
-    // Space (32)
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    // More character definitions would go here
-    // For example, letter 'A' (65)
-    {0x1E, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x21},
-    // Letter 'B'
-    {0x3E, 0x21, 0x21, 0x3E, 0x21, 0x21, 0x3E},
-    // Letter 'C'
-    {0x1E, 0x21, 0x20, 0x20, 0x20, 0x21, 0x1E},
-    // Letter 'D'
-    {0x3E, 0x11, 0x21, 0x21, 0x21, 0x11, 0x3E},
-    // Letter 'E'
-    {0x3F, 0x20, 0x20, 0x3E, 0x20, 0x20, 0x3F},
-    // Letter 'F'
-    {0x3F, 0x20, 0x20, 0x3E, 0x20, 0x20, 0x20},
-    // Letter 'G'
-    {0x1E, 0x21, 0x20, 0x27, 0x21, 0x21, 0x1E},
-    // Letter 'H'
-    {0x21, 0x21, 0x21, 0x3F, 0x21, 0x21, 0x21},
-    // Letter 'I'
-    {0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E},
-    // Letter 'J'
-    {0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x1E},
-    // Letter 'K'
-    {0x21, 0x22, 0x24, 0x38, 0x24, 0x22, 0x21},
-    // Letter 'L'
-    {0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F},
-    // Letter 'M'
-    {0x41, 0x63, 0x55, 0x49, 0x41, 0x41, 0x41},
-    // Letter 'N'
-    {0x21, 0x31, 0x29, 0x25, 0x23, 0x21, 0x21},
-    // Letter 'O'
-    {0x1E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1E},
-};
+static scroller_t textScroller = {"HELLO", "HELLO", 0, 0, 0, {0}};
+
+// Replace the scrolling message; the string is not copied
+void setTextScrollerMessage(const char *text) {
+    if (text == NULL) {
+        text = "";
+    }
+    textScroller.text = text;
+    textScroller.nextChar = text;
+    textScroller.nextCol = 0;
+    textScroller.tailCols = 0;
+    textScroller.frameCount = 0;
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        textScroller.window[x] = 0;
+    }
+}
+
+// Produce the next column of the strip, wrapping at the end of the message
+static uint8_t nextStripColumn(void) {
+    if (*textScroller.nextChar == '\0') {
+        if (textScroller.tailCols < CUBE_SIZE) {
+            textScroller.tailCols++;
+            return 0;
+        }
+        textScroller.nextChar = textScroller.text;
+        textScroller.nextCol = 0;
+        textScroller.tailCols = 0;
+        if (*textScroller.nextChar == '\0') {
+            return 0;
+        }
+    }
+
+    uint8_t mask = Font_Column(*textScroller.nextChar, textScroller.nextCol);
+    if (++textScroller.nextCol >= FONT_ADVANCE) {
+        textScroller.nextCol = 0;
+        textScroller.nextChar++;
+    }
+    return mask;
+}
 
 // Update scrolling text pattern
 void updateTextScrollerPattern(uint8_t position, float brightness) {
-    clearAllLeds();
-    
-    // Update scroll position every 20 frames
-    if (position % 20 == 0) {
-        textScroller.scrollOffset = (textScroller.scrollOffset + 1) % (textScroller.textLength * 6 + CUBE_SIZE);
+    (void)position;    // Scrolls at its own pace
+    (void)brightness;  // Applied to the palette at output
+    Palette_BeginFrame();
+
+    // Shift the window one column toward x = 0 and feed in the next column
+    if (++textScroller.frameCount >= TEXT_SCROLL_FRAMES) {
+        textScroller.frameCount = 0;
+        for (uint8_t x = 0; x < CUBE_SIZE - 1; x++) {
+            textScroller.window[x] = textScroller.window[x + 1];
+        }
+        textScroller.window[CUBE_SIZE - 1] = nextStripColumn();
     }
-    
-    // Calculate the first character to display
-    int firstCharPos = (textScroller.scrollOffset / 6) - 1;
-    int xOffset = textScroller.scrollOffset % 6;
-    
-    // Display up to 3 characters (max that can fit in cube width)
-    for (int charPos = firstCharPos; charPos < firstCharPos + 3; charPos++) {
-        // Calculate character index in the text string
-        int charIdx = charPos % textScroller.textLength;
-        if (charIdx < 0) charIdx += textScroller.textLength;
-        
-        // Get the character
-        char c = textScroller.text[charIdx];
-        
-        // Skip if out of ascii range
-        if (c < 32 || c > 126) continue;
-        
-        // Calculate x position in the cube
-        int xStart = 6 * (charPos - firstCharPos) - xOffset;
-        
-        // Draw the character
-        for (int row = 0; row < 7; row++) {
-            for (int col = 0; col < 5; col++) {
-                // Check if this pixel is set in the bitmap
-                if ((charMap[c - 32][row] >> (4 - col)) & 0x01) {
-                    // Calculate position
-                    int x = xStart + col;
-                    
-                    // Make sure it's within the cube
-                    if (x >= 0 && x < CUBE_SIZE) {
-                        // Set this column on all Y positions (depth)
-                        for (int y = 0; y < CUBE_SIZE; y++) {
-                            rgb_t color = {40, 40, 0}; // Yellow text
-                            color = scaleBrightness(color, brightness);
-                            setVoxel(x, y, row, color);
-                        }
-                    }
+
+    rgb_t color = {40, 40, 0}; // Yellow text
+    Palette_SetEntry(TEXT_INDEX, color);
+
+    // Extrude each lit pixel of the window through all Y positions (depth)
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        uint8_t mask = textScroller.window[x];
+        for (uint8_t row = 0; mask != 0; row++, mask >>= 1) {
+            if (mask & 0x01) {
+                uint8_t z = TEXT_BASE_Z + FONT_HEIGHT - 1 - row;  // bit 0 is the top row
+                for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+                    Palette_SetVoxel(x, y, z, TEXT_INDEX);
                 }
             }
         }
     }
 }
 
+#if PLASMA_FROM_FLASH
 // Plasma pattern state
-static uint8_t plasmaOffset = 0;
+static animation_player_t plasmaPlayer;
+static uint8_t plasmaOpen = 0;
 
-// Update plasma pattern - 3D plasma effect
+// Update plasma pattern - plays the 100-frame loop baked from the live version below
 void updatePlasmaPattern(uint8_t position, float brightness) {
-    clearAllLeds();
-    
-    // Increment plasma animation
-    plasmaOffset = (plasmaOffset + 1) % 100;
-    
-    // Calculate plasma based on 3D sine waves
-    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
-        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
-            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-                // Calculate plasma value based on position and time
-                float value = 
-                    sinf(x * 0.5f + plasmaOffset * 0.1f) + 
-                    sinf(y * 0.5f + plasmaOffset * 0.08f) + 
-                    sinf(z * 0.5f + plasmaOffset * 0.06f) + 
-                    sinf(sqrtf((x-3)*(x-3) + (y-3)*(y-3) + (z-3)*(z-3)) * 0.4f + plasmaOffset * 0.07f);
-                
-                // Normalize to 0-1 range
-                value = (value + 4.0f) / 8.0f;
-                
-                // Calculate color based on plasma value
-                rgb_t color;
-                value *= 3.0f; // Scale to cover 3 color regions
-                
-                if (value < 1.0f) {
-                    // Red to Yellow
-                    color.r = 40;
-                    color.g = (uint8_t)(40.0f * value);
-                    color.b = 0;
-                } else if (value < 2.0f) {
-                    // Yellow to Cyan
-                    value -= 1.0f;
-                    color.r = (uint8_t)(40.0f * (1.0f - value));
-                    color.g = 40;
-                    color.b = (uint8_t)(40.0f * value);
-                } else {
-                    // Cyan to Magenta
-                    value -= 2.0f;
-                    color.r = (uint8_t)(40.0f * value);
-                    color.g = (uint8_t)(40.0f * (1.0f - value));
-                    color.b = 40;
-                }
-                
-                // Apply brightness
-                color = scaleBrightness(color, brightness);
-                
-                // Set voxel with plasma color
-                setVoxel(x, y, z, color);
+    if (!plasmaOpen) {
+        if (!Animation_Open(&plasmaPlayer, plasmaAnimation)) {
+            clearAllLeds();
+            return;
+        }
+        plasmaOpen = 1;
+    }
+    Animation_Draw(&plasmaPlayer, brightness);
+}
+#else
+// Plasma pattern state
+static uint8_t plasmaOffset = 0;
+static float plasmaBrightness = 0.0f;
+
+// One x layer of the plasma, computed as the LED chain reaches it
+static void plasmaSlice(uint8_t x, uint8_t *slice) {
+    float xWave = sinf(x * 0.5f + plasmaOffset * 0.1f);
+    for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+        float yWave = sinf(y * 0.5f + plasmaOffset * 0.08f);
+        for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+            // Calculate plasma value based on position and time
+            float value = 
+                xWave + 
+                yWave + 
+                sinf(z * 0.5f + plasmaOffset * 0.06f) + 
+                sinf(sqrtf((x-CUBE_CENTER)*(x-CUBE_CENTER) + (y-CUBE_CENTER)*(y-CUBE_CENTER) + (z-CUBE_CENTER)*(z-CUBE_CENTER)) * 0.4f + plasmaOffset * 0.07f);
+            
+            // Normalize to 0-1 range
+            value = (value + 4.0f) / 8.0f;
+            
+            // Calculate color based on plasma value
+            rgb_t color;
+            value *= 3.0f; // Scale to cover 3 color regions
+            
+            if (value < 1.0f) {
+                // Red to Yellow
+                color.r = 40;
+                color.g = (uint8_t)(40.0f * value);
+                color.b = 0;
+            } else if (value < 2.0f) {
+                // Yellow to Cyan
+                value -= 1.0f;
+                color.r = (uint8_t)(40.0f * (1.0f - value));
+                color.g = 40;
+                color.b = (uint8_t)(40.0f * value);
+            } else {
+                // Cyan to Magenta
+                value -= 2.0f;
+                color.r = (uint8_t)(40.0f * value);
+                color.g = (uint8_t)(40.0f * (1.0f - value));
+                color.b = 40;
             }
+            
+            // Apply brightness
+            color = scaleBrightness(color, plasmaBrightness);
+            
+            // Set voxel with plasma color
+            ChainRender_SetVoxel(slice, y, z, color);
         }
     }
-}
\ No newline at end of file
+}
+
+// Update plasma pattern - 3D plasma effect, computed while the frame goes out
+void updatePlasmaPattern(uint8_t position, float brightness) {
+    // Increment plasma animation
+    plasmaOffset = (plasmaOffset + 1) % 100;
+    plasmaBrightness = brightness;
+    ChainRender_BeginFrame(plasmaSlice);
+}
+#endif
@@ -0,0 +1,197 @@
+/**
+ * @file anim_pack.c
+ * @brief Palette building and keyframe/delta selection for flash animations.
+ */
+
+#include "anim_pack.h"
+#include <stddef.h>  // For NULL definition
+#include <string.h>
+
+// Frames are staged here until the palette size is known
+#define STAGING_OFFSET  (ANIM_HEADER_SIZE + ANIM_PALETTE_MAX * 3)
+
+static void write16(uint8_t *p, uint16_t value) {
+    p[0] = (uint8_t)(value & 0xFF);
+    p[1] = (uint8_t)(value >> 8);
+}
+
+// Palette index of a GRB color, adding it if it is new (-1 when full)
+static int16_t paletteIndex(anim_packer_t *pack, const uint8_t *grb) {
+    for (uint16_t i = 0; i < pack->paletteSize; i++) {
+        const uint8_t *entry = &pack->palette[i * 3];
+        if (entry[0] == grb[0] && entry[1] == grb[1] && entry[2] == grb[2]) {
+            return (int16_t)i;
+        }
+    }
+    if (pack->paletteSize >= ANIM_PALETTE_MAX) {
+        return -1;
+    }
+    memcpy(&pack->palette[pack->paletteSize * 3], grb, 3);
+    return (int16_t)pack->paletteSize++;
+}
+
+// Each writer returns the payload size; with out == NULL it only measures
+
+static uint16_t writeRle(const uint8_t *indices, uint8_t *out) {
+    uint16_t length = 0;
+    uint16_t led = 0;
+
+    while (led < NUM_LEDS) {
+        uint16_t end = led + 1;
+        while (end < NUM_LEDS && end - led < ANIM_RUN_MAX && indices[end] == indices[led]) {
+            end++;
+        }
+        if (out != NULL) {
+            out[length]     = (uint8_t)(end - led);
+            out[length + 1] = indices[led];
+        }
+        length += 2;
+        led = end;
+    }
+    return length;
+}
+
+static uint16_t writeSpans(const uint8_t *previous, const uint8_t *indices, uint8_t *out) {
+    uint16_t length = 0;
+    uint16_t led = 0;
+
+    while (led < NUM_LEDS) {
+        if (indices[led] == previous[led]) {
+            led++;
+            continue;
+        }
+        // Bridge short unchanged gaps: rewriting up to 2 LEDs beats a new span header
+        uint16_t end = led + 1;
+        while (end < NUM_LEDS && end - led < ANIM_RUN_MAX) {
+            if (indices[end] != previous[end]) {
+                end++;
+                continue;
+            }
+            uint16_t next = end;
+            while (next < NUM_LEDS && next - end < 3 && indices[next] == previous[next]) {
+                next++;
+            }
+            if (next < NUM_LEDS && next - end < 3 && next - led < ANIM_RUN_MAX) {
+                end = next;
+            } else {
+                break;
+            }
+        }
+        if (out != NULL) {
+            write16(&out[length], led);
+            out[length + 2] = (uint8_t)(end - led);
+            memcpy(&out[length + 3], &indices[led], end - led);
+        }
+        length += 3 + (end - led);
+        led = end;
+    }
+    return length;
+}
+
+void AnimPack_Begin(anim_packer_t *pack, uint8_t *out, uint32_t capacity,
+                    uint16_t keyInterval, uint8_t flags) {
+    pack->out = out;
+    pack->capacity = capacity;
+    pack->size = 0;
+    pack->paletteSize = 0;
+    pack->frameCount = 0;
+    pack->keyInterval = keyInterval;
+    pack->sinceKey = 0;
+    pack->flags = flags;
+    pack->failed = capacity < STAGING_OFFSET;
+}
+
+int AnimPack_AddFrame(anim_packer_t *pack, const uint8_t *frame, uint16_t durationMs) {
+    uint8_t indices[NUM_LEDS];
+
+    if (pack->failed || pack->frameCount == 0xFFFF) {
+        pack->failed = 1;
+        return 0;
+    }
+    for (uint16_t led = 0; led < NUM_LEDS; led++) {
+        int16_t index = paletteIndex(pack, &frame[led * 3]);
+        if (index < 0) {
+            pack->failed = 1;
+            return 0;
+        }
+        indices[led] = (uint8_t)index;
+    }
+
+    uint8_t keyDue = pack->frameCount == 0 ||
+                     (pack->keyInterval != 0 && pack->sinceKey + 1 >= pack->keyInterval);
+    uint8_t type = ANIM_FRAME_KEY_RAW;
+    uint16_t length = NUM_LEDS;
+    uint16_t candidate;
+
+    // Measure every allowed encoding and keep the smallest
+    candidate = writeRle(indices, NULL);
+    if (candidate < length) {
+        type = ANIM_FRAME_KEY_RLE;
+        length = candidate;
+    }
+    if (!keyDue) {
+        candidate = writeSpans(pack->previous, indices, NULL);
+        if (candidate < length) {
+            type = ANIM_FRAME_DELTA_SPANS;
+            length = candidate;
+        }
+    }
+
+    if (STAGING_OFFSET + pack->size + ANIM_FRAME_HEADER_SIZE + length > pack->capacity) {
+        pack->failed = 1;
+        return 0;
+    }
+
+    uint8_t *record = pack->out + STAGING_OFFSET + pack->size;
+    uint8_t *payload = record + ANIM_FRAME_HEADER_SIZE;
+    record[0] = type;
+    write16(&record[1], durationMs);
+    write16(&record[3], length);
+    switch (type) {
+        case ANIM_FRAME_KEY_RAW:
+            memcpy(payload, indices, NUM_LEDS);
+            break;
+        case ANIM_FRAME_KEY_RLE:
+            writeRle(indices, payload);
+            break;
+        case ANIM_FRAME_DELTA_SPANS:
+            writeSpans(pack->previous, indices, payload);
+            break;
+    }
+
+    pack->size += ANIM_FRAME_HEADER_SIZE + length;
+    pack->frameCount++;
+    pack->sinceKey = (type == ANIM_FRAME_DELTA_SPANS) ? pack->sinceKey + 1 : 0;
+    memcpy(pack->previous, indices, NUM_LEDS);
+    return 1;
+}
+
+uint32_t AnimPack_Finish(anim_packer_t *pack) {
+    if (pack->failed || pack->frameCount == 0) {
+        return 0;
+    }
+
+    uint8_t *out = pack->out;
+    uint32_t paletteBytes = pack->paletteSize * 3U;
+
+    // Close the gap left for a full palette
+    memmove(out + ANIM_HEADER_SIZE + paletteBytes, out + STAGING_OFFSET, pack->size);
+    memcpy(out + ANIM_HEADER_SIZE, pack->palette, paletteBytes);
+
+    out[0] = 'A';
+    out[1] = 'N';
+    out[2] = 'I';
+    out[3] = 'M';
+    write16(&out[4], pack->frameCount);
+    write16(&out[6], NUM_LEDS);
+    write16(&out[8], pack->paletteSize);
+    out[10] = pack->flags;
+    out[11] = 0;
+
+    return ANIM_HEADER_SIZE + paletteBytes + pack->size;
+}
+
+uint32_t AnimPack_RatioX100(const anim_packer_t *pack) {
+    uint32_t size = ANIM_HEADER_SIZE + pack->paletteSize * 3U + pack->size;
+    return (uint32_t)(((uint64_t)pack->frameCount * NUM_LEDS * 3U * 100U) / size);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file anim_pack.h
+ * @brief Builds animation containers (see animation.h) from GRB frames.
+ *
+ * Plain C with no hardware access, for a PC tool that turns a frame dump
+ * into a const array, or for packing on the target. Colors go into the
+ * palette as they are first seen and each frame is stored as whichever of
+ * KEY_RAW, KEY_RLE or DELTA_SPANS is smallest, with a keyframe at least
+ * every keyInterval frames so a replay never walks far.
+ */
+#ifndef ANIM_PACK_H
+#define ANIM_PACK_H
+
+#include <stdint.h>
+#include "animation.h"
+#include "cube_config.h"
+
+typedef struct {
+    uint8_t *out;                           // Container being written
+    uint32_t capacity;
+    uint32_t size;                          // Frame bytes written so far
+    uint8_t palette[ANIM_PALETTE_MAX * 3];
+    uint16_t paletteSize;
+    uint8_t previous[NUM_LEDS];             // Indices of the last frame added
+    uint16_t frameCount;
+    uint16_t keyInterval;                   // Keyframe at least this often (0 = only the first)
+    uint16_t sinceKey;                      // Frames since the last keyframe
+    uint8_t flags;
+    uint8_t failed;                         // Out of space or palette entries
+} anim_packer_t;
+
+/**
+ * @brief Start a container in @p out.
+ *
+ * Frames are staged after room for a full palette, so @p capacity must
+ * cover ANIM_HEADER_SIZE + ANIM_PALETTE_MAX * 3 plus the frame data.
+ * @param flags ANIM_FLAG_* for the header.
+ */
+void AnimPack_Begin(anim_packer_t *pack, uint8_t *out, uint32_t capacity,
+                    uint16_t keyInterval, uint8_t flags);
+
+/**
+ * @brief Append one frame.
+ * @param frame      GRB frame in LED buffer order (NUM_LEDS * 3 bytes).
+ * @param durationMs How long to show it, 0 = one Animation_Draw() call.
+ * @return 1 on success, 0 if the container is full or the palette overflowed.
+ */
+int AnimPack_AddFrame(anim_packer_t *pack, const uint8_t *frame, uint16_t durationMs);
+
+/**
+ * @brief Write the header and palette and close up the frame data.
+ * @return Container size in bytes, or 0 if any frame failed.
+ */
+uint32_t AnimPack_Finish(anim_packer_t *pack);
+
+/**
+ * @brief Raw GRB size of the frames divided by the container size, times 100.
+ *
+ * Only meaningful after a successful AnimPack_Finish().
+ */
+uint32_t AnimPack_RatioX100(const anim_packer_t *pack);
+
+#endif // ANIM_PACK_H
@@ -0,0 +1,2149 @@
+/**
+ * @file anim_plasma.c
+ * @brief Baked 100-frame plasma loop for the flash animation player.
+ *
+ * Generated with AnimPack (anim_pack.h, key interval 10, ANIM_FLAG_LOOP)
+ * from the live plasma pattern built with PLASMA_FROM_FLASH 0 at
+ * brightness 1.0, one frame per update (test/bake_plasma.c), by make
+ * anim_plasma in test/. 34138 bytes, 121 palette entries, 3.01x smaller
+ * than the raw GRB frames. Do not edit by hand.
+ */
+
+#include <stdint.h>
+
+const uint8_t plasmaAnimation[] = {
+    0x41, 0x4E, 0x49, 0x4D, 0x64, 0x00, 0x57, 0x01, 0x79, 0x00, 0x01, 0x00, 0x23, 0x04, 0x28, 0x1D,
+    0x0A, 0x28, 0x1B, 0x0C, 0x28, 0x28, 0x03, 0x24, 0x16, 0x11, 0x28, 0x14, 0x13, 0x28, 0x11, 0x16,
+    0x28, 0x0F, 0x18, 0x28, 0x0E, 0x19, 0x28, 0x28, 0x04, 0x23, 0x0C, 0x1B, 0x28, 0x0A, 0x1D, 0x28,
+    0x10, 0x17, 0x28, 0x0B, 0x1C, 0x28, 0x09, 0x1E, 0x28, 0x1E, 0x09, 0x28, 0x1C, 0x0B, 0x28, 0x0D,
+    0x1A, 0x28, 0x15, 0x12, 0x28, 0x12, 0x15, 0x28, 0x17, 0x10, 0x28, 0x24, 0x03, 0x28, 0x00, 0x00,
+    0x00, 0x21, 0x06, 0x28, 0x19, 0x0E, 0x28, 0x1A, 0x0D, 0x28, 0x20, 0x07, 0x28, 0x28, 0x00, 0x27,
+    0x18, 0x0F, 0x28, 0x13, 0x14, 0x28, 0x22, 0x05, 0x28, 0x28, 0x05, 0x22, 0x08, 0x1F, 0x28, 0x07,
+    0x20, 0x28, 0x1F, 0x08, 0x28, 0x25, 0x02, 0x28, 0x26, 0x01, 0x28, 0x28, 0x06, 0x21, 0x28, 0x08,
+    0x1F, 0x28, 0x07, 0x20, 0x06, 0x21, 0x28, 0x05, 0x22, 0x28, 0x27, 0x00, 0x28, 0x28, 0x0D, 0x1A,
+    0x28, 0x01, 0x26, 0x28, 0x09, 0x1E, 0x28, 0x02, 0x25, 0x04, 0x23, 0x28, 0x28, 0x0A, 0x1D, 0x28,
+    0x11, 0x16, 0x28, 0x0C, 0x1B, 0x03, 0x24, 0x28, 0x02, 0x25, 0x28, 0x28, 0x0B, 0x1C, 0x28, 0x15,
+    0x12, 0x28, 0x0E, 0x19, 0x01, 0x26, 0x28, 0x28, 0x10, 0x17, 0x28, 0x19, 0x0E, 0x28, 0x14, 0x13,
+    0x28, 0x0F, 0x18, 0x28, 0x1E, 0x09, 0x28, 0x13, 0x14, 0x00, 0x27, 0x28, 0x28, 0x18, 0x0F, 0x28,
+    0x22, 0x05, 0x28, 0x16, 0x11, 0x28, 0x1C, 0x0B, 0x28, 0x12, 0x15, 0x28, 0x26, 0x01, 0x28, 0x17,
+    0x10, 0x28, 0x21, 0x06, 0x28, 0x20, 0x07, 0x26, 0x28, 0x00, 0x28, 0x1F, 0x08, 0x28, 0x1A, 0x0D,
+    0x28, 0x1B, 0x0C, 0x28, 0x25, 0x02, 0x28, 0x24, 0x03, 0x22, 0x28, 0x00, 0x28, 0x23, 0x04, 0x27,
+    0x28, 0x00, 0x28, 0x1D, 0x0A, 0x28, 0x27, 0x00, 0x1F, 0x28, 0x00, 0x23, 0x28, 0x00, 0x24, 0x28,
+    0x00, 0x1B, 0x28, 0x00, 0x25, 0x28, 0x00, 0x21, 0x28, 0x00, 0x18, 0x28, 0x00, 0x1C, 0x28, 0x00,
+    0x1E, 0x28, 0x00, 0x16, 0x28, 0x00, 0x20, 0x28, 0x00, 0x19, 0x28, 0x00, 0x13, 0x28, 0x00, 0x1D,
+    0x28, 0x00, 0x11, 0x28, 0x00, 0x1A, 0x28, 0x00, 0x0F, 0x28, 0x00, 0x17, 0x28, 0x00, 0x14, 0x28,
+    0x00, 0x0D, 0x28, 0x00, 0x15, 0x28, 0x00, 0x12, 0x28, 0x00, 0x0C, 0x28, 0x00, 0x10, 0x28, 0x00,
+    0x0B, 0x28, 0x00, 0x0E, 0x28, 0x00, 0x0A, 0x28, 0x00, 0x09, 0x28, 0x00, 0x08, 0x28, 0x00, 0x07,
+    0x28, 0x00, 0x06, 0x28, 0x00, 0x05, 0x28, 0x00, 0x04, 0x28, 0x00, 0x03, 0x28, 0x00, 0x02, 0x28,
+    0x00, 0x01, 0x28, 0x00, 0x00, 0x28, 0x00, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x01, 0x02, 0x01,
+    0x00, 0x03, 0x00, 0x02, 0x04, 0x05, 0x04, 0x02, 0x00, 0x01, 0x04, 0x06, 0x07, 0x06, 0x04, 0x01,
+    0x02, 0x05, 0x07, 0x08, 0x07, 0x05, 0x02, 0x01, 0x04, 0x06, 0x07, 0x06, 0x04, 0x01, 0x00, 0x02,
+    0x04, 0x05, 0x04, 0x02, 0x00, 0x03, 0x00, 0x01, 0x02, 0x01, 0x00, 0x09, 0x00, 0x02, 0x04, 0x05,
+    0x04, 0x02, 0x00, 0x02, 0x05, 0x07, 0x08, 0x07, 0x05, 0x02, 0x04, 0x07, 0x0A, 0x0B, 0x0A, 0x0C,
+    0x04, 0x05, 0x08, 0x0D, 0x0B, 0x0B, 0x08, 0x05, 0x04, 0x07, 0x0A, 0x0D, 0x0A, 0x0C, 0x04, 0x02,
+    0x05, 0x0C, 0x08, 0x07, 0x05, 0x02, 0x00, 0x02, 0x04, 0x05, 0x04, 0x02, 0x00, 0x01, 0x04, 0x06,
+    0x07, 0x06, 0x04, 0x01, 0x04, 0x0C, 0x0A, 0x0A, 0x07, 0x04, 0x06, 0x0A, 0x0E, 0x0E, 0x0E, 0x0A,
+    0x06, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x07, 0x06, 0x0A, 0x0E, 0x0E, 0x0B, 0x0A, 0x06, 0x04,
+    0x0C, 0x0A, 0x0D, 0x0A, 0x0C, 0x04, 0x01, 0x04, 0x06, 0x0C, 0x06, 0x04, 0x0F, 0x02, 0x05, 0x07,
+    0x08, 0x0C, 0x05, 0x10, 0x05, 0x08, 0x0D, 0x08, 0x05, 0x07, 0x0D, 0x0E, 0x0E, 0x0E, 0x0D, 0x0C,
+    0x08, 0x0B, 0x0B, 0x11, 0x0E, 0x0B, 0x08, 0x0C, 0x0D, 0x0E, 0x0B, 0x0E, 0x0D, 0x0C, 0x12, 0x07,
+    0x0D, 0x0B, 0x0D, 0x08, 0x05, 0x10, 0x05, 0x0C, 0x08, 0x0C, 0x12, 0x10, 0x0F, 0x04, 0x06, 0x0C,
+    0x06, 0x04, 0x0F, 0x04, 0x0C, 0x0A, 0x0A, 0x0C, 0x04, 0x06, 0x0A, 0x0B, 0x0B, 0x0A, 0x13, 0x0C,
+    0x0D, 0x0B, 0x0B, 0x0D, 0x0C, 0x06, 0x0A, 0x0B, 0x0B, 0x0B, 0x0A, 0x13, 0x14, 0x0C, 0x0A, 0x0D,
+    0x0A, 0x0C, 0x04, 0x0F, 0x04, 0x13, 0x0C, 0x13, 0x14, 0x0F, 0x00, 0x02, 0x04, 0x12, 0x04, 0x10,
+    0x15, 0x10, 0x12, 0x0C, 0x07, 0x0C, 0x05, 0x02, 0x04, 0x0C, 0x0A, 0x0D, 0x0A, 0x0C, 0x14, 0x12,
+    0x07, 0x0D, 0x0B, 0x0D, 0x07, 0x12, 0x04, 0x0C, 0x0A, 0x0D, 0x11, 0x0C, 0x14, 0x10, 0x12, 0x0C,
+    0x07, 0x0C, 0x12, 0x10, 0x15, 0x10, 0x14, 0x12, 0x14, 0x10, 0x15, 0x09, 0x00, 0x0F, 0x10, 0x0F,
+    0x15, 0x09, 0x15, 0x10, 0x14, 0x12, 0x04, 0x10, 0x00, 0x0F, 0x04, 0x13, 0x0C, 0x13, 0x14, 0x0F,
+    0x10, 0x12, 0x0C, 0x07, 0x0C, 0x12, 0x10, 0x0F, 0x14, 0x13, 0x0C, 0x13, 0x14, 0x0F, 0x15, 0x10,
+    0x14, 0x12, 0x14, 0x10, 0x15, 0x09, 0x15, 0x0F, 0x10, 0x0F, 0x15, 0x09, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x1A, 0x17, 0x02, 0x18, 0x19, 0x1A,
+    0x1B, 0x1A, 0x1C, 0x1D, 0x06, 0x05, 0x18, 0x17, 0x10, 0x05, 0x07, 0x11, 0x08, 0x1D, 0x02, 0x18,
+    0x13, 0x11, 0x0A, 0x08, 0x1D, 0x1D, 0x00, 0x08, 0x0C, 0x08, 0x0C, 0x05, 0x10, 0x1E, 0x19, 0x12,
+    0x28, 0x00, 0x04, 0x15, 0x1F, 0x15, 0x0F, 0x2F, 0x00, 0x1C, 0x03, 0x1E, 0x18, 0x05, 0x06, 0x1D,
+    0x1C, 0x1A, 0x1C, 0x06, 0x11, 0x0D, 0x11, 0x13, 0x19, 0x12, 0x08, 0x0B, 0x20, 0x0E, 0x11, 0x1D,
+    0x13, 0x0A, 0x0E, 0x20, 0x0E, 0x11, 0x4E, 0x00, 0x08, 0x0D, 0x0E, 0x0B, 0x08, 0x12, 0x19, 0x1D,
+    0x07, 0x59, 0x00, 0x03, 0x10, 0x15, 0x10, 0x62, 0x00, 0x23, 0x12, 0x07, 0x11, 0x07, 0x1D, 0x02,
+    0x05, 0x11, 0x0E, 0x0B, 0x08, 0x12, 0x06, 0x0D, 0x20, 0x21, 0x21, 0x0B, 0x07, 0x08, 0x0E, 0x21,
+    0x20, 0x20, 0x0B, 0x07, 0x13, 0x0A, 0x0E, 0x20, 0x20, 0x0D, 0x0C, 0x04, 0x07, 0x89, 0x00, 0x04,
+    0x14, 0x22, 0x14, 0x13, 0x94, 0x00, 0x13, 0x11, 0x08, 0x1D, 0x19, 0x1D, 0x0A, 0x0B, 0x08, 0x05,
+    0x0C, 0x0D, 0x20, 0x20, 0x20, 0x0E, 0x08, 0x11, 0x0E, 0x20, 0xAA, 0x00, 0x05, 0x07, 0x06, 0x0A,
+    0x0B, 0x0E, 0xB5, 0x00, 0x42, 0x0D, 0x0A, 0x0C, 0x04, 0x0F, 0x04, 0x06, 0x07, 0x06, 0x12, 0x01,
+    0x0F, 0x14, 0x06, 0x07, 0x06, 0x12, 0x01, 0x12, 0x07, 0x0D, 0x0A, 0x0C, 0x14, 0x13, 0x11, 0x0B,
+    0x0E, 0x0D, 0x06, 0x0C, 0x0D, 0x0E, 0x0B, 0x0A, 0x06, 0x05, 0x08, 0x0D, 0x0B, 0x0B, 0x11, 0x13,
+    0x1C, 0x06, 0x11, 0x11, 0x08, 0x13, 0x18, 0x17, 0x18, 0x05, 0x13, 0x1D, 0x1C, 0x1A, 0x23, 0x01,
+    0x14, 0x12, 0x04, 0x02, 0x00, 0x02, 0x05, 0xFA, 0x00, 0x05, 0x12, 0x01, 0x1C, 0x06, 0x11, 0x05,
+    0x01, 0x1E, 0x0A, 0x0D, 0x0A, 0x0C, 0x14, 0x18, 0x1D, 0x08, 0x11, 0x08, 0x06, 0x1C, 0x0F, 0x04,
+    0x13, 0x06, 0x1D, 0x1C, 0x22, 0x1B, 0x22, 0x19, 0x14, 0x18, 0x0F, 0x24, 0x25, 0x23, 0x22, 0x01,
+    0x2A, 0x01, 0x26, 0x14, 0x01, 0x23, 0x1A, 0x1C, 0x1D, 0x06, 0x13, 0x14, 0x22, 0x01, 0x04, 0x06,
+    0x0C, 0x13, 0x14, 0x22, 0x17, 0x18, 0x05, 0x13, 0x1D, 0x1C, 0x1A, 0x24, 0x0F, 0x18, 0x14, 0x19,
+    0x22, 0x1B, 0x26, 0x1B, 0x1E, 0x22, 0x17, 0x24, 0x27, 0x03, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00,
+    0x2B, 0x1A, 0x18, 0x04, 0x1C, 0x01, 0x24, 0x01, 0x12, 0x0C, 0x07, 0x13, 0x1C, 0x1A, 0x10, 0x1D,
+    0x08, 0x0D, 0x0A, 0x06, 0x1C, 0x14, 0x0C, 0x0D, 0x0D, 0x11, 0x1D, 0x02, 0x0F, 0x04, 0x0C, 0x11,
+    0x08, 0x1D, 0x02, 0x17, 0x18, 0x05, 0x1D, 0x04, 0x10, 0x23, 0x25, 0x23, 0x2E, 0x00, 0x1F, 0x1E,
+    0x03, 0x17, 0x1C, 0x13, 0x07, 0x0C, 0x12, 0x01, 0x04, 0x08, 0x0B, 0x0E, 0x0A, 0x06, 0x18, 0x05,
+    0x11, 0x20, 0x28, 0x21, 0x0B, 0x06, 0x0C, 0x0B, 0x21, 0x28, 0x20, 0x11, 0x05, 0x14, 0x50, 0x00,
+    0x2E, 0x0E, 0x11, 0x1D, 0x19, 0x13, 0x08, 0x11, 0x0C, 0x12, 0x01, 0x24, 0x01, 0x14, 0x05, 0x12,
+    0x19, 0x1E, 0x10, 0x05, 0x08, 0x0A, 0x11, 0x06, 0x18, 0x06, 0x0D, 0x21, 0x0E, 0x11, 0x12, 0x0C,
+    0x0B, 0x21, 0x29, 0x29, 0x20, 0x11, 0x11, 0x21, 0x28, 0x21, 0x21, 0x0B, 0x0C, 0x1D, 0x11, 0x81,
+    0x00, 0x01, 0x0B, 0x85, 0x00, 0x17, 0x0D, 0x0D, 0x11, 0x13, 0x18, 0x17, 0x18, 0x1D, 0x06, 0x13,
+    0x04, 0x0F, 0x10, 0x05, 0x08, 0x0A, 0x11, 0x06, 0x1C, 0x06, 0x0D, 0x0E, 0x11, 0xA0, 0x00, 0x11,
+    0x21, 0x28, 0x20, 0x11, 0x11, 0x20, 0x20, 0x0A, 0x0E, 0x0D, 0x0C, 0x1D, 0x11, 0x0B, 0x0B, 0x0E,
+    0x0B, 0xB4, 0x00, 0x0D, 0x0A, 0x0D, 0x11, 0x13, 0x18, 0x17, 0x18, 0x1D, 0x06, 0x13, 0x04, 0x0F,
+    0x22, 0xC4, 0x00, 0x0F, 0x0C, 0x05, 0x10, 0x12, 0x08, 0x0B, 0x0A, 0x06, 0x1C, 0x05, 0x08, 0x0B,
+    0x20, 0x0D, 0x0C, 0xD7, 0x00, 0x1A, 0x11, 0x1D, 0x04, 0x0C, 0x0A, 0x0D, 0x0D, 0x11, 0x1D, 0x18,
+    0x13, 0x07, 0x08, 0x0C, 0x12, 0x10, 0x15, 0x10, 0x04, 0x05, 0x12, 0x18, 0x17, 0x24, 0x0F, 0x1C,
+    0xF9, 0x00, 0x07, 0x06, 0x14, 0x22, 0x19, 0x1D, 0x08, 0x0A, 0x03, 0x01, 0x21, 0x04, 0x0C, 0x0A,
+    0x0A, 0x08, 0x13, 0x18, 0x10, 0x12, 0x0C, 0x08, 0x07, 0x13, 0x18, 0x1A, 0x1C, 0x05, 0x1D, 0x04,
+    0x02, 0x00, 0x03, 0x00, 0x01, 0x19, 0x02, 0x1A, 0x1B, 0x26, 0x2A, 0x1A, 0x01, 0x22, 0x29, 0x01,
+    0x27, 0x04, 0x18, 0x22, 0x2A, 0x1E, 0x19, 0x05, 0x13, 0x1D, 0x14, 0x22, 0x0F, 0x14, 0x13, 0x06,
+    0x05, 0x18, 0x17, 0x23, 0x01, 0x14, 0x05, 0x12, 0x19, 0x1E, 0x1B, 0x1A, 0x02, 0x19, 0x01, 0x00,
+    0x09, 0x2B, 0x09, 0x23, 0x1E, 0x15, 0x2C, 0x2D, 0x03, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x1C,
+    0x22, 0x1C, 0x05, 0x12, 0x19, 0x00, 0x02, 0x1D, 0x08, 0x11, 0x0C, 0x14, 0x1A, 0x02, 0x1D, 0x0A,
+    0x0E, 0x0B, 0x08, 0x04, 0x04, 0x08, 0x0B, 0x0E, 0x0A, 0x13, 0x02, 0x22, 0x1F, 0x00, 0x03, 0x11,
+    0x13, 0x19, 0x27, 0x00, 0x22, 0x01, 0x24, 0x27, 0x24, 0x22, 0x10, 0x01, 0x1E, 0x2E, 0x1A, 0x14,
+    0x06, 0x11, 0x08, 0x1D, 0x02, 0x1D, 0x0A, 0x20, 0x21, 0x0B, 0x0C, 0x1C, 0x05, 0x0A, 0x21, 0x29,
+    0x29, 0x20, 0x07, 0x07, 0x20, 0x29, 0x29, 0x4C, 0x00, 0x08, 0x1C, 0x0C, 0x0D, 0x20, 0x20, 0x0A,
+    0x1D, 0x18, 0x58, 0x00, 0x07, 0x04, 0x0F, 0x2A, 0x22, 0x1C, 0x12, 0x04, 0x62, 0x00, 0x2E, 0x1D,
+    0x11, 0x0B, 0x0D, 0x07, 0x14, 0x0C, 0x0E, 0x29, 0x20, 0x11, 0x12, 0x06, 0x0B, 0x28, 0x2F, 0x2F,
+    0x28, 0x0A, 0x0A, 0x28, 0x29, 0x28, 0x21, 0x0B, 0x06, 0x05, 0x08, 0x0B, 0x20, 0x21, 0x0E, 0x07,
+    0x04, 0x07, 0x0A, 0x0D, 0x08, 0x1D, 0x02, 0x00, 0x02, 0x12, 0x13, 0x13, 0x14, 0x94, 0x00, 0x0A,
+    0x0D, 0x0D, 0x0C, 0x14, 0x0C, 0x0E, 0x0E, 0x08, 0x12, 0x06, 0xA1, 0x00, 0x0D, 0x29, 0x21, 0x0A,
+    0x0A, 0x21, 0x21, 0x0A, 0x0B, 0x0A, 0x06, 0x12, 0x07, 0x0D, 0xB2, 0x00, 0x20, 0x04, 0x0C, 0x11,
+    0x11, 0x07, 0x05, 0x02, 0x15, 0x02, 0x12, 0x13, 0x1D, 0x14, 0x22, 0x17, 0x1C, 0x13, 0x07, 0x07,
+    0x05, 0x10, 0x05, 0x11, 0x0B, 0x0A, 0x13, 0x18, 0x12, 0x07, 0x0D, 0x20, 0x0B, 0xD6, 0x00, 0x1C,
+    0x0D, 0x07, 0x12, 0x18, 0x13, 0x08, 0x0A, 0x0A, 0x08, 0x05, 0x19, 0x05, 0x0C, 0x0C, 0x1D, 0x1C,
+    0x22, 0x1B, 0x22, 0x18, 0x04, 0x14, 0x02, 0x00, 0x1B, 0x22, 0x18, 0x04, 0xF9, 0x00, 0x2A, 0x13,
+    0x1C, 0x1A, 0x10, 0x12, 0x07, 0x11, 0x11, 0x0C, 0x14, 0x14, 0x0C, 0x11, 0x11, 0x0C, 0x12, 0x10,
+    0x1A, 0x1C, 0x1D, 0x0C, 0x0C, 0x05, 0x02, 0x1E, 0x19, 0x04, 0x04, 0x1C, 0x0F, 0x2A, 0x26, 0x2A,
+    0x1A, 0x01, 0x0F, 0x1E, 0x03, 0x30, 0x1B, 0x17, 0x0F, 0x29, 0x01, 0x27, 0x14, 0x19, 0x1A, 0x2C,
+    0x23, 0x10, 0x04, 0x1D, 0x05, 0x1C, 0x1A, 0x22, 0x1C, 0x05, 0x1D, 0x04, 0x10, 0x15, 0x1B, 0x1A,
+    0x19, 0x14, 0x14, 0x10, 0x00, 0x03, 0x1E, 0x0F, 0x01, 0x1A, 0x2A, 0x26, 0x31, 0x26, 0x2C, 0x23,
+    0x24, 0x03, 0x32, 0x03, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x17, 0x0F, 0x04, 0x1D, 0x1D, 0x1C,
+    0x1A, 0x1C, 0x0C, 0x0A, 0x0D, 0x07, 0x04, 0x22, 0x02, 0x13, 0x0D, 0x20, 0x20, 0x0A, 0x05, 0x05,
+    0x11, 0x0E, 0x1B, 0x00, 0x02, 0x1A, 0x14, 0x20, 0x00, 0x1D, 0x06, 0x18, 0x1A, 0x1C, 0x05, 0x1D,
+    0x14, 0x0F, 0x2A, 0x2D, 0x2A, 0x1A, 0x10, 0x01, 0x17, 0x2E, 0x1A, 0x04, 0x07, 0x0A, 0x0A, 0x06,
+    0x18, 0x06, 0x0B, 0x28, 0x28, 0x0E, 0x07, 0x40, 0x00, 0x0E, 0x28, 0x33, 0x33, 0x28, 0x11, 0x08,
+    0x21, 0x2F, 0x2F, 0x21, 0x11, 0x05, 0x18, 0x06, 0x51, 0x00, 0x02, 0x0D, 0x13, 0x56, 0x00, 0x07,
+    0x08, 0x06, 0x14, 0x1A, 0x2C, 0x1A, 0x18, 0x64, 0x00, 0x08, 0x0E, 0x0E, 0x08, 0x12, 0x08, 0x21,
+    0x2F, 0x21, 0x71, 0x00, 0x0D, 0x33, 0x34, 0x2F, 0x0B, 0x0D, 0x29, 0x2F, 0x28, 0x21, 0x0D, 0x13,
+    0x04, 0x07, 0x86, 0x00, 0x1D, 0x0A, 0x07, 0x12, 0x01, 0x24, 0x01, 0x04, 0x1D, 0x1D, 0x14, 0x22,
+    0x01, 0x05, 0x08, 0x0B, 0x0D, 0x07, 0x04, 0x07, 0x20, 0x0E, 0x08, 0x04, 0x13, 0x0A, 0x20, 0x28,
+    0x29, 0x28, 0xA9, 0x00, 0x1E, 0x11, 0x1D, 0x14, 0x0C, 0x11, 0x0D, 0x0E, 0x0D, 0x0C, 0x14, 0x06,
+    0x08, 0x08, 0x06, 0x04, 0x0F, 0x2A, 0x0F, 0x1C, 0x05, 0x05, 0x1C, 0x1A, 0x1E, 0x18, 0x1D, 0x07,
+    0x07, 0x1D, 0x02, 0xCA, 0x00, 0x06, 0x11, 0x1D, 0x02, 0x14, 0x0C, 0x0A, 0xD3, 0x00, 0x7D, 0x06,
+    0x0D, 0x0B, 0x0D, 0x06, 0x1C, 0x10, 0x12, 0x0C, 0x08, 0x11, 0x07, 0x12, 0x10, 0x12, 0x13, 0x13,
+    0x12, 0x02, 0x00, 0x09, 0x00, 0x10, 0x18, 0x18, 0x01, 0x23, 0x2E, 0x17, 0x19, 0x04, 0x14, 0x02,
+    0x00, 0x10, 0x05, 0x0C, 0x0C, 0x1D, 0x19, 0x1E, 0x22, 0x14, 0x06, 0x08, 0x08, 0x06, 0x1C, 0x1C,
+    0x06, 0x07, 0x07, 0x13, 0x14, 0x22, 0x00, 0x02, 0x12, 0x13, 0x13, 0x12, 0x10, 0x15, 0x10, 0x1C,
+    0x1C, 0x10, 0x1E, 0x03, 0x32, 0x03, 0x15, 0x1A, 0x1A, 0x23, 0x1F, 0x35, 0x2E, 0x00, 0x22, 0x22,
+    0x15, 0x1F, 0x23, 0x01, 0x1C, 0x1C, 0x02, 0x1E, 0x03, 0x2A, 0x22, 0x1C, 0x05, 0x12, 0x18, 0x17,
+    0x17, 0x18, 0x12, 0x12, 0x1C, 0x22, 0x1B, 0x09, 0x00, 0x01, 0x18, 0x18, 0x01, 0x23, 0x1F, 0x23,
+    0x1A, 0x1A, 0x15, 0x03, 0x32, 0x36, 0x32, 0x09, 0x2C, 0x2C, 0x25, 0x37, 0x03, 0x00, 0x00, 0x46,
+    0x01, 0x00, 0x00, 0x0C, 0x01, 0x12, 0x06, 0x06, 0x04, 0x0F, 0x04, 0x08, 0x0B, 0x0B, 0x08, 0x12,
+    0x10, 0x00, 0x12, 0x21, 0x21, 0x0D, 0x13, 0x1D, 0x0A, 0x20, 0x20, 0x0A, 0x1D, 0x10, 0x17, 0x1C,
+    0x0C, 0x11, 0x0A, 0x0C, 0x1C, 0x25, 0x00, 0x08, 0x05, 0x1C, 0x22, 0x2C, 0x30, 0x2C, 0x17, 0x01,
+    0x30, 0x00, 0x0C, 0x22, 0x04, 0x07, 0x0B, 0x0B, 0x07, 0x14, 0x07, 0x20, 0x2F, 0x2F, 0x20, 0x41,
+    0x00, 0x07, 0x34, 0x34, 0x29, 0x0A, 0x11, 0x28, 0x33, 0x4B, 0x00, 0x06, 0x12, 0x19, 0x13, 0x0A,
+    0x20, 0x21, 0x57, 0x00, 0x14, 0x13, 0x18, 0x1E, 0x03, 0x1E, 0x19, 0x04, 0x04, 0x02, 0x00, 0x10,
+    0x1D, 0x0A, 0x20, 0x20, 0x0A, 0x05, 0x11, 0x28, 0x33, 0x6E, 0x00, 0x06, 0x13, 0x0D, 0x28, 0x33,
+    0x38, 0x33, 0x78, 0x00, 0x07, 0x29, 0x20, 0x0A, 0x1D, 0x1C, 0x0C, 0x0D, 0x83, 0x00, 0x22, 0x14,
+    0x0C, 0x11, 0x11, 0x06, 0x14, 0x22, 0x1B, 0x22, 0x1C, 0x05, 0x05, 0x1C, 0x1A, 0x0F, 0x12, 0x08,
+    0x0B, 0x0B, 0x08, 0x04, 0x08, 0x20, 0x0E, 0x07, 0x14, 0x05, 0x11, 0x0E, 0x28, 0x2F, 0x28, 0x0D,
+    0x11, 0xA8, 0x00, 0x1C, 0x0D, 0x07, 0x12, 0x19, 0x1D, 0x08, 0x0A, 0x0B, 0x0D, 0x06, 0x1C, 0x13,
+    0x07, 0x0C, 0x1D, 0x18, 0x17, 0x2E, 0x17, 0x19, 0x04, 0x04, 0x19, 0x17, 0x15, 0x02, 0x05, 0x0C,
+    0xCA, 0x00, 0x28, 0x08, 0x05, 0x10, 0x18, 0x13, 0x11, 0x0E, 0x0D, 0x06, 0x13, 0x0A, 0x0D, 0x11,
+    0x1D, 0x19, 0x22, 0x1C, 0x1D, 0x0C, 0x08, 0x0C, 0x04, 0x0F, 0x14, 0x05, 0x05, 0x1C, 0x0F, 0x24,
+    0x26, 0x24, 0x22, 0x02, 0x02, 0x22, 0x2A, 0x09, 0x00, 0x02, 0x14, 0xF7, 0x00, 0x2E, 0x06, 0x06,
+    0x12, 0x10, 0x15, 0x17, 0x18, 0x1D, 0x07, 0x08, 0x13, 0x18, 0x18, 0x1D, 0x0C, 0x06, 0x05, 0x19,
+    0x1E, 0x2A, 0x22, 0x1C, 0x12, 0x05, 0x14, 0x0F, 0x24, 0x22, 0x02, 0x02, 0x22, 0x24, 0x27, 0x39,
+    0x27, 0x2A, 0x00, 0x00, 0x2A, 0x27, 0x2B, 0x09, 0x15, 0x1A, 0x1A, 0x23, 0x28, 0x01, 0x28, 0x18,
+    0x18, 0x01, 0x15, 0x25, 0x2E, 0x17, 0x19, 0x04, 0x04, 0x19, 0x17, 0x1E, 0x02, 0x14, 0x14, 0x02,
+    0x1E, 0x03, 0x26, 0x2A, 0x1A, 0x10, 0x02, 0x22, 0x2A, 0x27, 0x2A, 0x00, 0x00, 0x2A, 0x25, 0x39,
+    0x3A, 0x39, 0x26, 0x09, 0x09, 0x2D, 0x31, 0x03, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x17, 0x10,
+    0x05, 0x0C, 0x07, 0x1D, 0x10, 0x05, 0x0A, 0x20, 0x0E, 0x11, 0x12, 0x0F, 0x02, 0x13, 0x0B, 0x28,
+    0x29, 0x0E, 0x06, 0x13, 0x0D, 0x21, 0x1B, 0x00, 0x03, 0x1E, 0x18, 0x06, 0x26, 0x00, 0x07, 0x18,
+    0x17, 0x2E, 0x32, 0x2E, 0x1E, 0x0F, 0x32, 0x00, 0x09, 0x08, 0x0E, 0x0E, 0x11, 0x12, 0x08, 0x28,
+    0x33, 0x33, 0x3E, 0x00, 0x01, 0x12, 0x42, 0x00, 0x33, 0x38, 0x2F, 0x0D, 0x0A, 0x29, 0x33, 0x2F,
+    0x20, 0x08, 0x04, 0x10, 0x1D, 0x0A, 0x20, 0x20, 0x0B, 0x06, 0x19, 0x13, 0x07, 0x07, 0x1D, 0x02,
+    0x15, 0x1F, 0x15, 0x10, 0x14, 0x14, 0x02, 0x00, 0x01, 0x05, 0x0A, 0x20, 0x21, 0x0D, 0x1D, 0x0A,
+    0x29, 0x34, 0x21, 0x11, 0x04, 0x1D, 0x0D, 0x28, 0x34, 0x38, 0x33, 0x0E, 0x78, 0x00, 0x4D, 0x28,
+    0x20, 0x11, 0x12, 0x19, 0x13, 0x11, 0x0E, 0x20, 0x0B, 0x0C, 0x1C, 0x06, 0x08, 0x07, 0x1D, 0x18,
+    0x1E, 0x03, 0x1E, 0x19, 0x04, 0x12, 0x18, 0x17, 0x22, 0x04, 0x07, 0x0B, 0x0B, 0x11, 0x12, 0x08,
+    0x21, 0x0B, 0x0C, 0x1C, 0x04, 0x08, 0x0E, 0x21, 0x2F, 0x28, 0x0A, 0x11, 0x20, 0x20, 0x11, 0x11,
+    0x0C, 0x14, 0x01, 0x12, 0x0C, 0x11, 0x0D, 0x0A, 0x13, 0x19, 0x1D, 0x06, 0x13, 0x04, 0x10, 0x15,
+    0x1F, 0x15, 0x01, 0x1C, 0x1C, 0x10, 0x00, 0x23, 0x10, 0x12, 0x0C, 0x0C, 0xCA, 0x00, 0x06, 0x07,
+    0x04, 0x0F, 0x10, 0x05, 0x08, 0xD3, 0x00, 0x7D, 0x1D, 0x11, 0x0A, 0x08, 0x04, 0x01, 0x1E, 0x02,
+    0x12, 0x13, 0x0C, 0x13, 0x1C, 0x1A, 0x18, 0x04, 0x14, 0x02, 0x1E, 0x2E, 0x35, 0x2E, 0x00, 0x0F,
+    0x0F, 0x1E, 0x2C, 0x25, 0x15, 0x01, 0x1C, 0x1C, 0x10, 0x15, 0x01, 0x12, 0x13, 0x13, 0x04, 0x0F,
+    0x2A, 0x15, 0x02, 0x12, 0x06, 0x0C, 0x1D, 0x19, 0x02, 0x05, 0x13, 0x1D, 0x04, 0x01, 0x23, 0x03,
+    0x1E, 0x02, 0x14, 0x04, 0x18, 0x1A, 0x1B, 0x17, 0x01, 0x0F, 0x1E, 0x2E, 0x35, 0x3B, 0x35, 0x03,
+    0x24, 0x24, 0x2E, 0x30, 0x3C, 0x25, 0x24, 0x17, 0x17, 0x23, 0x1F, 0x24, 0x0F, 0x19, 0x19, 0x22,
+    0x24, 0x26, 0x1F, 0x00, 0x10, 0x1C, 0x14, 0x02, 0x00, 0x15, 0x10, 0x18, 0x18, 0x0F, 0x23, 0x25,
+    0x32, 0x2E, 0x00, 0x0F, 0x0F, 0x1E, 0x2C, 0x30, 0x2E, 0x24, 0x24, 0x03, 0x30, 0x3B, 0x3D, 0x3B,
+    0x32, 0x27, 0x27, 0x35, 0x3E, 0x03, 0x00, 0x00, 0x49, 0x01, 0x01, 0x00, 0x09, 0x1D, 0x08, 0x08,
+    0x13, 0x19, 0x13, 0x0D, 0x21, 0x20, 0x0D, 0x00, 0x09, 0x10, 0x13, 0x0B, 0x29, 0x29, 0x20, 0x0C,
+    0x13, 0x0B, 0x19, 0x00, 0x05, 0x05, 0x01, 0x00, 0x19, 0x13, 0x21, 0x00, 0x0E, 0x14, 0x1A, 0x1C,
+    0x12, 0x12, 0x19, 0x1E, 0x09, 0x37, 0x09, 0x15, 0x22, 0x0F, 0x1E, 0x34, 0x00, 0x11, 0x20, 0x0A,
+    0x1D, 0x0A, 0x29, 0x34, 0x33, 0x21, 0x07, 0x1C, 0x04, 0x11, 0x28, 0x38, 0x3F, 0x33, 0x0B, 0x4A,
+    0x00, 0x18, 0x07, 0x1C, 0x0F, 0x12, 0x08, 0x0E, 0x20, 0x0D, 0x13, 0x19, 0x1D, 0x07, 0x0C, 0x12,
+    0x01, 0x24, 0x27, 0x24, 0x0F, 0x18, 0x1C, 0x10, 0x15, 0x0F, 0x66, 0x00, 0x0E, 0x0B, 0x13, 0x0D,
+    0x2F, 0x38, 0x21, 0x08, 0x14, 0x12, 0x11, 0x28, 0x33, 0x38, 0x34, 0x79, 0x00, 0x07, 0x0B, 0x07,
+    0x14, 0x10, 0x05, 0x08, 0x0B, 0x83, 0x00, 0x12, 0x18, 0x13, 0x07, 0x0C, 0x12, 0x10, 0x23, 0x25,
+    0x15, 0x01, 0x1C, 0x14, 0x19, 0x1E, 0x17, 0x14, 0x0C, 0x0D, 0x9A, 0x00, 0x59, 0x0D, 0x06, 0x19,
+    0x1C, 0x0C, 0x0D, 0x21, 0x29, 0x28, 0x0A, 0x08, 0x0E, 0x20, 0x08, 0x08, 0x1D, 0x19, 0x1A, 0x1C,
+    0x13, 0x07, 0x11, 0x08, 0x05, 0x10, 0x12, 0x13, 0x05, 0x1C, 0x22, 0x1B, 0x2D, 0x2A, 0x1A, 0x02,
+    0x19, 0x01, 0x23, 0x2A, 0x0F, 0x04, 0x06, 0x0C, 0x05, 0x02, 0x12, 0x08, 0x0D, 0x06, 0x1C, 0x17,
+    0x0F, 0x04, 0x0C, 0x0B, 0x0A, 0x13, 0x05, 0x08, 0x11, 0x0C, 0x18, 0x1A, 0x24, 0x0F, 0x1C, 0x05,
+    0x13, 0x05, 0x19, 0x1E, 0x02, 0x18, 0x19, 0x0F, 0x23, 0x25, 0x3C, 0x25, 0x24, 0x17, 0x1A, 0x15,
+    0x09, 0x26, 0x24, 0x0F, 0x19, 0x18, 0xF6, 0x00, 0x5A, 0x04, 0x1D, 0x05, 0x1C, 0x1A, 0x2C, 0x2A,
+    0x0F, 0x14, 0x13, 0x06, 0x05, 0x02, 0x01, 0x04, 0x1D, 0x12, 0x18, 0x1A, 0x2C, 0x25, 0x24, 0x0F,
+    0x19, 0x18, 0x02, 0x1E, 0x03, 0x00, 0x1A, 0x17, 0x24, 0x1F, 0x3C, 0x40, 0x3C, 0x27, 0x2E, 0x2C,
+    0x1F, 0x32, 0x31, 0x26, 0x2A, 0x1E, 0x1E, 0x24, 0x25, 0x24, 0x22, 0x02, 0x10, 0x17, 0x2C, 0x30,
+    0x26, 0x24, 0x0F, 0x18, 0x18, 0x10, 0x15, 0x24, 0x0F, 0x02, 0x10, 0x1A, 0x1B, 0x2D, 0x3C, 0x25,
+    0x24, 0x17, 0x1A, 0x15, 0x03, 0x32, 0x09, 0x1B, 0x2C, 0x25, 0x37, 0x40, 0x41, 0x40, 0x3C, 0x30,
+    0x30, 0x37, 0x42, 0x03, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x15, 0x02, 0x1D, 0x08, 0x0A, 0x0C,
+    0x1C, 0x06, 0x0E, 0x28, 0x21, 0x0A, 0x12, 0x22, 0x10, 0x1D, 0x0D, 0x29, 0x2F, 0x21, 0x07, 0x06,
+    0x18, 0x00, 0x08, 0x11, 0x12, 0x22, 0x23, 0x02, 0x1D, 0x08, 0x11, 0x23, 0x00, 0x22, 0x18, 0x12,
+    0x04, 0x10, 0x15, 0x25, 0x3C, 0x25, 0x23, 0x1A, 0x22, 0x1E, 0x2E, 0x1A, 0x04, 0x08, 0x20, 0x21,
+    0x0D, 0x13, 0x0A, 0x2F, 0x38, 0x33, 0x20, 0x0C, 0x18, 0x14, 0x08, 0x28, 0x34, 0x3F, 0x34, 0x0E,
+    0x48, 0x00, 0x1C, 0x29, 0x0E, 0x06, 0x18, 0x1A, 0x14, 0x07, 0x0B, 0x0E, 0x0D, 0x13, 0x02, 0x1D,
+    0x0C, 0x13, 0x14, 0x22, 0x1B, 0x30, 0x1B, 0x1A, 0x19, 0x18, 0x01, 0x15, 0x22, 0x12, 0x11, 0x67,
+    0x00, 0x01, 0x06, 0x6B, 0x00, 0x09, 0x20, 0x07, 0x1C, 0x04, 0x08, 0x21, 0x33, 0x38, 0x33, 0x78,
+    0x00, 0x1D, 0x21, 0x0D, 0x06, 0x18, 0x22, 0x14, 0x0C, 0x0A, 0x0B, 0x0D, 0x13, 0x19, 0x1D, 0x0C,
+    0x13, 0x14, 0x0F, 0x1B, 0x2D, 0x2A, 0x22, 0x19, 0x18, 0x10, 0x00, 0x1E, 0x18, 0x06, 0x0A, 0x99,
+    0x00, 0xB7, 0x20, 0x0A, 0x1D, 0x10, 0x19, 0x13, 0x0A, 0x20, 0x28, 0x21, 0x11, 0x07, 0x0B, 0x0B,
+    0x07, 0x0C, 0x12, 0x01, 0x00, 0x02, 0x12, 0x06, 0x08, 0x07, 0x12, 0x0F, 0x14, 0x12, 0x04, 0x02,
+    0x1E, 0x03, 0x32, 0x03, 0x00, 0x0F, 0x10, 0x22, 0x2A, 0x2C, 0x1A, 0x1C, 0x13, 0x06, 0x05, 0x10,
+    0x12, 0x08, 0x0A, 0x13, 0x19, 0x00, 0x17, 0x18, 0x13, 0x0A, 0x11, 0x1D, 0x04, 0x0C, 0x07, 0x13,
+    0x02, 0x15, 0x2E, 0x17, 0x02, 0x04, 0x05, 0x04, 0x10, 0x23, 0x0F, 0x02, 0x01, 0x1E, 0x2C, 0x30,
+    0x3B, 0x30, 0x2E, 0x23, 0x00, 0x24, 0x25, 0x30, 0x2C, 0x1A, 0x02, 0x19, 0x01, 0x23, 0x0F, 0x14,
+    0x05, 0x12, 0x19, 0x1E, 0x09, 0x2E, 0x1A, 0x18, 0x05, 0x1D, 0x12, 0x10, 0x22, 0x1C, 0x12, 0x14,
+    0x10, 0x00, 0x09, 0x30, 0x2C, 0x1E, 0x01, 0x02, 0x0F, 0x23, 0x1F, 0x24, 0x00, 0x15, 0x2E, 0x2D,
+    0x3E, 0x43, 0x3E, 0x30, 0x1F, 0x09, 0x27, 0x3C, 0x3E, 0x30, 0x2C, 0x15, 0x00, 0x24, 0x25, 0x2A,
+    0x22, 0x10, 0x01, 0x1E, 0x03, 0x2B, 0x30, 0x2C, 0x17, 0x02, 0x19, 0x01, 0x23, 0x2A, 0x1A, 0x01,
+    0x0F, 0x00, 0x03, 0x2B, 0x3E, 0x2D, 0x2C, 0x15, 0x00, 0x24, 0x25, 0x37, 0x27, 0x03, 0x09, 0x30,
+    0x44, 0x43, 0x45, 0x43, 0x3E, 0x37, 0x2B, 0x39, 0x40, 0x03, 0x00, 0x00, 0x42, 0x01, 0x02, 0x00,
+    0x0C, 0x11, 0x0D, 0x07, 0x04, 0x0C, 0x20, 0x29, 0x21, 0x11, 0x12, 0x22, 0x01, 0x13, 0x00, 0x01,
+    0x08, 0x17, 0x00, 0x18, 0x0E, 0x08, 0x04, 0x1A, 0x2A, 0x01, 0x12, 0x07, 0x11, 0x0C, 0x1C, 0x17,
+    0x18, 0x04, 0x1C, 0x01, 0x24, 0x26, 0x31, 0x27, 0x2A, 0x17, 0x22, 0x00, 0x35, 0x00, 0x03, 0x0B,
+    0x06, 0x0D, 0x3D, 0x00, 0x04, 0x19, 0x1C, 0x07, 0x21, 0x49, 0x00, 0x1B, 0x0D, 0x13, 0x02, 0x1E,
+    0x18, 0x06, 0x0A, 0x0B, 0x0A, 0x1D, 0x10, 0x05, 0x13, 0x1D, 0x18, 0x17, 0x03, 0x32, 0x2E, 0x1E,
+    0x10, 0x02, 0x0F, 0x23, 0x1A, 0x04, 0x08, 0x6A, 0x00, 0x08, 0x34, 0x0E, 0x06, 0x19, 0x1C, 0x0C,
+    0x0E, 0x2F, 0x75, 0x00, 0xDB, 0x0A, 0x28, 0x29, 0x20, 0x11, 0x1D, 0x02, 0x1E, 0x18, 0x13, 0x08,
+    0x0D, 0x11, 0x1D, 0x10, 0x12, 0x13, 0x05, 0x19, 0x17, 0x03, 0x32, 0x2E, 0x1E, 0x10, 0x02, 0x0F,
+    0x23, 0x15, 0x02, 0x13, 0x11, 0x0D, 0x08, 0x12, 0x07, 0x20, 0x11, 0x12, 0x0F, 0x01, 0x05, 0x08,
+    0x0B, 0x21, 0x20, 0x08, 0x06, 0x0D, 0x0D, 0x06, 0x13, 0x1C, 0x1A, 0x24, 0x0F, 0x14, 0x1D, 0x0C,
+    0x06, 0x14, 0x1A, 0x18, 0x14, 0x18, 0x0F, 0x24, 0x27, 0x39, 0x25, 0x24, 0x17, 0x22, 0x1E, 0x2C,
+    0x09, 0x1E, 0x18, 0x05, 0x13, 0x12, 0x01, 0x04, 0x07, 0x11, 0x05, 0x10, 0x23, 0x15, 0x02, 0x05,
+    0x11, 0x08, 0x12, 0x1C, 0x13, 0x06, 0x05, 0x22, 0x2A, 0x25, 0x23, 0x0F, 0x18, 0x14, 0x1C, 0x0F,
+    0x2A, 0x1A, 0x0F, 0x1A, 0x23, 0x1F, 0x37, 0x40, 0x37, 0x1F, 0x1B, 0x24, 0x2C, 0x26, 0x2B, 0x03,
+    0x1E, 0x10, 0x02, 0x0F, 0x23, 0x22, 0x1C, 0x12, 0x14, 0x10, 0x23, 0x25, 0x1F, 0x00, 0x10, 0x04,
+    0x05, 0x14, 0x0F, 0x1A, 0x19, 0x1C, 0x19, 0x22, 0x24, 0x26, 0x37, 0x1F, 0x23, 0x1A, 0x0F, 0x1A,
+    0x2A, 0x26, 0x2C, 0x24, 0x1B, 0x1F, 0x2B, 0x46, 0x47, 0x46, 0x37, 0x26, 0x27, 0x30, 0x31, 0x36,
+    0x35, 0x03, 0x23, 0x00, 0x2A, 0x25, 0x1B, 0x1A, 0x01, 0x22, 0x23, 0x1F, 0x3C, 0x2B, 0x03, 0x00,
+    0x01, 0x10, 0x22, 0x24, 0x2C, 0x1E, 0x22, 0x17, 0x24, 0x25, 0x39, 0x46, 0x2B, 0x1F, 0x2A, 0x23,
+    0x1B, 0x26, 0x31, 0x2D, 0x25, 0x26, 0x2B, 0x42, 0x48, 0x49, 0x4A, 0x46, 0x31, 0x3C, 0x3E, 0x4B,
+    0x01, 0x00, 0x00, 0x57, 0x01, 0x10, 0x1D, 0x11, 0x0D, 0x08, 0x12, 0x07, 0x20, 0x29, 0x21, 0x11,
+    0x04, 0x1A, 0x0F, 0x12, 0x0A, 0x28, 0x2F, 0x21, 0x08, 0x06, 0x0B, 0x21, 0x0E, 0x07, 0x1C, 0x1E,
+    0x2C, 0x22, 0x04, 0x0C, 0x08, 0x06, 0x1C, 0x17, 0x19, 0x14, 0x18, 0x22, 0x1B, 0x30, 0x3E, 0x2D,
+    0x1B, 0x1E, 0x1A, 0x00, 0x03, 0x17, 0x14, 0x08, 0x20, 0x28, 0x0E, 0x06, 0x0D, 0x2F, 0x38, 0x33,
+    0x0E, 0x13, 0x02, 0x19, 0x06, 0x0E, 0x33, 0x38, 0x33, 0x0B, 0x11, 0x28, 0x2F, 0x21, 0x0A, 0x05,
+    0x0F, 0x23, 0x02, 0x1D, 0x11, 0x0D, 0x11, 0x05, 0x01, 0x04, 0x1D, 0x12, 0x02, 0x15, 0x25, 0x3C,
+    0x1F, 0x15, 0x0F, 0x10, 0x22, 0x24, 0x1E, 0x1C, 0x07, 0x0E, 0x21, 0x0B, 0x06, 0x0D, 0x2F, 0x34,
+    0x0B, 0x13, 0x10, 0x02, 0x13, 0x0B, 0x29, 0x34, 0x2F, 0x0B, 0x08, 0x20, 0x21, 0x0B, 0x07, 0x04,
+    0x0F, 0x23, 0x10, 0x12, 0x0C, 0x11, 0x08, 0x12, 0x01, 0x14, 0x05, 0x14, 0x10, 0x23, 0x25, 0x3C,
+    0x1F, 0x23, 0x22, 0x01, 0x22, 0x2A, 0x24, 0x10, 0x05, 0x08, 0x0A, 0x08, 0x04, 0x0C, 0x0E, 0x07,
+    0x14, 0x1A, 0x22, 0x14, 0x0C, 0x0D, 0x20, 0x0E, 0x07, 0x13, 0x11, 0x11, 0x1D, 0x12, 0x02, 0x00,
+    0x2E, 0x17, 0x19, 0x04, 0x13, 0x1D, 0x18, 0x1E, 0x02, 0x18, 0x10, 0x17, 0x2C, 0x35, 0x3B, 0x30,
+    0x2E, 0x15, 0x1E, 0x15, 0x03, 0x25, 0x15, 0x02, 0x12, 0x1D, 0x04, 0x01, 0x14, 0x06, 0x08, 0x04,
+    0x22, 0x1B, 0x2A, 0x0F, 0x14, 0x07, 0x0C, 0x04, 0x19, 0x05, 0x1D, 0x04, 0x1E, 0x03, 0x2D, 0x2C,
+    0x17, 0x10, 0x18, 0x19, 0x17, 0x2E, 0x00, 0x17, 0x00, 0x2C, 0x2D, 0x44, 0x43, 0x44, 0x2D, 0x03,
+    0x2C, 0x09, 0x35, 0x3C, 0x1F, 0x15, 0x0F, 0x10, 0x22, 0x24, 0x1A, 0x18, 0x14, 0x18, 0x22, 0x2A,
+    0x2D, 0x26, 0x24, 0x0F, 0x1C, 0x04, 0x1C, 0x22, 0x00, 0x10, 0x19, 0x10, 0x1E, 0x2E, 0x35, 0x44,
+    0x2D, 0x2C, 0x00, 0x17, 0x00, 0x2E, 0x35, 0x03, 0x2C, 0x03, 0x2D, 0x31, 0x4C, 0x4D, 0x4C, 0x44,
+    0x32, 0x30, 0x2B, 0x3B, 0x46, 0x2B, 0x09, 0x24, 0x15, 0x2A, 0x27, 0x2C, 0x17, 0x22, 0x17, 0x2A,
+    0x27, 0x31, 0x39, 0x25, 0x24, 0x1A, 0x0F, 0x1A, 0x2A, 0x03, 0x15, 0x17, 0x00, 0x2C, 0x30, 0x3E,
+    0x4C, 0x31, 0x26, 0x2E, 0x1B, 0x03, 0x30, 0x3E, 0x32, 0x2D, 0x35, 0x31, 0x4B, 0x4E, 0x4F, 0x50,
+    0x4B, 0x3B, 0x44, 0x36, 0x43, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x53,
+    0x01, 0x03, 0x00, 0x0E, 0x0B, 0x11, 0x05, 0x07, 0x21, 0x29, 0x21, 0x08, 0x14, 0x17, 0x1A, 0x04,
+    0x11, 0x21, 0x14, 0x00, 0x2E, 0x13, 0x0D, 0x20, 0x0D, 0x06, 0x19, 0x15, 0x03, 0x17, 0x1C, 0x13,
+    0x0C, 0x13, 0x18, 0x1E, 0x02, 0x18, 0x02, 0x17, 0x2E, 0x32, 0x36, 0x35, 0x2E, 0x15, 0x1E, 0x15,
+    0x03, 0x1E, 0x1C, 0x07, 0x0E, 0x21, 0x0E, 0x0C, 0x0D, 0x2F, 0x34, 0x2F, 0x0B, 0x1D, 0x01, 0x10,
+    0x1D, 0x0B, 0x2F, 0x45, 0x00, 0xFF, 0x08, 0x21, 0x28, 0x20, 0x08, 0x14, 0x1A, 0x2A, 0x0F, 0x12,
+    0x07, 0x11, 0x08, 0x12, 0x0F, 0x14, 0x12, 0x1C, 0x0F, 0x2A, 0x26, 0x44, 0x26, 0x2A, 0x1A, 0x0F,
+    0x1A, 0x2A, 0x00, 0x18, 0x06, 0x0B, 0x20, 0x0B, 0x06, 0x0A, 0x29, 0x33, 0x0A, 0x05, 0x0F, 0x01,
+    0x05, 0x0A, 0x21, 0x2F, 0x29, 0x0D, 0x07, 0x0E, 0x20, 0x0A, 0x06, 0x1C, 0x17, 0x1B, 0x22, 0x1C,
+    0x13, 0x07, 0x0C, 0x04, 0x22, 0x18, 0x14, 0x18, 0x22, 0x1B, 0x2D, 0x3E, 0x2D, 0x1B, 0x17, 0x22,
+    0x17, 0x1B, 0x1B, 0x22, 0x04, 0x07, 0x11, 0x07, 0x04, 0x06, 0x0B, 0x06, 0x19, 0x00, 0x00, 0x19,
+    0x13, 0x11, 0x0B, 0x0B, 0x0C, 0x05, 0x07, 0x07, 0x12, 0x14, 0x0F, 0x24, 0x25, 0x23, 0x01, 0x1C,
+    0x12, 0x12, 0x10, 0x23, 0x0F, 0x10, 0x22, 0x23, 0x1F, 0x3C, 0x40, 0x37, 0x1F, 0x2A, 0x15, 0x2A,
+    0x25, 0x26, 0x24, 0x0F, 0x14, 0x12, 0x14, 0x0F, 0x18, 0x13, 0x0C, 0x18, 0x17, 0x03, 0x2E, 0x17,
+    0x18, 0x06, 0x13, 0x1C, 0x10, 0x04, 0x12, 0x18, 0x23, 0x25, 0x2B, 0x09, 0x23, 0x22, 0x10, 0x01,
+    0x00, 0x09, 0x24, 0x15, 0x24, 0x09, 0x2B, 0x42, 0x48, 0x42, 0x2B, 0x25, 0x09, 0x25, 0x2B, 0x31,
+    0x27, 0x24, 0x1A, 0x0F, 0x1A, 0x2A, 0x1E, 0x02, 0x1C, 0x02, 0x17, 0x2E, 0x32, 0x35, 0x2C, 0x17,
+    0x02, 0x1C, 0x19, 0x17, 0x23, 0x0F, 0x10, 0x22, 0x23, 0x1F, 0x3C, 0x42, 0x2B, 0x09, 0x24, 0x00,
+    0x23, 0x09, 0x2B, 0x25, 0x09, 0x25, 0x2B, 0x36, 0x4A, 0x51, 0x3D, 0x36, 0x3C, 0x2B, 0x3C, 0x42,
+    0x3A, 0x3C, 0x25, 0x1B, 0x24, 0x1B, 0x27, 0x2E, 0x1E, 0x1A, 0x1E, 0x2C, 0x30, 0x3B, 0x3E, 0x2D,
+    0x1B, 0x1E, 0x22, 0x1E, 0x2C, 0x1F, 0x24, 0x00, 0x24, 0x09, 0x2B, 0x46, 0x3D, 0x3B, 0x35, 0x1F,
+    0x03, 0x1F, 0x32, 0x36, 0x37, 0x44, 0x01, 0x0C, 0x32, 0x37, 0x3B, 0x52, 0x53, 0x54, 0x53, 0x52,
+    0x46, 0x36, 0x46, 0x3D, 0x03, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x02, 0x01, 0x05, 0x05, 0x00,
+    0x0D, 0x1D, 0x08, 0x21, 0x29, 0x20, 0x07, 0x1C, 0x1E, 0x1E, 0x1C, 0x07, 0x20, 0x29, 0x15, 0x00,
+    0x1F, 0x0A, 0x0B, 0x0A, 0x1D, 0x10, 0x24, 0x1F, 0x15, 0x19, 0x05, 0x06, 0x1D, 0x19, 0x00, 0x10,
+    0x19, 0x01, 0x15, 0x1F, 0x3C, 0x46, 0x37, 0x09, 0x24, 0x00, 0x23, 0x09, 0x15, 0x19, 0x06, 0x0B,
+    0x3A, 0x00, 0xFF, 0x29, 0x0A, 0x12, 0x22, 0x0F, 0x12, 0x0A, 0x28, 0x33, 0x2F, 0x0D, 0x07, 0x0E,
+    0x21, 0x0B, 0x06, 0x18, 0x00, 0x2E, 0x17, 0x1C, 0x06, 0x08, 0x0C, 0x14, 0x1A, 0x18, 0x14, 0x19,
+    0x17, 0x2E, 0x35, 0x3B, 0x30, 0x2C, 0x00, 0x1A, 0x1E, 0x2C, 0x23, 0x02, 0x13, 0x0A, 0x0E, 0x0D,
+    0x13, 0x11, 0x28, 0x2F, 0x08, 0x14, 0x1A, 0x1A, 0x14, 0x07, 0x0E, 0x29, 0x28, 0x11, 0x06, 0x0D,
+    0x0B, 0x08, 0x05, 0x02, 0x15, 0x09, 0x00, 0x19, 0x05, 0x06, 0x13, 0x1C, 0x1E, 0x02, 0x18, 0x10,
+    0x00, 0x03, 0x2B, 0x42, 0x32, 0x03, 0x15, 0x1E, 0x15, 0x2E, 0x03, 0x17, 0x1C, 0x06, 0x07, 0x06,
+    0x14, 0x13, 0x0A, 0x05, 0x10, 0x24, 0x24, 0x01, 0x12, 0x07, 0x0D, 0x0A, 0x13, 0x14, 0x06, 0x06,
+    0x14, 0x19, 0x17, 0x2E, 0x30, 0x1B, 0x17, 0x02, 0x14, 0x1C, 0x0F, 0x2A, 0x17, 0x22, 0x1E, 0x1B,
+    0x2D, 0x3E, 0x43, 0x44, 0x2D, 0x2E, 0x2A, 0x2C, 0x26, 0x35, 0x2C, 0x1A, 0x18, 0x04, 0x18, 0x22,
+    0x19, 0x05, 0x13, 0x02, 0x15, 0x25, 0x25, 0x15, 0x10, 0x1D, 0x05, 0x19, 0x0F, 0x1C, 0x1C, 0x10,
+    0x2C, 0x30, 0x31, 0x26, 0x1B, 0x1E, 0x22, 0x1A, 0x24, 0x27, 0x1B, 0x2A, 0x2E, 0x26, 0x31, 0x4C,
+    0x4E, 0x4B, 0x39, 0x30, 0x27, 0x2D, 0x39, 0x3E, 0x30, 0x1B, 0x1E, 0x22, 0x17, 0x1B, 0x00, 0x10,
+    0x19, 0x01, 0x15, 0x1F, 0x37, 0x37, 0x09, 0x15, 0x01, 0x19, 0x10, 0x00, 0x2A, 0x1A, 0x22, 0x1E,
+    0x1B, 0x2D, 0x44, 0x4B, 0x39, 0x26, 0x2C, 0x24, 0x1B, 0x27, 0x39, 0x2D, 0x27, 0x30, 0x39, 0x3A,
+    0x50, 0x55, 0x41, 0x3A, 0x44, 0x39, 0x44, 0x3A, 0x4C, 0x31, 0x26, 0x2C, 0x2A, 0x2C, 0x27, 0x2E,
+    0x15, 0x1E, 0x15, 0x03, 0x32, 0x42, 0x42, 0x32, 0x03, 0x15, 0x17, 0x00, 0x2E, 0x27, 0x1B, 0x24,
+    0x1B, 0x27, 0x39, 0x01, 0x17, 0x39, 0x4B, 0x41, 0x40, 0x3C, 0x26, 0x1F, 0x27, 0x37, 0x46, 0x39,
+    0x37, 0x31, 0x40, 0x47, 0x56, 0x57, 0x58, 0x47, 0x4B, 0x46, 0x3A, 0x48, 0x03, 0x00, 0x00, 0x56,
+    0x01, 0x00, 0x00, 0xFF, 0x0F, 0x12, 0x08, 0x0D, 0x0A, 0x1D, 0x08, 0x20, 0x28, 0x0E, 0x0C, 0x18,
+    0x00, 0x00, 0x19, 0x0C, 0x0E, 0x28, 0x20, 0x07, 0x1D, 0x11, 0x0D, 0x08, 0x12, 0x0F, 0x1B, 0x26,
+    0x24, 0x01, 0x04, 0x1D, 0x12, 0x02, 0x15, 0x0F, 0x10, 0x22, 0x24, 0x27, 0x31, 0x4B, 0x39, 0x27,
+    0x1B, 0x23, 0x24, 0x1F, 0x23, 0x02, 0x13, 0x0D, 0x20, 0x0B, 0x0C, 0x0A, 0x29, 0x2F, 0x21, 0x08,
+    0x14, 0x17, 0x17, 0x14, 0x08, 0x21, 0x2F, 0x28, 0x0A, 0x06, 0x0B, 0x0E, 0x0A, 0x1D, 0x10, 0x24,
+    0x1F, 0x15, 0x02, 0x05, 0x06, 0x13, 0x18, 0x1E, 0x02, 0x18, 0x01, 0x00, 0x1F, 0x3C, 0x46, 0x2B,
+    0x09, 0x23, 0x1E, 0x15, 0x2E, 0x2A, 0x0F, 0x05, 0x11, 0x0B, 0x0A, 0x1D, 0x08, 0x21, 0x28, 0x0C,
+    0x18, 0x00, 0x00, 0x19, 0x06, 0x0D, 0x21, 0x20, 0x08, 0x1D, 0x11, 0x0A, 0x0C, 0x04, 0x22, 0x1B,
+    0x26, 0x24, 0x0F, 0x14, 0x05, 0x12, 0x02, 0x15, 0x01, 0x10, 0x22, 0x24, 0x27, 0x31, 0x3A, 0x39,
+    0x25, 0x2A, 0x15, 0x24, 0x1F, 0x1F, 0x00, 0x19, 0x1D, 0x0C, 0x13, 0x18, 0x05, 0x11, 0x04, 0x22,
+    0x2C, 0x2C, 0x1A, 0x1C, 0x13, 0x08, 0x08, 0x05, 0x18, 0x1D, 0x1D, 0x18, 0x01, 0x23, 0x25, 0x37,
+    0x09, 0x15, 0x0F, 0x19, 0x02, 0x17, 0x2E, 0x00, 0x1E, 0x23, 0x09, 0x2B, 0x46, 0x4A, 0x36, 0x32,
+    0x1F, 0x2E, 0x09, 0x30, 0x2B, 0x09, 0x1E, 0x02, 0x1C, 0x19, 0x17, 0x10, 0x12, 0x05, 0x0F, 0x2A,
+    0x2D, 0x2D, 0x1B, 0x22, 0x12, 0x04, 0x10, 0x17, 0x02, 0x19, 0x0F, 0x1F, 0x37, 0x42, 0x32, 0x09,
+    0x23, 0x1E, 0x00, 0x2C, 0x30, 0x03, 0x2E, 0x1F, 0x32, 0x36, 0x4A, 0x53, 0x52, 0x3B, 0x2B, 0x30,
+    0x32, 0x3E, 0x42, 0x32, 0x03, 0x15, 0x17, 0x1E, 0x2C, 0x15, 0x0F, 0x10, 0x22, 0x24, 0x27, 0x31,
+    0x31, 0x26, 0x2A, 0xFF, 0x00, 0x51, 0x1A, 0x01, 0x0F, 0x23, 0x2C, 0x00, 0x1E, 0x23, 0x09, 0x32,
+    0x42, 0x3D, 0x3B, 0x35, 0x09, 0x2C, 0x03, 0x2D, 0x44, 0x32, 0x30, 0x2B, 0x3B, 0x52, 0x53, 0x54,
+    0x45, 0x52, 0x42, 0x3E, 0x3B, 0x4C, 0x52, 0x3E, 0x30, 0x03, 0x1B, 0x2C, 0x26, 0x03, 0x23, 0x00,
+    0x24, 0x1F, 0x37, 0x40, 0x3A, 0x3C, 0x1F, 0x24, 0x00, 0x23, 0x09, 0x26, 0x2E, 0x1B, 0x03, 0x30,
+    0x3E, 0x52, 0x4D, 0x4C, 0x44, 0x35, 0x26, 0x30, 0x39, 0x3A, 0x3E, 0x31, 0x3B, 0x4C, 0x4E, 0x59,
+    0x5A, 0x4F, 0x4E, 0x52, 0x4B, 0x4C, 0x41, 0x03, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xFF, 0x22,
+    0x04, 0x07, 0x0D, 0x11, 0x1D, 0x07, 0x20, 0x21, 0x0B, 0x13, 0x02, 0x23, 0x24, 0x10, 0x13, 0x0D,
+    0x20, 0x0E, 0x0C, 0x12, 0x08, 0x11, 0x0C, 0x1C, 0x17, 0x03, 0x35, 0x2C, 0x22, 0x1C, 0x12, 0x04,
+    0x01, 0x24, 0x22, 0x0F, 0x17, 0x1B, 0x30, 0x3B, 0x43, 0x44, 0x2D, 0x2E, 0x24, 0x1B, 0x25, 0x2A,
+    0x01, 0x05, 0x11, 0x0E, 0x0D, 0x06, 0x11, 0x28, 0x29, 0x0E, 0x0C, 0x18, 0x00, 0x15, 0x19, 0x06,
+    0x0B, 0x28, 0x21, 0x08, 0x1D, 0x0A, 0x0D, 0x07, 0x04, 0x22, 0x2C, 0x2D, 0x2A, 0x0F, 0x14, 0x1D,
+    0x05, 0x02, 0x15, 0x01, 0x10, 0x22, 0x2A, 0x26, 0x44, 0x4B, 0x39, 0x27, 0x1B, 0x15, 0x24, 0x09,
+    0x2E, 0x1A, 0x14, 0x07, 0x0A, 0x11, 0x05, 0x07, 0x0E, 0x20, 0x1D, 0x10, 0x24, 0x24, 0x01, 0x05,
+    0x11, 0x0E, 0x0B, 0x0C, 0x12, 0x07, 0x07, 0x1D, 0x19, 0x1E, 0x03, 0x35, 0x2E, 0x17, 0x19, 0x04,
+    0x14, 0x01, 0x24, 0x1A, 0x22, 0x1E, 0x2C, 0x35, 0x3B, 0x52, 0x3E, 0x30, 0x2E, 0x2A, 0x1B, 0x27,
+    0x26, 0x24, 0x01, 0x04, 0x13, 0x05, 0x19, 0x04, 0x07, 0x18, 0x1E, 0x09, 0x1F, 0x00, 0x02, 0x05,
+    0x0C, 0x06, 0x04, 0x10, 0x04, 0x04, 0x10, 0x1A, 0x1B, 0x30, 0x44, 0x26, 0x1B, 0x17, 0x01, 0x0F,
+    0x00, 0x1F, 0x24, 0x23, 0x2C, 0x26, 0x31, 0x4C, 0x50, 0x3A, 0x39, 0x2D, 0x1F, 0x27, 0x2B, 0x39,
+    0x25, 0x23, 0x0F, 0x19, 0x10, 0x1E, 0x0F, 0x14, 0x04, 0x17, 0x2E, 0x32, 0x2B, 0x03, 0x1E, 0x1C,
+    0x1C, 0x0F, 0x15, 0x0F, 0x01, 0x17, 0x26, 0x44, 0x4B, 0x39, 0x27, 0x2C, 0x23, 0x23, 0x09, 0x2B,
+    0x25, 0x1F, 0x2D, 0x39, 0x3A, 0x50, 0x56, 0x47, 0x40, 0x31, 0x2B, 0x3C, 0x36, 0x40, 0x37, 0x1F,
+    0x24, 0x1E, 0x15, 0x2E, 0x24, 0x22, 0x0F, 0x1E, 0x2C, 0x30, 0x3B, 0x36, 0x35, 0x2E, 0xFF, 0x00,
+    0x51, 0x00, 0x22, 0x1A, 0x2A, 0x09, 0x23, 0x15, 0x1B, 0x27, 0x39, 0x4B, 0x41, 0x40, 0x3C, 0x26,
+    0x09, 0x1F, 0x32, 0x36, 0x37, 0x2B, 0x39, 0x40, 0x47, 0x56, 0x5B, 0x49, 0x48, 0x3A, 0x36, 0x46,
+    0x52, 0x3D, 0x36, 0x35, 0x09, 0x2C, 0x2E, 0x26, 0x09, 0x24, 0x23, 0x1B, 0x27, 0x31, 0x4B, 0x4C,
+    0x31, 0x26, 0x2C, 0x23, 0x2A, 0x1F, 0x30, 0x09, 0x03, 0x25, 0x2B, 0x46, 0x48, 0x51, 0x3D, 0x36,
+    0x37, 0x30, 0x32, 0x44, 0x4C, 0x36, 0x3B, 0x46, 0x3D, 0x51, 0x5C, 0x5D, 0x54, 0x53, 0x4A, 0x43,
+    0x52, 0x50, 0x03, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x04, 0x17, 0x14, 0x0C, 0x0A, 0x07, 0x00,
+    0xFF, 0x0E, 0x20, 0x0A, 0x05, 0x01, 0x2A, 0x1B, 0x0F, 0x12, 0x11, 0x0B, 0x0D, 0x06, 0x04, 0x0C,
+    0x07, 0x1D, 0x19, 0x15, 0x1F, 0x2B, 0x09, 0x1E, 0x02, 0x14, 0x1C, 0x0F, 0x2A, 0x17, 0x1A, 0x15,
+    0x03, 0x2B, 0x42, 0x3D, 0x36, 0x35, 0x09, 0x1B, 0x2C, 0x27, 0x2C, 0x22, 0x04, 0x07, 0x0D, 0x0A,
+    0x13, 0x08, 0x20, 0x21, 0x0D, 0x13, 0x10, 0x23, 0x2A, 0x01, 0x05, 0x0A, 0x20, 0x0E, 0x07, 0x12,
+    0x07, 0x08, 0x13, 0x18, 0x1E, 0x09, 0x32, 0x2E, 0x17, 0x19, 0x04, 0x14, 0x01, 0x24, 0x1A, 0x22,
+    0x1E, 0x2E, 0x35, 0x36, 0x52, 0x3E, 0x30, 0x03, 0x2A, 0x1B, 0x25, 0x09, 0x00, 0x18, 0x13, 0x08,
+    0x07, 0x12, 0x06, 0x0D, 0x0B, 0x12, 0x22, 0x2C, 0x2E, 0x1A, 0x14, 0x0C, 0x0A, 0x11, 0x13, 0x1C,
+    0x13, 0x13, 0x04, 0x01, 0x24, 0x27, 0x3C, 0x25, 0x23, 0x01, 0x18, 0x19, 0x1A, 0x2C, 0x00, 0x1E,
+    0x24, 0x1F, 0x37, 0x40, 0x48, 0x46, 0x2B, 0x25, 0x2E, 0x03, 0x2D, 0x35, 0x2C, 0x22, 0x1C, 0x05,
+    0x12, 0x02, 0x1C, 0x13, 0x10, 0x23, 0x27, 0x26, 0x2A, 0x0F, 0x14, 0x1D, 0x1D, 0x18, 0x0F, 0x18,
+    0x18, 0x22, 0x15, 0x09, 0x37, 0x42, 0x32, 0x03, 0x23, 0x1A, 0x1A, 0x24, 0x27, 0x2C, 0x1B, 0x09,
+    0x32, 0x36, 0x4A, 0x53, 0x52, 0x3E, 0x32, 0x26, 0x2D, 0x3C, 0x3E, 0x2D, 0x2A, 0x1A, 0x10, 0x01,
+    0x00, 0x1A, 0x19, 0x18, 0x15, 0x1F, 0x3C, 0x39, 0x27, 0x23, 0x19, 0x02, 0x17, 0x24, 0x1A, 0x1A,
+    0x15, 0x32, 0x36, 0x3D, 0x3B, 0x35, 0x09, 0x1B, 0x1B, 0x25, 0x3C, 0x2D, 0x26, 0x32, 0x3E, 0x52,
+    0x53, 0x5E, 0x4D, 0x4C, 0x3B, 0x39, 0x31, 0x46, 0x4B, 0x31, 0x27, 0x1B, 0x15, 0x23, 0x03, 0x2A,
+    0x17, 0x1A, 0x15, 0x03, 0x2B, 0x46, 0x40, 0x37, 0x1F, 0x23, 0x1E, 0x1E, 0x2C, 0x25, 0x1B, 0x2A,
+    0x06, 0x01, 0x4A, 0x03, 0x30, 0x3B, 0x52, 0x4D, 0x43, 0x44, 0x35, 0x27, 0x26, 0x37, 0x46, 0x31,
+    0x39, 0x3B, 0x4C, 0x4E, 0x59, 0x5F, 0x4F, 0x50, 0x43, 0x40, 0x3A, 0x4A, 0x48, 0x46, 0x2B, 0x25,
+    0x2E, 0x03, 0x2D, 0x1F, 0x2A, 0x24, 0x2E, 0x30, 0x3E, 0x52, 0x3D, 0x3B, 0x35, 0x03, 0x1B, 0x2C,
+    0x27, 0x32, 0x25, 0x1F, 0x2D, 0x39, 0x4B, 0x50, 0x56, 0x41, 0x40, 0x31, 0x2B, 0x37, 0x3B, 0x52,
+    0x46, 0x42, 0x4B, 0x47, 0x56, 0x57, 0x60, 0x5B, 0x49, 0x41, 0x3D, 0x4A, 0x4D, 0x03, 0x00, 0x00,
+    0x56, 0x01, 0x00, 0x00, 0xFF, 0x1E, 0x18, 0x06, 0x11, 0x08, 0x1D, 0x0C, 0x0D, 0x0B, 0x08, 0x04,
+    0x22, 0x2C, 0x03, 0x17, 0x14, 0x0C, 0x0A, 0x0A, 0x13, 0x1C, 0x13, 0x06, 0x12, 0x01, 0x2A, 0x26,
+    0x39, 0x27, 0x23, 0x0F, 0x19, 0x19, 0x1A, 0x2C, 0x00, 0x1E, 0x24, 0x25, 0x39, 0x3A, 0x48, 0x46,
+    0x37, 0x25, 0x2E, 0x03, 0x26, 0x03, 0x1E, 0x1C, 0x06, 0x11, 0x11, 0x1D, 0x0C, 0x0B, 0x0E, 0x11,
+    0x12, 0x0F, 0x1B, 0x2E, 0x1A, 0x14, 0x07, 0x0D, 0x0A, 0x06, 0x14, 0x06, 0x06, 0x12, 0x10, 0x24,
+    0x27, 0x39, 0x25, 0x15, 0x01, 0x18, 0x18, 0x22, 0x1B, 0x1E, 0x17, 0x24, 0x1F, 0x3C, 0x40, 0x48,
+    0x46, 0x2B, 0x1F, 0x2C, 0x2E, 0x26, 0x27, 0x23, 0x10, 0x05, 0x0C, 0x06, 0x14, 0x1D, 0x11, 0x11,
+    0x18, 0x1E, 0x09, 0x1F, 0x15, 0x19, 0x1D, 0x07, 0x07, 0x12, 0x02, 0x12, 0x12, 0x18, 0x1A, 0x2C,
+    0x35, 0x3E, 0x2D, 0x1B, 0x17, 0x01, 0x01, 0x00, 0x09, 0x24, 0x23, 0x2C, 0x2D, 0x44, 0x43, 0x4E,
+    0x4B, 0x31, 0x2D, 0x1F, 0x25, 0x35, 0x2B, 0x09, 0x1E, 0x02, 0x14, 0x14, 0x01, 0x19, 0x05, 0x22,
+    0x2C, 0x30, 0x32, 0x2E, 0x17, 0x19, 0x04, 0x04, 0x10, 0x17, 0x10, 0x10, 0x1E, 0x2A, 0x26, 0x44,
+    0x4B, 0x39, 0x27, 0x1B, 0x00, 0x15, 0x2C, 0x30, 0x09, 0x09, 0x26, 0x3C, 0x3A, 0x41, 0x58, 0x47,
+    0x46, 0x3C, 0x35, 0x32, 0x44, 0x36, 0x32, 0x2E, 0x00, 0x0F, 0x22, 0x23, 0x1E, 0x10, 0x02, 0x2A,
+    0x26, 0x44, 0x3B, 0x30, 0x2C, 0x01, 0x0F, 0x00, 0x2C, 0x00, 0x00, 0x1B, 0x39, 0x3A, 0x47, 0x40,
+    0x3C, 0x27, 0x03, 0x03, 0x2D, 0x44, 0x32, 0x35, 0x39, 0x46, 0x47, 0x58, 0x61, 0x51, 0x4A, 0x46,
+    0x3E, 0x3B, 0x4B, 0x43, 0x3E, 0x2D, 0x2E, 0x24, 0x24, 0x09, 0x2C, 0x00, 0x1E, 0x24, 0x25, 0x39,
+    0x3A, 0x4C, 0x31, 0x26, 0xFF, 0x00, 0x51, 0x1B, 0x15, 0x23, 0x03, 0x26, 0x2E, 0x2E, 0x25, 0x37,
+    0x46, 0x47, 0x49, 0x4A, 0x42, 0x37, 0x30, 0x35, 0x39, 0x3A, 0x3E, 0x3E, 0x46, 0x3D, 0x51, 0x61,
+    0x5D, 0x54, 0x45, 0x4A, 0x4C, 0x4C, 0x47, 0x47, 0x40, 0x3C, 0x27, 0x03, 0x09, 0x2D, 0x25, 0x2C,
+    0x1B, 0x09, 0x32, 0x36, 0x4A, 0x48, 0x46, 0x2B, 0x25, 0x2E, 0x2E, 0x26, 0x37, 0x26, 0x27, 0x35,
+    0x3E, 0x52, 0x45, 0x59, 0x4D, 0x4C, 0x3B, 0x3C, 0x39, 0x42, 0x3D, 0x3A, 0x40, 0x43, 0x4E, 0x4F,
+    0x5A, 0x62, 0x63, 0x55, 0x4E, 0x48, 0x48, 0x45, 0x03, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xFF,
+    0x15, 0x02, 0x1D, 0x07, 0x07, 0x05, 0x13, 0x0A, 0x0A, 0x06, 0x1C, 0x1E, 0x03, 0x1F, 0x15, 0x19,
+    0x1D, 0x08, 0x07, 0x05, 0x19, 0x12, 0x05, 0x1C, 0x1A, 0x2E, 0x35, 0x3E, 0x30, 0x1B, 0x17, 0x10,
+    0x01, 0x1E, 0x2E, 0x23, 0x23, 0x2C, 0x2D, 0x3E, 0x43, 0x41, 0x4B, 0x39, 0x2D, 0x09, 0x09, 0x2D,
+    0x1F, 0x15, 0x02, 0x1D, 0x07, 0x07, 0x05, 0x13, 0x0A, 0x0A, 0x0C, 0x1C, 0x1E, 0x03, 0x1F, 0x15,
+    0x19, 0x13, 0x08, 0x08, 0x05, 0x19, 0x05, 0x05, 0x1C, 0x1A, 0x2C, 0x35, 0x3E, 0x30, 0x1B, 0x1A,
+    0x10, 0x10, 0x1E, 0x2E, 0x23, 0x23, 0x2C, 0x2D, 0x44, 0x43, 0x50, 0x4B, 0x39, 0x26, 0x09, 0x09,
+    0x2D, 0x30, 0x1B, 0x22, 0x14, 0x1D, 0x1D, 0x1C, 0x04, 0x0C, 0x0C, 0x10, 0x23, 0x27, 0x2D, 0x2A,
+    0x0F, 0x04, 0x13, 0x13, 0x1C, 0x0F, 0x1C, 0x1C, 0x01, 0x15, 0x1F, 0x3C, 0x46, 0x2B, 0x09, 0x15,
+    0x1A, 0x1A, 0x24, 0x25, 0x2C, 0x1B, 0x1F, 0x2B, 0x42, 0x48, 0x53, 0x3D, 0x3B, 0x32, 0x26, 0x26,
+    0x37, 0x39, 0x27, 0x23, 0x0F, 0x18, 0x19, 0x22, 0x10, 0x14, 0x1E, 0x09, 0x37, 0x39, 0x25, 0x23,
+    0x01, 0x18, 0x18, 0x0F, 0x15, 0x22, 0x22, 0x23, 0x03, 0x32, 0x42, 0x3D, 0x3B, 0x35, 0x03, 0x2A,
+    0x2A, 0x09, 0x2B, 0x27, 0x27, 0x35, 0x3E, 0x52, 0x45, 0x59, 0x4E, 0x4C, 0x3E, 0x3C, 0x3C, 0x3B,
+    0x40, 0x3C, 0x1F, 0x23, 0x17, 0x17, 0x2A, 0x15, 0x0F, 0x0F, 0x2E, 0x32, 0x36, 0x46, 0x37, 0x09,
+    0x1A, 0x1A, 0x24, 0x09, 0x24, 0x24, 0x03, 0x3B, 0x52, 0x4D, 0x43, 0x44, 0x35, 0x25, 0x25, 0x32,
+    0x36, 0x3C, 0x3C, 0x3E, 0x4C, 0x4E, 0x59, 0x63, 0x55, 0x41, 0x4B, 0x42, 0x42, 0x43, 0x3D, 0x36,
+    0x32, 0x09, 0x1B, 0x1B, 0x1F, 0x03, 0x23, 0x23, 0x2C, 0x2D, 0x44, 0x43, 0x3D, 0x3B, 0x35, 0xFF,
+    0x00, 0x51, 0x03, 0x2A, 0x2A, 0x1F, 0x35, 0x1F, 0x1F, 0x2D, 0x31, 0x4B, 0x4E, 0x55, 0x50, 0x3A,
+    0x31, 0x2B, 0x2B, 0x3E, 0x4C, 0x42, 0x36, 0x4B, 0x41, 0x56, 0x63, 0x60, 0x5B, 0x49, 0x47, 0x52,
+    0x52, 0x41, 0x50, 0x4B, 0x31, 0x2D, 0x09, 0x09, 0x2D, 0x27, 0x2E, 0x2E, 0x25, 0x37, 0x46, 0x48,
+    0x50, 0x3A, 0x39, 0x26, 0x09, 0x09, 0x2D, 0x3C, 0x30, 0x30, 0x37, 0x42, 0x4A, 0x49, 0x5C, 0x51,
+    0x3D, 0x42, 0x44, 0x44, 0x40, 0x48, 0x4C, 0x4B, 0x4A, 0x53, 0x54, 0x5D, 0x64, 0x5A, 0x59, 0x45,
+    0x41, 0x41, 0x53, 0x03, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0xFF, 0x24, 0x01, 0x12, 0x06, 0x0C,
+    0x12, 0x1D, 0x08, 0x07, 0x1D, 0x02, 0x23, 0x1F, 0x26, 0x2A, 0x0F, 0x04, 0x06, 0x06, 0x04, 0x10,
+    0x14, 0x14, 0x10, 0x15, 0x1F, 0x37, 0x42, 0x2B, 0x09, 0x15, 0x22, 0x22, 0x15, 0x09, 0x2A, 0x1B,
+    0x09, 0x32, 0x42, 0x3D, 0x4D, 0x43, 0x3E, 0x35, 0x25, 0x25, 0x30, 0x26, 0x2A, 0x0F, 0x04, 0x06,
+    0x06, 0x04, 0x05, 0x07, 0x07, 0x1D, 0x02, 0x23, 0x25, 0x2D, 0x2A, 0x0F, 0x04, 0x06, 0x06, 0x04,
+    0x01, 0x14, 0x14, 0x10, 0x15, 0x1F, 0x3C, 0x46, 0x2B, 0x09, 0x15, 0x22, 0x22, 0x23, 0x1F, 0x1B,
+    0x1B, 0x09, 0x32, 0x42, 0x4A, 0x45, 0x52, 0x3E, 0x35, 0x27, 0x27, 0x35, 0x2B, 0x03, 0x1E, 0x19,
+    0x12, 0x12, 0x19, 0x1C, 0x1D, 0x1D, 0x22, 0x2C, 0x30, 0x2B, 0x03, 0x1E, 0x19, 0x12, 0x12, 0x02,
+    0x17, 0x02, 0x02, 0x1A, 0x1B, 0x2D, 0x3E, 0x4C, 0x44, 0x26, 0x1B, 0x00, 0x00, 0x2C, 0x2D, 0x09,
+    0x09, 0x26, 0x39, 0x4B, 0x50, 0x58, 0x47, 0x40, 0x39, 0x35, 0x35, 0x39, 0x3E, 0x30, 0x2C, 0x17,
+    0x10, 0x10, 0x17, 0x22, 0x18, 0x24, 0x26, 0x31, 0x3E, 0x30, 0x1B, 0x17, 0x10, 0x10, 0x17, 0x2A,
+    0x1E, 0x1E, 0x1B, 0x27, 0x39, 0x4B, 0x41, 0x40, 0x3C, 0x27, 0x2E, 0x2E, 0x27, 0x39, 0x30, 0x30,
+    0x3C, 0x46, 0x47, 0x58, 0x5C, 0x51, 0x3D, 0x42, 0x44, 0x44, 0x46, 0x4B, 0x31, 0x26, 0x1B, 0x00,
+    0x00, 0x1B, 0x24, 0x17, 0x17, 0x1F, 0x3C, 0x40, 0x4C, 0x31, 0x26, 0x00, 0x00, 0x1B, 0x27, 0x2C,
+    0x2C, 0x25, 0x46, 0x47, 0x49, 0x4A, 0x42, 0x37, 0x2D, 0x2D, 0x3C, 0x46, 0x44, 0x44, 0x42, 0x3D,
+    0x51, 0x5C, 0x65, 0x5E, 0x45, 0x3D, 0x3A, 0x3A, 0x3D, 0x48, 0x40, 0x37, 0x25, 0x2E, 0x2C, 0x25,
+    0x09, 0x2A, 0x2A, 0x09, 0x32, 0x36, 0x3D, 0x47, 0x40, 0x37, 0xFF, 0x00, 0x50, 0x25, 0x2C, 0x2C,
+    0x27, 0x2B, 0x26, 0x27, 0x32, 0x3B, 0x3D, 0x53, 0x5E, 0x45, 0x43, 0x3B, 0x39, 0x39, 0x36, 0x52,
+    0x40, 0x40, 0x52, 0x4D, 0x59, 0x65, 0x62, 0x63, 0x55, 0x4E, 0x4A, 0x4A, 0x4E, 0x4E, 0x4C, 0x44,
+    0x30, 0x25, 0x1F, 0x30, 0x26, 0x03, 0x03, 0x26, 0x39, 0x3A, 0x41, 0x4D, 0x43, 0x44, 0x30, 0x25,
+    0x25, 0x35, 0x31, 0x32, 0x32, 0x31, 0x3A, 0x41, 0x56, 0x5B, 0x58, 0x47, 0x3A, 0x3B, 0x3B, 0x3A,
+    0x47, 0x43, 0x52, 0x47, 0x49, 0x5B, 0x66, 0x67, 0x5D, 0x54, 0x51, 0x50, 0x50, 0x03, 0x00, 0x00,
+    0x56, 0x01, 0x00, 0x00, 0xFF, 0x2C, 0x1A, 0x1C, 0x1D, 0x13, 0x04, 0x12, 0x06, 0x06, 0x04, 0x0F,
+    0x2A, 0x26, 0x35, 0x2E, 0x17, 0x18, 0x05, 0x05, 0x1C, 0x22, 0x19, 0x19, 0x22, 0x2A, 0x2D, 0x44,
+    0x4B, 0x31, 0x27, 0x2A, 0x1E, 0x1E, 0x2A, 0x25, 0x2E, 0x2E, 0x27, 0x3C, 0x3A, 0x47, 0x53, 0x4A,
+    0x42, 0x37, 0x2D, 0x26, 0x32, 0x35, 0x2E, 0x17, 0x18, 0x05, 0x1D, 0x1C, 0x04, 0x06, 0x13, 0x14,
+    0x22, 0x1B, 0x2D, 0x32, 0x03, 0x17, 0x18, 0x05, 0x05, 0x18, 0x22, 0x19, 0x02, 0x22, 0x1B, 0x2D,
+    0x3E, 0x4C, 0x31, 0x26, 0x1B, 0x00, 0x00, 0x1B, 0x27, 0x03, 0x03, 0x26, 0x39, 0x4B, 0x41, 0x49,
+    0x48, 0x46, 0x3C, 0x30, 0x2D, 0x2B, 0x3C, 0x27, 0x23, 0x01, 0x1C, 0x1C, 0x10, 0x02, 0x04, 0x04,
+    0x00, 0x1F, 0x37, 0x31, 0x27, 0x24, 0x01, 0x18, 0x1C, 0x0F, 0x15, 0x22, 0x22, 0x15, 0x09, 0x2B,
+    0x46, 0x4A, 0x42, 0x32, 0x09, 0x2A, 0x2A, 0x09, 0x32, 0x27, 0x27, 0x32, 0x3B, 0x3D, 0x53, 0x4F,
+    0x4D, 0x4C, 0x3E, 0x37, 0x37, 0x44, 0x42, 0x2B, 0x09, 0x15, 0x22, 0x0F, 0x00, 0x17, 0x10, 0x2C,
+    0x35, 0x3B, 0x46, 0x37, 0x09, 0x15, 0x22, 0x22, 0x15, 0x2E, 0x23, 0x23, 0x03, 0x30, 0x3B, 0x52,
+    0x45, 0x43, 0x44, 0x30, 0x1F, 0x1F, 0x35, 0x3E, 0x37, 0x37, 0x44, 0x4C, 0x4E, 0x59, 0x57, 0x56,
+    0x41, 0x4B, 0x36, 0x3B, 0x3A, 0x52, 0x3B, 0x35, 0x03, 0x24, 0x23, 0x2E, 0x1B, 0x00, 0x00, 0x26,
+    0x44, 0x4C, 0x3D, 0x36, 0x35, 0x24, 0x24, 0x03, 0x2D, 0x09, 0x09, 0x2D, 0x4C, 0x4E, 0x4F, 0x50,
+    0x3A, 0x31, 0x32, 0x32, 0x31, 0x4B, 0x36, 0x36, 0x3A, 0x41, 0x56, 0x63, 0x66, 0x61, 0x49, 0x48,
+    0x43, 0x4C, 0x48, 0x41, 0x4B, 0x39, 0x26, 0x03, 0x03, 0x27, 0x25, 0x2C, 0x2C, 0x25, 0x37, 0x40,
+    0x47, 0x4E, 0x4C, 0x31, 0xFF, 0x00, 0x51, 0x2D, 0x09, 0x09, 0x2D, 0x3C, 0x30, 0x30, 0x3C, 0x46,
+    0x47, 0x58, 0x61, 0x49, 0x4A, 0x46, 0x44, 0x44, 0x46, 0x4A, 0x4B, 0x4C, 0x4A, 0x51, 0x5C, 0x68,
+    0x64, 0x65, 0x59, 0x45, 0x47, 0x47, 0x4D, 0x4D, 0x52, 0x3B, 0x32, 0x27, 0x25, 0x30, 0x2D, 0x1F,
+    0x1F, 0x30, 0x44, 0x4C, 0x4E, 0x53, 0x3D, 0x36, 0x2B, 0x26, 0x26, 0x32, 0x3E, 0x37, 0x37, 0x3E,
+    0x4C, 0x4D, 0x59, 0x5F, 0x4F, 0x50, 0x4C, 0x42, 0x42, 0x4C, 0x41, 0x3D, 0x3D, 0x50, 0x56, 0x63,
+    0x69, 0x6A, 0x66, 0x61, 0x58, 0x4D, 0x4E, 0x51, 0x01, 0x00, 0x00, 0x57, 0x01, 0x03, 0x1E, 0x19,
+    0x12, 0x05, 0x14, 0x14, 0x1D, 0x05, 0x18, 0x17, 0x03, 0x35, 0x37, 0x25, 0x23, 0x10, 0x14, 0x14,
+    0x02, 0x17, 0x01, 0x0F, 0x00, 0x03, 0x32, 0x36, 0x52, 0x3B, 0x35, 0x03, 0x24, 0x23, 0x2C, 0x26,
+    0x09, 0x1F, 0x30, 0x3E, 0x43, 0x4E, 0x49, 0x47, 0x40, 0x39, 0x35, 0x30, 0x2B, 0x2B, 0x1F, 0x15,
+    0x10, 0x14, 0x04, 0x19, 0x18, 0x12, 0x12, 0x19, 0x1E, 0x09, 0x2B, 0x39, 0x27, 0x23, 0x01, 0x1C,
+    0x1C, 0x10, 0x00, 0x0F, 0x0F, 0x00, 0x09, 0x2B, 0x42, 0x3D, 0x36, 0x32, 0x03, 0x24, 0x24, 0x03,
+    0x30, 0x25, 0x25, 0x35, 0x3B, 0x52, 0x45, 0x56, 0x50, 0x4B, 0x44, 0x2B, 0x32, 0x39, 0x3E, 0x30,
+    0x2C, 0x1A, 0x02, 0x02, 0x22, 0x0F, 0x18, 0x18, 0x2A, 0x26, 0x31, 0x36, 0x35, 0x2E, 0x17, 0x10,
+    0x10, 0x17, 0x2A, 0x1E, 0x1E, 0x1B, 0x26, 0x44, 0x4C, 0x50, 0x4B, 0x39, 0x26, 0x03, 0x2E, 0x27,
+    0x3C, 0x30, 0x35, 0x39, 0x40, 0x41, 0x56, 0x54, 0x51, 0x4A, 0x42, 0x31, 0x31, 0x36, 0x3A, 0x31,
+    0x27, 0x2A, 0x1E, 0x17, 0x23, 0x15, 0x22, 0x1F, 0x3C, 0x40, 0x4C, 0x44, 0x26, 0x1B, 0x1E, 0x1E,
+    0x2A, 0x25, 0x2C, 0x2C, 0x25, 0x37, 0x40, 0x47, 0x49, 0x48, 0x42, 0x37, 0x2D, 0x2D, 0x37, 0x36,
+    0x31, 0x31, 0x42, 0x3D, 0x51, 0x5C, 0x5A, 0x59, 0x4D, 0x52, 0x40, 0x46, 0x4C, 0x4A, 0x46, 0x37,
+    0x1F, 0x1B, 0x1B, 0x09, 0x03, 0x24, 0x24, 0x32, 0x36, 0x3D, 0x41, 0x40, 0x37, 0x2C, 0x2C, 0x25,
+    0x32, 0x27, 0x27, 0x32, 0x4A, 0x51, 0x54, 0x53, 0x52, 0x3B, 0x3C, 0x3C, 0x3B, 0x43, 0x46, 0x40,
+    0x52, 0x4D, 0x5E, 0x65, 0x69, 0x63, 0x56, 0x50, 0x3D, 0x52, 0x41, 0x4E, 0x43, 0x3E, 0x30, 0x1F,
+    0x09, 0x26, 0x27, 0x03, 0x09, 0x2D, 0x31, 0x4C, 0x50, 0x53, 0x3D, 0x3B, 0x32, 0x27, 0x25, 0x35,
+    0x31, 0x2B, 0x2B, 0x44, 0x4B, 0x4E, 0x4F, 0x63, 0x55, 0x41, 0x4B, 0x36, 0x36, 0x3A, 0x47, 0x43,
+    0x52, 0x41, 0x58, 0x57, 0x60, 0x67, 0x68, 0x5C, 0x51, 0x50, 0x41, 0x45, 0x45, 0x3D, 0x36, 0x2B,
+    0x26, 0x27, 0x30, 0x30, 0x25, 0x27, 0x32, 0x3B, 0x52, 0x45, 0x49, 0x47, 0x46, 0x3C, 0x30, 0x2D,
+    0x37, 0x3B, 0x39, 0x39, 0x42, 0x3D, 0x53, 0x54, 0x65, 0x5E, 0x45, 0x3D, 0x40, 0x40, 0x43, 0x50,
+    0x4A, 0x48, 0x4D, 0x4F, 0x5A, 0x6B, 0x6C, 0x60, 0x5B, 0x56, 0x45, 0x4D, 0x51, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0xFF, 0x25, 0x23, 0x01, 0x1C,
+    0x04, 0x18, 0x18, 0x04, 0x14, 0x01, 0x23, 0x25, 0x37, 0x44, 0x30, 0x1B, 0x1A, 0x02, 0x19, 0x01,
+    0x15, 0x1A, 0x17, 0x2A, 0x27, 0x39, 0x40, 0x48, 0x40, 0x3C, 0x25, 0x2C, 0x1B, 0x09, 0x30, 0x27,
+    0x26, 0x37, 0x42, 0x4A, 0x53, 0x56, 0x4E, 0x4C, 0x3E, 0x2B, 0x32, 0x3C, 0x39, 0x26, 0x2A, 0x22,
+    0x19, 0x18, 0x10, 0x10, 0x1C, 0x18, 0x0F, 0x24, 0x26, 0x39, 0x3B, 0x35, 0x2C, 0x17, 0x10, 0x02,
+    0x22, 0x24, 0x1E, 0x1E, 0x2A, 0x26, 0x31, 0x4B, 0x41, 0x3A, 0x39, 0x27, 0x2E, 0x2C, 0x25, 0x2B,
+    0x2D, 0x30, 0x3C, 0x46, 0x47, 0x49, 0x59, 0x45, 0x52, 0x36, 0x39, 0x37, 0x44, 0x42, 0x2B, 0x09,
+    0x15, 0x22, 0x0F, 0x17, 0x17, 0x10, 0x01, 0x03, 0x32, 0x36, 0x3A, 0x3C, 0x25, 0x23, 0x1A, 0x1A,
+    0x15, 0x03, 0x24, 0x24, 0x03, 0x32, 0x42, 0x4A, 0x53, 0x3D, 0x3B, 0x35, 0x25, 0x25, 0x30, 0x44,
+    0x2B, 0x37, 0x3E, 0x43, 0x4D, 0x59, 0x5B, 0x56, 0x41, 0x4B, 0x3B, 0x3E, 0x46, 0x43, 0x3B, 0x30,
+    0x2E, 0x23, 0x15, 0x1B, 0x2A, 0x00, 0x2D, 0x44, 0x4C, 0x4A, 0x42, 0x32, 0x03, 0x24, 0x24, 0x2E,
+    0x2D, 0x09, 0x09, 0x2D, 0x44, 0x43, 0x4D, 0x4F, 0x4E, 0x4B, 0x31, 0x32, 0x32, 0x31, 0x40, 0x3B,
+    0x3B, 0x3A, 0x41, 0x55, 0x57, 0x68, 0x5C, 0x51, 0x48, 0x4B, 0x4B, 0x52, 0x41, 0x4B, 0x39, 0x26,
+    0x03, 0x2E, 0x1F, 0x1F, 0x2C, 0x2C, 0x3C, 0x3A, 0x47, 0x4D, 0x43, 0x44, 0x09, 0x09, 0x26, 0x3C,
+    0x30, 0x30, 0x39, 0x41, 0x56, 0x5B, 0x58, 0x48, 0x40, 0x44, 0x44, 0x46, 0x3D, 0x4B, 0x4B, 0x48,
+    0x51, 0x61, 0x68, 0x64, 0x5A, 0x59, 0x45, 0x47, 0x4A, 0x50, 0x45, 0x3D, 0x36, 0x2B, 0x27, 0x25,
+    0x2D, 0x2D, 0x1F, 0x25, 0x35, 0x3B, 0x52, 0x4D, 0x49, 0x48, 0x46, 0xFF, 0x00, 0x4F, 0x37, 0x2D,
+    0x2D, 0x2B, 0x3E, 0x3C, 0x39, 0x36, 0x52, 0x53, 0x54, 0x5A, 0x5E, 0x4D, 0x52, 0x46, 0x46, 0x4C,
+    0x41, 0x3D, 0x4A, 0x4E, 0x4F, 0x5F, 0x6B, 0x6A, 0x60, 0x5B, 0x58, 0x4D, 0x4E, 0x53, 0x53, 0x4A,
+    0x46, 0x3C, 0x2D, 0x26, 0x30, 0x35, 0x27, 0x2D, 0x37, 0x42, 0x4A, 0x53, 0x56, 0x50, 0x4B, 0x31,
+    0x32, 0x35, 0x3C, 0x36, 0x44, 0x3E, 0x40, 0x48, 0x58, 0x61, 0x5D, 0x5C, 0x51, 0x48, 0x4B, 0x3A,
+    0x52, 0x4E, 0x48, 0x41, 0x53, 0x5E, 0x65, 0x64, 0x6C, 0x69, 0x63, 0x55, 0x53, 0x03, 0x00, 0x00,
+    0x55, 0x01, 0x00, 0x00, 0xFF, 0x2D, 0x2C, 0x1A, 0x02, 0x18, 0x02, 0x10, 0x18, 0x02, 0x1A, 0x2C,
+    0x2D, 0x31, 0x36, 0x2B, 0x09, 0x15, 0x0F, 0x01, 0x1A, 0x2A, 0x15, 0x23, 0x03, 0x35, 0x3B, 0x43,
+    0x50, 0x43, 0x44, 0x30, 0x1F, 0x03, 0x25, 0x2B, 0x30, 0x35, 0x31, 0x3A, 0x41, 0x58, 0x4F, 0x45,
+    0x3D, 0x42, 0x39, 0x37, 0x39, 0x3E, 0x32, 0x03, 0x00, 0x01, 0x02, 0x0F, 0x22, 0x02, 0x10, 0x1E,
+    0x2E, 0x32, 0x3B, 0x40, 0x3C, 0x25, 0x23, 0x1A, 0x22, 0x00, 0x2C, 0x23, 0x24, 0x09, 0x32, 0x42,
+    0x3D, 0x45, 0x52, 0x3B, 0x35, 0x25, 0x1F, 0x2D, 0x3C, 0x32, 0x2B, 0x3E, 0x4C, 0x4E, 0x55, 0x5C,
+    0x49, 0x48, 0x40, 0x44, 0x31, 0x3B, 0x3A, 0x31, 0x26, 0x1B, 0x1E, 0x17, 0x15, 0x15, 0x1A, 0x17,
+    0x27, 0x39, 0x3A, 0x52, 0x3B, 0x30, 0x2C, 0x15, 0x00, 0x1B, 0x25, 0x2E, 0x2E, 0x27, 0x39, 0x4B,
+    0x50, 0x56, 0x41, 0x40, 0x3C, 0x30, 0x2D, 0x37, 0x36, 0x31, 0x44, 0x46, 0x48, 0x49, 0x5C, 0x5F,
+    0x59, 0x4D, 0x52, 0x46, 0x42, 0x3A, 0x4A, 0x46, 0x37, 0x1F, 0x1B, 0x2A, 0x2E, 0x2E, 0x24, 0x2B,
+    0x42, 0x4A, 0x41, 0x3A, 0x3C, 0x27, 0x2E, 0x2C, 0x25, 0x32, 0x27, 0x26, 0x2B, 0x42, 0x48, 0x49,
+    0x5C, 0x53, 0x3D, 0x36, 0x39, 0x3C, 0x3B, 0x4C, 0x46, 0x46, 0x52, 0x4D, 0x5E, 0x5A, 0x60, 0x57,
+    0x56, 0x50, 0x52, 0x43, 0x4A, 0x4E, 0x43, 0x3E, 0x35, 0x1F, 0x09, 0x27, 0x27, 0x03, 0x09, 0x44,
+    0x43, 0x4E, 0x51, 0x4A, 0x36, 0x27, 0x27, 0x35, 0x44, 0x2B, 0x37, 0x3E, 0x4D, 0x59, 0x5F, 0x4F,
+    0x50, 0x4C, 0x36, 0x36, 0x3A, 0x48, 0x43, 0x52, 0x41, 0x56, 0x57, 0x69, 0x6D, 0x68, 0x5C, 0x51,
+    0x50, 0x47, 0x4D, 0x53, 0x48, 0x46, 0x3C, 0x2D, 0x27, 0x30, 0x35, 0x27, 0x26, 0x37, 0x42, 0x48,
+    0x51, 0x55, 0x50, 0x4B, 0xFF, 0x00, 0x50, 0x31, 0x32, 0x35, 0x3C, 0x36, 0x31, 0x44, 0x46, 0x48,
+    0x58, 0x61, 0x68, 0x5C, 0x51, 0x4A, 0x4B, 0x3A, 0x52, 0x50, 0x48, 0x47, 0x53, 0x5E, 0x65, 0x64,
+    0x6E, 0x69, 0x57, 0x55, 0x45, 0x4D, 0x51, 0x51, 0x47, 0x40, 0x39, 0x30, 0x26, 0x35, 0x32, 0x2D,
+    0x30, 0x39, 0x40, 0x47, 0x51, 0x4F, 0x4D, 0x43, 0x3B, 0x37, 0x2B, 0x39, 0x46, 0x3E, 0x36, 0x4B,
+    0x50, 0x55, 0x57, 0x66, 0x5B, 0x58, 0x41, 0x43, 0x4C, 0x3D, 0x4E, 0x47, 0x50, 0x49, 0x5C, 0x68,
+    0x6D, 0x6E, 0x62, 0x5F, 0x4F, 0x51, 0x45, 0x03, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0xFF, 0x32,
+    0x09, 0x15, 0x0F, 0x02, 0x01, 0x22, 0x10, 0x0F, 0x15, 0x09, 0x2B, 0x3B, 0x3A, 0x31, 0x26, 0x1B,
+    0x1E, 0x17, 0x00, 0x2E, 0x2A, 0x2C, 0x27, 0x3C, 0x40, 0x4A, 0x53, 0x4A, 0x42, 0x37, 0x26, 0x25,
+    0x2D, 0x3C, 0x2B, 0x3C, 0x3B, 0x52, 0x4D, 0x55, 0x5E, 0x49, 0x47, 0x3A, 0x3E, 0x39, 0x44, 0x42,
+    0x3C, 0x27, 0x2A, 0x17, 0x22, 0x17, 0x1E, 0x22, 0x1A, 0x24, 0x27, 0x39, 0x46, 0x43, 0x3E, 0x30,
+    0x2E, 0x15, 0x00, 0x24, 0x1F, 0x2C, 0x2E, 0x26, 0x39, 0x4B, 0x41, 0x49, 0x47, 0x40, 0x3C, 0x30,
+    0x2D, 0x32, 0x44, 0x3C, 0x31, 0x42, 0x4A, 0x51, 0x54, 0x5B, 0x55, 0x4E, 0x4C, 0x36, 0x3E, 0x42,
+    0x43, 0x36, 0x32, 0x03, 0x24, 0x15, 0x2A, 0x2A, 0x15, 0x23, 0x35, 0x3B, 0x43, 0x48, 0x40, 0x37,
+    0x1F, 0x1B, 0x2A, 0x03, 0x30, 0x1F, 0x25, 0x35, 0x3B, 0x3D, 0x53, 0x59, 0x45, 0x43, 0x3E, 0x37,
+    0x2B, 0x31, 0x46, 0x3B, 0x36, 0x4C, 0x50, 0x4F, 0x63, 0x5D, 0x5C, 0x51, 0x48, 0x4B, 0x3A, 0x4C,
+    0x41, 0x4B, 0x31, 0x2D, 0x03, 0x2C, 0x09, 0x1F, 0x2C, 0x39, 0x4B, 0x41, 0x45, 0x52, 0x3E, 0x30,
+    0x1F, 0x09, 0x2D, 0x3C, 0x35, 0x35, 0x39, 0x3A, 0x50, 0x4F, 0x57, 0x56, 0x47, 0x40, 0x3E, 0x44,
+    0x46, 0x52, 0x3A, 0x4B, 0x48, 0x49, 0x61, 0x68, 0x62, 0x5A, 0x59, 0x45, 0x48, 0x3D, 0x47, 0x45,
+    0x4A, 0x42, 0x37, 0x26, 0x25, 0x2D, 0x30, 0x25, 0x27, 0x36, 0x4A, 0x53, 0x56, 0x41, 0x40, 0x30,
+    0x30, 0x37, 0x3B, 0x39, 0x31, 0x42, 0x49, 0x5C, 0x5D, 0x54, 0x45, 0x3D, 0x40, 0x46, 0x4C, 0x41,
+    0x3D, 0x48, 0x4D, 0x59, 0x5A, 0x6B, 0x6A, 0x60, 0x5B, 0x56, 0x4D, 0x50, 0x45, 0x49, 0x41, 0x3A,
+    0x31, 0x35, 0x2D, 0x35, 0x32, 0x2D, 0x35, 0x39, 0x3A, 0x41, 0x58, 0x59, 0x45, 0x43, 0xFF, 0x00,
+    0x4E, 0x3B, 0x37, 0x2B, 0x31, 0x46, 0x3B, 0x36, 0x4B, 0x50, 0x55, 0x63, 0x60, 0x57, 0x58, 0x41,
+    0x43, 0x4C, 0x3D, 0x4D, 0x47, 0x50, 0x49, 0x5C, 0x68, 0x67, 0x6E, 0x62, 0x5F, 0x59, 0x51, 0x45,
+    0x51, 0x51, 0x41, 0x4B, 0x31, 0x35, 0x2D, 0x35, 0x32, 0x30, 0x32, 0x44, 0x4B, 0x50, 0x58, 0x59,
+    0x53, 0x3D, 0x42, 0x39, 0x37, 0x31, 0x40, 0x36, 0x46, 0x43, 0x4D, 0x59, 0x63, 0x60, 0x63, 0x55,
+    0x4E, 0x3D, 0x43, 0x4A, 0x4D, 0x41, 0x4E, 0x58, 0x61, 0x66, 0x67, 0x6E, 0x6B, 0x5F, 0x59, 0x03,
+    0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xFF, 0x3C, 0x27, 0x2A, 0x17, 0x0F, 0x22, 0x1E, 0x1A, 0x1E,
+    0x1B, 0x26, 0x31, 0x46, 0x43, 0x36, 0x2B, 0x09, 0x24, 0x15, 0x2A, 0x1F, 0x03, 0x1F, 0x35, 0x3E,
+    0x43, 0x50, 0x58, 0x50, 0x4B, 0x44, 0x32, 0x30, 0x32, 0x31, 0x3C, 0x44, 0x40, 0x48, 0x51, 0x5E,
+    0x5C, 0x56, 0x50, 0x4C, 0x36, 0x44, 0x3E, 0x3A, 0x3E, 0x35, 0x2E, 0x15, 0x1E, 0x15, 0x23, 0x00,
+    0x23, 0x2E, 0x35, 0x3B, 0x4C, 0x48, 0x40, 0x3C, 0x25, 0x1B, 0x2A, 0x2E, 0x26, 0x1F, 0x27, 0x32,
+    0x36, 0x3D, 0x45, 0x4F, 0x4D, 0x43, 0x3E, 0x37, 0x32, 0x3C, 0x36, 0x44, 0x3B, 0x4B, 0x41, 0x56,
+    0x5B, 0x63, 0x5E, 0x53, 0x3D, 0x40, 0x42, 0x40, 0x4A, 0x40, 0x3C, 0x27, 0x2C, 0x2A, 0x2C, 0x2E,
+    0x2A, 0x2C, 0x3C, 0x40, 0x48, 0x4E, 0x43, 0x44, 0x30, 0x09, 0x03, 0x27, 0x2B, 0x2D, 0x30, 0x3C,
+    0x40, 0x41, 0x56, 0x61, 0x49, 0x48, 0x46, 0x31, 0x39, 0x3B, 0x4B, 0x46, 0x40, 0x3D, 0x53, 0x54,
+    0x65, 0x66, 0x57, 0x56, 0x50, 0x52, 0x4C, 0x52, 0x4E, 0x52, 0x36, 0x32, 0x25, 0x09, 0x27, 0x26,
+    0x09, 0x3B, 0x52, 0x4D, 0x58, 0x47, 0x46, 0x37, 0x2D, 0x26, 0x32, 0x44, 0x37, 0x3C, 0x3E, 0x52,
+    0x53, 0x54, 0x5A, 0x59, 0x4E, 0x43, 0x42, 0x36, 0x3A, 0x4A, 0x43, 0x52, 0x50, 0x55, 0x63, 0x69,
+    0x64, 0x5D, 0x5C, 0x51, 0x41, 0x48, 0x50, 0x51, 0x47, 0x3A, 0x31, 0x35, 0x26, 0x35, 0x32, 0x2D,
+    0x30, 0x40, 0x41, 0x49, 0x59, 0x4D, 0x43, 0x2B, 0x32, 0x39, 0x46, 0x3E, 0x3E, 0x3A, 0x55, 0x57,
+    0x66, 0x5B, 0x49, 0x48, 0x4C, 0x4B, 0x3D, 0x50, 0x48, 0x41, 0x51, 0x54, 0x5D, 0x6D, 0x6C, 0x69,
+    0x63, 0x4F, 0x53, 0x4E, 0x53, 0x58, 0x50, 0x4C, 0x3E, 0x2B, 0x30, 0x32, 0x37, 0x35, 0x2B, 0x3E,
+    0x4C, 0x4E, 0x56, 0x54, 0x51, 0x4A, 0xFF, 0x00, 0x49, 0x42, 0x31, 0x3C, 0x44, 0x3A, 0x42, 0x46,
+    0x52, 0x4D, 0x5E, 0x5A, 0x69, 0x5F, 0x55, 0x4E, 0x3D, 0x52, 0x48, 0x4D, 0x50, 0x4D, 0x56, 0x5B,
+    0x60, 0x6A, 0x6F, 0x6B, 0x5A, 0x5E, 0x49, 0x45, 0x51, 0x49, 0x50, 0x4C, 0x3E, 0x2B, 0x30, 0x35,
+    0x2B, 0x35, 0x37, 0x3B, 0x43, 0x4E, 0x56, 0x54, 0x49, 0x48, 0x40, 0x44, 0x39, 0x44, 0x3A, 0x42,
+    0x40, 0x3D, 0x53, 0x5E, 0x5A, 0x69, 0x5F, 0x59, 0x4D, 0x4A, 0x52, 0x48, 0x4D, 0x50, 0x4D, 0x56,
+    0x57, 0x60, 0x4B, 0x01, 0x05, 0x5A, 0x5E, 0x49, 0x45, 0x53, 0x03, 0x00, 0x00, 0x54, 0x01, 0x00,
+    0x00, 0xFF, 0x44, 0x35, 0x03, 0x23, 0x17, 0x1E, 0x23, 0x00, 0x24, 0x09, 0x32, 0x36, 0x4C, 0x48,
+    0x3A, 0x31, 0x2D, 0x03, 0x1B, 0x2E, 0x2D, 0x27, 0x2D, 0x3C, 0x46, 0x48, 0x45, 0x4F, 0x45, 0x3D,
+    0x42, 0x39, 0x2B, 0x3C, 0x3B, 0x44, 0x36, 0x4C, 0x50, 0x56, 0x5C, 0x5B, 0x59, 0x45, 0x3D, 0x40,
+    0x3B, 0x36, 0x52, 0x46, 0x37, 0x25, 0x1B, 0x23, 0x2A, 0x2C, 0x2A, 0x2C, 0x27, 0x3C, 0x40, 0x4A,
+    0x50, 0x43, 0x3E, 0x35, 0x1F, 0x03, 0x25, 0x32, 0x2D, 0x35, 0x31, 0x3A, 0x41, 0x58, 0x54, 0x49,
+    0x48, 0x40, 0x44, 0x39, 0x3E, 0x40, 0x36, 0x40, 0x3D, 0x45, 0x5E, 0x63, 0x65, 0x61, 0x58, 0x47,
+    0x4C, 0x40, 0x4B, 0x41, 0x43, 0x3E, 0x35, 0x1F, 0x2E, 0x09, 0x25, 0x03, 0x1F, 0x3E, 0x43, 0x4E,
+    0x51, 0x48, 0x42, 0x37, 0x26, 0x27, 0x30, 0x31, 0x2B, 0x37, 0x3E, 0x43, 0x45, 0x59, 0x63, 0x4F,
+    0x4E, 0x4C, 0x36, 0x3B, 0x46, 0x52, 0x4B, 0x43, 0x41, 0x58, 0x5B, 0x68, 0x69, 0x5A, 0x59, 0x45,
+    0x48, 0x3D, 0x4A, 0x53, 0x48, 0x40, 0x39, 0x30, 0x27, 0x2D, 0x35, 0x26, 0x40, 0x47, 0x51, 0x4F,
+    0x4D, 0x4C, 0x44, 0x32, 0x35, 0x3C, 0x36, 0x31, 0x44, 0x42, 0x48, 0x56, 0x5B, 0x68, 0x61, 0x51,
+    0x4A, 0x3A, 0x40, 0x43, 0x47, 0x4A, 0x48, 0x45, 0x5E, 0x65, 0x6B, 0x67, 0x66, 0x5B, 0x56, 0x4D,
+    0x41, 0x4E, 0x58, 0x4E, 0x4C, 0x3E, 0x2B, 0x35, 0x32, 0x37, 0x35, 0x2B, 0x4C, 0x4D, 0x55, 0x54,
+    0x51, 0x4A, 0x39, 0x3C, 0x3E, 0x3A, 0x36, 0x42, 0x43, 0x59, 0x5A, 0x69, 0x63, 0x55, 0x50, 0x52,
+    0x43, 0x48, 0x4D, 0x41, 0x4E, 0x58, 0x61, 0x66, 0x6A, 0x6E, 0x6B, 0x5A, 0x59, 0x51, 0x45, 0x51,
+    0x56, 0x4D, 0x52, 0x36, 0x3C, 0x32, 0x2B, 0x3C, 0x2B, 0x3C, 0x36, 0x3D, 0x45, 0x4F, 0x61, 0x56,
+    0x41, 0xFF, 0x00, 0x42, 0x3A, 0x3E, 0x31, 0x3B, 0x4C, 0x40, 0x3A, 0x4A, 0x51, 0x5C, 0x65, 0x6B,
+    0x65, 0x5E, 0x45, 0x48, 0x3D, 0x47, 0x45, 0x4E, 0x45, 0x55, 0x63, 0x69, 0x6C, 0x6F, 0x64, 0x65,
+    0x54, 0x58, 0x53, 0x51, 0x49, 0x4E, 0x43, 0x3B, 0x37, 0x35, 0x35, 0x37, 0x2B, 0x3C, 0x42, 0x3D,
+    0x45, 0x55, 0x5C, 0x56, 0x41, 0x4B, 0x3B, 0x31, 0x3E, 0x4B, 0x40, 0x4B, 0x48, 0x49, 0x5C, 0x65,
+    0x62, 0x65, 0x5E, 0x53, 0x47, 0x3D, 0x44, 0x01, 0x06, 0x45, 0x55, 0x63, 0x69, 0x6A, 0x6C, 0x4F,
+    0x01, 0x01, 0x45, 0x03, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0xFF, 0x42, 0x3C, 0x27, 0x1B, 0x23,
+    0x23, 0x1B, 0x2A, 0x2E, 0x2D, 0x31, 0x40, 0x3D, 0x50, 0x52, 0x36, 0x2B, 0x27, 0x09, 0x1F, 0x32,
+    0x35, 0x2B, 0x3E, 0x43, 0x4E, 0x58, 0x54, 0x58, 0x41, 0x4B, 0x3B, 0x31, 0x44, 0x42, 0x36, 0x40,
+    0x4A, 0x53, 0x59, 0x57, 0x63, 0x54, 0x49, 0x47, 0x4B, 0x46, 0x46, 0x48, 0x4B, 0x44, 0x30, 0x09,
+    0x2C, 0x2E, 0x09, 0x03, 0x1F, 0x35, 0x3B, 0x43, 0x41, 0x53, 0x48, 0x40, 0x3C, 0x2D, 0x27, 0x2D,
+    0x39, 0x2B, 0x3C, 0x36, 0x52, 0x45, 0x59, 0x57, 0x4F, 0x4E, 0x43, 0x42, 0x3B, 0x42, 0x4B, 0x3A,
+    0x4C, 0x47, 0x49, 0x61, 0x65, 0x68, 0x57, 0x55, 0x4E, 0x3D, 0x4C, 0x43, 0x4D, 0x4A, 0x46, 0x3C,
+    0x2D, 0x25, 0x27, 0x2D, 0x27, 0x2D, 0x46, 0x48, 0x53, 0x55, 0x4E, 0x4C, 0x44, 0x32, 0x35, 0x37,
+    0x3B, 0x31, 0x44, 0x46, 0x48, 0x58, 0x61, 0x65, 0x5C, 0x53, 0x3D, 0x3A, 0x46, 0x4B, 0x4A, 0x52,
+    0x4A, 0x4D, 0x4F, 0x5F, 0x69, 0x6B, 0x5D, 0x5C, 0x49, 0x50, 0x48, 0x47, 0x58, 0x50, 0x4C, 0x3E,
+    0x2B, 0x30, 0x32, 0x2B, 0x35, 0x4C, 0x4E, 0x56, 0x54, 0x51, 0x3D, 0x36, 0x39, 0x3C, 0x44, 0x40,
+    0x36, 0x36, 0x3A, 0x4E, 0x59, 0x5F, 0x60, 0x63, 0x56, 0x41, 0x43, 0x4C, 0x4A, 0x50, 0x47, 0x50,
+    0x49, 0x5C, 0x68, 0x6D, 0x6A, 0x69, 0x63, 0x4F, 0x53, 0x4E, 0x45, 0x55, 0x45, 0x3D, 0x42, 0x39,
+    0x2B, 0x37, 0x39, 0x37, 0x39, 0x3D, 0x53, 0x59, 0x5B, 0x56, 0x41, 0x3E, 0x44, 0x36, 0x4C, 0x40,
+    0x3A, 0x3D, 0x5C, 0x5D, 0x6B, 0x65, 0x59, 0x4D, 0x48, 0x3D, 0x47, 0x45, 0x4E, 0x45, 0x55, 0x57,
+    0x69, 0x6C, 0x6F, 0x64, 0x65, 0x54, 0x58, 0x53, 0x51, 0x55, 0x53, 0x4A, 0x46, 0x39, 0x2B, 0x37,
+    0x31, 0x3C, 0x44, 0x40, 0x48, 0x51, 0x5E, 0x57, 0x4F, 0x4E, 0xFF, 0x00, 0x1D, 0x4C, 0x42, 0x3E,
+    0x42, 0x43, 0x4B, 0x4C, 0x47, 0x58, 0x5B, 0x68, 0x64, 0x5D, 0x54, 0x51, 0x41, 0x48, 0x41, 0x53,
+    0x4D, 0x53, 0x59, 0x5F, 0x62, 0x6C, 0x6F, 0x6D, 0x5D, 0x5C, 0x20, 0x01, 0x2B, 0x4D, 0x52, 0x36,
+    0x3C, 0x35, 0x35, 0x3C, 0x37, 0x31, 0x46, 0x4A, 0x53, 0x4F, 0x61, 0x55, 0x4E, 0x43, 0x42, 0x3E,
+    0x3B, 0x4C, 0x3A, 0x43, 0x41, 0x58, 0x61, 0x5D, 0x6B, 0x5D, 0x5C, 0x51, 0x41, 0x4A, 0x47, 0x4D,
+    0x4E, 0x53, 0x4F, 0x63, 0x69, 0x67, 0x6A, 0x62, 0x4E, 0x01, 0x02, 0x4D, 0x4D, 0x03, 0x00, 0x00,
+    0x52, 0x01, 0x00, 0x00, 0xFF, 0x3A, 0x44, 0x35, 0x09, 0x1B, 0x1B, 0x03, 0x03, 0x27, 0x2B, 0x36,
+    0x43, 0x47, 0x53, 0x41, 0x4B, 0x44, 0x35, 0x26, 0x2D, 0x3C, 0x37, 0x31, 0x40, 0x48, 0x51, 0x4F,
+    0x5B, 0x4F, 0x45, 0x3D, 0x46, 0x3B, 0x36, 0x40, 0x40, 0x4C, 0x41, 0x58, 0x5C, 0x5F, 0x5F, 0x61,
+    0x56, 0x50, 0x52, 0x3A, 0x40, 0x50, 0x3D, 0x42, 0x3C, 0x26, 0x1F, 0x1F, 0x26, 0x27, 0x30, 0x39,
+    0x40, 0x48, 0x45, 0x56, 0x4D, 0x43, 0x3B, 0x37, 0x35, 0x2B, 0x3E, 0x31, 0x3E, 0x3A, 0x41, 0x58,
+    0x5C, 0x5A, 0x54, 0x51, 0x48, 0x4B, 0x46, 0x3A, 0x52, 0x43, 0x3D, 0x4D, 0x4F, 0x63, 0x66, 0x66,
+    0x5A, 0x5E, 0x53, 0x47, 0x52, 0x3D, 0x51, 0x41, 0x4C, 0x3E, 0x32, 0x2D, 0x30, 0x2B, 0x35, 0x2B,
+    0x4C, 0x4E, 0x58, 0x5E, 0x51, 0x4A, 0x42, 0x39, 0x3C, 0x31, 0x46, 0x36, 0x42, 0x4C, 0x4E, 0x59,
+    0x63, 0x66, 0x57, 0x56, 0x41, 0x43, 0x4C, 0x52, 0x47, 0x48, 0x41, 0x51, 0x54, 0x5D, 0x6B, 0x6D,
+    0x66, 0x5B, 0x56, 0x4D, 0x41, 0x50, 0x55, 0x45, 0x3D, 0x42, 0x39, 0x2B, 0x37, 0x39, 0x37, 0x4A,
+    0x51, 0x59, 0x5B, 0x56, 0x41, 0x3A, 0x3E, 0x44, 0x36, 0x4C, 0x40, 0x40, 0x43, 0x53, 0x5C, 0x5D,
+    0x6B, 0x5A, 0x59, 0x4D, 0x4A, 0x3D, 0x47, 0x4D, 0x50, 0x4D, 0x56, 0x57, 0x60, 0x6A, 0x6E, 0x6B,
+    0x5A, 0x5E, 0x49, 0x45, 0x53, 0x59, 0x51, 0x47, 0x3A, 0x44, 0x3C, 0x39, 0x44, 0x31, 0x3E, 0x47,
+    0x58, 0x54, 0x63, 0x59, 0x4D, 0x42, 0x36, 0x46, 0x52, 0x4B, 0x43, 0x47, 0x57, 0x66, 0x6D, 0x68,
+    0x54, 0x51, 0x41, 0x48, 0x50, 0x53, 0x4D, 0x51, 0x59, 0x5F, 0x6B, 0x6E, 0x6F, 0x6D, 0x5D, 0x5C,
+    0x56, 0x51, 0x51, 0x4F, 0x51, 0x47, 0x3A, 0x44, 0x3C, 0x3C, 0x44, 0x31, 0x3B, 0x4B, 0x41, 0x58,
+    0x54, 0x63, 0x5E, 0x45, 0xFF, 0x00, 0x19, 0x3D, 0x40, 0x36, 0x46, 0x52, 0x4C, 0x3D, 0x50, 0x55,
+    0x63, 0x66, 0x6D, 0x66, 0x61, 0x58, 0x4E, 0x47, 0x50, 0x53, 0x45, 0x49, 0x5E, 0x5A, 0x6B, 0x6E,
+    0x1C, 0x01, 0x01, 0x56, 0x21, 0x01, 0x19, 0x3D, 0x46, 0x39, 0x32, 0x32, 0x3C, 0x3C, 0x3E, 0x3A,
+    0x47, 0x51, 0x4F, 0x5B, 0x59, 0x45, 0x3D, 0x46, 0x3B, 0x36, 0x4C, 0x4B, 0x52, 0x4E, 0x55, 0x57,
+    0x3D, 0x01, 0x0D, 0x61, 0x58, 0x50, 0x48, 0x47, 0x4E, 0x4E, 0x53, 0x59, 0x5F, 0x69, 0x67, 0x67,
+    0x4F, 0x01, 0x01, 0x4E, 0x03, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xFF, 0x52, 0x42, 0x3C, 0x26,
+    0x09, 0x2E, 0x27, 0x27, 0x35, 0x44, 0x3A, 0x48, 0x4D, 0x58, 0x45, 0x3D, 0x42, 0x39, 0x32, 0x2B,
+    0x3E, 0x44, 0x42, 0x43, 0x4E, 0x55, 0x5C, 0x5F, 0x5C, 0x49, 0x41, 0x4C, 0x40, 0x40, 0x4B, 0x4C,
+    0x4A, 0x4D, 0x4F, 0x57, 0x65, 0x65, 0x57, 0x59, 0x45, 0x4A, 0x4C, 0x4B, 0x45, 0x47, 0x4B, 0x3E,
+    0x32, 0x26, 0x26, 0x35, 0x35, 0x37, 0x3B, 0x43, 0x4E, 0x49, 0x5E, 0x49, 0x48, 0x40, 0x44, 0x39,
+    0x31, 0x46, 0x36, 0x40, 0x3D, 0x45, 0x59, 0x63, 0x68, 0x57, 0x55, 0x50, 0x52, 0x4C, 0x43, 0x4A,
+    0x4A, 0x41, 0x51, 0x54, 0x65, 0x69, 0x69, 0x5D, 0x61, 0x58, 0x50, 0x48, 0x4A, 0x56, 0x45, 0x3D,
+    0x46, 0x39, 0x2B, 0x2B, 0x39, 0x3C, 0x31, 0x48, 0x51, 0x59, 0x5B, 0x55, 0x50, 0x4B, 0x36, 0x3E,
+    0x36, 0x4C, 0x40, 0x4B, 0x4A, 0x51, 0x5C, 0x5D, 0x62, 0x5A, 0x59, 0x4D, 0x48, 0x3D, 0x48, 0x4E,
+    0x41, 0x4D, 0x56, 0x5B, 0x66, 0x6D, 0x67, 0x69, 0x5F, 0x59, 0x53, 0x4E, 0x4E, 0x59, 0x49, 0x41,
+    0x4B, 0x3E, 0x39, 0x39, 0x3E, 0x44, 0x41, 0x56, 0x5C, 0x5F, 0x5E, 0x4D, 0x43, 0x46, 0x36, 0x40,
+    0x3D, 0x4C, 0x43, 0x4A, 0x58, 0x57, 0x60, 0x6D, 0x68, 0x54, 0x53, 0x41, 0x47, 0x50, 0x53, 0x4D,
+    0x51, 0x59, 0x5F, 0x62, 0x6E, 0x6E, 0x64, 0x5D, 0x5C, 0x56, 0x53, 0x51, 0x5E, 0x58, 0x50, 0x4C,
+    0x36, 0x31, 0x31, 0x3B, 0x3E, 0x42, 0x4E, 0x55, 0x61, 0x5A, 0x54, 0x53, 0x3A, 0x46, 0x3A, 0x4A,
+    0x52, 0x3D, 0x50, 0x5F, 0x69, 0x67, 0x66, 0x61, 0x58, 0x4E, 0x41, 0x4D, 0x51, 0x53, 0x49, 0x5E,
+    0x65, 0x64, 0x6F, 0x6F, 0x67, 0x68, 0x61, 0x55, 0x51, 0x49, 0x4F, 0x49, 0x41, 0x4B, 0x3B, 0x39,
+    0x39, 0x3E, 0x3E, 0x42, 0x43, 0x4E, 0x55, 0x5C, 0x5F, 0x54, 0x51, 0xFF, 0x00, 0x12, 0x48, 0x4B,
+    0x46, 0x3A, 0x4A, 0x52, 0x4A, 0x4D, 0x59, 0x5F, 0x60, 0x67, 0x60, 0x5B, 0x56, 0x4D, 0x50, 0x4E,
+    0x14, 0x01, 0x2D, 0x54, 0x65, 0x6B, 0x6E, 0x6E, 0x64, 0x5D, 0x61, 0x56, 0x53, 0x53, 0x49, 0x45,
+    0x4A, 0x40, 0x31, 0x2B, 0x32, 0x39, 0x39, 0x3B, 0x4C, 0x41, 0x49, 0x59, 0x57, 0x5E, 0x53, 0x48,
+    0x3A, 0x42, 0x42, 0x43, 0x43, 0x4A, 0x4D, 0x4F, 0x63, 0x68, 0x6B, 0x68, 0x5B, 0x56, 0x4E, 0x47,
+    0x44, 0x01, 0x01, 0x51, 0x48, 0x01, 0x08, 0x6D, 0x6D, 0x69, 0x5A, 0x5E, 0x51, 0x4E, 0x50, 0x03,
+    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xE6, 0x48, 0x4B, 0x3E, 0x32, 0x27, 0x25, 0x30, 0x35, 0x3C,
+    0x42, 0x3D, 0x4E, 0x51, 0x59, 0x58, 0x50, 0x4C, 0x3B, 0x31, 0x39, 0x42, 0x42, 0x4B, 0x48, 0x51,
+    0x5E, 0x57, 0x65, 0x57, 0x4F, 0x4D, 0x4A, 0x4C, 0x4C, 0x52, 0x52, 0x41, 0x51, 0x54, 0x5F, 0x68,
+    0x5D, 0x5F, 0x54, 0x51, 0x41, 0x52, 0x4C, 0x49, 0x4D, 0x3D, 0x46, 0x39, 0x32, 0x35, 0x3C, 0x3C,
+    0x3E, 0x3A, 0x47, 0x51, 0x4F, 0x61, 0x4F, 0x4D, 0x52, 0x46, 0x3B, 0x36, 0x4B, 0x3A, 0x43, 0x41,
+    0x58, 0x61, 0x65, 0x69, 0x5A, 0x5E, 0x53, 0x47, 0x3D, 0x4A, 0x47, 0x47, 0x4D, 0x56, 0x5B, 0x68,
+    0x6B, 0x62, 0x66, 0x57, 0x4F, 0x45, 0x41, 0x47, 0x4F, 0x49, 0x41, 0x4B, 0x3B, 0x39, 0x39, 0x3E,
+    0x44, 0x36, 0x4E, 0x56, 0x5C, 0x5F, 0x54, 0x53, 0x3D, 0x3A, 0x46, 0x40, 0x3D, 0x43, 0x52, 0x50,
+    0x56, 0x63, 0x66, 0x64, 0x68, 0x5C, 0x49, 0x50, 0x47, 0x50, 0x45, 0x4D, 0x51, 0x59, 0x5F, 0x62,
+    0x6A, 0x6A, 0x6B, 0x65, 0x54, 0x58, 0x45, 0x45, 0x54, 0x55, 0x4D, 0x52, 0x42, 0x3E, 0x3E, 0x42,
+    0x36, 0x45, 0x59, 0x5B, 0x65, 0x61, 0x51, 0x4A, 0x4B, 0x3A, 0x4C, 0x48, 0x3D, 0x3D, 0x41, 0x4F,
+    0x5A, 0x62, 0x6A, 0x60, 0x5B, 0x58, 0x4D, 0x50, 0x4D, 0x51, 0x53, 0x58, 0x54, 0x65, 0x64, 0x6F,
+    0x6F, 0x6D, 0x68, 0x61, 0x55, 0x51, 0x51, 0x54, 0x55, 0x4D, 0x52, 0x46, 0x3E, 0x3E, 0x42, 0x36,
+    0x40, 0x53, 0x59, 0x57, 0x5D, 0x5B, 0x58, 0x43, 0x4B, 0x4C, 0x47, 0x4A, 0x48, 0x45, 0x65, 0x62,
+    0x6A, 0x69, 0x57, 0x55, 0x45, 0x4E, 0x45, 0x49, 0x51, 0x56, 0x5C, 0x5D, 0x6D, 0xE9, 0x00, 0x30,
+    0x66, 0x5B, 0x4F, 0x49, 0x49, 0x59, 0x58, 0x4E, 0x43, 0x42, 0x31, 0x39, 0x3B, 0x3B, 0x40, 0x3D,
+    0x45, 0x4F, 0x61, 0x5A, 0x61, 0x58, 0x41, 0x43, 0x3A, 0x4B, 0x48, 0x4A, 0x47, 0x53, 0x5E, 0x5A,
+    0x69, 0x67, 0x60, 0x63, 0x4F, 0x45, 0x4E, 0x4E, 0x53, 0x53, 0x58, 0x5C, 0x65, 0x64, 0x6C, 0x6C,
+    0x1E, 0x01, 0x1C, 0x45, 0x49, 0x45, 0x48, 0x3A, 0x44, 0x2B, 0x32, 0x31, 0x31, 0x42, 0x43, 0x4E,
+    0x58, 0x59, 0x57, 0x54, 0x49, 0x47, 0x4C, 0x46, 0x46, 0x52, 0x52, 0x48, 0x53, 0x5E, 0x5F, 0x3E,
+    0x01, 0x12, 0x55, 0x4D, 0x47, 0x47, 0x50, 0x4E, 0x51, 0x5E, 0x5F, 0x69, 0x64, 0x6B, 0x60, 0x5F,
+    0x5E, 0x51, 0x50, 0x41, 0x01, 0x00, 0x00, 0x57, 0x01, 0x4E, 0x3D, 0x46, 0x39, 0x35, 0x2D, 0x37,
+    0x3C, 0x3B, 0x4C, 0x41, 0x51, 0x56, 0x5C, 0x4F, 0x53, 0x4A, 0x3A, 0x36, 0x3B, 0x4B, 0x4B, 0x3D,
+    0x4D, 0x55, 0x5B, 0x5A, 0x66, 0x5A, 0x5C, 0x49, 0x50, 0x3D, 0x3D, 0x4A, 0x48, 0x4D, 0x56, 0x5B,
+    0x5D, 0x60, 0x68, 0x65, 0x61, 0x56, 0x4E, 0x4A, 0x52, 0x55, 0x51, 0x41, 0x4C, 0x3B, 0x39, 0x37,
+    0x3E, 0x3E, 0x46, 0x52, 0x4D, 0x55, 0x54, 0x63, 0x5C, 0x49, 0x47, 0x4C, 0x40, 0x40, 0x3D, 0x52,
+    0x48, 0x45, 0x59, 0x5F, 0x66, 0x6B, 0x68, 0x5B, 0x56, 0x4D, 0x41, 0x41, 0x4E, 0x4E, 0x51, 0x59,
+    0x5F, 0x69, 0x6D, 0x64, 0x60, 0x5F, 0x5E, 0x51, 0x4E, 0x41, 0x54, 0x55, 0x45, 0x3D, 0x40, 0x3B,
+    0x3E, 0x46, 0x42, 0x3A, 0x53, 0x5E, 0x57, 0x5D, 0x5B, 0x58, 0x41, 0x43, 0x4B, 0x43, 0x47, 0x4A,
+    0x47, 0x45, 0x5E, 0x65, 0x62, 0x67, 0x69, 0x57, 0x55, 0x45, 0x4E, 0x4D, 0x53, 0x53, 0x58, 0x54,
+    0x65, 0x64, 0x6E, 0x6C, 0x64, 0x68, 0x61, 0x55, 0x51, 0x53, 0x61, 0x59, 0x53, 0x48, 0x3A, 0x36,
+    0x36, 0x40, 0x40, 0x49, 0x54, 0x5F, 0x66, 0x57, 0x56, 0x50, 0x52, 0x43, 0x52, 0x50, 0x48, 0x47,
+    0x4E, 0x5E, 0x5D, 0x64, 0x6C, 0x62, 0x63, 0x55, 0x53, 0x4D, 0x53, 0x49, 0x49, 0x55, 0x61, 0x68,
+    0x6D, 0x70, 0x6F, 0x67, 0x66, 0x57, 0x4F, 0x49, 0x49, 0x5C, 0x59, 0x53, 0x48, 0x3A, 0x36, 0x3B,
+    0x40, 0x40, 0x4C, 0x49, 0x54, 0x63, 0x68, 0x63, 0x55, 0x3D, 0x43, 0x52, 0x50, 0x47, 0x41, 0x51,
+    0x5D, 0x64, 0x6C, 0x62, 0x5F, 0x4F, 0x51, 0x45, 0x53, 0x49, 0x49, 0x55, 0x61, 0x68, 0x6D, 0x6F,
+    0x6E, 0x67, 0x66, 0x57, 0x4F, 0x49, 0x51, 0x59, 0x56, 0x4D, 0x3D, 0x46, 0x3E, 0x31, 0x42, 0x42,
+    0x4B, 0x48, 0x51, 0x5E, 0x5B, 0x65, 0x5B, 0x55, 0x4E, 0x3D, 0x4C, 0x4C, 0x47, 0x48, 0x50, 0x49,
+    0x5C, 0x5D, 0x62, 0x67, 0x69, 0x5F, 0x59, 0x51, 0x4E, 0x4D, 0x45, 0x53, 0x56, 0x5C, 0x5D, 0x64,
+    0x6C, 0x67, 0x6B, 0x5D, 0x61, 0x56, 0x53, 0x4D, 0x49, 0x53, 0x47, 0x4B, 0x3E, 0x37, 0x32, 0x31,
+    0x3E, 0x46, 0x3D, 0x4D, 0x56, 0x59, 0x63, 0x5C, 0x58, 0x50, 0x43, 0x40, 0x46, 0x52, 0x3D, 0x41,
+    0x51, 0x54, 0x5F, 0x68, 0x62, 0x68, 0x57, 0x55, 0x45, 0x41, 0x47, 0x41, 0x4E, 0x51, 0x5E, 0x5F,
+    0x60, 0x6B, 0x69, 0x66, 0x63, 0x59, 0x53, 0x41, 0x48, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+    0x03, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0xFF, 0x53, 0x41, 0x4C, 0x3B, 0x3C, 0x32, 0x31, 0x3E,
+    0x40, 0x4A, 0x45, 0x55, 0x59, 0x57, 0x5C, 0x56, 0x4E, 0x52, 0x3A, 0x40, 0x52, 0x3D, 0x41, 0x49,
+    0x54, 0x5F, 0x68, 0x69, 0x68, 0x57, 0x4F, 0x45, 0x41, 0x48, 0x47, 0x50, 0x51, 0x59, 0x63, 0x66,
+    0x62, 0x66, 0x5D, 0x57, 0x4F, 0x45, 0x47, 0x3D, 0x59, 0x55, 0x45, 0x4A, 0x40, 0x3E, 0x44, 0x42,
+    0x46, 0x4C, 0x41, 0x49, 0x54, 0x5B, 0x5D, 0x57, 0x4F, 0x45, 0x4A, 0x43, 0x43, 0x47, 0x47, 0x4E,
+    0x58, 0x61, 0x5D, 0x62, 0x6D, 0x69, 0x5F, 0x59, 0x51, 0x4D, 0x4D, 0x45, 0x53, 0x56, 0x5C, 0x65,
+    0x6B, 0x67, 0x64, 0x62, 0x65, 0x5C, 0x58, 0x45, 0x4E, 0x61, 0x5E, 0x49, 0x41, 0x4C, 0x46, 0x36,
+    0x4B, 0x4B, 0x52, 0x56, 0x61, 0x5F, 0x60, 0x5F, 0x59, 0x45, 0x48, 0x3D, 0x4A, 0x4E, 0x41, 0x4E,
+    0x49, 0x61, 0x66, 0x6D, 0x6C, 0x6B, 0x5A, 0x5E, 0x49, 0x53, 0x53, 0x49, 0x49, 0x4F, 0x5B, 0x68,
+    0x6D, 0x6F, 0x6C, 0x6D, 0x66, 0x57, 0x4F, 0x49, 0x51, 0x57, 0x54, 0x58, 0x50, 0x43, 0x40, 0x46,
+    0x4C, 0x4C, 0x55, 0x5B, 0x65, 0x69, 0x5A, 0x59, 0x45, 0x48, 0x4A, 0x48, 0x4D, 0x50, 0x4E, 0x53,
+    0x61, 0x66, 0x67, 0x6E, 0x64, 0x5A, 0x59, 0x49, 0x53, 0x49, 0x58, 0x58, 0x4F, 0x5B, 0x66, 0x67,
+    0x70, 0x6F, 0x6A, 0x60, 0x63, 0x59, 0x58, 0x49, 0x61, 0x5E, 0x49, 0x41, 0x4C, 0x46, 0x42, 0x4B,
+    0x4B, 0x52, 0x56, 0x61, 0x5A, 0x60, 0x5F, 0x59, 0x48, 0x3D, 0x4A, 0x4E, 0x50, 0x4E, 0x58, 0x66,
+    0x6D, 0x6C, 0x6B, 0x5A, 0x5E, 0x49, 0x53, 0x51, 0x49, 0x49, 0x4F, 0x5B, 0x66, 0x67, 0x6F, 0x6E,
+    0x6D, 0x66, 0x57, 0x59, 0x49, 0x51, 0x5E, 0x55, 0x45, 0x4A, 0x3A, 0x3B, 0x44, 0x46, 0x40, 0x43,
+    0x41, 0x49, 0x54, 0x5B, 0x5D, 0x63, 0x59, 0xFF, 0x00, 0x09, 0x45, 0x48, 0x43, 0x43, 0x47, 0x47,
+    0x4E, 0x58, 0x61, 0x0D, 0x01, 0x03, 0x5E, 0x51, 0x4D, 0x16, 0x01, 0x04, 0x6B, 0x6A, 0x6D, 0x62,
+    0x1D, 0x01, 0x22, 0x45, 0x4E, 0x49, 0x53, 0x41, 0x4C, 0x3B, 0x3C, 0x32, 0x44, 0x3B, 0x3A, 0x4A,
+    0x45, 0x55, 0x5E, 0x63, 0x61, 0x55, 0x4E, 0x3D, 0x3A, 0x40, 0x52, 0x3D, 0x50, 0x49, 0x5C, 0x5A,
+    0x68, 0x69, 0x68, 0x57, 0x4F, 0x42, 0x01, 0x02, 0x47, 0x50, 0x47, 0x01, 0x09, 0x66, 0x62, 0x66,
+    0x5D, 0x57, 0x59, 0x53, 0x47, 0x3D, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0xE8, 0x58, 0x45,
+    0x4A, 0x40, 0x44, 0x3C, 0x36, 0x40, 0x52, 0x50, 0x58, 0x5E, 0x5C, 0x5A, 0x63, 0x5E, 0x51, 0x41,
+    0x52, 0x4C, 0x48, 0x41, 0x45, 0x4F, 0x57, 0x68, 0x60, 0x6B, 0x69, 0x5A, 0x54, 0x58, 0x4D, 0x50,
+    0x50, 0x4D, 0x58, 0x5C, 0x65, 0x69, 0x6B, 0x60, 0x68, 0x5F, 0x5E, 0x51, 0x50, 0x4A, 0x5C, 0x5E,
+    0x58, 0x50, 0x43, 0x46, 0x36, 0x4B, 0x4C, 0x48, 0x45, 0x4F, 0x5B, 0x5F, 0x60, 0x65, 0x5C, 0x58,
+    0x4E, 0x48, 0x4A, 0x4E, 0x4D, 0x51, 0x59, 0x63, 0x60, 0x64, 0x6A, 0x64, 0x5D, 0x61, 0x56, 0x51,
+    0x53, 0x51, 0x49, 0x4F, 0x57, 0x66, 0x6D, 0x6C, 0x6D, 0x6B, 0x68, 0x5B, 0x4F, 0x53, 0x4D, 0x57,
+    0x61, 0x55, 0x4D, 0x4A, 0x4B, 0x40, 0x52, 0x52, 0x47, 0x5E, 0x63, 0x5D, 0x62, 0x5D, 0x5C, 0x49,
+    0x4E, 0x47, 0x41, 0x45, 0x45, 0x53, 0x4F, 0x63, 0x69, 0x6A, 0x6F, 0x6D, 0x5D, 0x5C, 0x55, 0x49,
+    0x58, 0x58, 0x56, 0x5E, 0x63, 0x60, 0x6A, 0x70, 0x6E, 0x67, 0x69, 0x5F, 0x5E, 0x58, 0x51, 0x63,
+    0x61, 0x4F, 0x45, 0x4A, 0x4C, 0x3A, 0x52, 0x3D, 0x5E, 0x63, 0x5D, 0x62, 0x5D, 0x5C, 0x51, 0x50,
+    0x47, 0x41, 0x53, 0x4D, 0x45, 0x49, 0x57, 0x69, 0x6A, 0x6F, 0x6D, 0x5D, 0x54, 0x56, 0x49, 0x58,
+    0x56, 0x56, 0x5E, 0x63, 0x60, 0x6A, 0x70, 0x6E, 0x6A, 0x69, 0x5F, 0x5E, 0x56, 0x49, 0x5B, 0x5C,
+    0x56, 0x4E, 0x52, 0x3A, 0x46, 0x4C, 0x43, 0x48, 0x4F, 0x57, 0x65, 0x69, 0x65, 0x54, 0x50, 0x48,
+    0x47, 0x4D, 0x4E, 0x45, 0x56, 0x60, 0x6D, 0x6E, 0x64, 0x65, 0x54, 0x58, 0x51, 0x51, 0x49, 0x58,
+    0x4F, 0x57, 0x66, 0x67, 0x6E, 0x6A, 0xED, 0x00, 0x3F, 0x53, 0x5E, 0x4F, 0x51, 0x47, 0x4B, 0x36,
+    0x44, 0x40, 0x3A, 0x52, 0x4E, 0x56, 0x5C, 0x57, 0x5D, 0x5F, 0x5E, 0x51, 0x47, 0x3D, 0x52, 0x41,
+    0x41, 0x45, 0x55, 0x5B, 0x68, 0x62, 0x6D, 0x69, 0x5A, 0x5E, 0x49, 0x45, 0x4D, 0x4D, 0x53, 0x56,
+    0x61, 0x5D, 0x6B, 0x67, 0x6B, 0x69, 0x65, 0x5C, 0x58, 0x4D, 0x50, 0x49, 0x51, 0x50, 0x43, 0x36,
+    0x39, 0x32, 0x44, 0x36, 0x4B, 0x47, 0x51, 0x4F, 0x2F, 0x01, 0x09, 0x4F, 0x45, 0x4A, 0x4B, 0x3A,
+    0x3D, 0x4A, 0x4E, 0x58, 0x3F, 0x01, 0x11, 0x53, 0x41, 0x48, 0x48, 0x50, 0x51, 0x59, 0x63, 0x68,
+    0x60, 0x5D, 0x65, 0x5B, 0x4F, 0x45, 0x48, 0x52, 0x03, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0xE9,
+    0x4F, 0x49, 0x50, 0x43, 0x42, 0x44, 0x3A, 0x43, 0x47, 0x51, 0x59, 0x5B, 0x57, 0x68, 0x65, 0x5B,
+    0x4F, 0x45, 0x47, 0x4A, 0x50, 0x45, 0x58, 0x5C, 0x65, 0x69, 0x6B, 0x6D, 0x6B, 0x68, 0x5B, 0x4F,
+    0x51, 0x4D, 0x4D, 0x51, 0x4F, 0x57, 0x68, 0x6B, 0x64, 0x60, 0x60, 0x65, 0x5C, 0x58, 0x4E, 0x48,
+    0x5B, 0x61, 0x4F, 0x53, 0x48, 0x4C, 0x40, 0x52, 0x4A, 0x4E, 0x58, 0x5C, 0x5A, 0x5D, 0x62, 0x66,
+    0x63, 0x59, 0x51, 0x4E, 0x50, 0x53, 0x51, 0x56, 0x5C, 0x5D, 0x6B, 0x6A, 0x6E, 0x67, 0x60, 0x63,
+    0x5E, 0x56, 0x49, 0x49, 0x56, 0x54, 0x5F, 0x69, 0x67, 0x6E, 0x6D, 0x64, 0x60, 0x63, 0x59, 0x49,
+    0x45, 0x5F, 0x57, 0x5E, 0x49, 0x41, 0x52, 0x4C, 0x48, 0x47, 0x4D, 0x61, 0x65, 0x66, 0x64, 0x60,
+    0x63, 0x4F, 0x53, 0x4D, 0x4D, 0x49, 0x51, 0x56, 0x54, 0x65, 0x64, 0x6C, 0x70, 0x6A, 0x66, 0x57,
+    0x59, 0x55, 0x56, 0x55, 0x4F, 0x5C, 0x5A, 0x62, 0x6C, 0x70, 0x6C, 0x6A, 0x62, 0x5A, 0x54, 0x56,
+    0x49, 0x5F, 0x57, 0x5E, 0x51, 0x41, 0x52, 0x4C, 0x4A, 0x48, 0x5C, 0x65, 0x66, 0x64, 0x66, 0x5B,
+    0x56, 0x45, 0x4E, 0x4E, 0x51, 0x51, 0x49, 0x56, 0x5F, 0x6B, 0x6C, 0x70, 0x67, 0x68, 0x61, 0x4F,
+    0x56, 0x56, 0x56, 0x55, 0x54, 0x5F, 0x69, 0x6C, 0x70, 0x6E, 0x67, 0x69, 0x5F, 0x54, 0x56, 0x49,
+    0x57, 0x61, 0x4F, 0x45, 0x4A, 0x4C, 0x40, 0x52, 0x3D, 0x41, 0x5E, 0x63, 0x5D, 0x62, 0x5D, 0x61,
+    0x4D, 0x41, 0x41, 0x45, 0x45, 0x51, 0x4F, 0x69, 0x67, 0x6C, 0x64, 0x5D, 0x5C, 0x55, 0x49, 0x49,
+    0x49, 0x58, 0x59, 0x57, 0x66, 0x6D, 0x6C, 0x67, 0x64, 0xED, 0x00, 0x3E, 0x45, 0x5E, 0x4F, 0x49,
+    0x41, 0x43, 0x42, 0x3E, 0x3A, 0x4C, 0x4A, 0x45, 0x55, 0x61, 0x57, 0x68, 0x5F, 0x54, 0x49, 0x50,
+    0x4A, 0x3D, 0x41, 0x50, 0x53, 0x4F, 0x57, 0x66, 0x62, 0x64, 0x69, 0x5A, 0x54, 0x58, 0x45, 0x4D,
+    0x4E, 0x45, 0x56, 0x5C, 0x65, 0x62, 0x64, 0x69, 0x60, 0x5A, 0x54, 0x58, 0x4E, 0x47, 0x51, 0x51,
+    0x4E, 0x3D, 0x46, 0x31, 0x2B, 0x3E, 0x42, 0x4C, 0x41, 0x49, 0x2E, 0x01, 0x11, 0x5B, 0x59, 0x53,
+    0x48, 0x43, 0x3A, 0x3D, 0x48, 0x4D, 0x56, 0x61, 0x5A, 0x5D, 0x66, 0x68, 0x63, 0x59, 0x42, 0x01,
+    0x0E, 0x4A, 0x41, 0x53, 0x59, 0x63, 0x5D, 0x66, 0x5F, 0x5F, 0x61, 0x55, 0x4D, 0x4A, 0x4C, 0x03,
+    0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0x89, 0x5C, 0x4F, 0x53, 0x48, 0x4B, 0x42, 0x43, 0x48, 0x4D,
+    0x55, 0x61, 0x5F, 0x5A, 0x69, 0x60, 0x5A, 0x5C, 0x58, 0x4D, 0x41, 0x45, 0x49, 0x59, 0x57, 0x66,
+    0x64, 0x6D, 0x6A, 0x6D, 0x69, 0x5F, 0x54, 0x56, 0x51, 0x45, 0x58, 0x5E, 0x5F, 0x60, 0x64, 0x6D,
+    0x60, 0x69, 0x5D, 0x5B, 0x55, 0x45, 0x41, 0x5F, 0x63, 0x5C, 0x56, 0x4E, 0x3D, 0x4C, 0x47, 0x50,
+    0x51, 0x59, 0x63, 0x68, 0x66, 0x6D, 0x62, 0x5D, 0x61, 0x55, 0x51, 0x45, 0x58, 0x56, 0x5E, 0x63,
+    0x60, 0x67, 0x6E, 0x6F, 0x6C, 0x62, 0x5A, 0x5C, 0x4F, 0x55, 0x56, 0x4F, 0x61, 0x65, 0x6B, 0x6C,
+    0x6E, 0x67, 0x6D, 0x69, 0x5A, 0x54, 0x58, 0x53, 0x65, 0x5A, 0x61, 0x55, 0x4D, 0x48, 0x52, 0x41,
+    0x4E, 0x51, 0x63, 0x66, 0x69, 0x67, 0x6B, 0x65, 0x54, 0x56, 0x51, 0x53, 0x56, 0x56, 0x4F, 0x61,
+    0x68, 0x67, 0x6F, 0x71, 0x6C, 0x69, 0x5F, 0x5C, 0x59, 0x4F, 0x4F, 0x59, 0x61, 0x65, 0x6B, 0x6E,
+    0x8D, 0x00, 0x30, 0x65, 0x5C, 0x55, 0x49, 0x5A, 0x5F, 0x5C, 0x56, 0x4E, 0x4A, 0x52, 0x41, 0x50,
+    0x57, 0x68, 0x60, 0x6D, 0x69, 0x63, 0x4F, 0x49, 0x45, 0x45, 0x58, 0x58, 0x56, 0x4F, 0x65, 0x64,
+    0x6E, 0x70, 0x6A, 0x66, 0x5B, 0x59, 0x55, 0x55, 0x55, 0x4F, 0x5C, 0x5A, 0x62, 0x6C, 0x6F, 0x6A,
+    0x67, 0x69, 0x5A, 0xC1, 0x00, 0x17, 0x5B, 0x59, 0x51, 0x47, 0x43, 0x3A, 0x3D, 0x48, 0x4E, 0x5C,
+    0x5A, 0x5D, 0x62, 0x68, 0x57, 0x53, 0x4E, 0x50, 0x53, 0x53, 0x49, 0x59, 0x62, 0xDC, 0x00, 0x05,
+    0x61, 0x55, 0x58, 0x49, 0x51, 0xE6, 0x00, 0x25, 0x6A, 0x64, 0x6B, 0x68, 0x57, 0x4F, 0x51, 0x4D,
+    0x59, 0x59, 0x58, 0x4E, 0x52, 0x46, 0x3B, 0x3A, 0x43, 0x47, 0x53, 0x59, 0x5B, 0x57, 0x68, 0x5A,
+    0x5C, 0x56, 0x4D, 0x48, 0x4A, 0x50, 0x4E, 0x51, 0x59, 0x63, 0x66, 0x62, 0x6B, 0x10, 0x01, 0x02,
+    0x4E, 0x50, 0x16, 0x01, 0x22, 0x69, 0x62, 0x68, 0x68, 0x5F, 0x54, 0x49, 0x50, 0x48, 0x51, 0x51,
+    0x4D, 0x4A, 0x40, 0x31, 0x2B, 0x3B, 0x46, 0x52, 0x4E, 0x58, 0x59, 0x59, 0x57, 0x5B, 0x5E, 0x51,
+    0x41, 0x52, 0x4B, 0x3D, 0x47, 0x45, 0x55, 0x3B, 0x01, 0x03, 0x68, 0x5D, 0x57, 0x41, 0x01, 0x0F,
+    0x4A, 0x3D, 0x47, 0x53, 0x59, 0x57, 0x65, 0x5D, 0x57, 0x57, 0x5C, 0x56, 0x4E, 0x52, 0x3A, 0x03,
+    0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0xAA, 0x5B, 0x5C, 0x56, 0x4E, 0x3D, 0x3A, 0x4A, 0x4E, 0x49,
+    0x54, 0x5F, 0x68, 0x5D, 0x6B, 0x6B, 0x66, 0x63, 0x59, 0x49, 0x4D, 0x49, 0x55, 0x61, 0x65, 0x62,
+    0x67, 0x6A, 0x6C, 0x6A, 0x6B, 0x5D, 0x5B, 0x4F, 0x58, 0x51, 0x55, 0x61, 0x65, 0x62, 0x67, 0x67,
+    0x60, 0x69, 0x68, 0x63, 0x59, 0x53, 0x41, 0x65, 0x65, 0x57, 0x59, 0x51, 0x41, 0x3D, 0x4E, 0x53,
+    0x55, 0x61, 0x65, 0x69, 0x62, 0x6A, 0x6D, 0x60, 0x63, 0x5E, 0x56, 0x49, 0x55, 0x59, 0x61, 0x65,
+    0x6B, 0x6C, 0x6F, 0x71, 0x6F, 0x6D, 0x68, 0x57, 0x54, 0x59, 0x55, 0x5E, 0x57, 0x68, 0x6D, 0x6E,
+    0x6F, 0x6D, 0x6D, 0x62, 0x65, 0x5C, 0x55, 0x53, 0x68, 0x5D, 0x63, 0x5E, 0x49, 0x50, 0x48, 0x4D,
+    0x53, 0x56, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x68, 0x5B, 0x59, 0x56, 0x58, 0x4F, 0x59, 0x54, 0x63,
+    0x69, 0x6C, 0x70, 0x71, 0x6E, 0x6B, 0x65, 0x5B, 0x54, 0x59, 0x4F, 0x5E, 0x57, 0x68, 0x64, 0x6E,
+    0x70, 0x6A, 0x6A, 0x6B, 0x5D, 0x61, 0x4F, 0x49, 0x65, 0x5A, 0x5B, 0x4F, 0x53, 0x41, 0x3D, 0x50,
+    0x4D, 0x5F, 0x66, 0x69, 0x67, 0x6B, 0x5A, 0x54, 0x56, 0x49, 0x51, 0x56, 0x56, 0x4F, 0x59, 0x5D,
+    0x6D, 0xAD, 0x00, 0x07, 0x60, 0x57, 0x54, 0x4F, 0x4F, 0x55, 0x59, 0xB7, 0x00, 0x27, 0x6A, 0x6F,
+    0x67, 0x6D, 0x69, 0x5A, 0x5C, 0x56, 0x51, 0x57, 0x57, 0x54, 0x58, 0x50, 0x3D, 0x4B, 0x48, 0x41,
+    0x45, 0x5B, 0x65, 0x68, 0x62, 0x66, 0x63, 0x51, 0x4D, 0x4E, 0x51, 0x51, 0x56, 0x5E, 0x62, 0x67,
+    0x6A, 0x64, 0x68, 0x61, 0x4F, 0xE5, 0x00, 0x46, 0x64, 0x67, 0x62, 0x69, 0x5D, 0x5B, 0x4F, 0x53,
+    0x4E, 0x59, 0x59, 0x56, 0x4D, 0x3D, 0x40, 0x3B, 0x4B, 0x52, 0x41, 0x49, 0x5E, 0x5B, 0x57, 0x5D,
+    0x65, 0x61, 0x55, 0x45, 0x41, 0x4A, 0x50, 0x4D, 0x49, 0x5E, 0x63, 0x66, 0x69, 0x62, 0x60, 0x5A,
+    0x54, 0x56, 0x45, 0x4E, 0x41, 0x4D, 0x58, 0x5C, 0x5A, 0x66, 0x60, 0x65, 0x65, 0x57, 0x5E, 0x51,
+    0x41, 0x3D, 0x53, 0x51, 0x4D, 0x48, 0x3A, 0x44, 0x2B, 0x3B, 0x40, 0x3D, 0x4D, 0x56, 0x30, 0x01,
+    0x02, 0x49, 0x50, 0x37, 0x01, 0x19, 0x4F, 0x5B, 0x5A, 0x65, 0x5D, 0x65, 0x57, 0x59, 0x51, 0x41,
+    0x4A, 0x43, 0x48, 0x45, 0x4F, 0x5B, 0x5F, 0x5F, 0x5C, 0x61, 0x5E, 0x49, 0x50, 0x43, 0x46, 0x03,
+    0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0xBB, 0x5F, 0x57, 0x5E, 0x51, 0x47, 0x43, 0x50, 0x53, 0x4F,
+    0x57, 0x68, 0x60, 0x60, 0x6D, 0x67, 0x62, 0x65, 0x61, 0x55, 0x51, 0x55, 0x5E, 0x63, 0x66, 0x6D,
+    0x6E, 0x6E, 0x6E, 0x6E, 0x67, 0x60, 0x5F, 0x54, 0x55, 0x49, 0x59, 0x57, 0x68, 0x64, 0x6A, 0x67,
+    0x60, 0x62, 0x66, 0x5F, 0x5E, 0x49, 0x50, 0x68, 0x68, 0x5A, 0x61, 0x56, 0x4D, 0x48, 0x53, 0x58,
+    0x54, 0x5F, 0x60, 0x6B, 0x64, 0x6E, 0x6C, 0x6B, 0x5D, 0x5B, 0x59, 0x55, 0x5E, 0x5C, 0x63, 0x66,
+    0x6D, 0x6F, 0x71, 0x71, 0x70, 0x6A, 0x60, 0x5A, 0x61, 0x5E, 0x4F, 0x5C, 0x5F, 0x60, 0x67, 0x6F,
+    0x6F, 0x6D, 0x67, 0x6B, 0x5D, 0x5B, 0x4F, 0x51, 0x66, 0x66, 0x65, 0x61, 0x56, 0x45, 0x41, 0x53,
+    0x58, 0x5E, 0x66, 0x6B, 0x64, 0x6E, 0x6A, 0x69, 0x5F, 0x5C, 0x59, 0x55, 0x5E, 0x54, 0x61, 0x5A,
+    0x62, 0x6E, 0x71, 0x72, 0x6F, 0x64, 0x5D, 0x57, 0x5C, 0x54, 0x59, 0x54, 0x63, 0x66, 0x6D, 0x6F,
+    0x70, 0x67, 0x67, 0x6B, 0x5D, 0x5B, 0x4F, 0x49, 0x5D, 0x5D, 0x63, 0x5E, 0x49, 0x4E, 0x48, 0x4D,
+    0x51, 0x65, 0x69, 0x62, 0x6A, 0x64, 0x5D, 0x61, 0x4F, 0x56, 0x58, 0x55, 0x4F, 0x59, 0x54, 0x68,
+    0x67, 0x6E, 0x6F, 0x6A, 0x69, 0x63, 0x5C, 0x59, 0x4F, 0x56, 0x59, 0x61, 0x65, 0x62, 0x6A, 0x6E,
+    0x64, 0x64, 0xBF, 0x00, 0x22, 0x53, 0x57, 0x57, 0x5C, 0x56, 0x4D, 0x4A, 0x4C, 0x47, 0x50, 0x51,
+    0x57, 0x5D, 0x68, 0x62, 0x60, 0x5F, 0x58, 0x53, 0x4D, 0x51, 0x49, 0x55, 0x54, 0x62, 0x6D, 0x67,
+    0x64, 0x68, 0x5B, 0x59, 0x58, 0x49, 0x53, 0xE4, 0x00, 0x0A, 0x68, 0x6B, 0x64, 0x60, 0x60, 0x65,
+    0x5B, 0x55, 0x53, 0x50, 0xF1, 0x00, 0x0A, 0x45, 0x4A, 0x3A, 0x36, 0x4C, 0x3D, 0x4E, 0x58, 0x54,
+    0x57, 0xFE, 0x00, 0x05, 0x5B, 0x4F, 0x53, 0x50, 0x48, 0x07, 0x01, 0x23, 0x5F, 0x68, 0x60, 0x69,
+    0x66, 0x5A, 0x5C, 0x56, 0x45, 0x50, 0x47, 0x4D, 0x58, 0x54, 0x5F, 0x68, 0x68, 0x63, 0x5F, 0x5B,
+    0x4F, 0x53, 0x47, 0x43, 0x53, 0x51, 0x45, 0x47, 0x4B, 0x3E, 0x37, 0x36, 0x3A, 0x4A, 0x45, 0x2D,
+    0x01, 0x06, 0x5B, 0x57, 0x54, 0x58, 0x4E, 0x3D, 0x36, 0x01, 0x01, 0x53, 0x3A, 0x01, 0x03, 0x5A,
+    0x5A, 0x5A, 0x41, 0x01, 0x0F, 0x3D, 0x4C, 0x48, 0x45, 0x55, 0x61, 0x63, 0x57, 0x59, 0x54, 0x4F,
+    0x51, 0x47, 0x4C, 0x36, 0x03, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00, 0x28, 0x5D, 0x5A, 0x61, 0x55,
+    0x4D, 0x4A, 0x45, 0x56, 0x5C, 0x65, 0x69, 0x6B, 0x62, 0x6A, 0x6C, 0x6D, 0x60, 0x5F, 0x54, 0x56,
+    0x59, 0x61, 0x65, 0x62, 0x6C, 0x70, 0x6F, 0x6F, 0x70, 0x6C, 0x62, 0x65, 0x61, 0x59, 0x58, 0x5E,
+    0x5F, 0x60, 0x6D, 0x6C, 0x2B, 0x00, 0x63, 0x60, 0x5A, 0x5C, 0x58, 0x4E, 0x66, 0x60, 0x68, 0x63,
+    0x5E, 0x51, 0x50, 0x49, 0x59, 0x5B, 0x5D, 0x6B, 0x67, 0x67, 0x6F, 0x6F, 0x67, 0x60, 0x5F, 0x61,
+    0x59, 0x5C, 0x57, 0x65, 0x62, 0x6C, 0x71, 0x72, 0x72, 0x71, 0x6C, 0x62, 0x5D, 0x57, 0x5C, 0x59,
+    0x61, 0x5A, 0x69, 0x6A, 0x6F, 0x6F, 0x64, 0x67, 0x6B, 0x68, 0x57, 0x4F, 0x51, 0x60, 0x69, 0x68,
+    0x57, 0x59, 0x51, 0x4E, 0x58, 0x4F, 0x5C, 0x69, 0x6D, 0x67, 0x6F, 0x6C, 0x6B, 0x65, 0x5B, 0x54,
+    0x59, 0x54, 0x61, 0x63, 0x5D, 0x64, 0x6F, 0x71, 0x72, 0x70, 0x6D, 0x66, 0x5F, 0x5B, 0x54, 0x59,
+    0x5C, 0x5F, 0x60, 0x6D, 0x6E, 0x6F, 0x6D, 0x67, 0x6B, 0x68, 0x92, 0x00, 0x1F, 0x68, 0x5A, 0x5C,
+    0x56, 0x4D, 0x47, 0x53, 0x58, 0x5D, 0x62, 0x6B, 0x6A, 0x6D, 0x66, 0x5B, 0x5E, 0x55, 0x56, 0x4F,
+    0x59, 0x54, 0x5C, 0x66, 0x67, 0x6E, 0x6E, 0x6A, 0x69, 0x5F, 0x61, 0x5E, 0xB7, 0x00, 0x14, 0x67,
+    0x6A, 0x62, 0x6B, 0x60, 0x5F, 0x54, 0x56, 0x45, 0x57, 0x63, 0x61, 0x55, 0x45, 0x48, 0x43, 0x41,
+    0x4D, 0x58, 0x63, 0xCF, 0x00, 0x3F, 0x5A, 0x56, 0x51, 0x45, 0x51, 0x58, 0x4F, 0x5C, 0x62, 0x64,
+    0x6D, 0x6B, 0x5D, 0x5B, 0x59, 0x56, 0x49, 0x45, 0x49, 0x59, 0x57, 0x5D, 0x69, 0x62, 0x5D, 0x68,
+    0x5A, 0x61, 0x56, 0x45, 0x47, 0x4F, 0x59, 0x55, 0x53, 0x47, 0x4B, 0x36, 0x4C, 0x48, 0x4D, 0x56,
+    0x5C, 0x57, 0x57, 0x65, 0x65, 0x57, 0x59, 0x51, 0x4E, 0x48, 0x50, 0x45, 0x58, 0x54, 0x5F, 0x68,
+    0x66, 0x66, 0x68, 0x5F, 0x54, 0x11, 0x01, 0x2D, 0x48, 0x4E, 0x49, 0x5E, 0x63, 0x65, 0x65, 0x61,
+    0x57, 0x5C, 0x55, 0x45, 0x4A, 0x4B, 0x45, 0x51, 0x45, 0x41, 0x4C, 0x3B, 0x37, 0x36, 0x4B, 0x47,
+    0x53, 0x55, 0x5E, 0x4F, 0x5B, 0x57, 0x5C, 0x56, 0x4D, 0x4A, 0x4C, 0x3D, 0x41, 0x51, 0x59, 0x5B,
+    0x5F, 0x5F, 0x63, 0x5F, 0x5B, 0x41, 0x01, 0x0F, 0x52, 0x4B, 0x4A, 0x4D, 0x56, 0x5C, 0x5B, 0x61,
+    0x56, 0x4F, 0x55, 0x53, 0x48, 0x3A, 0x3E, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x9C, 0x66,
+    0x68, 0x5F, 0x5E, 0x51, 0x41, 0x49, 0x59, 0x63, 0x66, 0x64, 0x67, 0x64, 0x6E, 0x6F, 0x6C, 0x6B,
+    0x5D, 0x5B, 0x59, 0x54, 0x63, 0x66, 0x6D, 0x6F, 0x71, 0x70, 0x6F, 0x71, 0x6E, 0x6D, 0x68, 0x57,
+    0x5E, 0x56, 0x5C, 0x5A, 0x62, 0x67, 0x6C, 0x67, 0x66, 0x62, 0x69, 0x65, 0x61, 0x56, 0x4E, 0x69,
+    0x6B, 0x69, 0x65, 0x61, 0x56, 0x45, 0x55, 0x5C, 0x5F, 0x60, 0x6D, 0x6C, 0x6A, 0x71, 0x71, 0x6C,
+    0x6B, 0x5D, 0x57, 0x5C, 0x5B, 0x5F, 0x66, 0x64, 0x6F, 0x72, 0x73, 0x72, 0x72, 0x6F, 0x64, 0x66,
+    0x5F, 0x61, 0x59, 0x5B, 0x5D, 0x6B, 0x6C, 0x6F, 0x6E, 0x6B, 0x6D, 0x6B, 0x66, 0x57, 0x59, 0x51,
+    0x69, 0x62, 0x60, 0x5A, 0x5C, 0x56, 0x45, 0x55, 0x5E, 0x57, 0x6B, 0x6A, 0x6A, 0x70, 0x6F, 0x6D,
+    0x66, 0x5F, 0x61, 0x54, 0x61, 0x57, 0x5F, 0x66, 0x6D, 0x70, 0x72, 0x71, 0x70, 0x67, 0x60, 0x5A,
+    0x57, 0x5C, 0x59, 0x61, 0x5F, 0x60, 0x67, 0x6E, 0x6E, 0x6B, 0x6D, 0x6B, 0x68, 0x57, 0x4F, 0x51,
+    0x5D, 0x66, 0x65, 0x5B, 0x4F, 0x53, 0x41, 0x51, 0x56, 0x66, 0x6B, 0x9F, 0x00, 0x0D, 0x60, 0x63,
+    0x5C, 0x59, 0x55, 0x59, 0x5E, 0x5C, 0x61, 0x60, 0x6A, 0x6E, 0x6C, 0xB2, 0x00, 0x01, 0x58, 0xB6,
+    0x00, 0x25, 0x69, 0x6D, 0x6D, 0x60, 0x69, 0x66, 0x5F, 0x54, 0x58, 0x4D, 0x57, 0x63, 0x5B, 0x59,
+    0x51, 0x41, 0x52, 0x50, 0x45, 0x56, 0x5F, 0x68, 0x5D, 0x62, 0x69, 0x65, 0x4F, 0x49, 0x53, 0x49,
+    0x56, 0x4F, 0x61, 0x62, 0x6B, 0x6B, 0x62, 0xDE, 0x00, 0x1E, 0x58, 0x51, 0x4D, 0x49, 0x4F, 0x5B,
+    0x65, 0x60, 0x60, 0x5F, 0x65, 0x63, 0x54, 0x58, 0x4E, 0x4A, 0x55, 0x59, 0x4F, 0x51, 0x41, 0x4C,
+    0x42, 0x43, 0x47, 0x45, 0x55, 0x5C, 0x57, 0x5B, 0xFF, 0x00, 0x0D, 0x5E, 0x49, 0x4E, 0x47, 0x50,
+    0x45, 0x56, 0x54, 0x5F, 0x5D, 0x68, 0x5D, 0x5D, 0x10, 0x01, 0x25, 0x41, 0x3D, 0x50, 0x49, 0x5E,
+    0x57, 0x5F, 0x63, 0x5E, 0x5C, 0x5E, 0x56, 0x4E, 0x3D, 0x40, 0x45, 0x51, 0x53, 0x50, 0x43, 0x36,
+    0x3C, 0x42, 0x4C, 0x41, 0x51, 0x4F, 0x5E, 0x4F, 0x61, 0x5B, 0x5C, 0x55, 0x45, 0x48, 0x4C, 0x52,
+    0x3A, 0x01, 0x16, 0x57, 0x5B, 0x63, 0x61, 0x59, 0x53, 0x47, 0x43, 0x40, 0x3D, 0x4E, 0x56, 0x5E,
+    0x5C, 0x5E, 0x51, 0x56, 0x58, 0x4D, 0x4A, 0x40, 0x31, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00,
+    0x56, 0x69, 0x69, 0x5D, 0x61, 0x56, 0x4E, 0x55, 0x61, 0x65, 0x62, 0x6A, 0x6C, 0x6D, 0x6F, 0x71,
+    0x70, 0x67, 0x60, 0x5F, 0x5C, 0x61, 0x65, 0x62, 0x6C, 0x71, 0x73, 0x71, 0x6F, 0x72, 0x70, 0x67,
+    0x60, 0x5F, 0x5C, 0x55, 0x61, 0x5D, 0x6B, 0x6A, 0x6C, 0x67, 0x68, 0x62, 0x69, 0x5D, 0x5B, 0x56,
+    0x4D, 0x62, 0x64, 0x6B, 0x66, 0x63, 0x59, 0x51, 0x59, 0x5B, 0x5D, 0x6B, 0x6C, 0x6F, 0x6C, 0x72,
+    0x72, 0x6F, 0x6D, 0x60, 0x5A, 0x5B, 0x57, 0x65, 0x69, 0x67, 0x70, 0x74, 0x73, 0x72, 0x73, 0x70,
+    0x67, 0x60, 0x5A, 0x5B, 0x5E, 0x57, 0x68, 0x59, 0x00, 0x02, 0x6C, 0x62, 0x5E, 0x00, 0x01, 0x63,
+    0x62, 0x00, 0x2D, 0x6B, 0x62, 0x5D, 0x5B, 0x4F, 0x53, 0x4F, 0x61, 0x5A, 0x6D, 0x6C, 0x6A, 0x70,
+    0x70, 0x67, 0x69, 0x65, 0x57, 0x5C, 0x5B, 0x63, 0x65, 0x60, 0x67, 0x70, 0x71, 0x70, 0x70, 0x6A,
+    0x69, 0x65, 0x57, 0x61, 0x59, 0x61, 0x5A, 0x60, 0x6D, 0x6C, 0x6A, 0x62, 0x64, 0x62, 0x5D, 0x5B,
+    0x93, 0x00, 0x08, 0x5D, 0x63, 0x5E, 0x49, 0x50, 0x49, 0x4F, 0x60, 0x9E, 0x00, 0x34, 0x67, 0x69,
+    0x5F, 0x61, 0x5E, 0x4F, 0x59, 0x54, 0x61, 0x61, 0x60, 0x67, 0x6C, 0x6A, 0x67, 0x69, 0x5A, 0x5B,
+    0x54, 0x4F, 0x58, 0x4F, 0x61, 0x5A, 0x60, 0x64, 0x6B, 0x68, 0x66, 0x68, 0x63, 0x5E, 0x49, 0x4E,
+    0x5B, 0x63, 0x5B, 0x5E, 0x49, 0x50, 0x52, 0x50, 0x53, 0x55, 0x5A, 0x68, 0x5D, 0x69, 0x60, 0x65,
+    0x59, 0x58, 0xD5, 0x00, 0x07, 0x59, 0x61, 0x69, 0x62, 0x69, 0x69, 0x65, 0xDF, 0x00, 0x0F, 0x53,
+    0x4E, 0x51, 0x4F, 0x61, 0x5A, 0x68, 0x5D, 0x5B, 0x63, 0x57, 0x5E, 0x49, 0x50, 0x3D, 0xF1, 0x00,
+    0x11, 0x49, 0x50, 0x43, 0x42, 0x52, 0x41, 0x53, 0x4F, 0x61, 0x57, 0x61, 0x5A, 0x5A, 0x63, 0x54,
+    0x58, 0x4D, 0x07, 0x01, 0x2C, 0x63, 0x5D, 0x65, 0x5A, 0x65, 0x63, 0x54, 0x58, 0x4D, 0x47, 0x52,
+    0x41, 0x51, 0x59, 0x61, 0x57, 0x5B, 0x55, 0x5E, 0x59, 0x49, 0x50, 0x43, 0x42, 0x4D, 0x51, 0x51,
+    0x50, 0x52, 0x42, 0x3C, 0x42, 0x43, 0x50, 0x49, 0x59, 0x5E, 0x55, 0x5C, 0x5B, 0x5C, 0x4F, 0x53,
+    0x47, 0x39, 0x01, 0x06, 0x63, 0x5B, 0x5C, 0x5B, 0x61, 0x4F, 0x42, 0x01, 0x0E, 0x46, 0x52, 0x50,
+    0x58, 0x59, 0x5E, 0x55, 0x4D, 0x49, 0x51, 0x4E, 0x3D, 0x42, 0x39, 0x01, 0x00, 0x00, 0x57, 0x01,
+    0x6B, 0x6B, 0x60, 0x63, 0x59, 0x53, 0x59, 0x63, 0x60, 0x6D, 0x6E, 0x6F, 0x6A, 0x70, 0x73, 0x72,
+    0x6E, 0x6B, 0x5D, 0x5B, 0x57, 0x68, 0x64, 0x6F, 0x73, 0x74, 0x72, 0x6F, 0x72, 0x71, 0x6C, 0x62,
+    0x65, 0x61, 0x4F, 0x5B, 0x68, 0x64, 0x6C, 0x6C, 0x6D, 0x5D, 0x69, 0x69, 0x68, 0x5B, 0x55, 0x4D,
+    0x62, 0x67, 0x6D, 0x69, 0x5A, 0x54, 0x58, 0x5C, 0x5F, 0x60, 0x67, 0x6F, 0x70, 0x6E, 0x72, 0x74,
+    0x71, 0x6C, 0x62, 0x5D, 0x63, 0x5F, 0x68, 0x6B, 0x6C, 0x72, 0x74, 0x73, 0x71, 0x73, 0x70, 0x6A,
+    0x62, 0x65, 0x57, 0x5E, 0x57, 0x68, 0x64, 0x6C, 0x6F, 0x6A, 0x60, 0x64, 0x6B, 0x66, 0x63, 0x59,
+    0x51, 0x69, 0x64, 0x6B, 0x66, 0x63, 0x5E, 0x49, 0x5E, 0x57, 0x5D, 0x6A, 0x6E, 0x6A, 0x70, 0x70,
+    0x6C, 0x62, 0x68, 0x5F, 0x5B, 0x5B, 0x5F, 0x5D, 0x69, 0x6A, 0x71, 0x71, 0x6F, 0x6F, 0x6A, 0x69,
+    0x5D, 0x63, 0x61, 0x4F, 0x61, 0x5A, 0x60, 0x6D, 0x6A, 0x67, 0x66, 0x62, 0x69, 0x5D, 0x5B, 0x4F,
+    0x53, 0x5D, 0x66, 0x68, 0x5F, 0x54, 0x58, 0x4E, 0x58, 0x5E, 0x69, 0x64, 0x6B, 0x67, 0x67, 0x69,
+    0x5A, 0x57, 0x5C, 0x59, 0x59, 0x5C, 0x5B, 0x5B, 0x60, 0x67, 0x6A, 0x6D, 0x6D, 0x60, 0x5F, 0x5B,
+    0x54, 0x4F, 0x49, 0x4F, 0x61, 0x5A, 0x66, 0x62, 0x69, 0x5A, 0x5D, 0x65, 0x57, 0x59, 0x51, 0x41,
+    0x61, 0x63, 0x57, 0x54, 0x58, 0x4E, 0x3D, 0x4E, 0x51, 0x59, 0x5A, 0x68, 0x65, 0x60, 0x60, 0x5D,
+    0x5E, 0x56, 0x53, 0x51, 0x56, 0x59, 0x61, 0x60, 0x69, 0x66, 0x66, 0x65, 0x61, 0x59, 0x58, 0x45,
+    0x41, 0x53, 0x55, 0x5C, 0x5F, 0x65, 0x5A, 0x54, 0x5B, 0x61, 0x59, 0x51, 0x41, 0x43, 0x56, 0x59,
+    0x59, 0x58, 0x4E, 0x52, 0x42, 0x52, 0x50, 0x51, 0x59, 0x61, 0x57, 0x5C, 0x5F, 0x5A, 0x63, 0x54,
+    0x56, 0x45, 0x47, 0x41, 0x45, 0x56, 0x54, 0x63, 0x65, 0x5A, 0x63, 0x5F, 0x57, 0x5E, 0x58, 0x4D,
+    0x48, 0x4C, 0x47, 0x53, 0x55, 0x5C, 0x61, 0x54, 0x49, 0x55, 0x55, 0x51, 0x41, 0x4C, 0x3B, 0x4E,
+    0x51, 0x51, 0x4E, 0x3D, 0x46, 0x39, 0x46, 0x3D, 0x4E, 0x58, 0x59, 0x5E, 0x56, 0x54, 0x5B, 0x61,
+    0x59, 0x51, 0x41, 0x43, 0x52, 0x50, 0x49, 0x59, 0x5B, 0x57, 0x5C, 0x5E, 0x61, 0x5C, 0x4F, 0x53,
+    0x47, 0x4C, 0x36, 0x43, 0x50, 0x49, 0x55, 0x4F, 0x58, 0x41, 0x45, 0x45, 0x41, 0x43, 0x36, 0x37,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x1A, 0x6D,
+    0x67, 0x62, 0x65, 0x5C, 0x49, 0x5C, 0x65, 0x62, 0x6C, 0x71, 0x71, 0x6C, 0x71, 0x74, 0x74, 0x70,
+    0x67, 0x66, 0x63, 0x5F, 0x60, 0x67, 0x71, 0x74, 0x75, 0x1D, 0x00, 0x08, 0x72, 0x6E, 0x64, 0x5D,
+    0x5B, 0x4F, 0x57, 0x66, 0x28, 0x00, 0x02, 0x64, 0x65, 0x2D, 0x00, 0x2F, 0x57, 0x4F, 0x4D, 0x6B,
+    0x6A, 0x6A, 0x6B, 0x68, 0x5B, 0x55, 0x5B, 0x65, 0x6B, 0x6C, 0x71, 0x72, 0x6F, 0x72, 0x74, 0x73,
+    0x6F, 0x6D, 0x66, 0x5F, 0x5A, 0x60, 0x64, 0x6E, 0x73, 0x75, 0x73, 0x70, 0x72, 0x71, 0x6C, 0x6B,
+    0x5D, 0x57, 0x5E, 0x63, 0x66, 0x64, 0x6C, 0x6E, 0x67, 0x66, 0x6B, 0x62, 0x00, 0x1E, 0x6D, 0x64,
+    0x69, 0x5A, 0x5C, 0x58, 0x54, 0x63, 0x66, 0x6C, 0x6F, 0x6A, 0x70, 0x71, 0x6E, 0x64, 0x66, 0x65,
+    0x57, 0x57, 0x5A, 0x68, 0x62, 0x6C, 0x70, 0x70, 0x6E, 0x6F, 0x6A, 0x62, 0x87, 0x00, 0x1C, 0x64,
+    0x67, 0x64, 0x5D, 0x60, 0x60, 0x65, 0x5B, 0x55, 0x45, 0x65, 0x66, 0x66, 0x5A, 0x61, 0x56, 0x4D,
+    0x56, 0x54, 0x62, 0x64, 0x62, 0x6D, 0x67, 0x62, 0x65, 0x63, 0x61, 0xA9, 0x00, 0x04, 0x6D, 0x67,
+    0x6B, 0x64, 0xB0, 0x00, 0x1E, 0x5E, 0x55, 0x53, 0x55, 0x5C, 0x5F, 0x68, 0x60, 0x68, 0x57, 0x5A,
+    0x5F, 0x5B, 0x4F, 0x53, 0x47, 0x5C, 0x63, 0x57, 0x5C, 0x56, 0x4D, 0x3D, 0x4E, 0x49, 0x5E, 0x65,
+    0x68, 0x5A, 0x66, 0xD1, 0x00, 0x02, 0x55, 0x51, 0xD7, 0x00, 0x18, 0x66, 0x66, 0x5D, 0x68, 0x5A,
+    0x61, 0x4F, 0x49, 0x45, 0x47, 0x45, 0x56, 0x54, 0x57, 0x5F, 0x57, 0x4F, 0x54, 0x54, 0x55, 0x53,
+    0x48, 0x4B, 0x58, 0xF2, 0x00, 0x0F, 0x4D, 0x3D, 0x46, 0x52, 0x50, 0x49, 0x5E, 0x5B, 0x5B, 0x5C,
+    0x57, 0x5F, 0x63, 0x5C, 0x55, 0x08, 0x01, 0x2A, 0x5A, 0x63, 0x61, 0x57, 0x5B, 0x5E, 0x49, 0x4E,
+    0x4A, 0x4B, 0x48, 0x45, 0x56, 0x5E, 0x54, 0x4F, 0x45, 0x49, 0x49, 0x45, 0x48, 0x3A, 0x44, 0x4E,
+    0x51, 0x49, 0x4D, 0x4A, 0x40, 0x39, 0x40, 0x4A, 0x4D, 0x56, 0x5E, 0x5E, 0x56, 0x5E, 0x61, 0x61,
+    0x59, 0x49, 0x37, 0x01, 0x19, 0x5E, 0x61, 0x5B, 0x54, 0x4F, 0x54, 0x54, 0x55, 0x53, 0x48, 0x4B,
+    0x3B, 0x4C, 0x41, 0x53, 0x56, 0x56, 0x53, 0x4A, 0x4E, 0x4E, 0x47, 0x4C, 0x3B, 0x32, 0x03, 0x00,
+    0x00, 0x49, 0x01, 0x00, 0x00, 0x21, 0x67, 0x6C, 0x6D, 0x66, 0x57, 0x55, 0x5B, 0x68, 0x6D, 0x70,
+    0x73, 0x72, 0x6C, 0x71, 0x75, 0x76, 0x72, 0x6C, 0x69, 0x5A, 0x5A, 0x69, 0x6C, 0x72, 0x75, 0x75,
+    0x72, 0x6E, 0x72, 0x72, 0x6F, 0x6D, 0x68, 0x25, 0x00, 0x06, 0x6D, 0x6C, 0x6A, 0x6B, 0x5A, 0x60,
+    0x31, 0x00, 0x0B, 0x6C, 0x6C, 0x6D, 0x60, 0x63, 0x59, 0x57, 0x66, 0x6D, 0x6F, 0x72, 0x3F, 0x00,
+    0x0E, 0x75, 0x74, 0x70, 0x6A, 0x69, 0x65, 0x65, 0x69, 0x67, 0x6F, 0x73, 0x75, 0x72, 0x6F, 0x51,
+    0x00, 0x03, 0x68, 0x57, 0x59, 0x58, 0x00, 0x05, 0x6C, 0x64, 0x5D, 0x69, 0x62, 0x60, 0x00, 0x31,
+    0x53, 0x69, 0x6D, 0x6D, 0x62, 0x5D, 0x61, 0x56, 0x5C, 0x5A, 0x60, 0x6E, 0x6F, 0x6A, 0x6F, 0x71,
+    0x6E, 0x6D, 0x69, 0x5D, 0x57, 0x57, 0x65, 0x66, 0x6B, 0x6C, 0x70, 0x6F, 0x6A, 0x6C, 0x67, 0x62,
+    0x68, 0x5F, 0x5C, 0x55, 0x5C, 0x5A, 0x66, 0x6B, 0x64, 0x69, 0x5F, 0x68, 0x68, 0x5A, 0x61, 0x56,
+    0x4D, 0x94, 0x00, 0x10, 0x65, 0x5B, 0x55, 0x45, 0x55, 0x5C, 0x62, 0x64, 0x69, 0x64, 0x6D, 0x62,
+    0x5D, 0x5F, 0x61, 0x5E, 0xA9, 0x00, 0x54, 0x64, 0x64, 0x69, 0x62, 0x66, 0x5F, 0x61, 0x5E, 0x56,
+    0x45, 0x56, 0x54, 0x63, 0x5D, 0x68, 0x65, 0x5C, 0x63, 0x63, 0x5C, 0x55, 0x45, 0x4A, 0x54, 0x57,
+    0x57, 0x5C, 0x55, 0x4D, 0x4A, 0x4D, 0x58, 0x54, 0x65, 0x5D, 0x5F, 0x5D, 0x66, 0x5D, 0x54, 0x55,
+    0x51, 0x53, 0x56, 0x5E, 0x61, 0x68, 0x5D, 0x5F, 0x65, 0x63, 0x5C, 0x4F, 0x49, 0x4E, 0x4A, 0x4D,
+    0x58, 0x5E, 0x61, 0x5B, 0x5C, 0x58, 0x59, 0x59, 0x56, 0x4D, 0x4A, 0x40, 0x49, 0x4F, 0x59, 0x56,
+    0x45, 0x4A, 0x46, 0x3D, 0x4E, 0x58, 0x54, 0x5B, 0x5B, 0x54, 0x5B, 0x01, 0x01, 0x03, 0x53, 0x47,
+    0x47, 0x07, 0x01, 0x2E, 0x57, 0x63, 0x5B, 0x54, 0x61, 0x5C, 0x59, 0x49, 0x4E, 0x3D, 0x40, 0x3D,
+    0x4D, 0x58, 0x4F, 0x4F, 0x58, 0x41, 0x53, 0x53, 0x4E, 0x4A, 0x40, 0x31, 0x50, 0x51, 0x49, 0x45,
+    0x47, 0x3A, 0x31, 0x40, 0x48, 0x53, 0x55, 0x5E, 0x59, 0x58, 0x59, 0x61, 0x61, 0x5E, 0x58, 0x50,
+    0x43, 0x43, 0x39, 0x01, 0x17, 0x61, 0x59, 0x56, 0x5E, 0x5E, 0x55, 0x45, 0x48, 0x3A, 0x3E, 0x4B,
+    0x47, 0x45, 0x49, 0x49, 0x4E, 0x43, 0x47, 0x41, 0x4A, 0x4B, 0x44, 0x30, 0x03, 0x00, 0x00, 0x45,
+    0x01, 0x00, 0x00, 0x2C, 0x6C, 0x6E, 0x6A, 0x69, 0x5F, 0x59, 0x63, 0x60, 0x6A, 0x72, 0x74, 0x73,
+    0x6E, 0x71, 0x76, 0x77, 0x74, 0x6F, 0x6B, 0x65, 0x65, 0x6B, 0x6E, 0x73, 0x76, 0x75, 0x71, 0x6C,
+    0x72, 0x72, 0x70, 0x67, 0x66, 0x57, 0x4F, 0x63, 0x60, 0x6D, 0x6A, 0x67, 0x69, 0x63, 0x68, 0x60,
+    0x32, 0x00, 0x0B, 0x6F, 0x6A, 0x62, 0x5A, 0x5E, 0x5F, 0x60, 0x6A, 0x71, 0x73, 0x73, 0x40, 0x00,
+    0x11, 0x75, 0x72, 0x6C, 0x6B, 0x5D, 0x65, 0x62, 0x6A, 0x70, 0x74, 0x74, 0x71, 0x6C, 0x71, 0x70,
+    0x6C, 0x64, 0x57, 0x00, 0x47, 0x6A, 0x67, 0x62, 0x5F, 0x66, 0x69, 0x68, 0x63, 0x59, 0x45, 0x69,
+    0x6D, 0x67, 0x6B, 0x68, 0x5B, 0x55, 0x61, 0x65, 0x62, 0x6F, 0x6F, 0x67, 0x6E, 0x70, 0x6F, 0x67,
+    0x62, 0x68, 0x63, 0x57, 0x65, 0x60, 0x6B, 0x6C, 0x6F, 0x6C, 0x6D, 0x6A, 0x6D, 0x69, 0x5D, 0x63,
+    0x5C, 0x56, 0x5C, 0x5F, 0x66, 0x62, 0x62, 0x66, 0x5B, 0x65, 0x5D, 0x5F, 0x5C, 0x58, 0x50, 0x5A,
+    0x66, 0x60, 0x5D, 0x57, 0x4F, 0x45, 0x55, 0x61, 0x6B, 0x6B, 0x60, 0x6B, 0xA2, 0x00, 0x01, 0x5B,
+    0xA6, 0x00, 0x23, 0x57, 0x5B, 0x66, 0x6B, 0x62, 0x68, 0x60, 0x68, 0x63, 0x61, 0x5E, 0x58, 0x4D,
+    0x58, 0x5E, 0x57, 0x5A, 0x65, 0x63, 0x59, 0x61, 0x5B, 0x54, 0x56, 0x4E, 0x52, 0x5E, 0x57, 0x63,
+    0x61, 0x4F, 0x45, 0x4A, 0x4D, 0x56, 0xCC, 0x00, 0x04, 0x63, 0x65, 0x68, 0x65, 0xD5, 0x00, 0x23,
+    0x59, 0x61, 0x5D, 0x5A, 0x5B, 0x5F, 0x57, 0x54, 0x55, 0x51, 0x50, 0x52, 0x50, 0x49, 0x4F, 0x5C,
+    0x5C, 0x59, 0x45, 0x56, 0x56, 0x49, 0x4E, 0x52, 0x42, 0x51, 0x4F, 0x59, 0x55, 0x45, 0x4A, 0x40,
+    0x3D, 0x4D, 0x56, 0xFB, 0x00, 0x06, 0x59, 0x5C, 0x63, 0x57, 0x5C, 0x4F, 0x07, 0x01, 0x28, 0x5B,
+    0x57, 0x5C, 0x4F, 0x54, 0x54, 0x4F, 0x51, 0x50, 0x52, 0x46, 0x52, 0x4E, 0x51, 0x56, 0x56, 0x53,
+    0x4A, 0x4E, 0x4D, 0x50, 0x52, 0x42, 0x3C, 0x41, 0x51, 0x49, 0x53, 0x41, 0x4B, 0x44, 0x3A, 0x47,
+    0x51, 0x4F, 0x5E, 0x59, 0x49, 0x4F, 0x5C, 0x32, 0x01, 0x01, 0x4E, 0x38, 0x01, 0x18, 0x5C, 0x5C,
+    0x55, 0x51, 0x4F, 0x59, 0x56, 0x45, 0x4A, 0x40, 0x31, 0x3A, 0x48, 0x4D, 0x51, 0x53, 0x47, 0x3A,
+    0x4A, 0x48, 0x3D, 0x3A, 0x31, 0x2D, 0x03, 0x00, 0x00, 0x45, 0x01, 0x01, 0x00, 0x0B, 0x70, 0x6E,
+    0x64, 0x65, 0x5E, 0x5F, 0x62, 0x6E, 0x73, 0x75, 0x74, 0x0F, 0x00, 0x0E, 0x78, 0x75, 0x71, 0x6D,
+    0x5D, 0x5D, 0x64, 0x6F, 0x74, 0x76, 0x75, 0x70, 0x6A, 0x71, 0x27, 0x00, 0x1D, 0x6D, 0x66, 0x5B,
+    0x5D, 0x66, 0x5D, 0x57, 0x4F, 0x4E, 0x6B, 0x6E, 0x6F, 0x6C, 0x6B, 0x65, 0x54, 0x5A, 0x62, 0x6C,
+    0x72, 0x74, 0x73, 0x6E, 0x71, 0x75, 0x75, 0x73, 0x6E, 0x64, 0x48, 0x00, 0x06, 0x71, 0x74, 0x74,
+    0x70, 0x6A, 0x70, 0x53, 0x00, 0x18, 0x4F, 0x57, 0x66, 0x6B, 0x67, 0x6D, 0x60, 0x57, 0x5D, 0x66,
+    0x5D, 0x57, 0x4F, 0x4D, 0x60, 0x6D, 0x67, 0x64, 0x66, 0x63, 0x4F, 0x5B, 0x5D, 0x6B, 0x6E, 0x00,
+    0x01, 0x6C, 0x72, 0x00, 0x01, 0x6B, 0x76, 0x00, 0x09, 0x5D, 0x60, 0x6B, 0x6A, 0x6E, 0x6A, 0x62,
+    0x6D, 0x64, 0x82, 0x00, 0x16, 0x54, 0x49, 0x54, 0x63, 0x68, 0x60, 0x60, 0x65, 0x54, 0x5F, 0x5A,
+    0x63, 0x54, 0x49, 0x41, 0x63, 0x68, 0x60, 0x5D, 0x63, 0x59, 0x53, 0x9C, 0x00, 0x2A, 0x66, 0x69,
+    0x64, 0x62, 0x68, 0x5A, 0x5B, 0x5E, 0x4F, 0x5C, 0x5B, 0x5B, 0x66, 0x62, 0x60, 0x65, 0x68, 0x65,
+    0x57, 0x5C, 0x59, 0x49, 0x50, 0x49, 0x59, 0x61, 0x63, 0x63, 0x61, 0x58, 0x5E, 0x54, 0x59, 0x49,
+    0x50, 0x4C, 0x59, 0x5B, 0x57, 0x61, 0x4F, 0x53, 0xC9, 0x00, 0x35, 0x5C, 0x65, 0x65, 0x57, 0x5F,
+    0x5D, 0x65, 0x5C, 0x4F, 0x53, 0x45, 0x56, 0x59, 0x5C, 0x5A, 0x63, 0x5C, 0x57, 0x61, 0x5E, 0x56,
+    0x53, 0x41, 0x43, 0x41, 0x53, 0x55, 0x5E, 0x59, 0x58, 0x50, 0x51, 0x49, 0x53, 0x41, 0x4C, 0x3B,
+    0x53, 0x55, 0x59, 0x55, 0x53, 0x48, 0x40, 0x3D, 0x45, 0x55, 0x5C, 0x5B, 0x61, 0x4F, 0x54, 0x57,
+    0x03, 0x01, 0x4D, 0x48, 0x45, 0x56, 0x5E, 0x61, 0x61, 0x5E, 0x58, 0x59, 0x5E, 0x55, 0x51, 0x41,
+    0x43, 0x36, 0x43, 0x41, 0x53, 0x49, 0x51, 0x4E, 0x4C, 0x47, 0x50, 0x47, 0x43, 0x36, 0x2B, 0x47,
+    0x51, 0x58, 0x51, 0x50, 0x4C, 0x3E, 0x4B, 0x41, 0x49, 0x59, 0x54, 0x59, 0x51, 0x56, 0x5C, 0x61,
+    0x54, 0x56, 0x4E, 0x52, 0x43, 0x50, 0x58, 0x59, 0x5C, 0x5E, 0x58, 0x45, 0x56, 0x55, 0x58, 0x4D,
+    0x4A, 0x46, 0x39, 0x40, 0x4A, 0x4E, 0x45, 0x4E, 0x4A, 0x42, 0x43, 0x4A, 0x52, 0x46, 0x39, 0x27,
+    0x03, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x1D, 0x6E, 0x71, 0x6F, 0x6D, 0x68, 0x5C, 0x65, 0x64,
+    0x70, 0x75, 0x76, 0x74, 0x6E, 0x70, 0x76, 0x78, 0x77, 0x72, 0x67, 0x68, 0x5D, 0x6D, 0x70, 0x75,
+    0x76, 0x75, 0x6F, 0x6D, 0x70, 0x20, 0x00, 0x1F, 0x60, 0x57, 0x55, 0x63, 0x60, 0x64, 0x67, 0x64,
+    0x5D, 0x5C, 0x5A, 0x68, 0x5D, 0x57, 0x55, 0x4E, 0x62, 0x6E, 0x70, 0x6F, 0x6D, 0x68, 0x5C, 0x65,
+    0x6B, 0x6E, 0x73, 0x75, 0x73, 0x6E, 0x70, 0x42, 0x00, 0x0D, 0x6F, 0x6D, 0x68, 0x65, 0x6B, 0x6C,
+    0x71, 0x73, 0x73, 0x6E, 0x64, 0x6E, 0x6F, 0x52, 0x00, 0x24, 0x5B, 0x55, 0x57, 0x68, 0x62, 0x64,
+    0x6B, 0x5D, 0x5C, 0x5A, 0x68, 0x65, 0x5B, 0x55, 0x4E, 0x66, 0x64, 0x67, 0x6D, 0x60, 0x63, 0x59,
+    0x5B, 0x68, 0x64, 0x6F, 0x6E, 0x64, 0x67, 0x6F, 0x6E, 0x67, 0x6B, 0x66, 0x63, 0x5B, 0x79, 0x00,
+    0x27, 0x67, 0x6C, 0x64, 0x60, 0x6B, 0x6B, 0x60, 0x5D, 0x57, 0x5E, 0x51, 0x5E, 0x57, 0x65, 0x66,
+    0x68, 0x63, 0x4F, 0x5B, 0x63, 0x5B, 0x5E, 0x51, 0x48, 0x57, 0x68, 0x60, 0x68, 0x63, 0x5E, 0x53,
+    0x4F, 0x5B, 0x6B, 0x62, 0x68, 0x66, 0x62, 0x69, 0xA3, 0x00, 0x22, 0x59, 0x55, 0x5C, 0x5B, 0x61,
+    0x68, 0x60, 0x5D, 0x63, 0x65, 0x5A, 0x5B, 0x54, 0x4F, 0x51, 0x47, 0x51, 0x4F, 0x5C, 0x5B, 0x5B,
+    0x59, 0x53, 0x55, 0x59, 0x55, 0x51, 0x47, 0x4B, 0x4F, 0x61, 0x57, 0x5B, 0x59, 0xC8, 0x00, 0x08,
+    0x55, 0x61, 0x65, 0x5A, 0x61, 0x57, 0x65, 0x5A, 0xD3, 0x00, 0x2B, 0x4D, 0x58, 0x59, 0x5C, 0x63,
+    0x61, 0x59, 0x5C, 0x5C, 0x59, 0x58, 0x45, 0x47, 0x4B, 0x47, 0x45, 0x58, 0x55, 0x55, 0x53, 0x4A,
+    0x4D, 0x53, 0x4D, 0x47, 0x4B, 0x44, 0x45, 0x55, 0x59, 0x4F, 0x51, 0x47, 0x3A, 0x4A, 0x45, 0x4F,
+    0x5C, 0x5B, 0x5C, 0x55, 0x59, 0x5B, 0x01, 0x01, 0x03, 0x51, 0x47, 0x4A, 0x07, 0x01, 0x22, 0x5C,
+    0x5C, 0x55, 0x51, 0x55, 0x4F, 0x56, 0x53, 0x47, 0x4B, 0x3E, 0x4C, 0x47, 0x45, 0x53, 0x45, 0x48,
+    0x40, 0x3D, 0x47, 0x4A, 0x4B, 0x3E, 0x35, 0x47, 0x53, 0x58, 0x49, 0x4E, 0x43, 0x3B, 0x4B, 0x41,
+    0x58, 0x2C, 0x01, 0x03, 0x53, 0x58, 0x54, 0x32, 0x01, 0x03, 0x4D, 0x52, 0x4C, 0x38, 0x01, 0x18,
+    0x54, 0x59, 0x49, 0x4E, 0x49, 0x56, 0x58, 0x4D, 0x3D, 0x42, 0x3C, 0x46, 0x3D, 0x50, 0x4D, 0x41,
+    0x43, 0x3E, 0x4B, 0x52, 0x4C, 0x42, 0x3C, 0x25, 0x03, 0x00, 0x00, 0x47, 0x01, 0x02, 0x00, 0x0C,
+    0x70, 0x6A, 0x66, 0x61, 0x5D, 0x6D, 0x71, 0x76, 0x77, 0x74, 0x6C, 0x6F, 0x11, 0x00, 0x0D, 0x73,
+    0x6A, 0x66, 0x5D, 0x6D, 0x71, 0x75, 0x76, 0x74, 0x6C, 0x6B, 0x6E, 0x71, 0x21, 0x00, 0x19, 0x5B,
+    0x55, 0x57, 0x66, 0x64, 0x6D, 0x62, 0x5A, 0x59, 0x63, 0x5D, 0x65, 0x5B, 0x55, 0x50, 0x62, 0x6C,
+    0x70, 0x6F, 0x67, 0x66, 0x61, 0x65, 0x64, 0x6F, 0x3D, 0x00, 0x06, 0x6C, 0x6E, 0x74, 0x75, 0x74,
+    0x70, 0x49, 0x00, 0x19, 0x72, 0x71, 0x6A, 0x62, 0x6A, 0x6E, 0x6A, 0x6B, 0x68, 0x61, 0x56, 0x5B,
+    0x5D, 0x69, 0x6B, 0x60, 0x5F, 0x59, 0x63, 0x65, 0x5A, 0x61, 0x56, 0x50, 0x5D, 0x65, 0x00, 0x0B,
+    0x69, 0x5F, 0x59, 0x5B, 0x66, 0x64, 0x6F, 0x6C, 0x6B, 0x64, 0x6E, 0x76, 0x00, 0x2B, 0x65, 0x60,
+    0x62, 0x6D, 0x67, 0x62, 0x5D, 0x69, 0x69, 0x66, 0x65, 0x5B, 0x4F, 0x45, 0x4F, 0x5B, 0x5A, 0x5D,
+    0x5A, 0x61, 0x58, 0x54, 0x5B, 0x61, 0x4F, 0x45, 0x3D, 0x5B, 0x5D, 0x66, 0x68, 0x5F, 0x5E, 0x53,
+    0x55, 0x5B, 0x62, 0x69, 0x65, 0x5D, 0x69, 0x60, 0x5D, 0xA4, 0x00, 0x1E, 0x56, 0x54, 0x5B, 0x61,
+    0x65, 0x68, 0x5A, 0x61, 0x5F, 0x63, 0x61, 0x5E, 0x55, 0x45, 0x4A, 0x45, 0x56, 0x5E, 0x5C, 0x54,
+    0x56, 0x50, 0x49, 0x55, 0x58, 0x45, 0x48, 0x40, 0x56, 0x5C, 0xC5, 0x00, 0x02, 0x51, 0x48, 0xCA,
+    0x00, 0x05, 0x5A, 0x5F, 0x5C, 0x61, 0x5F, 0xD3, 0x00, 0x24, 0x4E, 0x58, 0x4F, 0x54, 0x57, 0x54,
+    0x56, 0x5E, 0x5E, 0x4F, 0x58, 0x4D, 0x4A, 0x40, 0x4A, 0x4D, 0x49, 0x58, 0x49, 0x50, 0x4C, 0x41,
+    0x4E, 0x50, 0x4A, 0x40, 0x39, 0x4E, 0x56, 0x59, 0x4F, 0x49, 0x41, 0x3A, 0x4A, 0x53, 0xFA, 0x00,
+    0x07, 0x54, 0x58, 0x55, 0x61, 0x5B, 0x5C, 0x59, 0x04, 0x01, 0x2E, 0x4D, 0x56, 0x59, 0x54, 0x5E,
+    0x58, 0x4D, 0x58, 0x55, 0x58, 0x45, 0x48, 0x3A, 0x44, 0x4B, 0x48, 0x4E, 0x4D, 0x50, 0x52, 0x36,
+    0x43, 0x4A, 0x3D, 0x3A, 0x44, 0x2D, 0x48, 0x53, 0x56, 0x58, 0x4D, 0x3D, 0x36, 0x4C, 0x50, 0x56,
+    0x5E, 0x54, 0x4F, 0x45, 0x49, 0x5E, 0x61, 0x54, 0x55, 0x38, 0x01, 0x07, 0x5E, 0x4F, 0x53, 0x47,
+    0x53, 0x58, 0x49, 0x42, 0x01, 0x0E, 0x37, 0x42, 0x52, 0x41, 0x50, 0x48, 0x3A, 0x39, 0x40, 0x4C,
+    0x4B, 0x36, 0x37, 0x1F, 0x03, 0x00, 0x00, 0x43, 0x01, 0x01, 0x00, 0x0E, 0x72, 0x71, 0x6C, 0x69,
+    0x5B, 0x68, 0x67, 0x72, 0x77, 0x77, 0x74, 0x6A, 0x6E, 0x75, 0x12, 0x00, 0x01, 0x6C, 0x18, 0x00,
+    0x2A, 0x75, 0x72, 0x6A, 0x69, 0x6A, 0x70, 0x6F, 0x67, 0x66, 0x5B, 0x56, 0x5B, 0x66, 0x6B, 0x6B,
+    0x60, 0x57, 0x55, 0x5B, 0x5A, 0x5A, 0x61, 0x56, 0x41, 0x69, 0x6C, 0x70, 0x70, 0x6A, 0x60, 0x5B,
+    0x65, 0x64, 0x70, 0x74, 0x75, 0x72, 0x67, 0x6C, 0x72, 0x75, 0x73, 0x45, 0x00, 0x1E, 0x5A, 0x62,
+    0x6C, 0x70, 0x71, 0x70, 0x6D, 0x66, 0x6D, 0x6A, 0x67, 0x62, 0x5D, 0x5C, 0x58, 0x61, 0x65, 0x60,
+    0x69, 0x68, 0x5B, 0x56, 0x61, 0x5F, 0x63, 0x5C, 0x58, 0x47, 0x65, 0x6B, 0x66, 0x00, 0x01, 0x5A,
+    0x6A, 0x00, 0x07, 0x6D, 0x6E, 0x6A, 0x69, 0x62, 0x6A, 0x6C, 0x74, 0x00, 0x1F, 0x57, 0x61, 0x65,
+    0x66, 0x69, 0x64, 0x64, 0x66, 0x5F, 0x66, 0x60, 0x68, 0x5A, 0x61, 0x55, 0x4D, 0x55, 0x61, 0x63,
+    0x5F, 0x57, 0x59, 0x45, 0x4F, 0x54, 0x54, 0x55, 0x4D, 0x52, 0x5C, 0x65, 0x9A, 0x00, 0x05, 0x69,
+    0x60, 0x5F, 0x5A, 0x66, 0xA3, 0x00, 0x22, 0x4F, 0x58, 0x54, 0x61, 0x5C, 0x5A, 0x65, 0x57, 0x5E,
+    0x5B, 0x5B, 0x5C, 0x59, 0x56, 0x4D, 0x52, 0x4D, 0x58, 0x4F, 0x5E, 0x4F, 0x53, 0x4A, 0x45, 0x49,
+    0x51, 0x4E, 0x3D, 0x42, 0x49, 0x54, 0x57, 0x5B, 0x5E, 0xCB, 0x00, 0x27, 0x63, 0x5E, 0x54, 0x63,
+    0x5F, 0x5C, 0x55, 0x45, 0x50, 0x49, 0x4F, 0x5E, 0x5C, 0x4F, 0x53, 0x55, 0x4F, 0x56, 0x51, 0x4E,
+    0x3D, 0x42, 0x3D, 0x50, 0x53, 0x51, 0x45, 0x48, 0x40, 0x4A, 0x41, 0x47, 0x52, 0x46, 0x37, 0x50,
+    0x56, 0x59, 0x59, 0xF7, 0x00, 0x08, 0x59, 0x61, 0x61, 0x5E, 0x49, 0x58, 0x54, 0x61, 0x03, 0x01,
+    0x1D, 0x3D, 0x4D, 0x58, 0x59, 0x5E, 0x4F, 0x51, 0x41, 0x51, 0x58, 0x49, 0x4D, 0x48, 0x40, 0x39,
+    0x40, 0x4A, 0x50, 0x4E, 0x47, 0x4B, 0x44, 0x3A, 0x43, 0x43, 0x40, 0x31, 0x26, 0x4A, 0x23, 0x01,
+    0x10, 0x45, 0x4A, 0x42, 0x43, 0x4E, 0x56, 0x54, 0x54, 0x4F, 0x4D, 0x53, 0x59, 0x5C, 0x5C, 0x55,
+    0x45, 0x38, 0x01, 0x18, 0x59, 0x56, 0x4D, 0x4A, 0x45, 0x49, 0x51, 0x4E, 0x52, 0x36, 0x2B, 0x42,
+    0x52, 0x47, 0x47, 0x3D, 0x46, 0x37, 0x36, 0x3A, 0x3A, 0x36, 0x2B, 0x09, 0x03, 0x00, 0x00, 0x46,
+    0x01, 0x00, 0x00, 0x32, 0x6C, 0x72, 0x72, 0x6E, 0x62, 0x57, 0x68, 0x6A, 0x73, 0x77, 0x77, 0x73,
+    0x67, 0x6A, 0x74, 0x78, 0x77, 0x74, 0x6C, 0x66, 0x65, 0x6D, 0x70, 0x74, 0x74, 0x71, 0x64, 0x68,
+    0x6D, 0x6E, 0x6E, 0x6D, 0x66, 0x61, 0x58, 0x5B, 0x68, 0x69, 0x69, 0x5D, 0x61, 0x49, 0x5C, 0x63,
+    0x63, 0x5C, 0x58, 0x47, 0x66, 0x6A, 0x38, 0x00, 0x09, 0x6D, 0x70, 0x74, 0x74, 0x71, 0x6D, 0x6D,
+    0x71, 0x74, 0x44, 0x00, 0x20, 0x5D, 0x5F, 0x62, 0x6A, 0x6F, 0x70, 0x6E, 0x62, 0x65, 0x6B, 0x6D,
+    0x6D, 0x69, 0x65, 0x54, 0x51, 0x54, 0x5A, 0x68, 0x66, 0x5A, 0x54, 0x51, 0x5E, 0x5B, 0x5B, 0x54,
+    0x49, 0x48, 0x5F, 0x69, 0x6D, 0x6B, 0x00, 0x06, 0x6C, 0x67, 0x66, 0x60, 0x6D, 0x6A, 0x75, 0x00,
+    0x22, 0x5C, 0x5A, 0x66, 0x60, 0x62, 0x62, 0x5D, 0x61, 0x65, 0x68, 0x65, 0x5F, 0x5C, 0x58, 0x50,
+    0x58, 0x54, 0x5B, 0x57, 0x5C, 0x56, 0x50, 0x58, 0x59, 0x59, 0x58, 0x50, 0x4C, 0x5E, 0x5F, 0x68,
+    0x68, 0x5F, 0x54, 0x9B, 0x00, 0x28, 0x68, 0x57, 0x57, 0x68, 0x68, 0x65, 0x5F, 0x5B, 0x55, 0x49,
+    0x5E, 0x5C, 0x54, 0x63, 0x5F, 0x5C, 0x56, 0x54, 0x5C, 0x5E, 0x4F, 0x49, 0x50, 0x43, 0x50, 0x51,
+    0x56, 0x55, 0x58, 0x4E, 0x43, 0x50, 0x45, 0x45, 0x50, 0x43, 0x3B, 0x51, 0x5E, 0x5B, 0xC8, 0x00,
+    0x2F, 0x4F, 0x61, 0x5F, 0x5B, 0x4F, 0x59, 0x5B, 0x63, 0x5C, 0x55, 0x4D, 0x41, 0x49, 0x55, 0x59,
+    0x5E, 0x58, 0x4E, 0x58, 0x56, 0x58, 0x53, 0x50, 0x43, 0x3B, 0x43, 0x41, 0x4D, 0x45, 0x50, 0x43,
+    0x3B, 0x43, 0x48, 0x4A, 0x43, 0x36, 0x32, 0x41, 0x58, 0x59, 0x59, 0x58, 0x50, 0x4B, 0x4A, 0x51,
+    0xFB, 0x00, 0x03, 0x53, 0x51, 0x5E, 0x02, 0x01, 0x1D, 0x48, 0x52, 0x4D, 0x58, 0x4F, 0x59, 0x56,
+    0x4D, 0x4A, 0x4D, 0x51, 0x51, 0x4E, 0x4A, 0x46, 0x3C, 0x46, 0x3D, 0x47, 0x41, 0x3D, 0x46, 0x3C,
+    0x42, 0x4B, 0x4B, 0x46, 0x39, 0x27, 0x22, 0x01, 0x12, 0x56, 0x53, 0x48, 0x46, 0x43, 0x4D, 0x55,
+    0x54, 0x54, 0x55, 0x4E, 0x45, 0x4F, 0x5C, 0x5C, 0x4F, 0x45, 0x3D, 0x37, 0x01, 0x19, 0x4F, 0x59,
+    0x58, 0x50, 0x43, 0x4E, 0x53, 0x53, 0x4E, 0x52, 0x3B, 0x32, 0x36, 0x43, 0x48, 0x48, 0x43, 0x3B,
+    0x35, 0x3E, 0x40, 0x40, 0x3B, 0x32, 0x03, 0x03, 0x00, 0x00, 0x43, 0x01, 0x03, 0x00, 0x03, 0x6F,
+    0x62, 0x63, 0x0A, 0x00, 0x06, 0x76, 0x72, 0x6D, 0x6D, 0x72, 0x77, 0x15, 0x00, 0x1E, 0x64, 0x70,
+    0x73, 0x73, 0x6F, 0x62, 0x5A, 0x6B, 0x6A, 0x6C, 0x64, 0x68, 0x5C, 0x51, 0x61, 0x65, 0x60, 0x66,
+    0x5A, 0x5E, 0x45, 0x59, 0x5B, 0x57, 0x54, 0x49, 0x48, 0x5D, 0x67, 0x6F, 0x3A, 0x00, 0x2A, 0x73,
+    0x73, 0x6F, 0x6B, 0x6B, 0x6F, 0x72, 0x72, 0x6F, 0x6D, 0x5D, 0x63, 0x69, 0x67, 0x6E, 0x6E, 0x67,
+    0x66, 0x63, 0x60, 0x6B, 0x6B, 0x60, 0x5A, 0x5E, 0x45, 0x5E, 0x63, 0x65, 0x65, 0x57, 0x4F, 0x4E,
+    0x55, 0x5C, 0x5C, 0x59, 0x53, 0x3D, 0x57, 0x60, 0x64, 0x6A, 0x00, 0x5C, 0x64, 0x6A, 0x64, 0x5D,
+    0x5D, 0x6B, 0x6D, 0x6D, 0x62, 0x68, 0x5B, 0x5E, 0x5F, 0x68, 0x66, 0x69, 0x66, 0x63, 0x5E, 0x63,
+    0x5A, 0x5A, 0x57, 0x54, 0x49, 0x47, 0x49, 0x59, 0x5C, 0x5C, 0x59, 0x53, 0x4A, 0x53, 0x56, 0x56,
+    0x51, 0x47, 0x3A, 0x4F, 0x63, 0x5D, 0x5D, 0x5F, 0x5E, 0x53, 0x56, 0x5B, 0x60, 0x65, 0x61, 0x61,
+    0x5A, 0x5D, 0x65, 0x5F, 0x61, 0x55, 0x51, 0x59, 0x5C, 0x5E, 0x57, 0x5B, 0x59, 0x51, 0x4F, 0x5E,
+    0x4F, 0x55, 0x51, 0x47, 0x4B, 0x47, 0x53, 0x49, 0x58, 0x53, 0x48, 0x40, 0x48, 0x4E, 0x4E, 0x47,
+    0x4B, 0x44, 0x45, 0x59, 0x61, 0x5B, 0x5E, 0x49, 0xCA, 0x00, 0x2C, 0x63, 0x61, 0x56, 0x56, 0x5C,
+    0x5B, 0x54, 0x55, 0x4D, 0x47, 0x51, 0x55, 0x4F, 0x4F, 0x53, 0x47, 0x53, 0x49, 0x51, 0x45, 0x41,
+    0x4C, 0x3E, 0x4C, 0x48, 0x50, 0x50, 0x48, 0x3A, 0x31, 0x3A, 0x52, 0x52, 0x4B, 0x3E, 0x35, 0x47,
+    0x49, 0x59, 0x59, 0x56, 0x4E, 0x4B, 0x48, 0xF9, 0x00, 0x06, 0x5C, 0x4F, 0x45, 0x45, 0x4F, 0x5C,
+    0x04, 0x01, 0x31, 0x4E, 0x58, 0x55, 0x4F, 0x58, 0x50, 0x43, 0x50, 0x53, 0x53, 0x4E, 0x3D, 0x42,
+    0x37, 0x42, 0x52, 0x48, 0x48, 0x43, 0x3B, 0x32, 0x3B, 0x40, 0x3A, 0x36, 0x37, 0x1F, 0x3D, 0x45,
+    0x56, 0x55, 0x51, 0x47, 0x40, 0x52, 0x45, 0x4F, 0x5C, 0x54, 0x56, 0x50, 0x4E, 0x55, 0x54, 0x5C,
+    0x4F, 0x53, 0x3D, 0x4B, 0x38, 0x01, 0x18, 0x4F, 0x51, 0x47, 0x4B, 0x41, 0x45, 0x45, 0x50, 0x52,
+    0x3B, 0x35, 0x3B, 0x4C, 0x4A, 0x3D, 0x4B, 0x31, 0x2D, 0x31, 0x42, 0x46, 0x3E, 0x32, 0x2E, 0x01,
+    0x00, 0x00, 0x57, 0x01, 0x6A, 0x71, 0x72, 0x6F, 0x6B, 0x63, 0x68, 0x6A, 0x73, 0x76, 0x75, 0x70,
+    0x6B, 0x6B, 0x70, 0x75, 0x76, 0x73, 0x6C, 0x66, 0x5A, 0x64, 0x6F, 0x72, 0x71, 0x6A, 0x66, 0x57,
+    0x60, 0x6D, 0x67, 0x6B, 0x5D, 0x54, 0x53, 0x54, 0x5A, 0x68, 0x5D, 0x57, 0x56, 0x50, 0x55, 0x5C,
+    0x61, 0x5E, 0x51, 0x3D, 0x65, 0x64, 0x6E, 0x6F, 0x6A, 0x60, 0x5B, 0x65, 0x64, 0x70, 0x73, 0x72,
+    0x6C, 0x60, 0x60, 0x6C, 0x71, 0x71, 0x6F, 0x64, 0x65, 0x57, 0x60, 0x6D, 0x6C, 0x6A, 0x64, 0x65,
+    0x5C, 0x5D, 0x69, 0x69, 0x66, 0x63, 0x4F, 0x4E, 0x4F, 0x5B, 0x5F, 0x5F, 0x5C, 0x49, 0x47, 0x49,
+    0x59, 0x5E, 0x55, 0x4D, 0x43, 0x61, 0x68, 0x6B, 0x64, 0x69, 0x5F, 0x4F, 0x61, 0x68, 0x64, 0x67,
+    0x62, 0x5F, 0x5F, 0x69, 0x64, 0x64, 0x62, 0x5D, 0x61, 0x59, 0x63, 0x65, 0x68, 0x66, 0x65, 0x61,
+    0x56, 0x61, 0x63, 0x63, 0x5B, 0x59, 0x53, 0x4A, 0x53, 0x4F, 0x5E, 0x5E, 0x56, 0x50, 0x4C, 0x4E,
+    0x51, 0x49, 0x45, 0x48, 0x46, 0x56, 0x5B, 0x65, 0x5D, 0x5F, 0x5E, 0x45, 0x56, 0x5B, 0x68, 0x5A,
+    0x5E, 0x5E, 0x63, 0x65, 0x5A, 0x63, 0x5C, 0x58, 0x45, 0x4F, 0x5E, 0x59, 0x61, 0x5C, 0x56, 0x4E,
+    0x58, 0x4F, 0x55, 0x58, 0x45, 0x48, 0x40, 0x48, 0x4D, 0x53, 0x53, 0x50, 0x43, 0x3B, 0x43, 0x47,
+    0x41, 0x4A, 0x3A, 0x39, 0x4E, 0x4F, 0x61, 0x61, 0x5E, 0x49, 0x48, 0x4E, 0x4F, 0x61, 0x57, 0x54,
+    0x49, 0x49, 0x5E, 0x61, 0x54, 0x56, 0x4E, 0x48, 0x53, 0x56, 0x55, 0x56, 0x4E, 0x3D, 0x4E, 0x53,
+    0x53, 0x4D, 0x48, 0x3A, 0x31, 0x3A, 0x4A, 0x41, 0x47, 0x52, 0x42, 0x37, 0x42, 0x4C, 0x43, 0x3A,
+    0x44, 0x2D, 0x48, 0x51, 0x4F, 0x59, 0x56, 0x4E, 0x4C, 0x48, 0x49, 0x5E, 0x61, 0x5C, 0x55, 0x4E,
+    0x4E, 0x55, 0x54, 0x54, 0x59, 0x51, 0x48, 0x43, 0x4E, 0x49, 0x55, 0x56, 0x51, 0x48, 0x3A, 0x47,
+    0x4D, 0x4D, 0x50, 0x52, 0x36, 0x32, 0x36, 0x4C, 0x3D, 0x3D, 0x3A, 0x31, 0x2D, 0x31, 0x42, 0x46,
+    0x3B, 0x2B, 0x09, 0x52, 0x45, 0x55, 0x4F, 0x49, 0x41, 0x3A, 0x3D, 0x53, 0x59, 0x5C, 0x54, 0x56,
+    0x41, 0x50, 0x56, 0x54, 0x5C, 0x59, 0x53, 0x3D, 0x4B, 0x50, 0x49, 0x55, 0x55, 0x53, 0x4A, 0x40,
+    0x48, 0x4D, 0x45, 0x50, 0x43, 0x3E, 0x30, 0x3B, 0x4C, 0x3D, 0x52, 0x40, 0x3C, 0x25, 0x3C, 0x36,
+    0x42, 0x3E, 0x35, 0x2E, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x42, 0x01,
+    0x00, 0x00, 0x02, 0x6D, 0x70, 0x0A, 0x00, 0x2A, 0x74, 0x6F, 0x69, 0x60, 0x6E, 0x74, 0x75, 0x72,
+    0x6A, 0x68, 0x63, 0x62, 0x6E, 0x70, 0x6F, 0x6D, 0x65, 0x5C, 0x5D, 0x6B, 0x64, 0x62, 0x5A, 0x59,
+    0x4D, 0x5E, 0x63, 0x65, 0x5A, 0x5C, 0x51, 0x48, 0x49, 0x5E, 0x54, 0x4F, 0x53, 0x52, 0x63, 0x62,
+    0x6C, 0x6E, 0x37, 0x00, 0x8C, 0x5A, 0x64, 0x6F, 0x72, 0x70, 0x67, 0x68, 0x5D, 0x6D, 0x6F, 0x70,
+    0x6E, 0x6B, 0x5A, 0x61, 0x68, 0x64, 0x67, 0x6D, 0x69, 0x63, 0x59, 0x5F, 0x68, 0x66, 0x5D, 0x5B,
+    0x56, 0x41, 0x56, 0x61, 0x57, 0x5B, 0x59, 0x4D, 0x52, 0x45, 0x55, 0x4F, 0x58, 0x4E, 0x4B, 0x54,
+    0x65, 0x62, 0x6B, 0x60, 0x5F, 0x4F, 0x5C, 0x68, 0x6B, 0x64, 0x60, 0x57, 0x5B, 0x68, 0x62, 0x62,
+    0x69, 0x65, 0x54, 0x55, 0x5B, 0x5A, 0x65, 0x65, 0x63, 0x5E, 0x51, 0x5E, 0x61, 0x5B, 0x5C, 0x55,
+    0x4D, 0x52, 0x4D, 0x56, 0x4F, 0x55, 0x53, 0x4A, 0x46, 0x48, 0x45, 0x53, 0x4E, 0x3D, 0x36, 0x49,
+    0x5C, 0x5A, 0x65, 0x63, 0x5E, 0x45, 0x58, 0x61, 0x5D, 0x63, 0x4F, 0x55, 0x5B, 0x5F, 0x5F, 0x63,
+    0x5C, 0x49, 0x4D, 0x55, 0x59, 0x55, 0x54, 0x59, 0x53, 0x48, 0x53, 0x58, 0x58, 0x49, 0x4D, 0x3D,
+    0x42, 0x3D, 0x50, 0x4D, 0x4E, 0x48, 0x40, 0x31, 0x3A, 0x3D, 0x48, 0x52, 0x46, 0x37, 0x50, 0x56,
+    0x5C, 0xC8, 0x00, 0x2D, 0x55, 0x61, 0x5B, 0x5E, 0x53, 0x45, 0x4F, 0x5C, 0x5E, 0x56, 0x50, 0x4A,
+    0x45, 0x58, 0x56, 0x51, 0x41, 0x4B, 0x41, 0x4D, 0x4D, 0x4E, 0x4A, 0x40, 0x3C, 0x40, 0x52, 0x48,
+    0x4A, 0x4B, 0x44, 0x30, 0x3E, 0x40, 0x4B, 0x46, 0x31, 0x27, 0x3D, 0x53, 0x4F, 0x59, 0x55, 0x4D,
+    0x43, 0xF9, 0x00, 0x06, 0x54, 0x56, 0x50, 0x41, 0x58, 0x5E, 0x03, 0x01, 0x1C, 0x4C, 0x50, 0x49,
+    0x56, 0x58, 0x45, 0x3D, 0x46, 0x4A, 0x50, 0x4E, 0x41, 0x43, 0x3B, 0x35, 0x3B, 0x4B, 0x52, 0x43,
+    0x46, 0x37, 0x25, 0x3C, 0x36, 0x42, 0x3E, 0x2B, 0x03, 0x23, 0x01, 0x05, 0x58, 0x50, 0x4B, 0x3D,
+    0x51, 0x2B, 0x01, 0x05, 0x58, 0x47, 0x47, 0x58, 0x5E, 0x38, 0x01, 0x08, 0x56, 0x4D, 0x52, 0x36,
+    0x3D, 0x4E, 0x4D, 0x41, 0x43, 0x01, 0x0B, 0x3E, 0x4B, 0x52, 0x4C, 0x42, 0x2B, 0x09, 0x37, 0x3E,
+    0x36, 0x44, 0x03, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00, 0x95, 0x6B, 0x6F, 0x71, 0x6E, 0x6B, 0x63,
+    0x5D, 0x6A, 0x72, 0x75, 0x73, 0x6A, 0x68, 0x68, 0x6A, 0x72, 0x73, 0x71, 0x67, 0x5D, 0x57, 0x69,
+    0x6A, 0x6E, 0x6C, 0x62, 0x63, 0x4F, 0x5F, 0x60, 0x62, 0x60, 0x5F, 0x55, 0x4E, 0x4F, 0x5B, 0x5F,
+    0x57, 0x59, 0x4D, 0x43, 0x45, 0x55, 0x59, 0x55, 0x4D, 0x4C, 0x5B, 0x60, 0x67, 0x6C, 0x67, 0x66,
+    0x61, 0x5F, 0x6B, 0x6E, 0x70, 0x6F, 0x64, 0x5A, 0x5F, 0x6B, 0x6C, 0x6E, 0x6A, 0x62, 0x63, 0x54,
+    0x5D, 0x62, 0x64, 0x6B, 0x68, 0x5C, 0x58, 0x61, 0x65, 0x5D, 0x5A, 0x61, 0x49, 0x48, 0x49, 0x5E,
+    0x61, 0x54, 0x58, 0x47, 0x3A, 0x50, 0x49, 0x56, 0x51, 0x41, 0x40, 0x4F, 0x5F, 0x60, 0x62, 0x60,
+    0x5F, 0x55, 0x54, 0x5D, 0x62, 0x6B, 0x5D, 0x5C, 0x54, 0x65, 0x60, 0x69, 0x66, 0x5A, 0x5E, 0x58,
+    0x61, 0x5F, 0x5F, 0x5F, 0x61, 0x56, 0x4E, 0x56, 0x54, 0x54, 0x5E, 0x56, 0x50, 0x4B, 0x50, 0x49,
+    0x56, 0x49, 0x4E, 0x4C, 0x3B, 0x52, 0x50, 0x4E, 0x41, 0x43, 0x3E, 0x53, 0x54, 0x63, 0x5A, 0x98,
+    0x00, 0x2B, 0x49, 0x61, 0x5A, 0x61, 0x58, 0x49, 0x54, 0x57, 0x57, 0x57, 0x54, 0x51, 0x50, 0x58,
+    0x4F, 0x56, 0x59, 0x56, 0x4E, 0x52, 0x4E, 0x51, 0x51, 0x53, 0x50, 0x43, 0x3B, 0x43, 0x47, 0x50,
+    0x41, 0x52, 0x36, 0x2B, 0x42, 0x43, 0x3D, 0x4C, 0x36, 0x32, 0x47, 0x58, 0x54, 0xCA, 0x00, 0x2A,
+    0x61, 0x4F, 0x4E, 0x50, 0x56, 0x5E, 0x5E, 0x58, 0x41, 0x3D, 0x4D, 0x49, 0x58, 0x45, 0x4A, 0x46,
+    0x4A, 0x50, 0x4E, 0x50, 0x3D, 0x42, 0x37, 0x46, 0x43, 0x3D, 0x52, 0x46, 0x3C, 0x27, 0x39, 0x42,
+    0x40, 0x42, 0x3C, 0x25, 0x52, 0x45, 0x55, 0x59, 0x55, 0x45, 0xF8, 0x00, 0x3C, 0x5C, 0x54, 0x58,
+    0x47, 0x48, 0x49, 0x59, 0x5E, 0x4F, 0x51, 0x4A, 0x4B, 0x50, 0x51, 0x58, 0x49, 0x4E, 0x4C, 0x3B,
+    0x43, 0x41, 0x50, 0x47, 0x43, 0x3E, 0x30, 0x3B, 0x4B, 0x43, 0x4B, 0x3B, 0x35, 0x03, 0x2B, 0x3E,
+    0x36, 0x44, 0x32, 0x2E, 0x43, 0x4D, 0x55, 0x59, 0x56, 0x4D, 0x4C, 0x4A, 0x49, 0x5E, 0x61, 0x54,
+    0x49, 0x48, 0x48, 0x49, 0x5E, 0x54, 0x59, 0x51, 0x4A, 0x37, 0x01, 0x19, 0x56, 0x58, 0x4E, 0x4C,
+    0x3E, 0x43, 0x41, 0x4E, 0x41, 0x43, 0x44, 0x30, 0x3E, 0x3A, 0x43, 0x4B, 0x3B, 0x35, 0x2E, 0x32,
+    0x44, 0x3B, 0x44, 0x35, 0x2C, 0x03, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0xC4, 0x62, 0x6C, 0x70,
+    0x6E, 0x62, 0x63, 0x65, 0x67, 0x71, 0x73, 0x71, 0x6D, 0x5A, 0x5F, 0x64, 0x6F, 0x72, 0x70, 0x6D,
+    0x5A, 0x61, 0x66, 0x6D, 0x6A, 0x6D, 0x66, 0x5C, 0x58, 0x5B, 0x5D, 0x60, 0x68, 0x57, 0x58, 0x41,
+    0x56, 0x5C, 0x57, 0x5C, 0x58, 0x47, 0x3A, 0x50, 0x49, 0x55, 0x58, 0x50, 0x4B, 0x54, 0x68, 0x6D,
+    0x6A, 0x6D, 0x66, 0x5C, 0x63, 0x62, 0x6C, 0x6F, 0x6A, 0x69, 0x57, 0x5B, 0x60, 0x6D, 0x6A, 0x67,
+    0x60, 0x57, 0x59, 0x5A, 0x60, 0x62, 0x60, 0x5F, 0x59, 0x45, 0x5E, 0x57, 0x5A, 0x63, 0x5E, 0x53,
+    0x3D, 0x53, 0x4F, 0x5E, 0x4F, 0x53, 0x52, 0x42, 0x4A, 0x45, 0x51, 0x45, 0x48, 0x42, 0x56, 0x57,
+    0x68, 0x69, 0x66, 0x63, 0x56, 0x5E, 0x65, 0x69, 0x69, 0x5A, 0x59, 0x4F, 0x63, 0x68, 0x66, 0x68,
+    0x5F, 0x4F, 0x51, 0x54, 0x57, 0x57, 0x5B, 0x5E, 0x53, 0x48, 0x51, 0x4F, 0x59, 0x4F, 0x49, 0x47,
+    0x40, 0x47, 0x45, 0x51, 0x45, 0x48, 0x46, 0x39, 0x3A, 0x48, 0x41, 0x48, 0x4B, 0x31, 0x4E, 0x59,
+    0x57, 0x5F, 0x57, 0x59, 0x4D, 0x51, 0x5C, 0x5F, 0x54, 0x53, 0x45, 0x59, 0x61, 0x5B, 0x61, 0x5E,
+    0x53, 0x47, 0x49, 0x55, 0x49, 0x56, 0x51, 0x47, 0x3A, 0x47, 0x4D, 0x45, 0x45, 0x41, 0x4B, 0x44,
+    0x4B, 0x4A, 0x47, 0x4A, 0x4B, 0x31, 0x2D, 0x3E, 0x3A, 0x4C, 0x3A, 0x3E, 0x30, 0x4A, 0x51, 0x5E,
+    0x5C, 0xC7, 0x00, 0x29, 0x50, 0x55, 0x5C, 0x5C, 0x56, 0x41, 0x47, 0x49, 0x59, 0x59, 0x58, 0x41,
+    0x43, 0x4E, 0x51, 0x49, 0x50, 0x43, 0x3B, 0x43, 0x47, 0x41, 0x47, 0x52, 0x36, 0x32, 0x36, 0x4C,
+    0x43, 0x4B, 0x36, 0x32, 0x09, 0x37, 0x3B, 0x42, 0x3B, 0x37, 0x1F, 0x43, 0x4D, 0xF4, 0x00, 0x01,
+    0x52, 0xF9, 0x00, 0x06, 0x5E, 0x49, 0x4A, 0x3D, 0x53, 0x4F, 0x04, 0x01, 0x1C, 0x41, 0x51, 0x49,
+    0x53, 0x41, 0x3A, 0x31, 0x4B, 0x48, 0x41, 0x48, 0x4C, 0x44, 0x30, 0x3E, 0x3A, 0x4C, 0x40, 0x44,
+    0x2D, 0x2C, 0x35, 0x31, 0x3B, 0x44, 0x35, 0x2E, 0x4C, 0x23, 0x01, 0x0D, 0x55, 0x45, 0x43, 0x48,
+    0x49, 0x54, 0x61, 0x5E, 0x49, 0x4A, 0x3D, 0x53, 0x59, 0x38, 0x01, 0x16, 0x49, 0x41, 0x3A, 0x31,
+    0x4C, 0x47, 0x50, 0x47, 0x4C, 0x44, 0x2D, 0x3E, 0x3A, 0x4C, 0x3A, 0x44, 0x26, 0x2C, 0x30, 0x31,
+    0x3B, 0x31, 0x03, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00, 0xC4, 0x66, 0x67, 0x6E, 0x6C, 0x69, 0x57,
+    0x5A, 0x6D, 0x70, 0x71, 0x6E, 0x62, 0x57, 0x5B, 0x69, 0x6C, 0x6F, 0x6E, 0x6B, 0x5F, 0x54, 0x5D,
+    0x6B, 0x6D, 0x62, 0x5A, 0x59, 0x45, 0x5E, 0x5F, 0x5D, 0x5A, 0x61, 0x51, 0x48, 0x49, 0x5E, 0x5C,
+    0x59, 0x53, 0x52, 0x42, 0x48, 0x53, 0x58, 0x51, 0x41, 0x40, 0x59, 0x65, 0x6B, 0x6D, 0x64, 0x68,
+    0x54, 0x5B, 0x69, 0x67, 0x6C, 0x6D, 0x68, 0x5C, 0x5E, 0x65, 0x6B, 0x6D, 0x64, 0x66, 0x61, 0x55,
+    0x63, 0x68, 0x66, 0x5D, 0x5B, 0x58, 0x41, 0x56, 0x5C, 0x57, 0x5B, 0x4F, 0x4E, 0x43, 0x4D, 0x56,
+    0x55, 0x58, 0x50, 0x3A, 0x44, 0x43, 0x50, 0x45, 0x4E, 0x3D, 0x36, 0x51, 0x61, 0x65, 0x66, 0x68,
+    0x57, 0x58, 0x4F, 0x5F, 0x60, 0x68, 0x57, 0x56, 0x49, 0x61, 0x5A, 0x5D, 0x65, 0x57, 0x55, 0x45,
+    0x59, 0x61, 0x61, 0x5C, 0x55, 0x50, 0x43, 0x4E, 0x58, 0x55, 0x56, 0x53, 0x3D, 0x42, 0x4A, 0x4E,
+    0x45, 0x50, 0x52, 0x3E, 0x32, 0x42, 0x52, 0x48, 0x3D, 0x40, 0x3C, 0x41, 0x56, 0x61, 0x63, 0x5B,
+    0x59, 0x4E, 0x53, 0x54, 0x57, 0x59, 0x4D, 0x50, 0x56, 0x54, 0x61, 0x5C, 0x4F, 0x4D, 0x48, 0x53,
+    0x58, 0x51, 0x49, 0x4D, 0x52, 0x36, 0x3D, 0x50, 0x4E, 0x4E, 0x48, 0x40, 0x39, 0x3A, 0x3D, 0x4A,
+    0x43, 0x42, 0x2B, 0x25, 0x39, 0x42, 0x3A, 0x40, 0x44, 0x2D, 0x52, 0x53, 0x59, 0x54, 0xC8, 0x00,
+    0x38, 0x56, 0x5C, 0x54, 0x49, 0x48, 0x3D, 0x53, 0x55, 0x59, 0x49, 0x47, 0x4C, 0x50, 0x53, 0x53,
+    0x47, 0x3A, 0x31, 0x4B, 0x4A, 0x47, 0x48, 0x43, 0x3E, 0x35, 0x3B, 0x3A, 0x4C, 0x40, 0x44, 0x2D,
+    0x2C, 0x35, 0x44, 0x36, 0x3E, 0x2B, 0x09, 0x4C, 0x4E, 0x55, 0x59, 0x4F, 0x53, 0x52, 0x48, 0x58,
+    0x5E, 0x5C, 0x59, 0x53, 0x3D, 0x43, 0x4D, 0x55, 0x59, 0x03, 0x01, 0x1C, 0x3A, 0x41, 0x53, 0x51,
+    0x45, 0x48, 0x46, 0x3C, 0x40, 0x3D, 0x47, 0x48, 0x4B, 0x31, 0x2D, 0x44, 0x40, 0x3A, 0x46, 0x39,
+    0x25, 0x2A, 0x2D, 0x39, 0x3E, 0x31, 0x35, 0x2C, 0x22, 0x01, 0x06, 0x5E, 0x4F, 0x53, 0x52, 0x47,
+    0x58, 0x2B, 0x01, 0x05, 0x51, 0x3D, 0x43, 0x45, 0x4F, 0x37, 0x01, 0x07, 0x58, 0x53, 0x47, 0x46,
+    0x3C, 0x3A, 0x48, 0x45, 0x01, 0x0B, 0x4B, 0x46, 0x39, 0x27, 0x2A, 0x2D, 0x39, 0x3E, 0x31, 0x35,
+    0x2E, 0x03, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0xC3, 0x5D, 0x64, 0x6C, 0x67, 0x60, 0x5B, 0x5F,
+    0x6B, 0x6E, 0x6F, 0x6A, 0x66, 0x5C, 0x5E, 0x5D, 0x6D, 0x6C, 0x6A, 0x69, 0x57, 0x59, 0x5A, 0x69,
+    0x62, 0x66, 0x57, 0x58, 0x41, 0x55, 0x5B, 0x5F, 0x63, 0x5E, 0x45, 0x3D, 0x53, 0x4F, 0x59, 0x56,
+    0x50, 0x3A, 0x44, 0x43, 0x4E, 0x53, 0x45, 0x48, 0x42, 0x56, 0x63, 0x60, 0x64, 0x62, 0x5D, 0x5E,
+    0x61, 0x66, 0x6D, 0x67, 0x62, 0x5A, 0x4F, 0x56, 0x63, 0x60, 0x6B, 0x62, 0x5D, 0x54, 0x58, 0x5B,
+    0x65, 0x5D, 0x5F, 0x5E, 0x45, 0x3D, 0x53, 0x59, 0x5C, 0x54, 0x56, 0x41, 0x4B, 0x50, 0x51, 0x58,
+    0x45, 0x4A, 0x36, 0x37, 0x40, 0x48, 0x50, 0x41, 0x43, 0x3E, 0x4D, 0x5E, 0x5F, 0x68, 0x65, 0x5B,
+    0x49, 0x55, 0x63, 0x68, 0x65, 0x5C, 0x51, 0x4D, 0x5E, 0x63, 0x5A, 0x5A, 0x61, 0x58, 0x4E, 0x55,
+    0x54, 0x54, 0x59, 0x51, 0x48, 0x40, 0x47, 0x53, 0x49, 0x49, 0x4D, 0x43, 0x3B, 0x52, 0x41, 0x50,
+    0x48, 0x3A, 0x3C, 0x26, 0x44, 0x4B, 0x52, 0x43, 0x42, 0x2B, 0x4A, 0x49, 0x54, 0x57, 0x5B, 0x4F,
+    0x4E, 0x45, 0x5E, 0x61, 0x56, 0x41, 0x48, 0x51, 0x59, 0x54, 0x54, 0x55, 0x4E, 0x3D, 0x45, 0x49,
+    0x45, 0x53, 0x41, 0x4B, 0x44, 0x4C, 0x48, 0x41, 0x41, 0x3D, 0x42, 0x37, 0x46, 0x43, 0x52, 0x4B,
+    0x3E, 0x30, 0x03, 0x2B, 0x3B, 0x46, 0x42, 0x39, 0x27, 0x4C, 0x4D, 0x55, 0xC7, 0x00, 0x2A, 0x41,
+    0x56, 0x54, 0x59, 0x53, 0x3D, 0x43, 0x4D, 0x56, 0x4F, 0x51, 0x48, 0x4B, 0x41, 0x45, 0x45, 0x4A,
+    0x42, 0x37, 0x46, 0x52, 0x48, 0x4A, 0x4C, 0x44, 0x30, 0x3E, 0x40, 0x3A, 0x42, 0x3C, 0x25, 0x2A,
+    0x2D, 0x39, 0x3E, 0x44, 0x32, 0x03, 0x3A, 0x4E, 0x56, 0xF4, 0x00, 0x01, 0x3D, 0xF8, 0x00, 0x47,
+    0x54, 0x4F, 0x45, 0x43, 0x4B, 0x4E, 0x58, 0x59, 0x4F, 0x53, 0x3D, 0x3A, 0x47, 0x45, 0x53, 0x4E,
+    0x3D, 0x3B, 0x32, 0x42, 0x52, 0x48, 0x4A, 0x4B, 0x31, 0x26, 0x44, 0x46, 0x40, 0x36, 0x37, 0x09,
+    0x23, 0x27, 0x37, 0x44, 0x39, 0x35, 0x2C, 0x4B, 0x4E, 0x55, 0x5E, 0x59, 0x51, 0x4A, 0x47, 0x56,
+    0x54, 0x61, 0x59, 0x53, 0x52, 0x4C, 0x4D, 0x55, 0x5E, 0x59, 0x49, 0x4A, 0x3A, 0x50, 0x51, 0x58,
+    0x45, 0x4A, 0x36, 0x2B, 0x46, 0x3D, 0x41, 0x44, 0x01, 0x08, 0x40, 0x4B, 0x42, 0x3C, 0x1F, 0x24,
+    0x26, 0x3C, 0x03, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00, 0xC7, 0x5F, 0x62, 0x67, 0x6D, 0x66, 0x61,
+    0x57, 0x69, 0x6A, 0x6C, 0x64, 0x65, 0x59, 0x56, 0x5F, 0x69, 0x6D, 0x64, 0x66, 0x61, 0x55, 0x63,
+    0x68, 0x66, 0x5A, 0x54, 0x4D, 0x52, 0x51, 0x5E, 0x5B, 0x61, 0x4F, 0x4E, 0x4C, 0x4D, 0x58, 0x56,
+    0x53, 0x48, 0x36, 0x3C, 0x3A, 0x47, 0x4D, 0x4E, 0x3D, 0x36, 0x51, 0x61, 0x68, 0x62, 0x69, 0x5A,
+    0x59, 0x54, 0x5D, 0x6B, 0x6B, 0x60, 0x57, 0x58, 0x53, 0x5C, 0x5D, 0x60, 0x60, 0x5A, 0x59, 0x53,
+    0x54, 0x63, 0x5F, 0x61, 0x56, 0x47, 0x3A, 0x50, 0x56, 0x59, 0x59, 0x49, 0x4A, 0x46, 0x47, 0x45,
+    0x53, 0x50, 0x4C, 0x31, 0x30, 0x36, 0x52, 0x48, 0x4A, 0x4B, 0x31, 0x41, 0x55, 0x57, 0x65, 0x5A,
+    0x61, 0x51, 0x58, 0x5B, 0x65, 0x63, 0x59, 0x4E, 0x41, 0x56, 0x61, 0x63, 0x63, 0x54, 0x51, 0x41,
+    0x58, 0x59, 0x59, 0x56, 0x4D, 0x43, 0x3B, 0x52, 0x4E, 0x53, 0x53, 0x41, 0x4B, 0x44, 0x4C, 0x48,
+    0x48, 0x52, 0x42, 0x32, 0x1F, 0x3C, 0x46, 0x4C, 0x4B, 0x3B, 0x35, 0x52, 0x53, 0x5E, 0x61, 0x61,
+    0x55, 0x50, 0x4D, 0x59, 0x54, 0x49, 0x4A, 0x43, 0x45, 0x55, 0x59, 0x5E, 0x56, 0x41, 0x43, 0x4E,
+    0x51, 0x4D, 0x4D, 0x4A, 0x42, 0x37, 0x40, 0x3D, 0x48, 0x47, 0x52, 0x3B, 0x32, 0x36, 0x4B, 0x4C,
+    0x46, 0x39, 0x25, 0x1B, 0x30, 0x31, 0x36, 0x3B, 0x3C, 0x25, 0x3A, 0x4E, 0x56, 0x5E, 0x59, 0x49,
+    0x4A, 0xCA, 0x00, 0x2C, 0x4F, 0x4D, 0x4C, 0x3A, 0x41, 0x49, 0x55, 0x51, 0x4A, 0x3A, 0x47, 0x4D,
+    0x4D, 0x43, 0x3E, 0x35, 0x3B, 0x4C, 0x3D, 0x3D, 0x4B, 0x31, 0x2D, 0x44, 0x46, 0x40, 0x3B, 0x2B,
+    0x03, 0x15, 0x25, 0x37, 0x44, 0x31, 0x32, 0x2E, 0x40, 0x50, 0x58, 0x59, 0x4F, 0x51, 0x3D, 0x47,
+    0xF9, 0x00, 0x23, 0x55, 0x4D, 0x4B, 0x40, 0x41, 0x49, 0x4F, 0x55, 0x53, 0x3D, 0x40, 0x47, 0x45,
+    0x45, 0x50, 0x43, 0x44, 0x30, 0x3B, 0x4C, 0x4A, 0x3D, 0x3A, 0x39, 0x26, 0x31, 0x46, 0x46, 0x3B,
+    0x32, 0x2E, 0x00, 0x1F, 0x2B, 0x31, 0x23, 0x01, 0x0D, 0x5E, 0x49, 0x48, 0x41, 0x56, 0x5C, 0x61,
+    0x59, 0x45, 0x43, 0x3A, 0x4E, 0x56, 0x37, 0x01, 0x0B, 0x49, 0x4D, 0x52, 0x3E, 0x35, 0x42, 0x52,
+    0x47, 0x48, 0x4C, 0x31, 0x45, 0x01, 0x0B, 0x3A, 0x36, 0x2B, 0x03, 0x15, 0x27, 0x37, 0x44, 0x31,
+    0x32, 0x03, 0x03, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0xC4, 0x5B, 0x66, 0x6B, 0x6B, 0x68, 0x5C,
+    0x61, 0x66, 0x6D, 0x6D, 0x69, 0x63, 0x58, 0x53, 0x61, 0x68, 0x62, 0x62, 0x5D, 0x5E, 0x49, 0x61,
+    0x5A, 0x65, 0x57, 0x55, 0x47, 0x3A, 0x4E, 0x55, 0x54, 0x54, 0x58, 0x47, 0x3A, 0x41, 0x51, 0x51,
+    0x4E, 0x43, 0x31, 0x35, 0x36, 0x3D, 0x41, 0x47, 0x43, 0x3E, 0x4E, 0x5E, 0x5A, 0x66, 0x66, 0x5F,
+    0x55, 0x59, 0x5A, 0x60, 0x69, 0x65, 0x5C, 0x45, 0x50, 0x59, 0x63, 0x5D, 0x5D, 0x57, 0x56, 0x4D,
+    0x59, 0x5B, 0x5B, 0x5E, 0x53, 0x52, 0x36, 0x4A, 0x53, 0x56, 0x56, 0x45, 0x52, 0x36, 0x3D, 0x50,
+    0x4E, 0x48, 0x40, 0x2B, 0x27, 0x31, 0x3A, 0x3D, 0x52, 0x40, 0x3C, 0x4A, 0x49, 0x61, 0x5F, 0x63,
+    0x54, 0x53, 0x49, 0x61, 0x5A, 0x5B, 0x56, 0x47, 0x3D, 0x51, 0x5E, 0x61, 0x5B, 0x59, 0x45, 0x4A,
+    0x51, 0x55, 0x56, 0x51, 0x47, 0x40, 0x39, 0x4B, 0x47, 0x4E, 0x4E, 0x48, 0x40, 0x39, 0x3A, 0x3D,
+    0x3D, 0x4B, 0x44, 0x26, 0x2C, 0x32, 0x3B, 0x40, 0x40, 0x3E, 0x2D, 0x4B, 0x4D, 0x4F, 0x5C, 0x5C,
+    0x56, 0x41, 0x4E, 0x4F, 0x59, 0x45, 0x43, 0x3A, 0x50, 0x49, 0x4F, 0x4F, 0x49, 0x47, 0x4C, 0x50,
+    0x45, 0x50, 0x41, 0x43, 0x3E, 0x35, 0x36, 0x4C, 0x3D, 0x4A, 0x4C, 0x3E, 0x35, 0x3B, 0x3A, 0x3A,
+    0x36, 0x2B, 0x03, 0x23, 0x27, 0x3C, 0x3E, 0x3E, 0x37, 0x1F, 0x46, 0x41, 0x58, 0x59, 0xC7, 0x00,
+    0x29, 0x47, 0x58, 0x5E, 0x56, 0x50, 0x3A, 0x42, 0x48, 0x53, 0x56, 0x53, 0x3D, 0x40, 0x48, 0x4E,
+    0x4E, 0x4B, 0x39, 0x26, 0x44, 0x3A, 0x52, 0x52, 0x3A, 0x39, 0x26, 0x31, 0x42, 0x42, 0x44, 0x30,
+    0x1B, 0x1E, 0x09, 0x32, 0x31, 0x39, 0x35, 0x2E, 0x46, 0x41, 0xF4, 0x00, 0x01, 0x4A, 0xF8, 0x00,
+    0x08, 0x5E, 0x56, 0x50, 0x3A, 0x42, 0x48, 0x51, 0x55, 0x05, 0x01, 0x09, 0x4D, 0x4D, 0x47, 0x4B,
+    0x39, 0x26, 0x44, 0x4B, 0x3D, 0x13, 0x01, 0x09, 0x42, 0x42, 0x44, 0x30, 0x1B, 0x17, 0x09, 0x32,
+    0x39, 0x1F, 0x01, 0x15, 0x3A, 0x50, 0x56, 0x54, 0x5E, 0x58, 0x47, 0x41, 0x55, 0x5C, 0x5C, 0x4F,
+    0x4D, 0x4C, 0x40, 0x41, 0x58, 0x59, 0x59, 0x49, 0x48, 0x37, 0x01, 0x08, 0x51, 0x4E, 0x43, 0x31,
+    0x2D, 0x3B, 0x43, 0x48, 0x45, 0x01, 0x09, 0x40, 0x3B, 0x32, 0x2E, 0x00, 0x25, 0x37, 0x44, 0x44,
+    0x03, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0xC6, 0x54, 0x65, 0x69, 0x69, 0x65, 0x5E, 0x54, 0x5D,
+    0x62, 0x62, 0x68, 0x5C, 0x53, 0x50, 0x59, 0x5F, 0x66, 0x66, 0x5F, 0x4F, 0x45, 0x54, 0x57, 0x57,
+    0x54, 0x53, 0x52, 0x36, 0x48, 0x51, 0x4F, 0x4F, 0x51, 0x4A, 0x46, 0x48, 0x4D, 0x4D, 0x48, 0x40,
+    0x2B, 0x26, 0x44, 0x4B, 0x4A, 0x4A, 0x4B, 0x31, 0x47, 0x55, 0x57, 0x5D, 0x5D, 0x57, 0x56, 0x55,
+    0x63, 0x68, 0x68, 0x63, 0x4F, 0x41, 0x4A, 0x58, 0x61, 0x5F, 0x5F, 0x61, 0x49, 0x41, 0x56, 0x54,
+    0x54, 0x56, 0x50, 0x3A, 0x31, 0x4C, 0x50, 0x51, 0x51, 0x50, 0x4B, 0x3E, 0x43, 0x47, 0x47, 0x43,
+    0x3B, 0x2D, 0x03, 0x37, 0x42, 0x4C, 0x4C, 0x42, 0x2B, 0x43, 0x53, 0x5E, 0x57, 0x57, 0x5E, 0x45,
+    0x53, 0x54, 0x63, 0x54, 0x51, 0x52, 0x4B, 0x4E, 0x55, 0x54, 0x5C, 0x55, 0x4E, 0x52, 0x45, 0x58,
+    0x49, 0x4D, 0x3D, 0x3B, 0x32, 0x42, 0x3D, 0x41, 0x41, 0x3D, 0x36, 0x37, 0x46, 0x4C, 0x4C, 0x46,
+    0x3C, 0x09, 0x24, 0x2D, 0x31, 0x42, 0x42, 0x31, 0x26, 0x40, 0x41, 0x56, 0x5E, 0x5E, 0x56, 0x47,
+    0x50, 0x55, 0x55, 0x4E, 0x3A, 0x42, 0x48, 0x53, 0x56, 0x55, 0x51, 0x4A, 0x3A, 0x47, 0x4E, 0x41,
+    0x48, 0x3A, 0x3C, 0x26, 0x44, 0x3A, 0x52, 0x52, 0x4B, 0x31, 0x30, 0x44, 0x46, 0x46, 0x44, 0x30,
+    0x1B, 0x1E, 0x1F, 0x2B, 0x44, 0x44, 0x2B, 0x09, 0x42, 0x48, 0x49, 0x4F, 0x4F, 0x51, 0xC9, 0x00,
+    0x2C, 0x59, 0x58, 0x47, 0x46, 0x3B, 0x3D, 0x45, 0x58, 0x45, 0x52, 0x46, 0x4A, 0x50, 0x41, 0x46,
+    0x2B, 0x1F, 0x39, 0x46, 0x4C, 0x43, 0x40, 0x3C, 0x27, 0x39, 0x36, 0x36, 0x39, 0x26, 0x24, 0x1A,
+    0x2E, 0x35, 0x3C, 0x3C, 0x35, 0x2C, 0x42, 0x47, 0x49, 0x59, 0x59, 0x49, 0x48, 0xF9, 0x00, 0x18,
+    0x58, 0x41, 0x46, 0x3B, 0x4A, 0x53, 0x56, 0x56, 0x53, 0x3D, 0x46, 0x48, 0x4D, 0x4E, 0x48, 0x40,
+    0x37, 0x25, 0x39, 0x40, 0x52, 0x52, 0x40, 0x3C, 0x15, 0x01, 0x06, 0x31, 0x2D, 0x24, 0x1A, 0x03,
+    0x35, 0x1E, 0x01, 0x02, 0x2E, 0x40, 0x23, 0x01, 0x04, 0x54, 0x56, 0x41, 0x50, 0x2A, 0x01, 0x06,
+    0x55, 0x4E, 0x3A, 0x42, 0x47, 0x49, 0x35, 0x01, 0x0E, 0x41, 0x53, 0x53, 0x50, 0x4B, 0x39, 0x26,
+    0x44, 0x4C, 0x4A, 0x4A, 0x4C, 0x31, 0x30, 0x46, 0x01, 0x0A, 0x3E, 0x35, 0x1B, 0x1E, 0x1F, 0x2B,
+    0x44, 0x44, 0x2B, 0x09, 0x03, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00, 0xC4, 0x55, 0x63, 0x68, 0x66,
+    0x5F, 0x4F, 0x59, 0x5A, 0x66, 0x66, 0x5F, 0x4F, 0x50, 0x4A, 0x58, 0x61, 0x5A, 0x65, 0x5B, 0x58,
+    0x4E, 0x4F, 0x5C, 0x5C, 0x55, 0x50, 0x40, 0x31, 0x4C, 0x4E, 0x49, 0x49, 0x4D, 0x43, 0x36, 0x3D,
+    0x41, 0x41, 0x52, 0x3B, 0x2D, 0x09, 0x3C, 0x46, 0x43, 0x52, 0x40, 0x3C, 0x3D, 0x51, 0x5C, 0x5F,
+    0x5F, 0x61, 0x49, 0x58, 0x5B, 0x5A, 0x5A, 0x61, 0x49, 0x3D, 0x4C, 0x45, 0x59, 0x5B, 0x57, 0x5E,
+    0x45, 0x48, 0x49, 0x4F, 0x55, 0x53, 0x4A, 0x3B, 0x32, 0x46, 0x48, 0x4D, 0x4D, 0x47, 0x40, 0x39,
+    0x3A, 0x3D, 0x3D, 0x3A, 0x39, 0x1F, 0x1B, 0x30, 0x3E, 0x40, 0x3A, 0x3B, 0x35, 0x3A, 0x4E, 0x55,
+    0x5C, 0x61, 0x4F, 0x4E, 0x4D, 0x59, 0x61, 0x4F, 0x4E, 0x4B, 0x42, 0x47, 0x49, 0x4F, 0x59, 0x58,
+    0x41, 0x4C, 0x4E, 0x53, 0x45, 0x41, 0x4B, 0x39, 0x26, 0x44, 0x4B, 0x4A, 0x48, 0x43, 0x3E, 0x32,
+    0x36, 0x3A, 0x3A, 0x3B, 0x35, 0x2C, 0x00, 0x25, 0x37, 0x3B, 0x3B, 0x3C, 0x25, 0x36, 0x48, 0x49,
+    0x59, 0x59, 0x58, 0x47, 0x41, 0x58, 0x49, 0x47, 0x42, 0x3E, 0x52, 0x4D, 0x49, 0x58, 0x53, 0x3D,
+    0x46, 0x48, 0x50, 0x48, 0x3D, 0x42, 0x32, 0x09, 0x3C, 0x42, 0x4C, 0x43, 0x40, 0x39, 0x26, 0x31,
+    0x36, 0x36, 0x39, 0x26, 0x23, 0x22, 0x2E, 0x35, 0x39, 0x39, 0x32, 0x03, 0x3B, 0x4A, 0x53, 0x55,
+    0xC7, 0x00, 0x2B, 0x48, 0x49, 0x4F, 0x51, 0x4A, 0x36, 0x31, 0x43, 0x4E, 0x49, 0x4D, 0x52, 0x42,
+    0x4A, 0x41, 0x47, 0x36, 0x35, 0x03, 0x2B, 0x36, 0x4B, 0x4C, 0x46, 0x37, 0x27, 0x39, 0x3B, 0x3B,
+    0x3C, 0x25, 0x15, 0x0F, 0x2C, 0x2D, 0x3C, 0x3C, 0x30, 0x2C, 0x36, 0x48, 0x51, 0x4F, 0xF8, 0x00,
+    0x17, 0x59, 0x49, 0x48, 0x42, 0x44, 0x52, 0x4D, 0x58, 0x56, 0x45, 0x52, 0x46, 0x48, 0x4E, 0x4E,
+    0x4A, 0x42, 0x32, 0x09, 0x37, 0x46, 0x43, 0x43, 0x13, 0x01, 0x09, 0x36, 0x36, 0x39, 0x27, 0x15,
+    0x22, 0x2E, 0x30, 0x3C, 0x20, 0x01, 0x01, 0x41, 0x24, 0x01, 0x03, 0x55, 0x50, 0x4E, 0x2B, 0x01,
+    0x07, 0x50, 0x40, 0x36, 0x4A, 0x51, 0x4F, 0x4F, 0x38, 0x01, 0x0A, 0x47, 0x3A, 0x37, 0x25, 0x31,
+    0x4B, 0x4A, 0x4A, 0x4B, 0x44, 0x45, 0x01, 0x06, 0x46, 0x44, 0x30, 0x2A, 0x1E, 0x09, 0x4E, 0x01,
+    0x02, 0x37, 0x1F, 0x01, 0x00, 0x00, 0x57, 0x01, 0x49, 0x61, 0x5A, 0x65, 0x57, 0x56, 0x56, 0x57,
+    0x65, 0x65, 0x61, 0x49, 0x4A, 0x4C, 0x4D, 0x59, 0x57, 0x63, 0x54, 0x51, 0x47, 0x58, 0x59, 0x4F,
+    0x51, 0x4A, 0x3B, 0x32, 0x46, 0x48, 0x45, 0x45, 0x41, 0x3A, 0x44, 0x4C, 0x4A, 0x4A, 0x3A, 0x39,
+    0x1F, 0x2C, 0x35, 0x3B, 0x3A, 0x4B, 0x42, 0x37, 0x4B, 0x4D, 0x59, 0x5B, 0x57, 0x54, 0x53, 0x53,
+    0x54, 0x57, 0x57, 0x59, 0x4D, 0x4B, 0x46, 0x47, 0x58, 0x54, 0x5C, 0x55, 0x4E, 0x52, 0x45, 0x58,
+    0x49, 0x4E, 0x4C, 0x39, 0x26, 0x3E, 0x43, 0x47, 0x41, 0x3D, 0x36, 0x37, 0x46, 0x4C, 0x4C, 0x36,
+    0x32, 0x2C, 0x15, 0x27, 0x39, 0x36, 0x42, 0x44, 0x2D, 0x42, 0x47, 0x58, 0x5E, 0x54, 0x55, 0x50,
+    0x50, 0x55, 0x54, 0x58, 0x47, 0x42, 0x44, 0x52, 0x45, 0x56, 0x55, 0x51, 0x4A, 0x3A, 0x47, 0x4D,
+    0x4E, 0x4A, 0x42, 0x32, 0x09, 0x3C, 0x46, 0x52, 0x3D, 0x4B, 0x31, 0x30, 0x3E, 0x46, 0x42, 0x31,
+    0x26, 0x23, 0x1A, 0x03, 0x32, 0x31, 0x44, 0x37, 0x1F, 0x3E, 0x3D, 0x53, 0x55, 0x4F, 0x49, 0x48,
+    0x48, 0x49, 0x53, 0x3D, 0x3E, 0x39, 0x4B, 0x50, 0x53, 0x49, 0x4D, 0x52, 0x42, 0x3D, 0x47, 0x4A,
+    0x4C, 0x3E, 0x2D, 0x2C, 0x32, 0x3B, 0x3A, 0x4B, 0x46, 0x37, 0x27, 0x39, 0x3B, 0x3E, 0x37, 0x1F,
+    0x1E, 0x01, 0x1B, 0x2D, 0x37, 0x3C, 0x35, 0x2E, 0x44, 0x52, 0x45, 0x56, 0x55, 0x51, 0x4A, 0x48,
+    0x51, 0x4F, 0x45, 0x52, 0x3E, 0x3C, 0x4B, 0x41, 0x51, 0x4E, 0x43, 0x36, 0x3D, 0x47, 0x48, 0x3E,
+    0x26, 0x2C, 0x35, 0x3B, 0x3A, 0x4B, 0x42, 0x2B, 0x25, 0x3C, 0x3E, 0x3E, 0x2B, 0x09, 0x17, 0x10,
+    0x2A, 0x26, 0x37, 0x37, 0x30, 0x2C, 0x3B, 0x3D, 0x53, 0x4F, 0x59, 0x49, 0x47, 0x47, 0x58, 0x59,
+    0x4F, 0x51, 0x4A, 0x3B, 0x39, 0x4C, 0x4E, 0x49, 0x58, 0x45, 0x52, 0x46, 0x4A, 0x4E, 0x50, 0x52,
+    0x3B, 0x30, 0x2E, 0x2B, 0x42, 0x4C, 0x43, 0x40, 0x3C, 0x26, 0x31, 0x36, 0x3B, 0x3C, 0x25, 0x00,
+    0x0F, 0x2C, 0x30, 0x3C, 0x39, 0x32, 0x03, 0x46, 0x47, 0x58, 0x54, 0x54, 0x55, 0x4E, 0x4E, 0x4F,
+    0x5C, 0x54, 0x56, 0x41, 0x46, 0x3E, 0x3D, 0x53, 0x55, 0x4F, 0x49, 0x48, 0x3A, 0x41, 0x45, 0x45,
+    0x48, 0x46, 0x32, 0x1F, 0x39, 0x3A, 0x3D, 0x4A, 0x4B, 0x44, 0x35, 0x3E, 0x40, 0x46, 0x44, 0x2D,
+    0x24, 0x17, 0x09, 0x32, 0x44, 0x3E, 0x3C, 0x25, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03,
+    0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0xC4, 0x4D, 0x59, 0x57, 0x63, 0x61, 0x49, 0x49, 0x5C, 0x63,
+    0x57, 0x59, 0x4D, 0x4B, 0x42, 0x47, 0x58, 0x54, 0x5C, 0x4F, 0x4D, 0x3D, 0x53, 0x56, 0x49, 0x4E,
+    0x4B, 0x3C, 0x26, 0x3E, 0x43, 0x41, 0x50, 0x4A, 0x46, 0x39, 0x40, 0x43, 0x4C, 0x36, 0x32, 0x2E,
+    0x23, 0x26, 0x31, 0x46, 0x40, 0x3B, 0x32, 0x46, 0x47, 0x58, 0x54, 0x5C, 0x59, 0x4D, 0x4D, 0x59,
+    0x61, 0x54, 0x56, 0x47, 0x42, 0x44, 0x52, 0x53, 0x55, 0x59, 0x58, 0x47, 0x4B, 0x50, 0x53, 0x45,
+    0x48, 0x46, 0x32, 0x09, 0x3C, 0x40, 0x3D, 0x4A, 0x4C, 0x3E, 0x32, 0x36, 0x3A, 0x40, 0x44, 0x26,
+    0x24, 0x17, 0x09, 0x2B, 0x3E, 0x3B, 0x39, 0x26, 0x3E, 0x3D, 0x53, 0x4F, 0x59, 0x58, 0x47, 0x47,
+    0x58, 0x59, 0x53, 0x3D, 0x3E, 0x3C, 0x4B, 0x50, 0x51, 0x58, 0x45, 0x52, 0x46, 0x4A, 0x50, 0x47,
+    0x43, 0x3E, 0x26, 0x2C, 0x35, 0x3B, 0x4B, 0x4C, 0x40, 0x3C, 0x26, 0x31, 0x36, 0x3B, 0x37, 0x1F,
+    0x1E, 0x01, 0x1B, 0x2D, 0x3C, 0x39, 0x32, 0x09, 0x31, 0x4C, 0x4D, 0x58, 0x55, 0x51, 0x4A, 0x4A,
+    0x51, 0x4D, 0x43, 0x31, 0x2B, 0x46, 0x48, 0x45, 0x53, 0x4E, 0x4C, 0x3B, 0x52, 0x48, 0x52, 0x3A,
+    0x31, 0x25, 0x24, 0x2D, 0x44, 0x46, 0x3A, 0x42, 0x2B, 0x25, 0x3C, 0x3E, 0x44, 0x32, 0x03, 0x1A,
+    0x02, 0x24, 0x27, 0x2B, 0x37, 0x30, 0x2E, 0x31, 0x4C, 0x4D, 0x58, 0xC7, 0x00, 0x17, 0x4A, 0x51,
+    0x55, 0x4D, 0x4C, 0x31, 0x32, 0x46, 0x48, 0x53, 0x4E, 0x4C, 0x3B, 0x52, 0x48, 0x4A, 0x31, 0x25,
+    0x24, 0x2D, 0x44, 0x40, 0x3A, 0xE3, 0x00, 0x11, 0x44, 0x32, 0x03, 0x1A, 0x02, 0x24, 0x27, 0x2B,
+    0x37, 0x30, 0x2E, 0x3E, 0x52, 0x53, 0x55, 0x59, 0x58, 0xF9, 0x00, 0x07, 0x53, 0x52, 0x3E, 0x37,
+    0x3A, 0x50, 0x51, 0x03, 0x01, 0x0C, 0x42, 0x4A, 0x50, 0x41, 0x43, 0x3E, 0x26, 0x1B, 0x35, 0x3B,
+    0x4B, 0x4C, 0x15, 0x01, 0x06, 0x37, 0x1F, 0x1E, 0x01, 0x1B, 0x2D, 0x1E, 0x01, 0x08, 0x09, 0x42,
+    0x47, 0x58, 0x5E, 0x5C, 0x4F, 0x4D, 0x29, 0x01, 0x08, 0x5E, 0x58, 0x48, 0x42, 0x44, 0x43, 0x45,
+    0x56, 0x37, 0x01, 0x14, 0x4D, 0x4A, 0x42, 0x35, 0x03, 0x37, 0x46, 0x52, 0x3D, 0x4B, 0x44, 0x32,
+    0x3B, 0x40, 0x46, 0x31, 0x26, 0x23, 0x17, 0x03, 0x4F, 0x01, 0x01, 0x27, 0x03, 0x00, 0x00, 0x4E,
+    0x01, 0x00, 0x00, 0xEB, 0x47, 0x56, 0x5C, 0x61, 0x5E, 0x53, 0x45, 0x59, 0x61, 0x54, 0x58, 0x47,
+    0x42, 0x44, 0x43, 0x45, 0x55, 0x59, 0x58, 0x41, 0x4C, 0x50, 0x53, 0x4D, 0x4A, 0x42, 0x35, 0x09,
+    0x3C, 0x40, 0x3D, 0x48, 0x43, 0x3B, 0x37, 0x42, 0x3A, 0x40, 0x44, 0x26, 0x24, 0x1E, 0x1F, 0x37,
+    0x3B, 0x36, 0x44, 0x30, 0x3E, 0x3D, 0x53, 0x4F, 0x5E, 0x56, 0x50, 0x50, 0x56, 0x5E, 0x4F, 0x53,
+    0x52, 0x44, 0x37, 0x3A, 0x50, 0x49, 0x58, 0x53, 0x3D, 0x46, 0x48, 0x4E, 0x41, 0x43, 0x44, 0x27,
+    0x1B, 0x35, 0x36, 0x4C, 0x43, 0x3A, 0x39, 0x30, 0x44, 0x42, 0x36, 0x37, 0x1F, 0x1E, 0x0F, 0x2C,
+    0x30, 0x39, 0x44, 0x37, 0x25, 0x39, 0x4C, 0x4E, 0x58, 0x55, 0x51, 0x48, 0x4A, 0x51, 0x55, 0x4E,
+    0x4B, 0x3C, 0x35, 0x42, 0x4A, 0x4D, 0x53, 0x4E, 0x4C, 0x3B, 0x52, 0x48, 0x4A, 0x3A, 0x3C, 0x09,
+    0x23, 0x26, 0x44, 0x40, 0x3A, 0x42, 0x2B, 0x27, 0x3C, 0x3E, 0x44, 0x35, 0x2E, 0x22, 0x02, 0x24,
+    0x27, 0x2B, 0x3C, 0x35, 0x03, 0x37, 0x3A, 0x50, 0x49, 0x58, 0x53, 0x3D, 0x3D, 0x45, 0x41, 0x3A,
+    0x37, 0x30, 0x36, 0x3D, 0x4E, 0x45, 0x41, 0x4B, 0x3E, 0x43, 0x4A, 0x43, 0x46, 0x37, 0x03, 0x15,
+    0x27, 0x39, 0x42, 0x40, 0x3B, 0x32, 0x1F, 0x37, 0x44, 0x39, 0x30, 0x1B, 0x01, 0x18, 0x15, 0x25,
+    0x32, 0x2B, 0x30, 0x2C, 0x3C, 0x4B, 0x50, 0x49, 0x56, 0x53, 0x4A, 0x4A, 0x53, 0x56, 0x50, 0x4B,
+    0x37, 0x30, 0x36, 0x4A, 0x45, 0x50, 0x4B, 0x3B, 0x43, 0x48, 0x3D, 0x3C, 0x09, 0x15, 0x27, 0x31,
+    0x46, 0x3A, 0x36, 0x32, 0x25, 0x3C, 0x44, 0x31, 0x35, 0x2C, 0x0F, 0x19, 0x23, 0x25, 0x32, 0xEE,
+    0x00, 0x14, 0x44, 0x43, 0x45, 0x55, 0x4F, 0x58, 0x41, 0x47, 0x58, 0x4F, 0x55, 0x4D, 0x43, 0x31,
+    0x2B, 0x40, 0x47, 0x53, 0x49, 0x4D, 0x05, 0x01, 0x15, 0x41, 0x47, 0x4C, 0x31, 0x25, 0x2A, 0x30,
+    0x3E, 0x4B, 0x4C, 0x46, 0x3C, 0x2D, 0x31, 0x36, 0x3E, 0x2B, 0x09, 0x17, 0x01, 0x2A, 0x1D, 0x01,
+    0x05, 0x2B, 0x1F, 0x42, 0x48, 0x49, 0x25, 0x01, 0x0E, 0x45, 0x4D, 0x4F, 0x54, 0x5E, 0x49, 0x4A,
+    0x36, 0x39, 0x4C, 0x4E, 0x58, 0x55, 0x51, 0x36, 0x01, 0x08, 0x4D, 0x4E, 0x3D, 0x3B, 0x2D, 0x2E,
+    0x2B, 0x42, 0x45, 0x01, 0x04, 0x42, 0x39, 0x27, 0x15, 0x4D, 0x01, 0x03, 0x3B, 0x39, 0x2D, 0x03,
+    0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0xDE, 0x3D, 0x53, 0x4F, 0x5E, 0x55, 0x4D, 0x4E, 0x56, 0x59,
+    0x55, 0x45, 0x43, 0x44, 0x2B, 0x40, 0x41, 0x51, 0x58, 0x53, 0x4A, 0x40, 0x48, 0x50, 0x47, 0x4C,
+    0x31, 0x25, 0x1B, 0x30, 0x3B, 0x4B, 0x43, 0x3A, 0x31, 0x32, 0x3E, 0x46, 0x36, 0x37, 0x1F, 0x1E,
+    0x22, 0x2C, 0x35, 0x31, 0x3E, 0x39, 0x2D, 0x39, 0x4B, 0x4E, 0x58, 0x55, 0x49, 0x47, 0x48, 0x51,
+    0x56, 0x58, 0x50, 0x3A, 0x37, 0x30, 0x36, 0x4A, 0x4D, 0x53, 0x4E, 0x4C, 0x36, 0x52, 0x47, 0x4A,
+    0x40, 0x37, 0x03, 0x15, 0x27, 0x31, 0x40, 0x4B, 0x42, 0x37, 0x26, 0x39, 0x3B, 0x44, 0x35, 0x2C,
+    0x22, 0x02, 0x24, 0x27, 0x37, 0x39, 0x2B, 0x1F, 0x2B, 0x46, 0x47, 0x51, 0x58, 0x45, 0x3D, 0x52,
+    0x45, 0x49, 0x47, 0x46, 0x32, 0x27, 0x3E, 0x43, 0x50, 0x4D, 0x47, 0x3A, 0x44, 0x4C, 0x3D, 0x43,
+    0x42, 0x32, 0x2C, 0x1E, 0x1F, 0x3C, 0x36, 0x46, 0x3B, 0x35, 0x25, 0x37, 0x31, 0x3C, 0x2D, 0x2A,
+    0x10, 0x18, 0x00, 0x1F, 0x35, 0x2B, 0x30, 0x2E, 0x32, 0x46, 0x48, 0x53, 0x49, 0x45, 0x3D, 0x52,
+    0x4D, 0x48, 0x42, 0x35, 0x27, 0x44, 0x43, 0x41, 0x4E, 0x47, 0x40, 0x44, 0x4B, 0x52, 0x4B, 0x36,
+    0x35, 0x1B, 0x17, 0x09, 0x37, 0x3B, 0x42, 0x3E, 0x35, 0x1F, 0x2B, 0x31, 0x3C, 0x26, 0x24, 0x02,
+    0x1C, 0x1E, 0x09, 0x35, 0x2B, 0x2D, 0x2C, 0x2B, 0x40, 0x41, 0x51, 0x58, 0x53, 0x4A, 0x3D, 0x45,
+    0x58, 0x47, 0x40, 0x2B, 0x26, 0x3E, 0x52, 0x4D, 0x41, 0x4B, 0x3E, 0x43, 0x4A, 0x52, 0x2B, 0x2C,
+    0x1E, 0x25, 0x3C, 0x42, 0x40, 0xE3, 0x00, 0x06, 0x39, 0x30, 0x1B, 0x01, 0x18, 0x15, 0xEC, 0x00,
+    0x06, 0x35, 0x03, 0x31, 0x4C, 0x4D, 0x56, 0xF6, 0x00, 0x0B, 0x49, 0x4F, 0x56, 0x4E, 0x4B, 0x39,
+    0x35, 0x42, 0x48, 0x45, 0x51, 0x04, 0x01, 0x0A, 0x3D, 0x41, 0x48, 0x3A, 0x39, 0x09, 0x23, 0x2D,
+    0x44, 0x3A, 0x15, 0x01, 0x10, 0x32, 0x03, 0x1A, 0x10, 0x2A, 0x26, 0x3C, 0x31, 0x37, 0x25, 0x36,
+    0x4A, 0x51, 0x5E, 0x5C, 0x59, 0x29, 0x01, 0x09, 0x59, 0x53, 0x3D, 0x3E, 0x3C, 0x3A, 0x50, 0x49,
+    0x56, 0x35, 0x01, 0x13, 0x47, 0x4D, 0x50, 0x43, 0x3E, 0x26, 0x2C, 0x32, 0x36, 0x43, 0x3D, 0x4B,
+    0x3E, 0x2B, 0x36, 0x40, 0x42, 0x3C, 0x25, 0x4E, 0x01, 0x02, 0x44, 0x30, 0x03, 0x00, 0x00, 0x4D,
+    0x01, 0x00, 0x00, 0xC5, 0x4B, 0x50, 0x58, 0x55, 0x58, 0x50, 0x47, 0x51, 0x56, 0x51, 0x41, 0x40,
+    0x37, 0x2D, 0x3E, 0x52, 0x4E, 0x45, 0x50, 0x43, 0x36, 0x52, 0x48, 0x52, 0x46, 0x2B, 0x2E, 0x15,
+    0x25, 0x39, 0x46, 0x3A, 0x42, 0x3C, 0x30, 0x31, 0x3B, 0x31, 0x35, 0x2C, 0x22, 0x10, 0x24, 0x26,
+    0x37, 0x31, 0x37, 0x27, 0x32, 0x42, 0x48, 0x53, 0x49, 0x45, 0x4A, 0x52, 0x4D, 0x51, 0x45, 0x4A,
+    0x36, 0x30, 0x25, 0x31, 0x4C, 0x41, 0x4E, 0x47, 0x3A, 0x44, 0x4B, 0x52, 0x4C, 0x3B, 0x30, 0x2A,
+    0x17, 0x09, 0x37, 0x3B, 0x46, 0x3B, 0x32, 0x25, 0x37, 0x31, 0x3C, 0x26, 0x24, 0x02, 0x18, 0x00,
+    0x1F, 0x35, 0x37, 0x35, 0x09, 0x30, 0x3B, 0x3D, 0x4D, 0x53, 0x4E, 0x52, 0x43, 0x4E, 0x53, 0x3D,
+    0x3B, 0x2D, 0x09, 0x3C, 0x3A, 0x48, 0x41, 0x4A, 0x46, 0x39, 0x3A, 0x43, 0x4B, 0x3E, 0x2D, 0x23,
+    0x22, 0x2E, 0x32, 0x3E, 0x36, 0x44, 0x30, 0x09, 0x2B, 0x39, 0x2B, 0x25, 0x15, 0x18, 0x04, 0x17,
+    0x03, 0x30, 0x32, 0x2D, 0x2C, 0x30, 0x3B, 0x3D, 0x4D, 0x53, 0x4E, 0x52, 0x43, 0x4E, 0x3D, 0x3B,
+    0x2D, 0x09, 0x3C, 0x3A, 0x48, 0x41, 0x4A, 0x46, 0x31, 0x3A, 0x43, 0x3A, 0x3E, 0x2D, 0x24, 0x22,
+    0x2E, 0x32, 0x3E, 0x36, 0x44, 0x30, 0x09, 0x2B, 0x39, 0x2B, 0x27, 0x23, 0x18, 0x04, 0x17, 0x03,
+    0x30, 0x32, 0x2D, 0x2C, 0x32, 0x46, 0x48, 0x53, 0x49, 0xC9, 0x00, 0x21, 0x49, 0x48, 0x42, 0x35,
+    0x25, 0x31, 0x4C, 0x4E, 0x47, 0x3A, 0x3E, 0x4C, 0x3D, 0x43, 0x35, 0x1B, 0x17, 0x09, 0x37, 0x36,
+    0x46, 0x3B, 0x32, 0x27, 0x3C, 0x44, 0x3C, 0x2D, 0x2A, 0x10, 0x18, 0x00, 0x1F, 0xED, 0x00, 0x26,
+    0x09, 0x39, 0x4B, 0x4E, 0x58, 0x4F, 0x58, 0x50, 0x47, 0x49, 0x55, 0x58, 0x50, 0x3A, 0x37, 0x2D,
+    0x3B, 0x3D, 0x4D, 0x51, 0x4E, 0x43, 0x42, 0x3D, 0x47, 0x4A, 0x40, 0x37, 0x03, 0x15, 0x27, 0x31,
+    0x40, 0x4B, 0x46, 0x3C, 0x30, 0x44, 0x16, 0x01, 0x02, 0x2E, 0x22, 0x1D, 0x01, 0x14, 0x3C, 0x27,
+    0x3B, 0x3D, 0x53, 0x59, 0x54, 0x59, 0x53, 0x4D, 0x55, 0x5E, 0x4F, 0x45, 0x43, 0x44, 0x2B, 0x40,
+    0x47, 0x51, 0x36, 0x01, 0x0D, 0x4E, 0x41, 0x4C, 0x31, 0x25, 0x1B, 0x30, 0x3B, 0x4C, 0x52, 0x4C,
+    0x3E, 0x37, 0x47, 0x01, 0x02, 0x1F, 0x00, 0x4C, 0x01, 0x04, 0x3E, 0x36, 0x3E, 0x32, 0x03, 0x00,
+    0x00, 0x46, 0x01, 0x00, 0x00, 0xDD, 0x42, 0x4A, 0x45, 0x49, 0x53, 0x48, 0x3D, 0x4D, 0x53, 0x4E,
+    0x52, 0x3B, 0x2D, 0x09, 0x3C, 0x3A, 0x48, 0x41, 0x48, 0x3A, 0x44, 0x3A, 0x43, 0x3A, 0x44, 0x26,
+    0x24, 0x1A, 0x2E, 0x32, 0x3E, 0x42, 0x3E, 0x32, 0x26, 0x3C, 0x31, 0x37, 0x27, 0x23, 0x02, 0x19,
+    0x00, 0x1F, 0x32, 0x3C, 0x2B, 0x25, 0x2D, 0x3E, 0x43, 0x4E, 0x45, 0x4E, 0x52, 0x4C, 0x41, 0x4D,
+    0x41, 0x4C, 0x31, 0x27, 0x2E, 0x2B, 0x46, 0x3D, 0x47, 0x3D, 0x42, 0x39, 0x40, 0x4B, 0x40, 0x31,
+    0x25, 0x00, 0x01, 0x1B, 0x30, 0x31, 0x3B, 0x31, 0x2D, 0x1F, 0x32, 0x3C, 0x32, 0x1F, 0x00, 0x1C,
+    0x04, 0x1A, 0x2E, 0x2D, 0x32, 0x30, 0x03, 0x27, 0x31, 0x4C, 0x41, 0x4D, 0x50, 0x4C, 0x4B, 0x47,
+    0x4E, 0x4B, 0x39, 0x1F, 0x2C, 0x32, 0x42, 0x52, 0x48, 0x52, 0x36, 0x3C, 0x46, 0x4B, 0x46, 0x39,
+    0x25, 0x1E, 0x10, 0x2A, 0x30, 0x31, 0x3E, 0x39, 0x26, 0x03, 0x35, 0x37, 0x35, 0x09, 0x1E, 0x14,
+    0x12, 0x22, 0x2C, 0x26, 0x35, 0x26, 0x2C, 0x26, 0x44, 0x43, 0x50, 0x45, 0x50, 0x43, 0x4B, 0x41,
+    0x4C, 0x31, 0x25, 0x2C, 0x2B, 0x46, 0x3D, 0x47, 0x3D, 0x42, 0x3C, 0x40, 0x4C, 0x40, 0x31, 0x27,
+    0x00, 0x01, 0x1B, 0x30, 0x44, 0x3B, 0x31, 0x2D, 0x09, 0x32, 0x3C, 0x32, 0x1F, 0x00, 0x1C, 0x12,
+    0x1A, 0x2E, 0x2D, 0x32, 0x2D, 0x2E, 0x35, 0x36, 0x4A, 0x45, 0x49, 0x45, 0x4A, 0x52, 0x4D, 0x51,
+    0x3D, 0x3B, 0x2D, 0x09, 0x3C, 0x4B, 0x50, 0x47, 0x40, 0x44, 0x4B, 0x52, 0x4C, 0x2D, 0x24, 0x22,
+    0x03, 0x2B, 0x3B, 0xE4, 0x00, 0x04, 0x26, 0x24, 0x02, 0x1C, 0xEC, 0x00, 0x07, 0x32, 0x1F, 0x3C,
+    0x3A, 0x50, 0x58, 0x55, 0xF7, 0x00, 0x0A, 0x56, 0x49, 0x47, 0x46, 0x2B, 0x26, 0x3E, 0x52, 0x4E,
+    0x53, 0x06, 0x01, 0x07, 0x3D, 0x46, 0x2B, 0x2C, 0x00, 0x25, 0x39, 0x10, 0x01, 0x07, 0x39, 0x35,
+    0x44, 0x36, 0x44, 0x35, 0x2C, 0x1C, 0x01, 0x17, 0x44, 0x39, 0x2D, 0x3E, 0x52, 0x45, 0x4F, 0x54,
+    0x59, 0x51, 0x4D, 0x55, 0x59, 0x55, 0x4D, 0x4C, 0x31, 0x32, 0x42, 0x48, 0x53, 0x58, 0x53, 0x36,
+    0x01, 0x09, 0x50, 0x47, 0x4B, 0x39, 0x1F, 0x2A, 0x2D, 0x3E, 0x4B, 0x42, 0x01, 0x05, 0x3C, 0x42,
+    0x40, 0x36, 0x37, 0x4D, 0x01, 0x03, 0x42, 0x3B, 0x2B, 0x03, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00,
+    0xB0, 0x44, 0x4C, 0x41, 0x4D, 0x4E, 0x3D, 0x4C, 0x47, 0x50, 0x48, 0x3A, 0x3C, 0x1F, 0x1B, 0x30,
+    0x3B, 0x4C, 0x4A, 0x43, 0x42, 0x3C, 0x42, 0x40, 0x36, 0x37, 0x09, 0x1E, 0x10, 0x24, 0x26, 0x3C,
+    0x44, 0x39, 0x30, 0x25, 0x32, 0x37, 0x35, 0x09, 0x1E, 0x1C, 0x14, 0x17, 0x2E, 0x2D, 0x32, 0x35,
+    0x1F, 0x1F, 0x3C, 0x3A, 0x48, 0x50, 0x47, 0x4C, 0x40, 0x48, 0x41, 0x4A, 0x46, 0x2B, 0x03, 0x24,
+    0x2D, 0x3E, 0x4B, 0x52, 0x4C, 0x3E, 0x2B, 0x36, 0x46, 0x3B, 0x2B, 0x03, 0x1A, 0x19, 0x23, 0x27,
+    0x37, 0x31, 0x3C, 0x27, 0x03, 0x30, 0x2B, 0x30, 0x2E, 0x1A, 0x04, 0x05, 0x0F, 0x1B, 0x27, 0x30,
+    0x26, 0x2E, 0x09, 0x3C, 0x40, 0x48, 0x50, 0x47, 0x4B, 0x40, 0x4A, 0x41, 0x46, 0x2B, 0x2E, 0x23,
+    0x2D, 0x3E, 0x4C, 0x3D, 0x4C, 0x3E, 0x2B, 0x36, 0x40, 0x36, 0x2B, 0x03, 0x22, 0x18, 0x23, 0x27,
+    0x3C, 0x44, 0x3C, 0x27, 0x03, 0x30, 0x2B, 0x30, 0x2E, 0x1A, 0x12, 0x1D, 0x01, 0x2A, 0x27, 0x30,
+    0x26, 0x2C, 0x25, 0x39, 0x4B, 0x47, 0x4E, 0x41, 0x4C, 0x3A, 0x47, 0x3A, 0x3C, 0x09, 0x2A, 0x30,
+    0x36, 0x52, 0x4A, 0x52, 0x36, 0x3C, 0x46, 0x3A, 0x46, 0x3C, 0x09, 0x17, 0x02, 0x24, 0x2D, 0x39,
+    0x3E, 0xB4, 0x00, 0x11, 0x37, 0x35, 0x09, 0x1E, 0x14, 0x12, 0x22, 0x2C, 0x26, 0x35, 0x2D, 0x2E,
+    0x2D, 0x3E, 0x52, 0x4D, 0x51, 0xC8, 0x00, 0x0A, 0x4E, 0x53, 0x43, 0x44, 0x27, 0x2E, 0x37, 0x40,
+    0x41, 0x48, 0xD6, 0x00, 0x1C, 0x4B, 0x26, 0x15, 0x0F, 0x2C, 0x32, 0x3B, 0x42, 0x3B, 0x32, 0x26,
+    0x3C, 0x31, 0x3C, 0x27, 0x23, 0x19, 0x1C, 0x1E, 0x09, 0x32, 0x3C, 0x2B, 0x25, 0x37, 0x40, 0x47,
+    0x49, 0xF6, 0x00, 0x18, 0x51, 0x58, 0x53, 0x48, 0x42, 0x35, 0x25, 0x31, 0x43, 0x50, 0x45, 0x50,
+    0x43, 0x42, 0x52, 0x48, 0x52, 0x42, 0x35, 0x1B, 0x1E, 0x1F, 0x3C, 0x46, 0x11, 0x01, 0x02, 0x32,
+    0x3E, 0x17, 0x01, 0x0C, 0x0F, 0x01, 0x2A, 0x26, 0x39, 0x3E, 0x31, 0x30, 0x44, 0x43, 0x4D, 0x55,
+    0x28, 0x01, 0x0A, 0x4F, 0x58, 0x50, 0x3A, 0x3C, 0x30, 0x3B, 0x3D, 0x45, 0x49, 0x35, 0x01, 0x09,
+    0x48, 0x50, 0x48, 0x40, 0x37, 0x09, 0x24, 0x26, 0x44, 0x41, 0x01, 0x02, 0x3B, 0x39, 0x47, 0x01,
+    0x02, 0x09, 0x1E, 0x4D, 0x01, 0x03, 0x46, 0x36, 0x3C, 0x03, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00,
+    0xB2, 0x37, 0x46, 0x3D, 0x41, 0x47, 0x4C, 0x40, 0x3D, 0x48, 0x43, 0x36, 0x35, 0x2C, 0x15, 0x25,
+    0x39, 0x46, 0x4C, 0x3A, 0x3E, 0x32, 0x3E, 0x36, 0x31, 0x30, 0x1B, 0x0F, 0x1C, 0x1E, 0x09, 0x32,
+    0x3C, 0x37, 0x27, 0x09, 0x30, 0x32, 0x26, 0x2C, 0x22, 0x12, 0x12, 0x0F, 0x2A, 0x27, 0x30, 0x2D,
+    0x09, 0x2E, 0x32, 0x36, 0x52, 0x48, 0x4A, 0x3A, 0x42, 0x52, 0x4A, 0x4C, 0x3B, 0x2D, 0x2A, 0x1E,
+    0x1F, 0x3C, 0x46, 0x4B, 0x40, 0x31, 0x35, 0x44, 0x3B, 0x31, 0x2D, 0x2A, 0x10, 0x14, 0x17, 0x09,
+    0x32, 0x3C, 0x2B, 0x25, 0x2E, 0x2D, 0x35, 0x27, 0x1B, 0x01, 0x1D, 0x13, 0x10, 0x24, 0x1F, 0x2D,
+    0x27, 0x2C, 0x2E, 0x32, 0x42, 0x52, 0x47, 0x4A, 0x3A, 0x42, 0x52, 0x4A, 0x3B, 0x30, 0x2A, 0x1E,
+    0x25, 0x39, 0x40, 0x4C, 0x3A, 0x31, 0x35, 0x3E, 0x42, 0x3E, 0x35, 0x1B, 0x10, 0x14, 0x1E, 0x1F,
+    0x2B, 0x39, 0x2B, 0x25, 0x2E, 0x2D, 0x35, 0x26, 0x1B, 0x0F, 0x1D, 0x13, 0x10, 0x24, 0x25, 0x2D,
+    0x27, 0x2C, 0x09, 0x37, 0x40, 0x48, 0x50, 0x47, 0x4C, 0x40, 0x48, 0x46, 0x32, 0x2E, 0x23, 0x26,
+    0x3E, 0x4C, 0x3D, 0x4C, 0x3B, 0x37, 0x42, 0x40, 0x36, 0x2B, 0x2E, 0x22, 0x18, 0x23, 0x26, 0x3C,
+    0x44, 0x39, 0x26, 0xB6, 0x00, 0x27, 0x03, 0x1A, 0x04, 0x05, 0x0F, 0x1B, 0x26, 0x35, 0x30, 0x03,
+    0x26, 0x44, 0x43, 0x50, 0x53, 0x4D, 0x4A, 0x43, 0x50, 0x45, 0x4C, 0x39, 0x1F, 0x2C, 0x32, 0x42,
+    0x47, 0x4A, 0x46, 0x31, 0x3A, 0x43, 0x3A, 0x25, 0x00, 0x01, 0x1B, 0x35, 0x3E, 0xE2, 0x00, 0x05,
+    0x44, 0x37, 0x27, 0x15, 0x18, 0xED, 0x00, 0x14, 0x27, 0x2B, 0x46, 0x48, 0x51, 0x56, 0x58, 0x4E,
+    0x47, 0x51, 0x49, 0x45, 0x3D, 0x3B, 0x30, 0x1F, 0x39, 0x4B, 0x41, 0x4D, 0x05, 0x01, 0x12, 0x4A,
+    0x43, 0x3B, 0x30, 0x2A, 0x1E, 0x09, 0x3C, 0x42, 0x4B, 0x40, 0x39, 0x2B, 0x3B, 0x36, 0x44, 0x30,
+    0x1B, 0x1A, 0x01, 0x0A, 0x2D, 0x39, 0x3B, 0x44, 0x32, 0x44, 0x4C, 0x4E, 0x56, 0x5E, 0x27, 0x01,
+    0x29, 0x56, 0x55, 0x49, 0x47, 0x40, 0x37, 0x2D, 0x3E, 0x52, 0x4E, 0x51, 0x45, 0x4A, 0x3A, 0x48,
+    0x41, 0x3D, 0x46, 0x2B, 0x03, 0x23, 0x27, 0x31, 0x3A, 0x43, 0x4C, 0x3B, 0x31, 0x46, 0x40, 0x36,
+    0x2B, 0x09, 0x1E, 0x1E, 0x03, 0x32, 0x3B, 0x46, 0x42, 0x31, 0x03, 0x00, 0x00, 0x4A, 0x01, 0x00,
+    0x00, 0xB9, 0x30, 0x3E, 0x4C, 0x4A, 0x3D, 0x3A, 0x36, 0x4C, 0x43, 0x40, 0x39, 0x27, 0x23, 0x1A,
+    0x2C, 0x35, 0x3E, 0x46, 0x42, 0x39, 0x30, 0x39, 0x31, 0x2B, 0x25, 0x15, 0x19, 0x12, 0x22, 0x2C,
+    0x26, 0x32, 0x35, 0x1F, 0x2E, 0x26, 0x2D, 0x1F, 0x24, 0x10, 0x1D, 0x1D, 0x10, 0x23, 0x09, 0x26,
+    0x26, 0x03, 0x2A, 0x26, 0x44, 0x4B, 0x52, 0x43, 0x46, 0x3B, 0x4B, 0x4C, 0x40, 0x39, 0x25, 0x15,
+    0x22, 0x2C, 0x35, 0x3E, 0x46, 0x36, 0x37, 0x2D, 0x39, 0x44, 0x37, 0x25, 0x00, 0x18, 0x05, 0x0F,
+    0x2C, 0x2D, 0x32, 0x35, 0x09, 0x2C, 0x27, 0x2D, 0x1F, 0x23, 0x02, 0x06, 0x06, 0x19, 0x15, 0x03,
+    0x27, 0x25, 0x2C, 0x2A, 0x2D, 0x3E, 0x4C, 0x3D, 0x52, 0x46, 0x3B, 0x4C, 0x52, 0x31, 0x27, 0x15,
+    0x1A, 0x03, 0x2B, 0x42, 0x3A, 0x46, 0x3C, 0x30, 0x31, 0x3B, 0x39, 0x26, 0x23, 0x19, 0x12, 0x1A,
+    0x03, 0x35, 0x37, 0x32, 0x1F, 0x2E, 0x26, 0x30, 0x27, 0x2A, 0x10, 0x13, 0x06, 0x02, 0x23, 0x1F,
+    0x26, 0x27, 0x2C, 0x2E, 0x32, 0x42, 0x3D, 0x41, 0x48, 0x4B, 0x46, 0x3D, 0x36, 0x30, 0x2A, 0x00,
+    0x25, 0x31, 0x3A, 0x43, 0x4B, 0x3E, 0x2B, 0x36, 0x46, 0x3B, 0x32, 0x1B, 0x01, 0x1C, 0x00, 0x25,
+    0x3C, 0x44, 0x3C, 0x26, 0x1F, 0x32, 0x2B, 0x30, 0x2E, 0x22, 0x12, 0xBF, 0x00, 0x06, 0x09, 0x27,
+    0x39, 0x4B, 0x41, 0x45, 0xC9, 0x00, 0x09, 0x4E, 0x3A, 0x37, 0x09, 0x2A, 0x30, 0x36, 0x48, 0x3D,
+    0xD5, 0x00, 0x08, 0x4C, 0x40, 0x1F, 0x17, 0x10, 0x2A, 0x30, 0x44, 0xE0, 0x00, 0x08, 0x2D, 0x39,
+    0x44, 0x37, 0x25, 0x15, 0x18, 0x18, 0xEB, 0x00, 0x08, 0x39, 0x37, 0x2D, 0x32, 0x36, 0x4A, 0x53,
+    0x58, 0xF6, 0x00, 0x0C, 0x53, 0x51, 0x4D, 0x52, 0x3E, 0x2D, 0x09, 0x37, 0x3A, 0x47, 0x4E, 0x41,
+    0x06, 0x01, 0x0E, 0x4C, 0x3E, 0x2D, 0x24, 0x17, 0x03, 0x37, 0x42, 0x3A, 0x40, 0x31, 0x37, 0x3B,
+    0x42, 0x18, 0x01, 0x01, 0x0F, 0x1D, 0x01, 0x2B, 0x3E, 0x37, 0x31, 0x3A, 0x50, 0x58, 0x59, 0x59,
+    0x49, 0x4D, 0x58, 0x56, 0x53, 0x48, 0x42, 0x2B, 0x27, 0x31, 0x4C, 0x50, 0x45, 0x4D, 0x4A, 0x3A,
+    0x4A, 0x47, 0x52, 0x36, 0x35, 0x2C, 0x23, 0x25, 0x39, 0x40, 0x43, 0x4C, 0x36, 0x44, 0x40, 0x3A,
+    0x36, 0x2B, 0x03, 0x4D, 0x01, 0x03, 0x40, 0x46, 0x44, 0x03, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00,
+    0x8E, 0x25, 0x3C, 0x46, 0x4C, 0x4C, 0x46, 0x44, 0x46, 0x40, 0x3B, 0x32, 0x2E, 0x17, 0x10, 0x23,
+    0x27, 0x3C, 0x3E, 0x44, 0x2B, 0x27, 0x2B, 0x37, 0x30, 0x2E, 0x1A, 0x04, 0x13, 0x02, 0x23, 0x1F,
+    0x2D, 0x26, 0x03, 0x2C, 0x25, 0x27, 0x2E, 0x00, 0x18, 0x0C, 0x06, 0x18, 0x00, 0x2E, 0x27, 0x27,
+    0x2E, 0x15, 0x1F, 0x37, 0x42, 0x4B, 0x4B, 0x36, 0x31, 0x46, 0x40, 0x3B, 0x32, 0x2E, 0x1A, 0x02,
+    0x23, 0x26, 0x39, 0x3B, 0x44, 0x32, 0x27, 0x2B, 0x3C, 0x35, 0x03, 0x1A, 0x04, 0x06, 0x10, 0x24,
+    0x25, 0x30, 0x2D, 0x2E, 0x1B, 0x25, 0x27, 0x03, 0x00, 0x18, 0x07, 0x07, 0x1C, 0x1E, 0x2E, 0x25,
+    0x1F, 0x1B, 0x23, 0x25, 0x39, 0x40, 0x43, 0x4C, 0x42, 0x3E, 0x3A, 0x4C, 0x3C, 0x09, 0x1E, 0x01,
+    0x1B, 0x35, 0x3E, 0x46, 0x36, 0x37, 0x2D, 0x39, 0x44, 0x37, 0x25, 0x00, 0x1C, 0x1D, 0x0F, 0x2C,
+    0x2D, 0x2B, 0x35, 0x09, 0x2C, 0x26, 0x2D, 0x1F, 0x23, 0x02, 0x06, 0x0C, 0x19, 0x15, 0x09, 0x91,
+    0x00, 0x1F, 0x1B, 0x30, 0x3B, 0x43, 0x48, 0x4A, 0x3A, 0x42, 0x52, 0x3E, 0x26, 0x23, 0x17, 0x09,
+    0x3C, 0x40, 0x4C, 0x3A, 0x44, 0x32, 0x3B, 0x42, 0x3B, 0x30, 0x2A, 0x02, 0x14, 0x1E, 0x1F, 0x37,
+    0x31, 0xB5, 0x00, 0x04, 0x2D, 0x2C, 0x22, 0x05, 0xBC, 0x00, 0x15, 0x27, 0x32, 0x35, 0x1F, 0x25,
+    0x3C, 0x3A, 0x47, 0x4D, 0x4E, 0x4A, 0x4C, 0x41, 0x50, 0x46, 0x2B, 0x2E, 0x24, 0x26, 0x3E, 0x4A,
+    0xD4, 0x00, 0x05, 0x40, 0x4C, 0x46, 0x03, 0x1A, 0xDF, 0x00, 0x03, 0x2B, 0x30, 0x31, 0xE5, 0x00,
+    0x04, 0x00, 0x18, 0x18, 0x00, 0xEC, 0x00, 0x22, 0x39, 0x30, 0x35, 0x3B, 0x3D, 0x4D, 0x58, 0x49,
+    0x4E, 0x48, 0x45, 0x53, 0x50, 0x4C, 0x31, 0x26, 0x2E, 0x2B, 0x46, 0x4A, 0x50, 0x41, 0x4C, 0x42,
+    0x43, 0x3D, 0x4B, 0x44, 0x27, 0x23, 0x17, 0x03, 0x2B, 0x36, 0x11, 0x01, 0x02, 0x3C, 0x36, 0x18,
+    0x01, 0x1B, 0x22, 0x1B, 0x2D, 0x31, 0x36, 0x36, 0x39, 0x39, 0x40, 0x47, 0x49, 0x4F, 0x4F, 0x49,
+    0x4E, 0x49, 0x58, 0x45, 0x3D, 0x3B, 0x35, 0x25, 0x3C, 0x3A, 0x47, 0x4D, 0x4E, 0x36, 0x01, 0x10,
+    0x48, 0x43, 0x3B, 0x30, 0x1B, 0x15, 0x1F, 0x3C, 0x46, 0x4C, 0x4B, 0x36, 0x3E, 0x40, 0x3A, 0x3B,
+    0x49, 0x01, 0x07, 0x00, 0x03, 0x2B, 0x3B, 0x3A, 0x3A, 0x3B, 0x01, 0x00, 0x00, 0x57, 0x01, 0x2E,
+    0x35, 0x3E, 0x40, 0x40, 0x3B, 0x39, 0x3B, 0x3B, 0x39, 0x26, 0x24, 0x0F, 0x1C, 0x17, 0x03, 0x35,
+    0x3C, 0x3C, 0x30, 0x1F, 0x30, 0x30, 0x25, 0x24, 0x10, 0x1D, 0x07, 0x1C, 0x1E, 0x2E, 0x25, 0x25,
+    0x2C, 0x1B, 0x09, 0x09, 0x1B, 0x1A, 0x14, 0x08, 0x0C, 0x1C, 0x1A, 0x1B, 0x1F, 0x1F, 0x2C, 0x17,
+    0x2E, 0x35, 0x3E, 0x40, 0x40, 0x3E, 0x3C, 0x3B, 0x36, 0x31, 0x2D, 0x2A, 0x01, 0x1C, 0x1E, 0x09,
+    0x2B, 0x31, 0x39, 0x30, 0x1F, 0x35, 0x32, 0x26, 0x1B, 0x01, 0x1D, 0x07, 0x18, 0x00, 0x09, 0x26,
+    0x27, 0x2C, 0x2A, 0x1F, 0x1F, 0x2C, 0x17, 0x14, 0x11, 0x08, 0x14, 0x1A, 0x1B, 0x1F, 0x1F, 0x1B,
+    0x00, 0x09, 0x37, 0x42, 0x4B, 0x4B, 0x36, 0x31, 0x46, 0x40, 0x32, 0x2C, 0x22, 0x02, 0x23, 0x26,
+    0x31, 0x36, 0x3E, 0x32, 0x27, 0x37, 0x39, 0x2B, 0x09, 0x1A, 0x04, 0x13, 0x10, 0x2A, 0x26, 0x32,
+    0x30, 0x03, 0x2C, 0x27, 0x26, 0x09, 0x15, 0x19, 0x0C, 0x0C, 0x18, 0x00, 0x03, 0x27, 0x27, 0x2E,
+    0x2A, 0x26, 0x44, 0x4B, 0x4A, 0x3D, 0x3A, 0x42, 0x43, 0x39, 0x25, 0x15, 0x22, 0x2E, 0x2B, 0x42,
+    0x4B, 0x40, 0x31, 0x32, 0x3E, 0x36, 0x3E, 0x2D, 0x23, 0x19, 0x04, 0x17, 0x09, 0x2B, 0x31, 0x3C,
+    0x26, 0x25, 0x32, 0x2B, 0x2D, 0x2C, 0x0F, 0x05, 0x05, 0x0F, 0x2A, 0x26, 0x32, 0x35, 0x25, 0x1F,
+    0x37, 0x46, 0x4A, 0x4E, 0x50, 0x3D, 0x4C, 0x47, 0x41, 0x42, 0x35, 0x2C, 0x15, 0x27, 0x44, 0x3D,
+    0x52, 0x42, 0x31, 0x40, 0x4B, 0x42, 0x2E, 0x22, 0x02, 0x24, 0x2D, 0x44, 0x36, 0x3B, 0x2B, 0x35,
+    0x31, 0x44, 0x37, 0x25, 0x00, 0x18, 0x19, 0x00, 0x1F, 0x2B, 0x31, 0x31, 0x32, 0x30, 0x3E, 0x43,
+    0x4E, 0x49, 0x49, 0x4E, 0x48, 0x45, 0x45, 0x41, 0x4B, 0x39, 0x25, 0x2C, 0x35, 0x42, 0x3D, 0x41,
+    0x47, 0x4C, 0x42, 0x43, 0x52, 0x3A, 0x31, 0x25, 0x15, 0x1A, 0x2E, 0x2B, 0x36, 0x3A, 0x40, 0x44,
+    0x39, 0x42, 0x42, 0x44, 0x30, 0x1B, 0x22, 0x1A, 0x1B, 0x30, 0x44, 0x42, 0x42, 0x31, 0x3C, 0x42,
+    0x4A, 0x53, 0x55, 0x55, 0x51, 0x4E, 0x51, 0x51, 0x4E, 0x43, 0x3E, 0x30, 0x09, 0x2B, 0x46, 0x4A,
+    0x4E, 0x50, 0x3D, 0x3A, 0x3D, 0x4A, 0x4B, 0x44, 0x26, 0x2A, 0x00, 0x09, 0x37, 0x42, 0x4C, 0x4B,
+    0x36, 0x3B, 0x3A, 0x3A, 0x3B, 0x32, 0x03, 0x1E, 0x15, 0x09, 0x2B, 0x36, 0x3A, 0x4B, 0x42, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x8D, 0x2A, 0x27,
+    0x3C, 0x3B, 0x36, 0x44, 0x2B, 0x31, 0x39, 0x32, 0x09, 0x1E, 0x19, 0x12, 0x01, 0x2A, 0x27, 0x32,
+    0x32, 0x27, 0x2E, 0x27, 0x27, 0x03, 0x1E, 0x18, 0x0C, 0x11, 0x12, 0x22, 0x2A, 0x09, 0x09, 0x2A,
+    0x2A, 0x03, 0x2E, 0x24, 0x0F, 0x05, 0x0A, 0x08, 0x04, 0x22, 0x24, 0x03, 0x09, 0x2C, 0x0F, 0x2A,
+    0x26, 0x39, 0x36, 0x36, 0x31, 0x2B, 0x44, 0x44, 0x2B, 0x1F, 0x00, 0x19, 0x12, 0x22, 0x2C, 0x30,
+    0x37, 0x2B, 0x26, 0x03, 0x2D, 0x30, 0x1F, 0x23, 0x19, 0x0C, 0x11, 0x14, 0x17, 0x2E, 0x25, 0x1F,
+    0x1B, 0x2A, 0x09, 0x09, 0x2A, 0x22, 0x12, 0x0A, 0x08, 0x04, 0x22, 0x2A, 0x09, 0x09, 0x1B, 0x17,
+    0x2C, 0x35, 0x3E, 0x40, 0x40, 0x3B, 0x39, 0x36, 0x42, 0x2D, 0x2A, 0x01, 0x1C, 0x00, 0x25, 0x3C,
+    0x3E, 0x31, 0x35, 0x25, 0x2B, 0x3C, 0x35, 0x2E, 0x0F, 0x05, 0x0C, 0x02, 0x24, 0x27, 0x35, 0x2D,
+    0x03, 0x2E, 0x27, 0x26, 0x03, 0x00, 0x18, 0x07, 0x0C, 0x18, 0x1E, 0x90, 0x00, 0x23, 0x03, 0x24,
+    0x25, 0x39, 0x40, 0x52, 0x52, 0x40, 0x36, 0x4B, 0x37, 0x09, 0x1E, 0x01, 0x1B, 0x32, 0x36, 0x40,
+    0x46, 0x39, 0x32, 0x44, 0x36, 0x44, 0x26, 0x15, 0x18, 0x12, 0x1A, 0x03, 0x2B, 0x39, 0x3C, 0x26,
+    0x27, 0xB6, 0x00, 0x04, 0x1B, 0x0F, 0x05, 0x12, 0xBE, 0x00, 0x07, 0x32, 0x26, 0x09, 0x32, 0x42,
+    0x3D, 0x50, 0xC8, 0x00, 0x0A, 0x48, 0x47, 0x3B, 0x2D, 0x1B, 0x00, 0x25, 0x31, 0x52, 0x43, 0xD5,
+    0x00, 0x0E, 0x3A, 0x42, 0x2C, 0x0F, 0x02, 0x23, 0x2D, 0x31, 0x36, 0x3B, 0x37, 0x32, 0x44, 0x3E,
+    0xE6, 0x00, 0x02, 0x19, 0x02, 0xEB, 0x00, 0x17, 0x44, 0x44, 0x37, 0x2D, 0x31, 0x4C, 0x50, 0x51,
+    0x51, 0x4E, 0x48, 0x4D, 0x4D, 0x48, 0x40, 0x37, 0x1F, 0x1B, 0x30, 0x3B, 0x52, 0x47, 0x48, 0x06,
+    0x01, 0x0E, 0x40, 0x39, 0x1F, 0x00, 0x1A, 0x2E, 0x32, 0x3B, 0x3A, 0x40, 0x3E, 0x44, 0x46, 0x46,
+    0x18, 0x01, 0x1B, 0x17, 0x2C, 0x30, 0x44, 0x46, 0x46, 0x3E, 0x2B, 0x36, 0x3D, 0x45, 0x56, 0x55,
+    0x51, 0x50, 0x53, 0x53, 0x41, 0x4B, 0x31, 0x2D, 0x03, 0x32, 0x36, 0x52, 0x41, 0x41, 0x36, 0x01,
+    0x0D, 0x3D, 0x3A, 0x31, 0x27, 0x24, 0x00, 0x09, 0x2B, 0x36, 0x4B, 0x4B, 0x42, 0x36, 0x49, 0x01,
+    0x01, 0x23, 0x4D, 0x01, 0x03, 0x4B, 0x4C, 0x46, 0x03, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x81,
+    0x00, 0x09, 0x32, 0x31, 0x44, 0x39, 0x30, 0x37, 0x2B, 0x26, 0x1B, 0x22, 0x14, 0x06, 0x19, 0x00,
+    0x03, 0x26, 0x2D, 0x1F, 0x1B, 0x09, 0x09, 0x2A, 0x22, 0x12, 0x11, 0x0B, 0x1D, 0x10, 0x15, 0x2C,
+    0x2E, 0x24, 0x24, 0x2C, 0x1B, 0x00, 0x02, 0x13, 0x0B, 0x11, 0x05, 0x01, 0x23, 0x2E, 0x09, 0x2C,
+    0x10, 0x15, 0x1F, 0x2B, 0x44, 0x3E, 0x3C, 0x35, 0x3C, 0x3C, 0x30, 0x2E, 0x1A, 0x14, 0x13, 0x10,
+    0x24, 0x27, 0x35, 0x35, 0x25, 0x2E, 0x27, 0x27, 0x03, 0x1E, 0x1C, 0x08, 0x0D, 0x12, 0x22, 0x1B,
+    0x09, 0x09, 0x2A, 0x2A, 0x03, 0x03, 0x24, 0x01, 0x05, 0x0D, 0x11, 0x12, 0x0F, 0x24, 0x03, 0x09,
+    0x2C, 0x22, 0x2A, 0x2D, 0x31, 0x42, 0x42, 0x44, 0x3C, 0x3B, 0x3B, 0x27, 0x15, 0x02, 0x04, 0x1A,
+    0x09, 0x32, 0x31, 0x39, 0x30, 0x25, 0x32, 0x2B, 0x2D, 0x1B, 0x01, 0x13, 0x07, 0x18, 0x15, 0x1F,
+    0x30, 0x85, 0x00, 0x2F, 0x27, 0x03, 0x1E, 0x1C, 0x07, 0x0C, 0x1C, 0x1E, 0x2E, 0x27, 0x26, 0x09,
+    0x15, 0x1F, 0x37, 0x46, 0x43, 0x43, 0x40, 0x3B, 0x3A, 0x2B, 0x2E, 0x17, 0x10, 0x24, 0x30, 0x3E,
+    0x46, 0x42, 0x39, 0x35, 0x44, 0x3B, 0x31, 0x27, 0x00, 0x1C, 0x12, 0x22, 0x03, 0x32, 0x39, 0x3C,
+    0x2D, 0x26, 0x2B, 0xB9, 0x00, 0x1F, 0x04, 0x0F, 0x1B, 0x26, 0x2B, 0x2B, 0x2D, 0x03, 0x35, 0x3B,
+    0x52, 0x41, 0x41, 0x3D, 0x4B, 0x4A, 0x4A, 0x44, 0x26, 0x2A, 0x1E, 0x09, 0x3C, 0x43, 0x4C, 0x42,
+    0x31, 0x46, 0x3A, 0x36, 0x1B, 0xDB, 0x00, 0x01, 0x26, 0xDF, 0x00, 0x03, 0x3C, 0x37, 0x3E, 0xE5,
+    0x00, 0x28, 0x15, 0x19, 0x10, 0x15, 0x25, 0x37, 0x3E, 0x3E, 0x3C, 0x26, 0x39, 0x3A, 0x47, 0x45,
+    0x53, 0x4E, 0x4A, 0x4E, 0x4E, 0x4A, 0x42, 0x2B, 0x09, 0x2A, 0x26, 0x3E, 0x4C, 0x48, 0x4A, 0x4B,
+    0x42, 0x4C, 0x43, 0x46, 0x3C, 0x09, 0x00, 0x1A, 0x2C, 0x35, 0x11, 0x01, 0x01, 0x3E, 0x17, 0x01,
+    0x27, 0x1A, 0x1E, 0x2C, 0x30, 0x3E, 0x40, 0x3A, 0x36, 0x32, 0x3E, 0x43, 0x4E, 0x49, 0x56, 0x51,
+    0x50, 0x45, 0x4D, 0x48, 0x40, 0x3C, 0x27, 0x2E, 0x30, 0x3E, 0x43, 0x47, 0x47, 0x52, 0x3A, 0x52,
+    0x43, 0x46, 0x3C, 0x25, 0x23, 0x00, 0x03, 0x32, 0x42, 0x01, 0x02, 0x42, 0x4B, 0x47, 0x01, 0x04,
+    0x2E, 0x00, 0x24, 0x1F, 0x4E, 0x01, 0x02, 0x43, 0x3A, 0x03, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00,
+    0x5E, 0x1A, 0x1B, 0x26, 0x37, 0x3C, 0x2B, 0x26, 0x35, 0x2D, 0x09, 0x15, 0x02, 0x05, 0x08, 0x04,
+    0x22, 0x1B, 0x1F, 0x25, 0x03, 0x24, 0x2E, 0x2C, 0x15, 0x10, 0x13, 0x0B, 0x20, 0x0C, 0x18, 0x1E,
+    0x2A, 0x1B, 0x23, 0x23, 0x1B, 0x2A, 0x17, 0x18, 0x0C, 0x0E, 0x11, 0x1D, 0x02, 0x00, 0x2C, 0x03,
+    0x2C, 0x19, 0x17, 0x2E, 0x30, 0x3C, 0x31, 0x37, 0x2D, 0x2B, 0x32, 0x27, 0x2A, 0x01, 0x12, 0x0C,
+    0x18, 0x00, 0x09, 0x2D, 0x2D, 0x09, 0x1B, 0x1F, 0x1F, 0x1B, 0x1A, 0x12, 0x0A, 0x0B, 0x1D, 0x01,
+    0x24, 0x03, 0x03, 0x24, 0x2A, 0x2E, 0x2E, 0x15, 0x10, 0x1D, 0x0B, 0x11, 0x05, 0x01, 0x23, 0x61,
+    0x00, 0x2B, 0x01, 0x23, 0x25, 0x3C, 0x3B, 0x36, 0x31, 0x2B, 0x44, 0x44, 0x09, 0x1E, 0x18, 0x12,
+    0x0F, 0x2C, 0x30, 0x3C, 0x37, 0x2D, 0x1F, 0x35, 0x32, 0x26, 0x24, 0x02, 0x06, 0x07, 0x1C, 0x00,
+    0x09, 0x2D, 0x26, 0x03, 0x03, 0x27, 0x27, 0x2E, 0x1E, 0x14, 0x07, 0x06, 0x18, 0x90, 0x00, 0x1E,
+    0x1F, 0x00, 0x03, 0x2B, 0x36, 0x4B, 0x4C, 0x46, 0x3E, 0x40, 0x35, 0x1B, 0x22, 0x02, 0x23, 0x26,
+    0x44, 0x42, 0x36, 0x3C, 0x35, 0x31, 0x3E, 0x31, 0x25, 0x1E, 0x14, 0x12, 0x22, 0x2E, 0xB2, 0x00,
+    0x03, 0x2D, 0x37, 0x37, 0xB8, 0x00, 0x21, 0x12, 0x14, 0x22, 0x1B, 0x26, 0x37, 0x37, 0x35, 0x2E,
+    0x30, 0x3E, 0x4C, 0x48, 0x47, 0x3D, 0x4B, 0x3D, 0x3D, 0x31, 0x25, 0x24, 0x17, 0x03, 0x37, 0x4C,
+    0x4C, 0x36, 0x44, 0x46, 0x40, 0x3B, 0x2A, 0x01, 0xDE, 0x00, 0x15, 0x36, 0x3C, 0x3C, 0x3B, 0x3B,
+    0x3C, 0x25, 0x15, 0x02, 0x01, 0x23, 0x25, 0x3C, 0x3B, 0x36, 0x31, 0x27, 0x3C, 0x40, 0x48, 0x4D,
+    0xF6, 0x00, 0x0B, 0x50, 0x41, 0x52, 0x36, 0x35, 0x03, 0x24, 0x27, 0x31, 0x4B, 0x3D, 0x05, 0x01,
+    0x05, 0x4C, 0x42, 0x37, 0x03, 0x1E, 0x0E, 0x01, 0x05, 0x40, 0x3A, 0x3B, 0x3B, 0x40, 0x18, 0x01,
+    0x32, 0x00, 0x2E, 0x35, 0x3E, 0x3A, 0x4B, 0x46, 0x35, 0x44, 0x4B, 0x41, 0x53, 0x49, 0x53, 0x41,
+    0x4D, 0x50, 0x3D, 0x42, 0x2B, 0x25, 0x1B, 0x26, 0x31, 0x4B, 0x4A, 0x48, 0x43, 0x40, 0x43, 0x4C,
+    0x42, 0x37, 0x09, 0x15, 0x1E, 0x2E, 0x35, 0x3B, 0x3A, 0x4B, 0x42, 0x46, 0x4B, 0x3A, 0x3E, 0x35,
+    0x2E, 0x00, 0x2A, 0x4D, 0x01, 0x03, 0x4C, 0x52, 0x4C, 0x03, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00,
+    0x52, 0x01, 0x23, 0x1F, 0x30, 0x2B, 0x35, 0x25, 0x26, 0x25, 0x1B, 0x1A, 0x1C, 0x06, 0x0A, 0x1D,
+    0x10, 0x15, 0x2E, 0x03, 0x1B, 0x23, 0x1B, 0x24, 0x17, 0x18, 0x0C, 0x20, 0x21, 0x08, 0x14, 0x22,
+    0x23, 0x24, 0x00, 0x23, 0x2A, 0x23, 0x1A, 0x1C, 0x07, 0x20, 0x0A, 0x13, 0x19, 0x1E, 0x1B, 0x2E,
+    0x2C, 0x1C, 0x0F, 0x2A, 0x27, 0x2B, 0x3C, 0x32, 0x27, 0x35, 0x30, 0x09, 0x15, 0x19, 0x1D, 0x08,
+    0x04, 0x1A, 0x2C, 0x25, 0x27, 0x03, 0x2A, 0x09, 0x03, 0x24, 0x01, 0x1D, 0x0D, 0x0E, 0x06, 0x02,
+    0x15, 0x2C, 0x2E, 0x55, 0x00, 0x04, 0x2C, 0x00, 0x02, 0x13, 0x5E, 0x00, 0x26, 0x2E, 0x09, 0x2E,
+    0x10, 0x00, 0x09, 0x32, 0x44, 0x3E, 0x31, 0x32, 0x39, 0x39, 0x2E, 0x1A, 0x1C, 0x1D, 0x01, 0x2A,
+    0x2D, 0x2B, 0x2B, 0x26, 0x1F, 0x30, 0x35, 0x27, 0x23, 0x19, 0x0C, 0x08, 0x1C, 0x1E, 0x09, 0x26,
+    0x26, 0x03, 0x09, 0x87, 0x00, 0x01, 0x17, 0x8E, 0x00, 0x15, 0x26, 0x2D, 0x25, 0x1E, 0x2E, 0x35,
+    0x3E, 0x3A, 0x4B, 0x46, 0x3E, 0x46, 0x2D, 0x2A, 0x0F, 0x19, 0x15, 0x27, 0x31, 0x36, 0x3B, 0xA7,
+    0x00, 0x03, 0x39, 0x1F, 0x17, 0xB1, 0x00, 0x02, 0x30, 0x30, 0xB9, 0x00, 0x19, 0x1C, 0x22, 0x1B,
+    0x2D, 0x37, 0x39, 0x2B, 0x2C, 0x26, 0x31, 0x4B, 0x4A, 0x48, 0x3D, 0x3A, 0x52, 0x52, 0x3C, 0x1F,
+    0x23, 0x1A, 0x2E, 0x2B, 0x4B, 0x4B, 0xDF, 0x00, 0x03, 0x39, 0x31, 0x36, 0xE6, 0x00, 0x1C, 0x10,
+    0x22, 0x24, 0x27, 0x3C, 0x36, 0x42, 0x3E, 0x27, 0x2B, 0x42, 0x3D, 0x4E, 0x45, 0x50, 0x3D, 0x41,
+    0x47, 0x4C, 0x3E, 0x2D, 0x2E, 0x23, 0x1F, 0x3C, 0x40, 0x52, 0x3D, 0x05, 0x01, 0x3E, 0x4B, 0x36,
+    0x32, 0x2E, 0x1E, 0x1A, 0x1B, 0x30, 0x3E, 0x40, 0x3A, 0x36, 0x42, 0x3A, 0x40, 0x44, 0x30, 0x2C,
+    0x17, 0x15, 0x03, 0x32, 0x3B, 0x3A, 0x4C, 0x3A, 0x30, 0x39, 0x40, 0x48, 0x45, 0x51, 0x53, 0x47,
+    0x50, 0x47, 0x43, 0x3B, 0x35, 0x09, 0x2A, 0x25, 0x3C, 0x40, 0x52, 0x4A, 0x43, 0x40, 0x4C, 0x4B,
+    0x3B, 0x32, 0x03, 0x00, 0x1E, 0x2C, 0x30, 0x3E, 0x40, 0x4B, 0x46, 0x40, 0x4B, 0x01, 0x05, 0x37,
+    0x36, 0x4C, 0x3D, 0x43, 0x03, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x28, 0x19, 0x17, 0x2C, 0x27,
+    0x30, 0x2D, 0x09, 0x1F, 0x03, 0x23, 0x01, 0x12, 0x08, 0x0E, 0x0C, 0x18, 0x17, 0x2A, 0x2C, 0x2A,
+    0x00, 0x24, 0x15, 0x0F, 0x04, 0x11, 0x28, 0x29, 0x0A, 0x12, 0x01, 0x00, 0x23, 0x00, 0x23, 0x24,
+    0x15, 0x0F, 0x04, 0x08, 0x2B, 0x00, 0x27, 0x18, 0x17, 0x2A, 0x2E, 0x2C, 0x04, 0x10, 0x15, 0x09,
+    0x30, 0x2B, 0x35, 0x25, 0x2D, 0x27, 0x2C, 0x17, 0x1C, 0x06, 0x0A, 0x05, 0x0F, 0x2A, 0x09, 0x1F,
+    0x2C, 0x24, 0x2E, 0x2C, 0x15, 0x02, 0x06, 0x0E, 0x20, 0x0C, 0x19, 0x00, 0x1B, 0x2C, 0x55, 0x00,
+    0x2B, 0x1B, 0x00, 0x19, 0x06, 0x0B, 0x08, 0x05, 0x10, 0x15, 0x2E, 0x09, 0x03, 0x02, 0x17, 0x2E,
+    0x30, 0x39, 0x44, 0x39, 0x35, 0x3C, 0x37, 0x1B, 0x0F, 0x04, 0x13, 0x02, 0x24, 0x27, 0x32, 0x32,
+    0x27, 0x09, 0x2D, 0x30, 0x1F, 0x15, 0x18, 0x07, 0x08, 0x14, 0x1E, 0x03, 0x84, 0x00, 0x01, 0x26,
+    0x8A, 0x00, 0x01, 0x1D, 0x8F, 0x00, 0x1C, 0x30, 0x26, 0x17, 0x1B, 0x2D, 0x44, 0x46, 0x3A, 0x46,
+    0x44, 0x42, 0x27, 0x23, 0x01, 0x18, 0x00, 0x25, 0x3C, 0x3B, 0x3E, 0x37, 0x32, 0x31, 0x44, 0x39,
+    0x09, 0x1A, 0x04, 0xAE, 0x00, 0x01, 0x35, 0xB2, 0x00, 0x02, 0x35, 0x3C, 0xB8, 0x00, 0x1A, 0x04,
+    0x18, 0x1A, 0x2C, 0x2D, 0x3C, 0x31, 0x37, 0x1B, 0x27, 0x39, 0x40, 0x3D, 0x48, 0x52, 0x3A, 0x43,
+    0x4C, 0x2B, 0x09, 0x15, 0x1A, 0x2C, 0x35, 0x3A, 0x3A, 0xD5, 0x00, 0x07, 0x46, 0x3E, 0x24, 0x01,
+    0x10, 0x23, 0x27, 0xDF, 0x00, 0x2B, 0x31, 0x44, 0x36, 0x36, 0x3C, 0x27, 0x23, 0x01, 0x1A, 0x2A,
+    0x26, 0x39, 0x42, 0x40, 0x36, 0x25, 0x32, 0x3B, 0x43, 0x41, 0x4D, 0x50, 0x3D, 0x48, 0x4A, 0x3A,
+    0x31, 0x26, 0x2C, 0x15, 0x09, 0x37, 0x42, 0x43, 0x52, 0x3A, 0x42, 0x4B, 0x3A, 0x3B, 0x35, 0x2C,
+    0x17, 0x11, 0x01, 0x02, 0x46, 0x4B, 0x17, 0x01, 0x39, 0x1E, 0x24, 0x09, 0x32, 0x3B, 0x4B, 0x43,
+    0x4C, 0x2D, 0x37, 0x42, 0x3D, 0x4E, 0x53, 0x45, 0x48, 0x41, 0x4A, 0x3A, 0x31, 0x2D, 0x03, 0x24,
+    0x09, 0x2B, 0x36, 0x4C, 0x52, 0x4C, 0x40, 0x4B, 0x40, 0x3E, 0x30, 0x2C, 0x1E, 0x1E, 0x2C, 0x2D,
+    0x44, 0x46, 0x3A, 0x46, 0x3A, 0x4C, 0x40, 0x3E, 0x30, 0x2E, 0x15, 0x1B, 0x25, 0x37, 0x42, 0x43,
+    0x4A, 0x3D, 0x03, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x57, 0x14, 0x0F, 0x24, 0x09, 0x26, 0x26,
+    0x2E, 0x03, 0x1B, 0x1E, 0x19, 0x13, 0x0A, 0x21, 0x11, 0x04, 0x0F, 0x15, 0x24, 0x23, 0x1E, 0x15,
+    0x1E, 0x10, 0x05, 0x0D, 0x29, 0x29, 0x0D, 0x1D, 0x02, 0x17, 0x15, 0x1E, 0x23, 0x24, 0x00, 0x01,
+    0x12, 0x11, 0x21, 0x0A, 0x06, 0x18, 0x1A, 0x2A, 0x2E, 0x2E, 0x05, 0x19, 0x1E, 0x2E, 0x26, 0x35,
+    0x30, 0x1F, 0x27, 0x1F, 0x2A, 0x0F, 0x04, 0x07, 0x0D, 0x13, 0x10, 0x15, 0x2E, 0x03, 0x1B, 0x24,
+    0x2C, 0x1B, 0x00, 0x19, 0x0C, 0x20, 0x20, 0x07, 0x18, 0x1E, 0x2A, 0x1B, 0x24, 0x1B, 0x2E, 0x1B,
+    0x1E, 0x5F, 0x00, 0x15, 0x1F, 0x09, 0x19, 0x1A, 0x1B, 0x26, 0x37, 0x31, 0x3C, 0x30, 0x2B, 0x32,
+    0x24, 0x10, 0x12, 0x06, 0x19, 0x15, 0x1F, 0x30, 0x30, 0x77, 0x00, 0x04, 0x2D, 0x09, 0x00, 0x1C,
+    0x7E, 0x00, 0x06, 0x17, 0x03, 0x27, 0x26, 0x09, 0x25, 0x88, 0x00, 0x1B, 0x1C, 0x0C, 0x05, 0x19,
+    0x1E, 0x03, 0x2D, 0x35, 0x2D, 0x17, 0x2A, 0x26, 0x39, 0x42, 0x40, 0x42, 0x44, 0x36, 0x25, 0x15,
+    0x10, 0x18, 0x17, 0x09, 0x37, 0x3E, 0x44, 0xAB, 0x00, 0x01, 0x04, 0xB0, 0x00, 0x21, 0x39, 0x35,
+    0x2B, 0x39, 0x3C, 0x30, 0x2C, 0x22, 0x14, 0x02, 0x17, 0x2E, 0x30, 0x39, 0x44, 0x39, 0x1B, 0x25,
+    0x37, 0x42, 0x43, 0x4A, 0x52, 0x40, 0x4C, 0x4B, 0x32, 0x2E, 0x00, 0x22, 0x1B, 0x30, 0x40, 0xD6,
+    0x00, 0x01, 0x44, 0xDE, 0x00, 0x24, 0x42, 0x44, 0x3B, 0x42, 0x36, 0x39, 0x27, 0x24, 0x0F, 0x1E,
+    0x1B, 0x26, 0x31, 0x46, 0x3A, 0x46, 0x1F, 0x30, 0x44, 0x4B, 0x47, 0x50, 0x41, 0x52, 0x4A, 0x52,
+    0x46, 0x3C, 0x25, 0x1B, 0x00, 0x03, 0x32, 0x36, 0x4B, 0x43, 0x05, 0x01, 0x41, 0x40, 0x3E, 0x30,
+    0x2C, 0x17, 0x17, 0x1B, 0x2D, 0x44, 0x40, 0x3A, 0x42, 0x40, 0x4B, 0x40, 0x3E, 0x30, 0x2C, 0x00,
+    0x2A, 0x1F, 0x2B, 0x36, 0x4C, 0x3D, 0x52, 0x27, 0x32, 0x3E, 0x4C, 0x41, 0x4D, 0x4D, 0x4A, 0x48,
+    0x52, 0x46, 0x3C, 0x27, 0x2C, 0x15, 0x03, 0x35, 0x3E, 0x3A, 0x43, 0x4B, 0x46, 0x3A, 0x46, 0x31,
+    0x2D, 0x1B, 0x1E, 0x1E, 0x1B, 0x26, 0x31, 0x42, 0x3A, 0x46, 0x4B, 0x4C, 0x40, 0x44, 0x49, 0x01,
+    0x01, 0x2C, 0x4F, 0x01, 0x01, 0x4A, 0x03, 0x00, 0x00, 0x4A, 0x01, 0x00, 0x00, 0x4B, 0x05, 0x02,
+    0x00, 0x2E, 0x25, 0x25, 0x1B, 0x1B, 0x23, 0x22, 0x14, 0x07, 0x0B, 0x28, 0x0D, 0x1D, 0x02, 0x1E,
+    0x15, 0x00, 0x17, 0x1E, 0x1A, 0x19, 0x06, 0x0E, 0x33, 0x2F, 0x0B, 0x13, 0x19, 0x1A, 0x00, 0x1E,
+    0x23, 0x23, 0x1E, 0x10, 0x05, 0x0A, 0x21, 0x11, 0x06, 0x1C, 0x1A, 0x24, 0x2E, 0x2E, 0x1D, 0x1C,
+    0x22, 0x2A, 0x25, 0x2D, 0x2D, 0x03, 0x1F, 0x2E, 0x15, 0x10, 0x05, 0x08, 0x0B, 0x0C, 0x19, 0x1E,
+    0x1B, 0x2E, 0x2A, 0x23, 0x1B, 0x2A, 0x17, 0x1C, 0x07, 0x4E, 0x00, 0x03, 0x1C, 0x17, 0x24, 0x55,
+    0x00, 0x06, 0x2A, 0x17, 0x18, 0x06, 0x0D, 0x07, 0x5F, 0x00, 0x26, 0x25, 0x1F, 0x18, 0x0F, 0x24,
+    0x27, 0x2B, 0x3C, 0x37, 0x30, 0x32, 0x30, 0x15, 0x02, 0x05, 0x0C, 0x1C, 0x00, 0x09, 0x2D, 0x30,
+    0x25, 0x09, 0x26, 0x26, 0x09, 0x1E, 0x14, 0x07, 0x07, 0x14, 0x17, 0x2E, 0x27, 0x26, 0x1F, 0x27,
+    0x2D, 0x89, 0x00, 0x19, 0x06, 0x12, 0x02, 0x00, 0x03, 0x2D, 0x32, 0x35, 0x1A, 0x24, 0x25, 0x37,
+    0x3B, 0x46, 0x42, 0x31, 0x3B, 0x09, 0x00, 0x10, 0x1C, 0x17, 0x03, 0x2B, 0x44, 0xA5, 0x00, 0x07,
+    0x39, 0x31, 0x3C, 0x03, 0x22, 0x04, 0x14, 0xB1, 0x00, 0x32, 0x32, 0x37, 0x31, 0x39, 0x30, 0x2C,
+    0x1A, 0x18, 0x01, 0x1E, 0x03, 0x35, 0x31, 0x3B, 0x44, 0x2A, 0x1F, 0x2B, 0x36, 0x4C, 0x3D, 0x52,
+    0x40, 0x4B, 0x3A, 0x30, 0x2C, 0x1E, 0x22, 0x2A, 0x2D, 0x46, 0x40, 0x3B, 0x3E, 0x42, 0x42, 0x44,
+    0x23, 0x01, 0x01, 0x23, 0x27, 0x39, 0x42, 0x42, 0x3E, 0x36, 0x46, 0x42, 0xE6, 0x00, 0x23, 0x22,
+    0x15, 0x2C, 0x2D, 0x31, 0x40, 0x4B, 0x3A, 0x09, 0x2D, 0x31, 0x3A, 0x4A, 0x41, 0x41, 0x43, 0x3D,
+    0x4C, 0x36, 0x2B, 0x1F, 0x2A, 0x00, 0x2E, 0x35, 0x3E, 0x3A, 0x4C, 0x40, 0x42, 0x3A, 0x40, 0x44,
+    0x2D, 0x1B, 0x0E, 0x01, 0x0C, 0x46, 0x3A, 0x46, 0x3A, 0x4C, 0x3A, 0x3E, 0x30, 0x2E, 0x15, 0x1B,
+    0x25, 0x1D, 0x01, 0x26, 0x4A, 0x3D, 0x25, 0x30, 0x31, 0x3A, 0x4A, 0x50, 0x4E, 0x3D, 0x3D, 0x4C,
+    0x3B, 0x32, 0x1F, 0x1B, 0x00, 0x2C, 0x2D, 0x31, 0x46, 0x4B, 0x3A, 0x46, 0x40, 0x36, 0x3C, 0x27,
+    0x2A, 0x17, 0x1E, 0x2A, 0x27, 0x3C, 0x42, 0x40, 0x46, 0x4C, 0x48, 0x01, 0x03, 0x23, 0x2E, 0x27,
+    0x4E, 0x01, 0x02, 0x48, 0x48, 0x03, 0x00, 0x00, 0x47, 0x01, 0x00, 0x00, 0x21, 0x13, 0x18, 0x1A,
+    0x2A, 0x03, 0x09, 0x24, 0x24, 0x1E, 0x10, 0x05, 0x11, 0x20, 0x2F, 0x0E, 0x06, 0x18, 0x22, 0x1E,
+    0x1E, 0x1A, 0x17, 0x0F, 0x1C, 0x0C, 0x20, 0x34, 0x2F, 0x0E, 0x0C, 0x1C, 0x22, 0x1E, 0x25, 0x00,
+    0x04, 0x02, 0x1D, 0x0A, 0x20, 0x2C, 0x00, 0x24, 0x22, 0x24, 0x2E, 0x03, 0x13, 0x04, 0x01, 0x23,
+    0x09, 0x27, 0x26, 0x2E, 0x03, 0x1B, 0x1E, 0x19, 0x13, 0x0A, 0x0E, 0x07, 0x1C, 0x1A, 0x24, 0x1B,
+    0x2A, 0x23, 0x2A, 0x23, 0x1A, 0x14, 0x08, 0x21, 0x20, 0x07, 0x14, 0x1A, 0x53, 0x00, 0x01, 0x2C,
+    0x59, 0x00, 0x24, 0x0A, 0x06, 0x12, 0x10, 0x15, 0x03, 0x25, 0x27, 0x1C, 0x01, 0x23, 0x1F, 0x35,
+    0x37, 0x37, 0x2D, 0x35, 0x2D, 0x1E, 0x19, 0x1D, 0x0C, 0x14, 0x17, 0x03, 0x26, 0x2D, 0x25, 0x1F,
+    0x26, 0x26, 0x03, 0x17, 0x14, 0x07, 0x0C, 0x83, 0x00, 0x22, 0x26, 0x30, 0x26, 0x2E, 0x17, 0x18,
+    0x13, 0x14, 0x10, 0x15, 0x09, 0x30, 0x2B, 0x2B, 0x1A, 0x23, 0x1F, 0x2B, 0x3E, 0x42, 0x36, 0x31,
+    0x3E, 0x03, 0x1E, 0x02, 0x1C, 0x1A, 0x2E, 0x32, 0x31, 0x31, 0x37, 0x2B, 0xAA, 0x00, 0x01, 0x14,
+    0xAE, 0x00, 0x24, 0x32, 0x39, 0x31, 0x2B, 0x39, 0x44, 0x39, 0x35, 0x2E, 0x17, 0x19, 0x22, 0x15,
+    0x09, 0x32, 0x44, 0x36, 0x3B, 0x24, 0x03, 0x35, 0x3E, 0x3A, 0x52, 0x43, 0x40, 0x3A, 0x46, 0x2D,
+    0x1B, 0x1E, 0x0F, 0x24, 0x26, 0x42, 0x46, 0xD6, 0x00, 0x04, 0x31, 0x23, 0x01, 0x0F, 0xDE, 0x00,
+    0x2C, 0x46, 0x3B, 0x46, 0x40, 0x42, 0x39, 0x26, 0x2A, 0x17, 0x23, 0x2E, 0x30, 0x44, 0x40, 0x43,
+    0x4C, 0x03, 0x27, 0x3C, 0x42, 0x52, 0x47, 0x47, 0x43, 0x43, 0x4B, 0x3E, 0x35, 0x03, 0x24, 0x1E,
+    0x1B, 0x2D, 0x44, 0x46, 0x3A, 0x40, 0x42, 0x40, 0x46, 0x31, 0x26, 0x2A, 0x1A, 0x0D, 0x01, 0x01,
+    0x31, 0x11, 0x01, 0x2F, 0x4C, 0x4C, 0x3A, 0x44, 0x30, 0x2E, 0x23, 0x2E, 0x25, 0x37, 0x36, 0x43,
+    0x48, 0x48, 0x09, 0x26, 0x3C, 0x42, 0x52, 0x47, 0x41, 0x43, 0x43, 0x40, 0x44, 0x30, 0x03, 0x24,
+    0x1E, 0x2A, 0x27, 0x3C, 0x36, 0x40, 0x40, 0x42, 0x46, 0x3B, 0x37, 0x1F, 0x24, 0x1A, 0x1E, 0x2A,
+    0x25, 0x37, 0x36, 0x45, 0x01, 0x0B, 0x31, 0x2D, 0x2E, 0x23, 0x03, 0x27, 0x37, 0x36, 0x43, 0x48,
+    0x47, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x25, 0x0C, 0x04, 0x0F, 0x23, 0x2C, 0x03, 0x23,
+    0x15, 0x1A, 0x18, 0x13, 0x0D, 0x21, 0x33, 0x20, 0x07, 0x14, 0x01, 0x17, 0x17, 0x1A, 0x1A, 0x10,
+    0x04, 0x08, 0x21, 0x34, 0x2F, 0x20, 0x07, 0x14, 0x0F, 0x17, 0x1E, 0x24, 0x23, 0x17, 0x29, 0x00,
+    0x02, 0x07, 0x13, 0x2E, 0x00, 0x3F, 0x03, 0x09, 0x06, 0x12, 0x02, 0x00, 0x2E, 0x25, 0x27, 0x2C,
+    0x2E, 0x24, 0x1A, 0x1C, 0x0C, 0x0A, 0x20, 0x08, 0x04, 0x22, 0x23, 0x2A, 0x24, 0x23, 0x2A, 0x15,
+    0x22, 0x04, 0x11, 0x21, 0x0E, 0x07, 0x14, 0x22, 0x23, 0x1B, 0x2A, 0x03, 0x03, 0x1B, 0x17, 0x18,
+    0x13, 0x11, 0x13, 0x04, 0x01, 0x23, 0x03, 0x27, 0x26, 0x1C, 0x10, 0x00, 0x03, 0x30, 0x2B, 0x2B,
+    0x2D, 0x30, 0x27, 0x17, 0x1C, 0x70, 0x00, 0x04, 0x1A, 0x2C, 0x27, 0x26, 0x77, 0x00, 0x06, 0x27,
+    0x2E, 0x17, 0x04, 0x07, 0x06, 0x81, 0x00, 0x22, 0x2D, 0x25, 0x30, 0x35, 0x26, 0x2E, 0x1E, 0x19,
+    0x05, 0x18, 0x01, 0x23, 0x09, 0x35, 0x3C, 0x3C, 0x22, 0x15, 0x03, 0x35, 0x44, 0x36, 0x36, 0x31,
+    0x44, 0x2C, 0x17, 0x02, 0x1C, 0x22, 0x2C, 0x35, 0x39, 0x39, 0xA8, 0x00, 0x2A, 0x2E, 0x22, 0x14,
+    0x18, 0x1A, 0x2E, 0x32, 0x31, 0x31, 0x3C, 0x44, 0x3E, 0x31, 0x35, 0x03, 0x1E, 0x10, 0x17, 0x23,
+    0x1F, 0x2B, 0x3E, 0x42, 0x42, 0x24, 0x2E, 0x30, 0x31, 0x40, 0x4C, 0x43, 0x46, 0x40, 0x42, 0x27,
+    0x2A, 0x17, 0x0F, 0x23, 0x27, 0x36, 0x42, 0xD5, 0x00, 0x01, 0x36, 0xD9, 0x00, 0x02, 0x22, 0x24,
+    0xDF, 0x00, 0x34, 0x36, 0x40, 0x3A, 0x46, 0x31, 0x26, 0x1B, 0x1E, 0x2A, 0x09, 0x35, 0x3E, 0x3A,
+    0x52, 0x52, 0x2E, 0x25, 0x2B, 0x3B, 0x4C, 0x4A, 0x48, 0x4C, 0x4C, 0x40, 0x31, 0x2D, 0x2E, 0x23,
+    0x17, 0x2A, 0x27, 0x39, 0x42, 0x40, 0x46, 0x42, 0x40, 0x42, 0x39, 0x27, 0x24, 0x1A, 0x1E, 0x1B,
+    0x26, 0x39, 0x42, 0x3A, 0x40, 0x43, 0x43, 0x16, 0x01, 0x34, 0x03, 0x24, 0x03, 0x27, 0x37, 0x42,
+    0x43, 0x48, 0x47, 0x03, 0x25, 0x32, 0x3B, 0x4C, 0x4A, 0x47, 0x4C, 0x4B, 0x42, 0x3C, 0x26, 0x2C,
+    0x23, 0x17, 0x23, 0x1F, 0x2B, 0x3E, 0x46, 0x46, 0x42, 0x42, 0x44, 0x32, 0x09, 0x15, 0x1A, 0x1E,
+    0x24, 0x1F, 0x2B, 0x3B, 0x46, 0x40, 0x43, 0x4C, 0x46, 0x39, 0x2D, 0x2E, 0x24, 0x09, 0x4E, 0x01,
+    0x02, 0x47, 0x41, 0x01, 0x00, 0x00, 0x57, 0x01, 0x07, 0x05, 0x10, 0x00, 0x1B, 0x2E, 0x15, 0x1E,
+    0x0F, 0x14, 0x0C, 0x0E, 0x28, 0x34, 0x28, 0x11, 0x12, 0x02, 0x22, 0x1A, 0x1A, 0x22, 0x02, 0x12,
+    0x11, 0x28, 0x34, 0x2F, 0x20, 0x07, 0x14, 0x01, 0x17, 0x1E, 0x2A, 0x24, 0x17, 0x19, 0x1D, 0x0A,
+    0x0E, 0x0C, 0x13, 0x1C, 0x22, 0x24, 0x03, 0x25, 0x0C, 0x1D, 0x19, 0x17, 0x1B, 0x1F, 0x25, 0x2C,
+    0x1B, 0x23, 0x0F, 0x04, 0x07, 0x0D, 0x20, 0x11, 0x12, 0x01, 0x00, 0x24, 0x24, 0x23, 0x24, 0x15,
+    0x0F, 0x12, 0x11, 0x20, 0x0B, 0x07, 0x14, 0x22, 0x23, 0x1B, 0x1B, 0x09, 0x09, 0x1B, 0x17, 0x19,
+    0x13, 0x08, 0x05, 0x14, 0x0F, 0x23, 0x09, 0x26, 0x30, 0x14, 0x02, 0x1E, 0x2E, 0x26, 0x32, 0x2B,
+    0x26, 0x2D, 0x25, 0x1A, 0x1C, 0x13, 0x0C, 0x04, 0x22, 0x1B, 0x25, 0x27, 0x25, 0x25, 0x26, 0x27,
+    0x2E, 0x1A, 0x04, 0x0C, 0x13, 0x1C, 0x17, 0x2E, 0x26, 0x2D, 0x26, 0x32, 0x32, 0x2D, 0x03, 0x00,
+    0x02, 0x04, 0x02, 0x22, 0x24, 0x1F, 0x32, 0x39, 0x31, 0x22, 0x00, 0x2E, 0x30, 0x39, 0x3B, 0x36,
+    0x39, 0x31, 0x1B, 0x1A, 0x19, 0x1C, 0x22, 0x2C, 0x30, 0x3C, 0x39, 0x37, 0x37, 0x39, 0x31, 0x3C,
+    0x2E, 0x22, 0x1C, 0x19, 0x17, 0x2E, 0x32, 0x31, 0x44, 0x39, 0x3E, 0x3B, 0x44, 0x32, 0x03, 0x00,
+    0x0F, 0x00, 0x2A, 0x25, 0x2B, 0x3B, 0x40, 0x3A, 0x23, 0x2C, 0x26, 0x39, 0x42, 0x4B, 0x4C, 0x42,
+    0x46, 0x3B, 0x25, 0x24, 0x17, 0x0F, 0x15, 0x25, 0x3B, 0x36, 0x3B, 0x3B, 0x42, 0x36, 0x39, 0x23,
+    0x0F, 0x1A, 0x24, 0x27, 0x39, 0x42, 0x46, 0x42, 0x4B, 0x4B, 0x46, 0x31, 0x2D, 0x2C, 0x15, 0x2C,
+    0x1F, 0x32, 0x3E, 0x4B, 0x3D, 0x4A, 0x2C, 0x09, 0x35, 0x44, 0x3A, 0x52, 0x4A, 0x4B, 0x3A, 0x42,
+    0x3C, 0x27, 0x1B, 0x15, 0x17, 0x24, 0x25, 0x37, 0x3B, 0x46, 0x46, 0x42, 0x46, 0x3B, 0x3C, 0x25,
+    0x24, 0x1A, 0x00, 0x1B, 0x26, 0x39, 0x42, 0x3A, 0x40, 0x52, 0x43, 0x3A, 0x44, 0x30, 0x03, 0x2A,
+    0x1F, 0x26, 0x37, 0x42, 0x52, 0x47, 0x50, 0x2E, 0x09, 0x30, 0x31, 0x40, 0x52, 0x4A, 0x3A, 0x40,
+    0x3E, 0x2B, 0x1F, 0x2A, 0x00, 0x1A, 0x15, 0x2E, 0x30, 0x31, 0x36, 0x42, 0x36, 0x3B, 0x31, 0x30,
+    0x2E, 0x00, 0x22, 0x1E, 0x23, 0x09, 0x32, 0x3E, 0x46, 0x40, 0x52, 0x4C, 0x46, 0x39, 0x26, 0x2E,
+    0x2A, 0x1F, 0x26, 0x2B, 0x36, 0x43, 0x47, 0x50, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03,
+    0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x23, 0x11, 0x13, 0x19, 0x17, 0x24, 0x2C, 0x00, 0x17, 0x10,
+    0x12, 0x08, 0x20, 0x29, 0x34, 0x29, 0x0A, 0x1D, 0x19, 0x0F, 0x1A, 0x1A, 0x0F, 0x19, 0x05, 0x0A,
+    0x29, 0x34, 0x29, 0x20, 0x08, 0x04, 0x01, 0x17, 0x00, 0x1B, 0x27, 0x00, 0x22, 0x11, 0x0B, 0x06,
+    0x1D, 0x18, 0x1A, 0x2A, 0x09, 0x27, 0x0C, 0x13, 0x1C, 0x1A, 0x2A, 0x03, 0x25, 0x1B, 0x2A, 0x00,
+    0x01, 0x12, 0x08, 0x0D, 0x20, 0x0A, 0x05, 0x10, 0x1E, 0x23, 0x24, 0x24, 0x24, 0x00, 0x01, 0x4C,
+    0x00, 0x01, 0x0D, 0x52, 0x00, 0x1B, 0x2C, 0x1F, 0x09, 0x1B, 0x1E, 0x19, 0x1D, 0x0C, 0x04, 0x18,
+    0x0F, 0x24, 0x1F, 0x30, 0x32, 0x14, 0x19, 0x17, 0x1B, 0x27, 0x35, 0x2B, 0x26, 0x26, 0x1F, 0x0F,
+    0x14, 0x71, 0x00, 0x02, 0x2A, 0x1F, 0x77, 0x00, 0x2C, 0x25, 0x2E, 0x1A, 0x14, 0x06, 0x1D, 0x18,
+    0x1E, 0x2E, 0x26, 0x30, 0x2D, 0x2B, 0x2B, 0x30, 0x09, 0x15, 0x10, 0x1C, 0x01, 0x1A, 0x2A, 0x25,
+    0x2B, 0x31, 0x3E, 0x22, 0x1E, 0x2C, 0x26, 0x3C, 0x3E, 0x3B, 0x39, 0x39, 0x2A, 0x22, 0x19, 0x1C,
+    0x0F, 0x1B, 0x2D, 0x37, 0x3C, 0xA6, 0x00, 0x01, 0x39, 0xAA, 0x00, 0x04, 0x18, 0x02, 0x17, 0x03,
+    0xB1, 0x00, 0x20, 0x31, 0x36, 0x36, 0x44, 0x32, 0x09, 0x15, 0x1A, 0x23, 0x1B, 0x27, 0x37, 0x36,
+    0x3A, 0x4C, 0x23, 0x1B, 0x25, 0x37, 0x36, 0x3A, 0x4C, 0x42, 0x42, 0x44, 0x09, 0x23, 0x1A, 0x0F,
+    0x15, 0x09, 0x3E, 0xD5, 0x00, 0x06, 0x3B, 0x3C, 0x23, 0x0F, 0x17, 0x2A, 0xDE, 0x00, 0x2B, 0x40,
+    0x46, 0x4C, 0x4C, 0x40, 0x31, 0x2D, 0x2E, 0x23, 0x03, 0x25, 0x2B, 0x3B, 0x4C, 0x4A, 0x47, 0x1B,
+    0x03, 0x2D, 0x39, 0x46, 0x43, 0x3D, 0x3A, 0x40, 0x3B, 0x2B, 0x1F, 0x2A, 0x00, 0x1A, 0x23, 0x09,
+    0x32, 0x44, 0x42, 0x42, 0x42, 0x42, 0x3E, 0x2B, 0x1F, 0x23, 0x0C, 0x01, 0x07, 0x27, 0x3C, 0x36,
+    0x3A, 0x3A, 0x3D, 0x52, 0x16, 0x01, 0x24, 0x09, 0x1B, 0x25, 0x2D, 0x3C, 0x42, 0x52, 0x41, 0x4E,
+    0x1B, 0x2E, 0x27, 0x37, 0x36, 0x4C, 0x3D, 0x40, 0x42, 0x31, 0x30, 0x03, 0x23, 0x1E, 0x22, 0x1E,
+    0x1B, 0x26, 0x3C, 0x3E, 0x36, 0x3B, 0x3E, 0x3C, 0x26, 0x2C, 0x1E, 0x3D, 0x01, 0x09, 0x03, 0x35,
+    0x44, 0x42, 0x46, 0x52, 0x4C, 0x42, 0x3C, 0x49, 0x01, 0x07, 0x25, 0x26, 0x2B, 0x3B, 0x43, 0x47,
+    0x4E, 0x03, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x0C, 0x0A, 0x06, 0x1C, 0x22, 0x23, 0x1B, 0x1E,
+    0x1A, 0x19, 0x1D, 0x0A, 0x21, 0x0F, 0x00, 0x0E, 0x0B, 0x13, 0x1C, 0x01, 0x22, 0x1A, 0x0F, 0x18,
+    0x1D, 0x0D, 0x29, 0x33, 0x28, 0x0E, 0x21, 0x00, 0x03, 0x15, 0x2C, 0x2A, 0x27, 0x00, 0x04, 0x08,
+    0x0A, 0x1D, 0x05, 0x2E, 0x00, 0x0E, 0x1F, 0x2D, 0x0C, 0x13, 0x14, 0x0F, 0x23, 0x2E, 0x1F, 0x1B,
+    0x24, 0x1E, 0x02, 0x05, 0x40, 0x00, 0x03, 0x1D, 0x02, 0x17, 0x4B, 0x00, 0x03, 0x0E, 0x0A, 0x0C,
+    0x51, 0x00, 0x55, 0x2C, 0x2E, 0x27, 0x1F, 0x2C, 0x1E, 0x02, 0x12, 0x13, 0x1C, 0x19, 0x22, 0x2A,
+    0x25, 0x35, 0x37, 0x14, 0x19, 0x22, 0x2A, 0x25, 0x30, 0x2B, 0x26, 0x27, 0x03, 0x01, 0x04, 0x1D,
+    0x06, 0x04, 0x0F, 0x2A, 0x09, 0x25, 0x25, 0x27, 0x26, 0x25, 0x2C, 0x1A, 0x14, 0x13, 0x12, 0x19,
+    0x1E, 0x03, 0x26, 0x35, 0x30, 0x3C, 0x37, 0x35, 0x09, 0x23, 0x01, 0x19, 0x1A, 0x1E, 0x1B, 0x27,
+    0x37, 0x3E, 0x36, 0x22, 0x17, 0x2A, 0x27, 0x37, 0x44, 0x3B, 0x39, 0x3C, 0x24, 0x22, 0x19, 0x18,
+    0x0F, 0x2A, 0x2D, 0x2B, 0x3C, 0x37, 0x3C, 0x31, 0xA9, 0x00, 0x2C, 0x1A, 0x19, 0x01, 0x1E, 0x03,
+    0x2B, 0x31, 0x3E, 0x44, 0x46, 0x42, 0x3E, 0x2B, 0x1F, 0x24, 0x1E, 0x2A, 0x2E, 0x26, 0x3C, 0x42,
+    0x4C, 0x52, 0x23, 0x2A, 0x1F, 0x32, 0x3E, 0x40, 0x4B, 0x36, 0x36, 0x31, 0x03, 0x15, 0x1A, 0x0F,
+    0x00, 0x03, 0x44, 0x3B, 0x3B, 0x3B, 0x36, 0xD8, 0x00, 0x04, 0x22, 0x1E, 0x2A, 0x26, 0xDF, 0x00,
+    0x2C, 0x40, 0x43, 0x43, 0x40, 0x44, 0x30, 0x03, 0x2A, 0x1F, 0x27, 0x2B, 0x36, 0x4C, 0x48, 0x41,
+    0x2A, 0x2C, 0x27, 0x37, 0x36, 0x4B, 0x52, 0x46, 0x42, 0x31, 0x35, 0x03, 0x23, 0x1E, 0x1A, 0x15,
+    0x03, 0x30, 0x31, 0x3B, 0x36, 0x42, 0x36, 0x44, 0x32, 0x09, 0x23, 0x17, 0x15, 0x0F, 0x01, 0x03,
+    0x40, 0x3A, 0x4A, 0x17, 0x01, 0x03, 0x2C, 0x26, 0x30, 0x1E, 0x01, 0x23, 0x4D, 0x2A, 0x1B, 0x1F,
+    0x32, 0x3E, 0x3A, 0x43, 0x42, 0x3E, 0x37, 0x27, 0x1B, 0x00, 0x17, 0x0F, 0x1A, 0x24, 0x25, 0x32,
+    0x31, 0x3E, 0x3B, 0x44, 0x2B, 0x27, 0x2A, 0x17, 0x0F, 0x1E, 0x15, 0x2E, 0x30, 0x39, 0x36, 0x44,
+    0x01, 0x06, 0x36, 0x37, 0x27, 0x2E, 0x1B, 0x27, 0x4D, 0x01, 0x01, 0x4C, 0x03, 0x00, 0x00, 0x4A,
+    0x01, 0x00, 0x00, 0x12, 0x0D, 0x07, 0x04, 0x01, 0x15, 0x1B, 0x1E, 0x22, 0x18, 0x13, 0x0D, 0x28,
+    0x29, 0x34, 0x2F, 0x0B, 0x06, 0x14, 0x17, 0x00, 0x1E, 0x13, 0x0D, 0x29, 0x2F, 0x20, 0x0E, 0x07,
+    0x04, 0x01, 0x1E, 0x23, 0x03, 0x1B, 0x1E, 0x02, 0x05, 0x07, 0x08, 0x12, 0x04, 0x19, 0x17, 0x1B,
+    0x25, 0x30, 0x0C, 0x06, 0x04, 0x01, 0x15, 0x39, 0x00, 0x09, 0x17, 0x19, 0x1D, 0x11, 0x0D, 0x0E,
+    0x0A, 0x1D, 0x19, 0x45, 0x00, 0x26, 0x2A, 0x24, 0x00, 0x10, 0x12, 0x08, 0x0B, 0x08, 0x06, 0x1C,
+    0x22, 0x24, 0x2E, 0x03, 0x2D, 0x27, 0x2E, 0x00, 0x10, 0x04, 0x05, 0x02, 0x10, 0x17, 0x1B, 0x27,
+    0x32, 0x39, 0x14, 0x18, 0x22, 0x24, 0x09, 0x30, 0x32, 0x26, 0x25, 0x2E, 0x6E, 0x00, 0x04, 0x13,
+    0x04, 0x0F, 0x24, 0x75, 0x00, 0x01, 0x26, 0x7A, 0x00, 0x23, 0x1C, 0x1D, 0x14, 0x02, 0x00, 0x03,
+    0x2D, 0x35, 0x32, 0x31, 0x39, 0x32, 0x1F, 0x24, 0x22, 0x10, 0x1E, 0x15, 0x2C, 0x26, 0x3C, 0x3B,
+    0x46, 0x22, 0x17, 0x24, 0x1F, 0x32, 0x31, 0x3B, 0x39, 0x37, 0x23, 0x0F, 0x02, 0xA0, 0x00, 0x01,
+    0x26, 0xA4, 0x00, 0x28, 0x39, 0x31, 0x39, 0x37, 0x2E, 0x1A, 0x02, 0x22, 0x00, 0x09, 0x2B, 0x44,
+    0x3B, 0x3E, 0x3A, 0x46, 0x3B, 0x37, 0x25, 0x2A, 0x15, 0x2E, 0x09, 0x2D, 0x39, 0x46, 0x43, 0x4A,
+    0x15, 0x24, 0x03, 0x30, 0x31, 0x42, 0x3A, 0x36, 0x3E, 0x3C, 0x2C, 0x00, 0xCF, 0x00, 0x0C, 0x2E,
+    0x39, 0x3E, 0x3E, 0x36, 0x36, 0x3E, 0x37, 0x23, 0x1A, 0x00, 0x1B, 0xE0, 0x00, 0x01, 0x3D, 0xE5,
+    0x00, 0x34, 0x09, 0x2C, 0x27, 0x2D, 0x37, 0x36, 0x43, 0x47, 0x4E, 0x24, 0x1B, 0x09, 0x35, 0x44,
+    0x40, 0x4C, 0x42, 0x3B, 0x3C, 0x2D, 0x2C, 0x15, 0x17, 0x1A, 0x00, 0x2C, 0x2D, 0x3C, 0x3E, 0x3B,
+    0x42, 0x36, 0x31, 0x35, 0x03, 0x15, 0x17, 0x23, 0x1B, 0x25, 0x37, 0x3B, 0x40, 0x4B, 0x4A, 0x52,
+    0x40, 0x44, 0x30, 0x1F, 0x2E, 0x2D, 0x1D, 0x01, 0x1D, 0x50, 0x45, 0x23, 0x24, 0x2E, 0x2D, 0x39,
+    0x42, 0x4B, 0x3B, 0x31, 0x35, 0x09, 0x24, 0x17, 0x1A, 0x01, 0x22, 0x15, 0x03, 0x30, 0x3C, 0x44,
+    0x3E, 0x31, 0x32, 0x1F, 0x24, 0x1A, 0x3D, 0x01, 0x07, 0x2C, 0x26, 0x3C, 0x3B, 0x46, 0x3D, 0x4B,
+    0x48, 0x01, 0x08, 0x2C, 0x26, 0x26, 0x2B, 0x3E, 0x4C, 0x47, 0x4D, 0x03, 0x00, 0x00, 0x47, 0x01,
+    0x01, 0x00, 0x14, 0x08, 0x12, 0x10, 0x00, 0x2A, 0x1E, 0x0F, 0x1C, 0x06, 0x0B, 0x28, 0x29, 0x33,
+    0x2F, 0x0E, 0x0C, 0x14, 0x10, 0x1A, 0x17, 0x19, 0x00, 0x04, 0x28, 0x29, 0x0E, 0x0B, 0x21, 0x00,
+    0x26, 0x24, 0x1F, 0x2C, 0x00, 0x10, 0x12, 0x06, 0x0C, 0x1C, 0x1C, 0x02, 0x1E, 0x2C, 0x27, 0x32,
+    0x0C, 0x06, 0x12, 0x10, 0x00, 0x2C, 0x1F, 0x1B, 0x23, 0x1A, 0x18, 0x13, 0x11, 0x0D, 0x0B, 0x0A,
+    0x13, 0x19, 0x1A, 0x15, 0x24, 0x1B, 0x2A, 0x4A, 0x00, 0x1D, 0x07, 0x0A, 0x0C, 0x1D, 0x18, 0x1A,
+    0x24, 0x03, 0x1F, 0x35, 0x26, 0x03, 0x15, 0x01, 0x1C, 0x04, 0x01, 0x0F, 0x1E, 0x2C, 0x26, 0x37,
+    0x44, 0x1C, 0x18, 0x0F, 0x23, 0x03, 0x2D, 0x6B, 0x00, 0x3A, 0x10, 0x04, 0x05, 0x1D, 0x04, 0x01,
+    0x24, 0x03, 0x25, 0x27, 0x2D, 0x2D, 0x25, 0x2C, 0x17, 0x18, 0x12, 0x18, 0x10, 0x15, 0x09, 0x2D,
+    0x32, 0x2B, 0x3E, 0x31, 0x32, 0x25, 0x2A, 0x17, 0x0F, 0x23, 0x24, 0x03, 0x2D, 0x39, 0x42, 0x3A,
+    0x22, 0x1A, 0x23, 0x09, 0x35, 0x39, 0x3E, 0x3C, 0x37, 0x15, 0x0F, 0x02, 0x19, 0x0F, 0x24, 0x27,
+    0x32, 0x37, 0x3C, 0x31, 0xA9, 0x00, 0x04, 0x17, 0x10, 0x1A, 0x15, 0xB1, 0x00, 0x21, 0x36, 0x4B,
+    0x3A, 0x36, 0x37, 0x27, 0x2C, 0x24, 0x09, 0x1F, 0x30, 0x31, 0x40, 0x52, 0x48, 0x15, 0x23, 0x2E,
+    0x2D, 0x3C, 0x36, 0x40, 0x3B, 0x44, 0x37, 0x1B, 0x1E, 0x1A, 0x22, 0x1E, 0x2E, 0x3C, 0x44, 0xD5,
+    0x00, 0x05, 0x44, 0x2B, 0x23, 0x17, 0x23, 0xDD, 0x00, 0x2B, 0x36, 0x40, 0x3A, 0x4A, 0x52, 0x3A,
+    0x44, 0x35, 0x1F, 0x03, 0x2D, 0x30, 0x3C, 0x36, 0x43, 0x41, 0x4D, 0x24, 0x24, 0x2E, 0x2D, 0x39,
+    0x42, 0x4B, 0x36, 0x44, 0x2B, 0x25, 0x2A, 0x1E, 0x17, 0x22, 0x1E, 0x1B, 0x27, 0x2B, 0x44, 0x3B,
+    0x36, 0x3B, 0x39, 0x30, 0x2E, 0x0D, 0x01, 0x0D, 0x2B, 0x3E, 0x40, 0x4B, 0x48, 0x52, 0x40, 0x31,
+    0x30, 0x1F, 0x09, 0x30, 0x35, 0x1E, 0x01, 0x22, 0x53, 0x15, 0x15, 0x2A, 0x25, 0x2B, 0x3B, 0x40,
+    0x3E, 0x3C, 0x2D, 0x2E, 0x00, 0x22, 0x0F, 0x10, 0x01, 0x1E, 0x2C, 0x26, 0x2B, 0x31, 0x44, 0x3C,
+    0x30, 0x03, 0x15, 0x22, 0x0F, 0x00, 0x15, 0x1B, 0x27, 0x37, 0x44, 0x01, 0x0A, 0x3B, 0x2B, 0x25,
+    0x2E, 0x2C, 0x2D, 0x2D, 0x32, 0x3E, 0x4B, 0x03, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x15, 0x0B,
+    0x08, 0x05, 0x02, 0x1E, 0x2A, 0x1E, 0x01, 0x14, 0x0C, 0x0E, 0x28, 0x28, 0x2F, 0x29, 0x0E, 0x07,
+    0x04, 0x10, 0x1A, 0x1E, 0x19, 0x00, 0x1D, 0x21, 0x28, 0x0D, 0x0A, 0x0C, 0x14, 0x01, 0x00, 0x2A,
+    0x25, 0x2E, 0x15, 0x10, 0x04, 0x13, 0x1D, 0x19, 0x18, 0x01, 0x00, 0x2E, 0x2D, 0x37, 0x06, 0x06,
+    0x12, 0x02, 0x1E, 0x1B, 0x39, 0x00, 0x69, 0x22, 0x1C, 0x13, 0x11, 0x0A, 0x0D, 0x11, 0x13, 0x18,
+    0x1A, 0x15, 0x2A, 0x2C, 0x2A, 0x00, 0x01, 0x12, 0x0C, 0x08, 0x13, 0x05, 0x19, 0x17, 0x2A, 0x09,
+    0x25, 0x2B, 0x2D, 0x09, 0x23, 0x0F, 0x19, 0x18, 0x1A, 0x1A, 0x15, 0x2E, 0x2D, 0x3C, 0x3B, 0x1C,
+    0x18, 0x01, 0x15, 0x2E, 0x26, 0x32, 0x26, 0x1F, 0x2C, 0x02, 0x04, 0x05, 0x05, 0x14, 0x01, 0x23,
+    0x03, 0x25, 0x26, 0x30, 0x2D, 0x27, 0x2E, 0x17, 0x19, 0x04, 0x02, 0x0F, 0x23, 0x09, 0x30, 0x2B,
+    0x3C, 0x36, 0x44, 0x2B, 0x27, 0x1B, 0x00, 0x17, 0x2A, 0x1B, 0x09, 0x35, 0x31, 0x46, 0x4C, 0x22,
+    0x1A, 0x15, 0x03, 0x30, 0x3C, 0x3E, 0x3C, 0x2B, 0x00, 0x01, 0x02, 0x02, 0x0F, 0x24, 0x25, 0x35,
+    0xA9, 0x00, 0x23, 0x1E, 0x0F, 0x1E, 0x24, 0x1F, 0x37, 0x44, 0x36, 0x42, 0x43, 0x4B, 0x36, 0x3C,
+    0x26, 0x2E, 0x1B, 0x25, 0x27, 0x35, 0x44, 0x3A, 0x3D, 0x41, 0x15, 0x15, 0x1B, 0x27, 0x37, 0x3B,
+    0x46, 0x3E, 0x31, 0x32, 0x2A, 0x17, 0xCF, 0x00, 0x06, 0x2C, 0x37, 0x31, 0x3E, 0x36, 0x3B, 0xD9,
+    0x00, 0x02, 0x24, 0x2C, 0xDF, 0x00, 0x02, 0x4B, 0x48, 0xE5, 0x00, 0x2D, 0x25, 0x09, 0x35, 0x35,
+    0x3C, 0x42, 0x52, 0x50, 0x53, 0x23, 0x23, 0x1B, 0x27, 0x37, 0x3B, 0x3A, 0x3B, 0x39, 0x35, 0x09,
+    0x23, 0x17, 0x1A, 0x22, 0x17, 0x24, 0x1F, 0x35, 0x39, 0x3E, 0x36, 0x3E, 0x37, 0x26, 0x2C, 0x00,
+    0x17, 0x24, 0x1B, 0x1F, 0x32, 0x3E, 0x46, 0x4B, 0x47, 0x16, 0x01, 0x04, 0x25, 0x1F, 0x32, 0x32,
+    0x1E, 0x01, 0x31, 0x51, 0x00, 0x1E, 0x23, 0x03, 0x30, 0x31, 0x42, 0x31, 0x2B, 0x25, 0x2A, 0x17,
+    0x01, 0x01, 0x10, 0x10, 0x1A, 0x2A, 0x25, 0x35, 0x3C, 0x44, 0x37, 0x26, 0x2C, 0x00, 0x0F, 0x0F,
+    0x00, 0x00, 0x2A, 0x25, 0x2B, 0x3E, 0x46, 0x3D, 0x3A, 0x3E, 0x32, 0x1F, 0x2E, 0x2E, 0x30, 0x2D,
+    0x32, 0x44, 0x3A, 0x48, 0x03, 0x00, 0x00, 0x48, 0x01, 0x01, 0x00, 0x04, 0x11, 0x1D, 0x19, 0x17,
+    0x08, 0x00, 0x06, 0x04, 0x07, 0x0E, 0x28, 0x21, 0x28, 0x13, 0x00, 0x26, 0x17, 0x00, 0x22, 0x18,
+    0x13, 0x0A, 0x20, 0x20, 0x08, 0x11, 0x06, 0x14, 0x0F, 0x15, 0x2C, 0x26, 0x03, 0x23, 0x0F, 0x1C,
+    0x05, 0x12, 0x01, 0x02, 0x0F, 0x15, 0x03, 0x30, 0x39, 0x13, 0x06, 0x05, 0x19, 0x17, 0x1B, 0x1F,
+    0x2C, 0x15, 0x3C, 0x00, 0x29, 0x08, 0x11, 0x11, 0x08, 0x1D, 0x18, 0x1A, 0x23, 0x1B, 0x03, 0x1B,
+    0x00, 0x01, 0x04, 0x06, 0x0C, 0x12, 0x04, 0x02, 0x17, 0x1B, 0x1F, 0x26, 0x3C, 0x35, 0x1F, 0x24,
+    0x1A, 0x10, 0x10, 0x00, 0x1E, 0x23, 0x03, 0x30, 0x31, 0x42, 0x18, 0x18, 0x01, 0x00, 0x6A, 0x00,
+    0x05, 0x1B, 0x02, 0x04, 0x12, 0x12, 0x72, 0x00, 0x2D, 0x2E, 0x25, 0x26, 0x35, 0x30, 0x27, 0x2E,
+    0x1E, 0x02, 0x1C, 0x01, 0x22, 0x24, 0x1F, 0x35, 0x37, 0x39, 0x46, 0x3E, 0x37, 0x26, 0x2C, 0x23,
+    0x15, 0x2E, 0x2E, 0x25, 0x32, 0x3E, 0x3A, 0x52, 0x1A, 0x1A, 0x00, 0x2E, 0x26, 0x37, 0x3E, 0x3C,
+    0x32, 0x1E, 0x01, 0x10, 0x10, 0x22, 0xA2, 0x00, 0x03, 0x2B, 0x3C, 0x44, 0xA8, 0x00, 0x42, 0x03,
+    0x1E, 0x22, 0x15, 0x2A, 0x25, 0x37, 0x3E, 0x42, 0x46, 0x52, 0x4B, 0x42, 0x39, 0x2D, 0x09, 0x2E,
+    0x2D, 0x2D, 0x32, 0x3E, 0x3A, 0x4A, 0x4E, 0x00, 0x00, 0x2A, 0x1F, 0x32, 0x44, 0x46, 0x3E, 0x3C,
+    0x30, 0x23, 0x1A, 0x1A, 0x22, 0x17, 0x1B, 0x2B, 0x39, 0x44, 0x36, 0x3B, 0x31, 0x32, 0x23, 0x1E,
+    0x1B, 0x2E, 0x26, 0x3C, 0x36, 0x3A, 0x4C, 0x47, 0x3D, 0x3A, 0x44, 0x32, 0x27, 0x25, 0x32, 0x32,
+    0x39, 0xED, 0x00, 0x22, 0x51, 0x15, 0x00, 0x24, 0x09, 0x35, 0x44, 0x46, 0x3E, 0x37, 0x2D, 0x2E,
+    0x15, 0x1A, 0x22, 0x22, 0x1A, 0x23, 0x03, 0x30, 0x3C, 0x44, 0x36, 0x44, 0x2B, 0x27, 0x1B, 0x00,
+    0x1E, 0x2A, 0x1B, 0x1F, 0x35, 0x44, 0x13, 0x01, 0x26, 0x46, 0x39, 0x30, 0x25, 0x25, 0x2B, 0x32,
+    0x3C, 0x36, 0x43, 0x50, 0x51, 0x17, 0x1A, 0x1E, 0x1B, 0x27, 0x3C, 0x3B, 0x3C, 0x30, 0x09, 0x23,
+    0x22, 0x02, 0x10, 0x02, 0x02, 0x0F, 0x15, 0x03, 0x30, 0x37, 0x31, 0x32, 0x25, 0x1B, 0x17, 0x3E,
+    0x01, 0x0F, 0x1F, 0x32, 0x44, 0x42, 0x3D, 0x3A, 0x44, 0x35, 0x1F, 0x2E, 0x03, 0x30, 0x2D, 0x35,
+    0x31, 0x03, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x04, 0x0D, 0x11, 0x13, 0x18, 0x0B, 0x00, 0x04,
+    0x21, 0x20, 0x21, 0x28, 0x12, 0x00, 0x1F, 0x01, 0x1E, 0x23, 0x1A, 0x19, 0x1D, 0x11, 0x0B, 0x0B,
+    0x0C, 0x07, 0x1D, 0x1C, 0x22, 0x24, 0x03, 0x30, 0x1F, 0x24, 0x22, 0x18, 0x14, 0x1C, 0x1A, 0x0F,
+    0x1A, 0x23, 0x09, 0x32, 0x44, 0x1D, 0x39, 0x00, 0x01, 0x0F, 0x3D, 0x00, 0x03, 0x07, 0x07, 0x07,
+    0x44, 0x00, 0x2D, 0x2C, 0x09, 0x2C, 0x15, 0x01, 0x14, 0x13, 0x13, 0x1C, 0x1C, 0x10, 0x1E, 0x2C,
+    0x25, 0x30, 0x31, 0x32, 0x25, 0x1B, 0x1E, 0x0F, 0x22, 0x24, 0x15, 0x2A, 0x1F, 0x32, 0x3E, 0x40,
+    0x19, 0x18, 0x10, 0x1E, 0x2C, 0x27, 0x32, 0x2D, 0x1F, 0x2A, 0x02, 0x14, 0x04, 0x14, 0x1C, 0x0F,
+    0x74, 0x00, 0x02, 0x2D, 0x32, 0x7A, 0x00, 0x33, 0x10, 0x19, 0x1A, 0x17, 0x2A, 0x25, 0x35, 0x3C,
+    0x44, 0x3A, 0x36, 0x3C, 0x2D, 0x03, 0x2A, 0x24, 0x1F, 0x09, 0x27, 0x2B, 0x3B, 0x4B, 0x4A, 0x1A,
+    0x22, 0x1E, 0x1B, 0x27, 0x2B, 0x44, 0x3C, 0x35, 0x1E, 0x01, 0x01, 0x01, 0x22, 0x23, 0x1F, 0x30,
+    0x2B, 0x3C, 0x3E, 0x31, 0x3C, 0x37, 0x03, 0x00, 0x17, 0x24, 0x1B, 0xB1, 0x00, 0x29, 0x40, 0x4A,
+    0x4C, 0x42, 0x39, 0x30, 0x1F, 0x1F, 0x35, 0x30, 0x2B, 0x3E, 0x4B, 0x48, 0x4D, 0x00, 0x1E, 0x23,
+    0x03, 0x30, 0x39, 0x42, 0x44, 0x37, 0x2D, 0x15, 0x1A, 0x1A, 0x1A, 0x17, 0x2A, 0x35, 0x3C, 0x44,
+    0x42, 0x3E, 0x39, 0x35, 0x23, 0x00, 0x2C, 0xDE, 0x00, 0x03, 0x40, 0x4C, 0x41, 0xE5, 0x00, 0x04,
+    0x26, 0x26, 0x37, 0x2B, 0xED, 0x00, 0x27, 0x49, 0x00, 0x1E, 0x15, 0x2E, 0x2D, 0x39, 0x36, 0x31,
+    0x32, 0x25, 0x1B, 0x1E, 0x0F, 0x22, 0x22, 0x22, 0x00, 0x2C, 0x26, 0x2B, 0x31, 0x3B, 0x31, 0x32,
+    0x25, 0x2A, 0x00, 0x1E, 0x1B, 0x1B, 0x09, 0x35, 0x31, 0x42, 0x4B, 0x47, 0x43, 0x42, 0x17, 0x01,
+    0x03, 0x27, 0x37, 0x2B, 0x1F, 0x01, 0x30, 0x1A, 0x0F, 0x1A, 0x23, 0x1F, 0x32, 0x44, 0x37, 0x26,
+    0x2C, 0x1E, 0x10, 0x19, 0x02, 0x02, 0x18, 0x01, 0x1E, 0x2C, 0x26, 0x2B, 0x39, 0x35, 0x1F, 0x24,
+    0x1A, 0x01, 0x0F, 0x15, 0x00, 0x24, 0x03, 0x30, 0x31, 0x42, 0x3D, 0x40, 0x31, 0x30, 0x09, 0x2E,
+    0x03, 0x35, 0x2D, 0x35, 0x39, 0x40, 0x4A, 0x03, 0x00, 0x00, 0x43, 0x01, 0x05, 0x00, 0x02, 0x1B,
+    0x00, 0x0C, 0x00, 0x5A, 0x0B, 0x0E, 0x20, 0x0B, 0x0C, 0x04, 0x01, 0x00, 0x24, 0x17, 0x19, 0x05,
+    0x08, 0x0D, 0x11, 0x1D, 0x13, 0x05, 0x19, 0x1A, 0x2A, 0x1F, 0x2B, 0x25, 0x2A, 0x1A, 0x02, 0x18,
+    0x02, 0x00, 0x1A, 0x1E, 0x2A, 0x25, 0x2B, 0x3B, 0x05, 0x13, 0x05, 0x18, 0x1A, 0x2A, 0x25, 0x2E,
+    0x15, 0x0F, 0x14, 0x13, 0x07, 0x0C, 0x06, 0x0C, 0x05, 0x19, 0x1A, 0x23, 0x2E, 0x25, 0x2E, 0x15,
+    0x0F, 0x1C, 0x05, 0x05, 0x19, 0x19, 0x0F, 0x15, 0x2E, 0x27, 0x32, 0x3E, 0x37, 0x26, 0x2C, 0x00,
+    0x1A, 0x1E, 0x2C, 0x2A, 0x2C, 0x25, 0x2B, 0x3B, 0x4B, 0x02, 0x18, 0x10, 0x17, 0x1B, 0x6D, 0x00,
+    0x03, 0x1C, 0x1C, 0x18, 0x74, 0x00, 0x23, 0x30, 0x37, 0x35, 0x27, 0x03, 0x00, 0x01, 0x10, 0x1E,
+    0x00, 0x1B, 0x27, 0x32, 0x39, 0x3B, 0x4C, 0x42, 0x39, 0x30, 0x09, 0x2C, 0x2C, 0x26, 0x25, 0x2D,
+    0x37, 0x36, 0x43, 0x47, 0x17, 0x22, 0x1E, 0x2A, 0x25, 0x32, 0x9A, 0x00, 0x0B, 0x17, 0x01, 0x01,
+    0x0F, 0x22, 0x23, 0x09, 0x2D, 0x2B, 0x39, 0x3B, 0xA9, 0x00, 0x23, 0x15, 0x1E, 0x1B, 0x2C, 0x27,
+    0x37, 0x3E, 0x46, 0x4B, 0x48, 0x43, 0x46, 0x31, 0x35, 0x27, 0x27, 0x2B, 0x32, 0x37, 0x3B, 0x4C,
+    0x47, 0x53, 0x00, 0x17, 0x15, 0x2C, 0x26, 0x3C, 0x36, 0x31, 0x2B, 0x27, 0x00, 0x22, 0xCF, 0x00,
+    0x03, 0x24, 0x30, 0x37, 0xD5, 0x00, 0x3A, 0x3C, 0x35, 0x23, 0x15, 0x2E, 0x03, 0x26, 0x3C, 0x3B,
+    0x40, 0x43, 0x50, 0x3D, 0x40, 0x44, 0x32, 0x2D, 0x2D, 0x39, 0x37, 0x31, 0x42, 0x52, 0x4E, 0x49,
+    0x1E, 0x1A, 0x1E, 0x2A, 0x25, 0x37, 0x3B, 0x39, 0x35, 0x09, 0x24, 0x1A, 0x01, 0x0F, 0x22, 0x0F,
+    0x1E, 0x1B, 0x25, 0x32, 0x39, 0x3B, 0x39, 0x30, 0x09, 0x24, 0x1E, 0x1E, 0x2C, 0x1B, 0x09, 0x30,
+    0x39, 0x14, 0x01, 0x3B, 0x3C, 0x2D, 0x27, 0x26, 0x3C, 0x2B, 0x3C, 0x3B, 0x4C, 0x41, 0x49, 0x22,
+    0x10, 0x0F, 0x00, 0x2E, 0x30, 0x39, 0x32, 0x25, 0x24, 0x1A, 0x19, 0x1C, 0x19, 0x19, 0x1C, 0x02,
+    0x1A, 0x2A, 0x25, 0x32, 0x3C, 0x30, 0x03, 0x15, 0x22, 0x10, 0x0F, 0x15, 0x1E, 0x23, 0x2E, 0x2D,
+    0x39, 0x42, 0x52, 0x46, 0x39, 0x2D, 0x09, 0x2E, 0x09, 0x32, 0x2D, 0x30, 0x3C, 0x46, 0x3D, 0x03,
+    0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x01, 0x0A, 0x06, 0x00, 0x01, 0x15, 0x0A, 0x00, 0x28, 0x0B,
+    0x0E, 0x0D, 0x0A, 0x0E, 0x0D, 0x0C, 0x14, 0x0F, 0x15, 0x1B, 0x1E, 0x02, 0x12, 0x0C, 0x11, 0x0C,
+    0x04, 0x05, 0x04, 0x02, 0x1E, 0x2C, 0x27, 0x3C, 0x26, 0x2C, 0x1E, 0x01, 0x02, 0x0F, 0x24, 0x00,
+    0x15, 0x1B, 0x27, 0x3C, 0x42, 0x04, 0x1D, 0x38, 0x00, 0x01, 0x23, 0x3C, 0x00, 0x04, 0x0C, 0x13,
+    0x1D, 0x06, 0x43, 0x00, 0x2D, 0x24, 0x03, 0x27, 0x03, 0x23, 0x22, 0x18, 0x04, 0x14, 0x01, 0x10,
+    0x22, 0x23, 0x03, 0x2D, 0x37, 0x36, 0x39, 0x2D, 0x2E, 0x23, 0x00, 0x23, 0x09, 0x2C, 0x03, 0x26,
+    0x37, 0x42, 0x43, 0x10, 0x19, 0x10, 0x17, 0x2A, 0x25, 0x2B, 0x2D, 0x09, 0x24, 0x02, 0x1C, 0x18,
+    0x19, 0x19, 0x73, 0x00, 0x2C, 0x27, 0x35, 0x3C, 0x35, 0x26, 0x03, 0x15, 0x22, 0x22, 0x23, 0x23,
+    0x2C, 0x27, 0x2B, 0x31, 0x36, 0x43, 0x46, 0x31, 0x35, 0x25, 0x03, 0x09, 0x35, 0x26, 0x30, 0x3C,
+    0x42, 0x52, 0x50, 0x17, 0x22, 0x17, 0x24, 0x1F, 0x35, 0x44, 0x3C, 0x30, 0x17, 0x01, 0x0F, 0x22,
+    0x1A, 0xA2, 0x00, 0x01, 0x32, 0xA9, 0x00, 0x0B, 0x23, 0x15, 0x2E, 0x03, 0x26, 0x3C, 0x3E, 0x46,
+    0x4C, 0x47, 0x52, 0xB7, 0x00, 0x26, 0x26, 0x2D, 0x39, 0x2B, 0x3C, 0x3B, 0x4C, 0x41, 0x51, 0x00,
+    0x17, 0x00, 0x1B, 0x25, 0x2B, 0x3E, 0x39, 0x35, 0x1F, 0x1E, 0x22, 0x1A, 0x17, 0x17, 0x23, 0x2D,
+    0x2B, 0x31, 0x42, 0x44, 0x3C, 0x30, 0x24, 0x23, 0x09, 0x09, 0x26, 0x37, 0xE4, 0x00, 0x05, 0x2B,
+    0x30, 0x35, 0x31, 0x3C, 0xED, 0x00, 0x23, 0x58, 0x1E, 0x22, 0x1A, 0x23, 0x09, 0x35, 0x44, 0x37,
+    0x2D, 0x2E, 0x00, 0x0F, 0x10, 0x0F, 0x22, 0x01, 0x1A, 0x24, 0x09, 0x30, 0x3C, 0x3E, 0x3C, 0x2D,
+    0x03, 0x23, 0x1E, 0x00, 0x2C, 0x1B, 0x03, 0x2D, 0x3C, 0x36, 0x13, 0x01, 0x06, 0x36, 0x37, 0x2D,
+    0x27, 0x2D, 0x39, 0x1C, 0x01, 0x2D, 0x4B, 0x41, 0x51, 0x0F, 0x19, 0x02, 0x1A, 0x2A, 0x27, 0x37,
+    0x30, 0x03, 0x15, 0x01, 0x1C, 0x14, 0x19, 0x19, 0x14, 0x18, 0x0F, 0x23, 0x09, 0x30, 0x37, 0x26,
+    0x2C, 0x00, 0x0F, 0x10, 0x0F, 0x23, 0x1E, 0x15, 0x2C, 0x26, 0x3C, 0x36, 0x52, 0x42, 0x3C, 0x26,
+    0x03, 0x2E, 0x1F, 0x4D, 0x01, 0x02, 0x42, 0x52, 0x01, 0x00, 0x00, 0x57, 0x01, 0x11, 0x08, 0x13,
+    0x18, 0x17, 0x2C, 0x23, 0x0F, 0x04, 0x07, 0x0D, 0x0B, 0x08, 0x08, 0x0D, 0x0A, 0x06, 0x1C, 0x22,
+    0x24, 0x2E, 0x00, 0x10, 0x04, 0x06, 0x0C, 0x1D, 0x19, 0x14, 0x1C, 0x01, 0x00, 0x2E, 0x2D, 0x31,
+    0x30, 0x2E, 0x15, 0x22, 0x0F, 0x1E, 0x2C, 0x23, 0x24, 0x2E, 0x2D, 0x31, 0x3A, 0x14, 0x05, 0x12,
+    0x18, 0x1A, 0x2A, 0x27, 0x03, 0x23, 0x0F, 0x1C, 0x1D, 0x06, 0x05, 0x12, 0x1D, 0x12, 0x02, 0x17,
+    0x2A, 0x09, 0x2D, 0x09, 0x24, 0x1A, 0x02, 0x1C, 0x19, 0x17, 0x22, 0x17, 0x24, 0x09, 0x30, 0x39,
+    0x40, 0x31, 0x30, 0x09, 0x2A, 0x23, 0x1B, 0x27, 0x09, 0x1F, 0x2D, 0x39, 0x46, 0x4A, 0x01, 0x19,
+    0x10, 0x1A, 0x2A, 0x25, 0x2B, 0x30, 0x09, 0x24, 0x02, 0x18, 0x02, 0x10, 0x02, 0x22, 0x23, 0x2E,
+    0x27, 0x35, 0x39, 0x32, 0x26, 0x03, 0x23, 0x1A, 0x17, 0x1B, 0x2A, 0x2E, 0x26, 0x37, 0x44, 0x46,
+    0x3D, 0x40, 0x44, 0x32, 0x27, 0x1F, 0x27, 0x2B, 0x30, 0x32, 0x39, 0x46, 0x3D, 0x4D, 0x1E, 0x22,
+    0x1A, 0x23, 0x03, 0x35, 0x31, 0x37, 0x2D, 0x1A, 0x01, 0x22, 0x17, 0x1A, 0x23, 0x03, 0x26, 0x32,
+    0x39, 0x36, 0x31, 0x3C, 0x37, 0x03, 0x24, 0x24, 0x09, 0x09, 0x26, 0x3C, 0x3E, 0x46, 0x43, 0x50,
+    0x52, 0x46, 0x44, 0x32, 0x30, 0x35, 0x44, 0x3C, 0x39, 0x36, 0x4C, 0x41, 0x49, 0x00, 0x1A, 0x17,
+    0x24, 0x09, 0x32, 0x44, 0x3C, 0x30, 0x09, 0x1A, 0x0F, 0x1A, 0x1E, 0x17, 0x15, 0x26, 0x32, 0x31,
+    0x42, 0x44, 0x37, 0x2D, 0x24, 0x24, 0x1F, 0x09, 0x26, 0x37, 0x3E, 0x40, 0x43, 0x4E, 0x3D, 0x40,
+    0x44, 0x2B, 0x30, 0x32, 0x3E, 0x39, 0x31, 0x42, 0x43, 0x4E, 0x58, 0x17, 0x0F, 0x0F, 0x00, 0x2E,
+    0x2D, 0x39, 0x2B, 0x27, 0x1B, 0x17, 0x01, 0x02, 0x0F, 0x22, 0x01, 0x22, 0x15, 0x2E, 0x2D, 0x37,
+    0x3E, 0x37, 0x26, 0x2E, 0x23, 0x1E, 0x15, 0x2E, 0x1B, 0x03, 0x26, 0x37, 0x3B, 0x4B, 0x47, 0x4C,
+    0x3B, 0x37, 0x2D, 0x27, 0x30, 0x31, 0x2B, 0x37, 0x3E, 0x4B, 0x47, 0x51, 0x01, 0x18, 0x18, 0x0F,
+    0x23, 0x1F, 0x32, 0x26, 0x2C, 0x1E, 0x02, 0x04, 0x04, 0x18, 0x19, 0x14, 0x1C, 0x01, 0x00, 0x2E,
+    0x2D, 0x37, 0x27, 0x1B, 0x17, 0x01, 0x02, 0x0F, 0x23, 0x1E, 0x00, 0x1B, 0x27, 0x37, 0x36, 0x52,
+    0x36, 0x37, 0x27, 0x03, 0x2E, 0x1F, 0x2B, 0x2D, 0x2D, 0x37, 0x3B, 0x43, 0x4E, 0x16, 0x16, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x03, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x00, 0x02, 0x07, 0x07, 0x05, 0x00,
+    0x2D, 0x2E, 0x24, 0x0F, 0x14, 0x0C, 0x0A, 0x0A, 0x0C, 0x06, 0x11, 0x08, 0x13, 0x18, 0x1A, 0x2A,
+    0x09, 0x23, 0x0F, 0x14, 0x1D, 0x13, 0x04, 0x01, 0x18, 0x19, 0x0F, 0x23, 0x09, 0x35, 0x3E, 0x32,
+    0x09, 0x23, 0x17, 0x17, 0x23, 0x1F, 0x1B, 0x1B, 0x09, 0x35, 0x3E, 0x4C, 0x18, 0x12, 0x35, 0x00,
+    0x03, 0x1B, 0x27, 0x09, 0x3B, 0x00, 0x2B, 0x05, 0x1D, 0x04, 0x1C, 0x12, 0x14, 0x02, 0x17, 0x1B,
+    0x25, 0x35, 0x1F, 0x2A, 0x17, 0x10, 0x19, 0x01, 0x15, 0x17, 0x00, 0x1B, 0x1F, 0x32, 0x44, 0x4B,
+    0x3E, 0x32, 0x1F, 0x2C, 0x1B, 0x09, 0x30, 0x25, 0x27, 0x35, 0x31, 0x3A, 0x47, 0x22, 0x02, 0x10,
+    0x1A, 0x24, 0x6C, 0x00, 0x04, 0x19, 0x10, 0x0F, 0x10, 0x74, 0x00, 0x1D, 0x32, 0x44, 0x2B, 0x2D,
+    0x09, 0x24, 0x1E, 0x00, 0x2E, 0x2C, 0x09, 0x2D, 0x37, 0x3E, 0x40, 0x48, 0x4B, 0x3E, 0x2B, 0x2D,
+    0x27, 0x30, 0x39, 0x32, 0x2B, 0x31, 0x40, 0x4A, 0x45, 0x94, 0x00, 0x37, 0x15, 0x2E, 0x30, 0x31,
+    0x37, 0x26, 0x1A, 0x0F, 0x1A, 0x1E, 0x17, 0x23, 0x03, 0x27, 0x32, 0x39, 0x42, 0x31, 0x37, 0x2B,
+    0x09, 0x2A, 0x2A, 0x25, 0x1F, 0x2D, 0x3C, 0x3E, 0x40, 0x43, 0x4E, 0x3D, 0x40, 0x44, 0x2B, 0x35,
+    0x2B, 0x3B, 0x39, 0x31, 0x36, 0x43, 0x50, 0x58, 0x00, 0x22, 0x1A, 0x15, 0x03, 0x30, 0x31, 0x3C,
+    0x26, 0x2E, 0x22, 0xD0, 0x00, 0x79, 0x25, 0x35, 0x39, 0x42, 0x31, 0x2B, 0x26, 0x24, 0x1B, 0x25,
+    0x1F, 0x26, 0x2B, 0x44, 0x40, 0x52, 0x4E, 0x3D, 0x46, 0x31, 0x2B, 0x35, 0x37, 0x3B, 0x31, 0x31,
+    0x36, 0x43, 0x50, 0x58, 0x17, 0x10, 0x01, 0x17, 0x2A, 0x27, 0x3C, 0x32, 0x1F, 0x24, 0x22, 0x02,
+    0x19, 0x0F, 0x22, 0x10, 0x0F, 0x00, 0x2C, 0x27, 0x2B, 0x44, 0x32, 0x25, 0x2C, 0x15, 0x1E, 0x15,
+    0x03, 0x2C, 0x2E, 0x27, 0x2B, 0x3E, 0x3A, 0x47, 0x4B, 0x3E, 0x2B, 0x26, 0x27, 0x35, 0x44, 0x37,
+    0x37, 0x44, 0x3A, 0x48, 0x51, 0x10, 0x14, 0x14, 0x02, 0x1E, 0x2E, 0x30, 0x27, 0x2A, 0x22, 0x18,
+    0x12, 0x05, 0x18, 0x19, 0x04, 0x14, 0x02, 0x17, 0x2C, 0x26, 0x2B, 0x25, 0x24, 0x1A, 0x10, 0x02,
+    0x22, 0x24, 0x1E, 0x00, 0x2A, 0x1F, 0x2B, 0x3B, 0x43, 0x36, 0x2B, 0x25, 0x2E, 0x2E, 0x25, 0x4C,
+    0x01, 0x03, 0x32, 0x3E, 0x4C, 0x03, 0x00, 0x00, 0x4D, 0x01, 0x00, 0x00, 0x63, 0x0C, 0x0C, 0x1D,
+    0x19, 0x1E, 0x2E, 0x2A, 0x22, 0x14, 0x06, 0x11, 0x08, 0x1D, 0x05, 0x0C, 0x0C, 0x1D, 0x19, 0x17,
+    0x2C, 0x25, 0x2A, 0x22, 0x18, 0x12, 0x12, 0x18, 0x17, 0x10, 0x10, 0x1A, 0x24, 0x25, 0x37, 0x42,
+    0x37, 0x25, 0x2A, 0x15, 0x15, 0x2C, 0x26, 0x03, 0x2E, 0x25, 0x32, 0x3B, 0x52, 0x02, 0x04, 0x04,
+    0x19, 0x1A, 0x1B, 0x26, 0x1F, 0x24, 0x22, 0x18, 0x12, 0x05, 0x18, 0x19, 0x14, 0x1C, 0x10, 0x1E,
+    0x2C, 0x27, 0x2B, 0x25, 0x1B, 0x1E, 0x0F, 0x01, 0x1A, 0x2A, 0x15, 0x23, 0x2C, 0x27, 0x2B, 0x3B,
+    0x43, 0x3B, 0x2B, 0x27, 0x03, 0x03, 0x27, 0x37, 0x2D, 0x26, 0x32, 0x3E, 0x4B, 0x50, 0x1A, 0x10,
+    0x66, 0x00, 0x3D, 0x1F, 0x2B, 0x35, 0x09, 0x24, 0x10, 0x02, 0x0F, 0x1A, 0x0F, 0x1A, 0x23, 0x2E,
+    0x26, 0x2B, 0x3E, 0x37, 0x2D, 0x09, 0x2A, 0x15, 0x24, 0x1F, 0x03, 0x1F, 0x30, 0x3C, 0x3B, 0x4B,
+    0x47, 0x4C, 0x3B, 0x37, 0x30, 0x2D, 0x32, 0x3E, 0x37, 0x37, 0x44, 0x40, 0x48, 0x51, 0x00, 0x22,
+    0x22, 0x00, 0x2C, 0x2D, 0x39, 0x37, 0x26, 0x22, 0x0F, 0x17, 0x15, 0x1E, 0x23, 0x2E, 0x27, 0x35,
+    0xA9, 0x00, 0x04, 0x1B, 0x2C, 0x26, 0x25, 0xB1, 0x00, 0x01, 0x52, 0xB6, 0x00, 0x06, 0x37, 0x32,
+    0x3C, 0x42, 0x31, 0x44, 0xBF, 0x00, 0x1B, 0x56, 0x00, 0x22, 0x22, 0x1E, 0x2C, 0x26, 0x39, 0x37,
+    0x27, 0x1B, 0x0F, 0x01, 0x17, 0x00, 0x17, 0x00, 0x1F, 0x30, 0x39, 0x42, 0x39, 0x32, 0x27, 0x2A,
+    0x2C, 0x26, 0xDE, 0x00, 0x04, 0x46, 0x52, 0x4E, 0x52, 0xE5, 0x00, 0x03, 0x32, 0x3C, 0x42, 0xEB,
+    0x00, 0x65, 0x4C, 0x50, 0x58, 0x1A, 0x02, 0x02, 0x22, 0x23, 0x1F, 0x2B, 0x30, 0x03, 0x15, 0x0F,
+    0x19, 0x18, 0x01, 0x22, 0x10, 0x01, 0x17, 0x2A, 0x25, 0x32, 0x44, 0x35, 0x1F, 0x2A, 0x00, 0x1E,
+    0x23, 0x09, 0x2C, 0x2E, 0x25, 0x32, 0x44, 0x3A, 0x47, 0x3A, 0x44, 0x32, 0x26, 0x26, 0x32, 0x3E,
+    0x37, 0x2B, 0x31, 0x46, 0x4A, 0x53, 0x02, 0x04, 0x12, 0x18, 0x1A, 0x1B, 0x26, 0x1F, 0x23, 0x01,
+    0x14, 0x1D, 0x05, 0x1C, 0x19, 0x04, 0x04, 0x18, 0x1A, 0x2A, 0x27, 0x32, 0x1F, 0x23, 0x22, 0x02,
+    0x02, 0x22, 0x2A, 0x1E, 0x1E, 0x24, 0x09, 0x32, 0x3B, 0x43, 0x3B, 0x32, 0x1F, 0x2E, 0x2E, 0x27,
+    0x37, 0x2D, 0x26, 0x35, 0x44, 0x4B, 0x50, 0x03, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x33, 0x13,
+    0x06, 0x05, 0x19, 0x00, 0x09, 0x2C, 0x17, 0x1C, 0x13, 0x07, 0x0C, 0x12, 0x14, 0x13, 0x13, 0x12,
+    0x02, 0x00, 0x03, 0x2D, 0x2C, 0x17, 0x02, 0x1C, 0x1C, 0x01, 0x23, 0x1A, 0x22, 0x1E, 0x1B, 0x26,
+    0x39, 0x40, 0x39, 0x26, 0x2C, 0x24, 0x2A, 0x1F, 0x35, 0x25, 0x09, 0x27, 0x37, 0x42, 0x4A, 0x01,
+    0x1C, 0x14, 0x36, 0x00, 0x2F, 0x2D, 0x27, 0x2A, 0x22, 0x18, 0x04, 0x04, 0x02, 0x01, 0x18, 0x19,
+    0x01, 0x00, 0x2E, 0x2D, 0x3C, 0x26, 0x2C, 0x15, 0x1A, 0x22, 0x00, 0x03, 0x24, 0x2A, 0x03, 0x26,
+    0x3C, 0x42, 0x3D, 0x42, 0x3C, 0x2D, 0x1F, 0x1F, 0x30, 0x31, 0x35, 0x30, 0x37, 0x3B, 0x43, 0x4E,
+    0x1E, 0x01, 0x10, 0x22, 0x6C, 0x00, 0x05, 0x10, 0x1A, 0x00, 0x22, 0x17, 0x74, 0x00, 0x2A, 0x37,
+    0x3B, 0x37, 0x2D, 0x1F, 0x1B, 0x24, 0x1B, 0x26, 0x1F, 0x25, 0x35, 0x39, 0x36, 0x4C, 0x50, 0x43,
+    0x36, 0x3C, 0x35, 0x35, 0x3C, 0x36, 0x39, 0x39, 0x3E, 0x3A, 0x47, 0x49, 0x15, 0x22, 0x22, 0x1E,
+    0x1B, 0x26, 0x39, 0x37, 0x27, 0x22, 0x0F, 0x1E, 0x23, 0xA1, 0x00, 0x04, 0x25, 0x35, 0x31, 0x46,
+    0xA9, 0x00, 0x05, 0x2C, 0x03, 0x30, 0x26, 0x30, 0xB1, 0x00, 0x02, 0x3D, 0x4D, 0xB7, 0x00, 0x04,
+    0x37, 0x31, 0x46, 0x3E, 0xC1, 0x00, 0x1D, 0x0F, 0x01, 0x17, 0x2A, 0x27, 0x3C, 0x2B, 0x25, 0x2A,
+    0x01, 0x01, 0x17, 0x15, 0x17, 0x1E, 0x09, 0x2D, 0x39, 0x36, 0x39, 0x35, 0x25, 0x2A, 0x2E, 0x2D,
+    0x25, 0x26, 0x32, 0x31, 0xE2, 0x00, 0x36, 0x42, 0x39, 0x2B, 0x32, 0x39, 0x46, 0x44, 0x31, 0x3B,
+    0x4B, 0x41, 0x58, 0x1A, 0x19, 0x18, 0x10, 0x00, 0x03, 0x35, 0x2D, 0x2C, 0x1E, 0x10, 0x1C, 0x18,
+    0x01, 0x1A, 0x10, 0x10, 0x1A, 0x23, 0x09, 0x35, 0x31, 0x30, 0x09, 0x24, 0x1E, 0x1E, 0x23, 0x1F,
+    0x2C, 0x2C, 0x1F, 0x35, 0x31, 0x3A, 0x48, 0x40, 0x31, 0x35, 0x26, 0x26, 0x2B, 0x1B, 0x01, 0x20,
+    0x39, 0x42, 0x3D, 0x53, 0x02, 0x12, 0x05, 0x14, 0x01, 0x24, 0x25, 0x09, 0x00, 0x02, 0x12, 0x13,
+    0x1D, 0x1C, 0x19, 0x12, 0x12, 0x1C, 0x0F, 0x24, 0x25, 0x35, 0x03, 0x15, 0x0F, 0x19, 0x02, 0x1A,
+    0x3E, 0x01, 0x09, 0x23, 0x03, 0x35, 0x3E, 0x4C, 0x3E, 0x35, 0x09, 0x2C, 0x4B, 0x01, 0x05, 0x27,
+    0x30, 0x31, 0x3A, 0x41, 0x03, 0x00, 0x00, 0x4F, 0x01, 0x00, 0x00, 0xA3, 0x05, 0x13, 0x12, 0x02,
+    0x15, 0x1F, 0x03, 0x1E, 0x19, 0x05, 0x06, 0x13, 0x1C, 0x02, 0x12, 0x05, 0x14, 0x01, 0x15, 0x1F,
+    0x35, 0x03, 0x00, 0x01, 0x19, 0x02, 0x17, 0x1B, 0x00, 0x1E, 0x15, 0x2E, 0x30, 0x3E, 0x4C, 0x44,
+    0x30, 0x09, 0x2C, 0x2E, 0x26, 0x3C, 0x2D, 0x27, 0x2D, 0x39, 0x40, 0x47, 0x22, 0x18, 0x1C, 0x02,
+    0x17, 0x2C, 0x30, 0x26, 0x1B, 0x1A, 0x19, 0x14, 0x1C, 0x0F, 0x1A, 0x10, 0x02, 0x0F, 0x15, 0x03,
+    0x35, 0x31, 0x2D, 0x03, 0x23, 0x1E, 0x1E, 0x24, 0x25, 0x2C, 0x2C, 0x09, 0x30, 0x31, 0x40, 0x48,
+    0x40, 0x39, 0x30, 0x27, 0x26, 0x37, 0x3B, 0x37, 0x32, 0x3C, 0x36, 0x52, 0x45, 0x00, 0x0F, 0x10,
+    0x22, 0x23, 0x1F, 0x37, 0x32, 0x09, 0x23, 0x01, 0x01, 0x1E, 0x23, 0x17, 0x1E, 0x24, 0x03, 0x26,
+    0x3C, 0x36, 0x3C, 0x30, 0x25, 0x2C, 0x1B, 0x03, 0x30, 0x27, 0x27, 0x35, 0x39, 0x42, 0x52, 0x4E,
+    0x43, 0x36, 0x39, 0x2B, 0x2B, 0x44, 0x40, 0x44, 0x31, 0x3B, 0x4B, 0x47, 0x58, 0x23, 0x22, 0x0F,
+    0x17, 0x2A, 0x27, 0x3C, 0x37, 0x25, 0x22, 0x22, 0x00, 0x2A, 0x00, 0x23, 0x2C, 0x1F, 0x30, 0xA6,
+    0x00, 0x07, 0x2B, 0x32, 0x09, 0x2E, 0x1F, 0x32, 0x2D, 0xB2, 0x00, 0x01, 0x45, 0xB6, 0x00, 0x08,
+    0x3C, 0x3C, 0x3E, 0x3A, 0x3B, 0x3E, 0x36, 0x4C, 0xC2, 0x00, 0x26, 0x10, 0x22, 0x23, 0x1F, 0x37,
+    0x32, 0x09, 0x23, 0x01, 0x01, 0x1E, 0x23, 0x17, 0x1E, 0x2E, 0x26, 0x3C, 0x36, 0x3C, 0x30, 0x25,
+    0x2A, 0x03, 0x30, 0x27, 0x27, 0x35, 0x39, 0x42, 0x52, 0x4E, 0x43, 0x36, 0x39, 0x2B, 0x2B, 0x44,
+    0x40, 0xEC, 0x00, 0x64, 0x47, 0x58, 0x22, 0x18, 0x1C, 0x02, 0x17, 0x2C, 0x30, 0x26, 0x2A, 0x1A,
+    0x19, 0x14, 0x1C, 0x0F, 0x1A, 0x02, 0x02, 0x0F, 0x15, 0x03, 0x30, 0x39, 0x2D, 0x2E, 0x23, 0x1E,
+    0x1E, 0x24, 0x25, 0x2C, 0x2C, 0x09, 0x2D, 0x39, 0x40, 0x48, 0x46, 0x39, 0x30, 0x27, 0x26, 0x2B,
+    0x3B, 0x37, 0x32, 0x3C, 0x36, 0x52, 0x45, 0x19, 0x05, 0x13, 0x12, 0x02, 0x00, 0x1F, 0x2E, 0x1E,
+    0x19, 0x1D, 0x06, 0x13, 0x1C, 0x02, 0x12, 0x05, 0x14, 0x01, 0x15, 0x1F, 0x35, 0x2E, 0x00, 0x01,
+    0x19, 0x02, 0x17, 0x1B, 0x00, 0x17, 0x15, 0x2E, 0x30, 0x3E, 0x4B, 0x44, 0x2D, 0x03, 0x2C, 0x2E,
+    0x26, 0x3C, 0x26, 0x27, 0x2D, 0x3C, 0x40, 0x47, 0x03, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x33,
+    0x14, 0x05, 0x04, 0x10, 0x23, 0x25, 0x09, 0x00, 0x02, 0x12, 0x1D, 0x12, 0x10, 0x0F, 0x1C, 0x04,
+    0x18, 0x0F, 0x24, 0x27, 0x2B, 0x1F, 0x23, 0x22, 0x01, 0x0F, 0x23, 0x09, 0x24, 0x15, 0x2A, 0x09,
+    0x32, 0x36, 0x52, 0x3B, 0x35, 0x25, 0x03, 0x25, 0x32, 0x44, 0x32, 0x2D, 0x35, 0x31, 0x4B, 0x50,
+    0x1E, 0x02, 0x18, 0x36, 0x00, 0x2E, 0x35, 0x2D, 0x1B, 0x17, 0x02, 0x18, 0x19, 0x1A, 0x00, 0x0F,
+    0x01, 0x1A, 0x23, 0x09, 0x32, 0x44, 0x35, 0x09, 0x2A, 0x15, 0x15, 0x2E, 0x2D, 0x09, 0x03, 0x25,
+    0x35, 0x44, 0x4B, 0x41, 0x3A, 0x31, 0x32, 0x2D, 0x35, 0x31, 0x46, 0x39, 0x37, 0x39, 0x42, 0x3D,
+    0x51, 0x23, 0x22, 0x01, 0x68, 0x00, 0x0E, 0x2B, 0x1F, 0x23, 0x01, 0x0F, 0x15, 0x2A, 0x00, 0x00,
+    0x24, 0x03, 0x2D, 0x39, 0x42, 0x79, 0x00, 0x20, 0x2E, 0x2C, 0x25, 0x2B, 0x2D, 0x2D, 0x32, 0x31,
+    0x46, 0x3D, 0x4D, 0x52, 0x42, 0x31, 0x37, 0x3C, 0x3B, 0x4B, 0x3B, 0x44, 0x3B, 0x4B, 0x41, 0x56,
+    0x24, 0x1A, 0x0F, 0x1A, 0x24, 0x25, 0x37, 0x2B, 0x9C, 0x00, 0x03, 0x23, 0x1B, 0x15, 0xA8, 0x00,
+    0x06, 0x1F, 0x03, 0x27, 0x37, 0x30, 0x35, 0xB1, 0x00, 0x0A, 0x4A, 0x45, 0x3D, 0x46, 0x44, 0x3C,
+    0x39, 0x36, 0x4C, 0x36, 0xC0, 0x00, 0x1A, 0x15, 0x01, 0x02, 0x0F, 0x00, 0x03, 0x32, 0x35, 0x03,
+    0x15, 0x10, 0x01, 0x1E, 0x24, 0x17, 0x17, 0x2C, 0x27, 0x37, 0x36, 0x37, 0x2D, 0x1F, 0x1B, 0x09,
+    0x32, 0xDD, 0x00, 0x3B, 0x3C, 0x36, 0x43, 0x4E, 0x43, 0x3B, 0x3C, 0x32, 0x2B, 0x3E, 0x3A, 0x44,
+    0x39, 0x3E, 0x40, 0x48, 0x49, 0x22, 0x18, 0x14, 0x18, 0x22, 0x2A, 0x26, 0x25, 0x24, 0x0F, 0x18,
+    0x04, 0x1C, 0x0F, 0x17, 0x02, 0x19, 0x01, 0x1E, 0x2C, 0x30, 0x39, 0x26, 0x2C, 0x15, 0x17, 0x1E,
+    0x2A, 0x27, 0x2C, 0x1B, 0x03, 0x26, 0x3C, 0x40, 0x4A, 0x42, 0x3C, 0x2D, 0x27, 0x26, 0x37, 0x1B,
+    0x01, 0x10, 0x37, 0x3B, 0x43, 0x4D, 0x19, 0x1D, 0x06, 0x1D, 0x18, 0x1E, 0x03, 0x2C, 0x1A, 0x1C,
+    0x13, 0x0C, 0x2F, 0x01, 0x09, 0x1D, 0x04, 0x02, 0x00, 0x09, 0x30, 0x2C, 0x1E, 0x10, 0x3B, 0x01,
+    0x15, 0x2C, 0x00, 0x17, 0x00, 0x2C, 0x2D, 0x44, 0x4B, 0x31, 0x26, 0x03, 0x1B, 0x2E, 0x2D, 0x3C,
+    0x26, 0x25, 0x26, 0x37, 0x46, 0x48, 0x03, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x63, 0x18, 0x04,
+    0x1C, 0x01, 0x24, 0x27, 0x25, 0x23, 0x01, 0x14, 0x12, 0x1C, 0x22, 0x1E, 0x02, 0x18, 0x02, 0x1A,
+    0x1B, 0x2D, 0x39, 0x27, 0x2A, 0x17, 0x22, 0x1E, 0x1B, 0x26, 0x2C, 0x2A, 0x2C, 0x25, 0x37, 0x40,
+    0x4A, 0x42, 0x2B, 0x26, 0x25, 0x2D, 0x39, 0x42, 0x37, 0x32, 0x2B, 0x3E, 0x4C, 0x4D, 0x15, 0x01,
+    0x19, 0x10, 0x1E, 0x2E, 0x35, 0x30, 0x2C, 0x1E, 0x10, 0x19, 0x01, 0x00, 0x2A, 0x1A, 0x22, 0x17,
+    0x24, 0x1F, 0x37, 0x3B, 0x32, 0x1F, 0x1B, 0x24, 0x2A, 0x1F, 0x2B, 0x27, 0x1F, 0x27, 0x32, 0x3B,
+    0x43, 0x50, 0x4B, 0x3E, 0x2B, 0x35, 0x2B, 0x3B, 0x4B, 0x3E, 0x39, 0x44, 0x46, 0x48, 0x49, 0x2A,
+    0x1A, 0x6B, 0x00, 0x23, 0x0F, 0x1A, 0x24, 0x2E, 0x15, 0x15, 0x2A, 0x03, 0x2D, 0x31, 0x46, 0x39,
+    0x35, 0x27, 0x03, 0x03, 0x26, 0x39, 0x30, 0x30, 0x2B, 0x31, 0x46, 0x4A, 0x45, 0x3D, 0x42, 0x31,
+    0x3C, 0x31, 0x46, 0x43, 0x36, 0x3E, 0x36, 0x91, 0x00, 0x1F, 0x2A, 0x1A, 0x0F, 0x22, 0x23, 0x1F,
+    0x37, 0x2B, 0x1F, 0x22, 0x1A, 0x24, 0x2E, 0x23, 0x23, 0x1B, 0x09, 0x30, 0x31, 0x40, 0x31, 0x32,
+    0x32, 0x1F, 0x09, 0x26, 0x39, 0x35, 0x35, 0x37, 0x44, 0xB6, 0x00, 0x04, 0x39, 0x31, 0x46, 0x43,
+    0xBD, 0x00, 0x02, 0x4B, 0x41, 0xC3, 0x00, 0x24, 0x10, 0x1E, 0x2E, 0x35, 0x30, 0x2E, 0x00, 0x02,
+    0x01, 0x00, 0x2A, 0x17, 0x17, 0x1B, 0x25, 0x37, 0x3B, 0x2B, 0x26, 0x09, 0x1B, 0x1F, 0x2B, 0x26,
+    0x27, 0x30, 0x37, 0x3B, 0x43, 0x50, 0x4C, 0x3E, 0x37, 0x32, 0x37, 0x3B, 0xEA, 0x00, 0x11, 0x44,
+    0x46, 0x4A, 0x49, 0x22, 0x1C, 0x12, 0x14, 0x01, 0x23, 0x25, 0x1F, 0x15, 0x01, 0x14, 0x12, 0x14,
+    0xFF, 0x00, 0x3D, 0x10, 0x17, 0x1B, 0x2D, 0x3C, 0x27, 0x1B, 0x00, 0x17, 0x1E, 0x1B, 0x26, 0x2E,
+    0x1B, 0x2E, 0x27, 0x37, 0x46, 0x3D, 0x36, 0x2B, 0x26, 0x25, 0x26, 0x3C, 0x36, 0x37, 0x35, 0x2B,
+    0x44, 0x4B, 0x4E, 0x19, 0x1D, 0x0C, 0x13, 0x14, 0x1A, 0x2C, 0x1B, 0x22, 0x04, 0x06, 0x07, 0x13,
+    0x18, 0x10, 0x12, 0x1D, 0x12, 0x19, 0x1E, 0x03, 0x30, 0x2C, 0x17, 0x02, 0x18, 0x10, 0x1E, 0x2E,
+    0x3F, 0x01, 0x11, 0x1B, 0x26, 0x31, 0x3A, 0x39, 0x27, 0x2E, 0x1B, 0x03, 0x30, 0x39, 0x26, 0x1F,
+    0x27, 0x2B, 0x36, 0x4A, 0x03, 0x00, 0x00, 0x4E, 0x01, 0x00, 0x00, 0x64, 0x02, 0x1C, 0x18, 0x22,
+    0x2A, 0x2D, 0x26, 0x24, 0x0F, 0x18, 0x1C, 0x02, 0x1E, 0x24, 0x22, 0x10, 0x01, 0x1E, 0x2E, 0x32,
+    0x44, 0x2D, 0x2C, 0x15, 0x1E, 0x23, 0x1F, 0x32, 0x1F, 0x2E, 0x03, 0x26, 0x39, 0x4B, 0x47, 0x40,
+    0x3C, 0x30, 0x2D, 0x32, 0x3B, 0x3A, 0x31, 0x37, 0x3C, 0x3B, 0x52, 0x53, 0x2A, 0x22, 0x10, 0x01,
+    0x1E, 0x03, 0x32, 0x32, 0x2E, 0x00, 0x0F, 0x10, 0x22, 0x24, 0x2E, 0x00, 0x17, 0x1E, 0x2A, 0x27,
+    0x3C, 0x42, 0x2B, 0x25, 0x2E, 0x1B, 0x2E, 0x26, 0x39, 0x2D, 0x27, 0x2D, 0x37, 0x36, 0x3D, 0x4D,
+    0x43, 0x3B, 0x3C, 0x2B, 0x39, 0x46, 0x52, 0x36, 0x44, 0x3E, 0x40, 0x48, 0x58, 0x1B, 0x17, 0x0F,
+    0x68, 0x00, 0x09, 0x37, 0x1F, 0x24, 0x22, 0x17, 0x1B, 0x09, 0x24, 0x23, 0x74, 0x00, 0x19, 0x44,
+    0x40, 0x31, 0x35, 0x27, 0x09, 0x1F, 0x35, 0x44, 0x32, 0x35, 0x2B, 0x44, 0x40, 0x48, 0x53, 0x3D,
+    0x46, 0x44, 0x39, 0x44, 0x3A, 0x3D, 0x46, 0x3B, 0x90, 0x00, 0x1D, 0x55, 0x1B, 0x1A, 0x01, 0x22,
+    0x15, 0x09, 0x2B, 0x2B, 0x09, 0x22, 0x17, 0x2A, 0x03, 0x24, 0x23, 0x1B, 0x03, 0x2D, 0x31, 0x40,
+    0x39, 0x32, 0x35, 0x1F, 0x1F, 0x30, 0x44, 0x32, 0xB0, 0x00, 0x0B, 0x46, 0x4A, 0x45, 0x52, 0x42,
+    0x44, 0x39, 0x44, 0x40, 0x52, 0x42, 0xC2, 0x00, 0x1C, 0x19, 0x02, 0x1A, 0x1B, 0x30, 0x2D, 0x2C,
+    0x17, 0x02, 0x01, 0x15, 0x1B, 0x1E, 0x1A, 0x2A, 0x1F, 0x2B, 0x3B, 0x32, 0x27, 0x03, 0x2C, 0x25,
+    0x37, 0x26, 0x27, 0x2D, 0x2B, 0xE1, 0x00, 0x02, 0x4B, 0x44, 0xE6, 0x00, 0x44, 0x36, 0x4B, 0x3E,
+    0x39, 0x31, 0x42, 0x3D, 0x51, 0x22, 0x1C, 0x05, 0x04, 0x02, 0x00, 0x1F, 0x09, 0x00, 0x02, 0x04,
+    0x12, 0x14, 0x22, 0x1E, 0x10, 0x18, 0x02, 0x1A, 0x2A, 0x26, 0x3C, 0x25, 0x2A, 0x1E, 0x1A, 0x1E,
+    0x2C, 0x2D, 0x2E, 0x1B, 0x2C, 0x25, 0x2B, 0x42, 0x52, 0x3B, 0x32, 0x27, 0x25, 0x2D, 0x39, 0x36,
+    0x2B, 0x30, 0x35, 0x31, 0x3A, 0x50, 0x19, 0x1D, 0x07, 0x0C, 0x04, 0x0F, 0x1B, 0x2A, 0x01, 0x12,
+    0x0C, 0x2D, 0x01, 0x0A, 0x01, 0x04, 0x1D, 0x05, 0x18, 0x17, 0x03, 0x2D, 0x1B, 0x1A, 0x3A, 0x01,
+    0x0F, 0x15, 0x03, 0x15, 0x17, 0x1E, 0x2A, 0x27, 0x31, 0x40, 0x3C, 0x25, 0x2C, 0x1B, 0x03, 0x35,
+    0x4C, 0x01, 0x04, 0x25, 0x35, 0x3B, 0x3D, 0x03, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x65, 0x0F,
+    0x19, 0x02, 0x1A, 0x1B, 0x30, 0x30, 0x1B, 0x1A, 0x02, 0x19, 0x0F, 0x24, 0x2E, 0x1E, 0x0F, 0x22,
+    0x15, 0x09, 0x37, 0x36, 0x35, 0x03, 0x24, 0x23, 0x2C, 0x2D, 0x39, 0x26, 0x1F, 0x25, 0x35, 0x3E,
+    0x43, 0x50, 0x3A, 0x31, 0x32, 0x35, 0x3C, 0x46, 0x43, 0x3B, 0x39, 0x31, 0x42, 0x3D, 0x51, 0x2C,
+    0x17, 0x01, 0x0F, 0x00, 0x03, 0x2B, 0x2B, 0x03, 0x15, 0x22, 0x0F, 0x17, 0x2C, 0x1F, 0x24, 0x00,
+    0x15, 0x2C, 0x26, 0x31, 0x40, 0x3C, 0x26, 0x03, 0x2E, 0x1F, 0x32, 0x3E, 0x32, 0x2D, 0x30, 0x3C,
+    0x42, 0x4A, 0x45, 0x52, 0x36, 0x39, 0x3C, 0x3E, 0x4B, 0x4A, 0x46, 0x3E, 0x3B, 0x3A, 0x47, 0x56,
+    0x2E, 0x1E, 0x22, 0x1A, 0x6B, 0x00, 0x18, 0x1A, 0x00, 0x2E, 0x25, 0x1B, 0x24, 0x2A, 0x03, 0x30,
+    0x44, 0x3A, 0x31, 0x35, 0x26, 0x1F, 0x27, 0x2B, 0x36, 0x37, 0x32, 0x37, 0x44, 0x40, 0x47, 0x87,
+    0x00, 0x07, 0x31, 0x3B, 0x4C, 0x48, 0x40, 0x36, 0x42, 0x91, 0x00, 0x06, 0x2C, 0x17, 0x01, 0x0F,
+    0x00, 0x03, 0x9C, 0x00, 0x05, 0x2C, 0x1F, 0x2A, 0x23, 0x2A, 0xA6, 0x00, 0x0A, 0x35, 0x30, 0x1F,
+    0x25, 0x32, 0x3E, 0x2B, 0x35, 0x37, 0x31, 0xB5, 0x00, 0x61, 0x31, 0x39, 0x3E, 0x4B, 0x4A, 0x46,
+    0x3E, 0x3B, 0x3A, 0x47, 0x56, 0x23, 0x01, 0x18, 0x19, 0x22, 0x2A, 0x2D, 0x2D, 0x2A, 0x1A, 0x19,
+    0x01, 0x23, 0x2C, 0x1E, 0x1A, 0x24, 0x09, 0x2B, 0x3B, 0x35, 0x1F, 0x2E, 0x2C, 0x26, 0x3C, 0x26,
+    0x25, 0x26, 0x32, 0x3E, 0x4C, 0x41, 0x3A, 0x31, 0x2B, 0x35, 0x37, 0x42, 0x4C, 0x3E, 0x3C, 0x39,
+    0x36, 0x52, 0x53, 0x22, 0x14, 0x1D, 0x05, 0x18, 0x17, 0x03, 0x03, 0x1E, 0x19, 0x12, 0x05, 0x14,
+    0x22, 0x00, 0x10, 0x18, 0x19, 0x22, 0x24, 0x27, 0x37, 0x1F, 0x24, 0x17, 0x1A, 0x00, 0x2E, 0x30,
+    0x2E, 0x2A, 0x1B, 0x1F, 0x32, 0x42, 0x43, 0x3E, 0x35, 0x25, 0x1F, 0x1A, 0x01, 0x23, 0x2D, 0x30,
+    0x3C, 0x46, 0x47, 0x02, 0x13, 0x08, 0x07, 0x05, 0x01, 0x2A, 0x24, 0x10, 0x05, 0x07, 0x08, 0x13,
+    0x19, 0x0F, 0x04, 0x1D, 0x1D, 0x1C, 0x1A, 0x2E, 0x2D, 0x2A, 0x22, 0x19, 0x18, 0x01, 0x23, 0x09,
+    0x23, 0x43, 0x01, 0x03, 0x37, 0x1F, 0x1B, 0x4B, 0x01, 0x05, 0x09, 0x1F, 0x30, 0x3E, 0x52, 0x03,
+    0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xFF, 0x15, 0x22, 0x0F, 0x1A, 0x24, 0x25, 0x24, 0x0F, 0x18,
+    0x04, 0x1C, 0x10, 0x15, 0x0F, 0x14, 0x1D, 0x13, 0x05, 0x18, 0x1A, 0x0F, 0x04, 0x13, 0x0C, 0x06,
+    0x12, 0x10, 0x01, 0x04, 0x13, 0x06, 0x1D, 0x1C, 0x22, 0x15, 0x10, 0x14, 0x12, 0x04, 0x02, 0x1E,
+    0x2E, 0x1E, 0x01, 0x10, 0x0F, 0x15, 0x09, 0x15, 0x10, 0x1C, 0x04, 0x18, 0x0F, 0x24, 0x0F, 0x14,
+    0x1D, 0x06, 0x06, 0x12, 0x10, 0x14, 0x06, 0x08, 0x11, 0x07, 0x1D, 0x18, 0x04, 0x06, 0x11, 0x0A,
+    0x0A, 0x07, 0x05, 0x04, 0x0C, 0x11, 0x0A, 0x08, 0x06, 0x1C, 0x10, 0x12, 0x06, 0x07, 0x0C, 0x05,
+    0x19, 0x1E, 0x19, 0x04, 0x05, 0x14, 0x10, 0x15, 0x0F, 0x14, 0x1D, 0x13, 0x05, 0x18, 0x1A, 0x18,
+    0x1D, 0x07, 0x08, 0x06, 0x14, 0x13, 0x11, 0x0D, 0x0D, 0x0A, 0x07, 0x05, 0x13, 0x11, 0x0D, 0x0D,
+    0x0B, 0x0D, 0x07, 0x06, 0x0A, 0x0B, 0x0B, 0x0D, 0x08, 0x1D, 0x14, 0x06, 0x11, 0x0D, 0x0A, 0x07,
+    0x12, 0x10, 0x12, 0x06, 0x07, 0x13, 0x14, 0x0F, 0x10, 0x12, 0x06, 0x0C, 0x13, 0x04, 0x0F, 0x04,
+    0x06, 0x0A, 0x07, 0x05, 0x07, 0x0D, 0x0B, 0x0D, 0x0D, 0x11, 0x13, 0x0C, 0x0A, 0x0D, 0x07, 0x0B,
+    0x0B, 0x11, 0x08, 0x0B, 0x0E, 0x0B, 0x0B, 0x0A, 0x06, 0x12, 0x07, 0x0D, 0x0B, 0x0B, 0x11, 0x1D,
+    0x18, 0x1D, 0x08, 0x11, 0x07, 0x05, 0x10, 0x01, 0x04, 0x13, 0x06, 0x1D, 0x1C, 0x22, 0x1C, 0x06,
+    0x08, 0x11, 0x0C, 0x04, 0x06, 0x0A, 0x0B, 0x0D, 0x08, 0x1D, 0x06, 0x0A, 0x0B, 0x0B, 0x0B, 0x08,
+    0x0C, 0x0D, 0x0E, 0x0E, 0x0B, 0x11, 0x13, 0x04, 0x0C, 0x0A, 0x0B, 0x0D, 0x08, 0x05, 0x02, 0x05,
+    0x0C, 0x08, 0x06, 0x04, 0x01, 0x1E, 0x02, 0x04, 0x12, 0x14, 0x10, 0x15, 0x10, 0x12, 0x06, 0x07,
+    0x0C, 0x05, 0x19, 0x12, 0x07, 0x0A, 0xFF, 0x00, 0x51, 0x0D, 0x11, 0x06, 0x14, 0x12, 0x07, 0x0D,
+    0x0B, 0x0B, 0x11, 0x1D, 0x05, 0x08, 0x0D, 0x0B, 0x0A, 0x0C, 0x04, 0x02, 0x05, 0x07, 0x11, 0x08,
+    0x13, 0x1C, 0x1A, 0x1C, 0x05, 0x1D, 0x12, 0x19, 0x1E, 0x2E, 0x1E, 0x01, 0x10, 0x0F, 0x15, 0x09,
+    0x15, 0x10, 0x14, 0x05, 0x04, 0x19, 0x1E, 0x10, 0x12, 0x06, 0x07, 0x13, 0x14, 0x0F, 0x10, 0x05,
+    0x07, 0x11, 0x08, 0x1D, 0x18, 0x02, 0x05, 0x0C, 0x08, 0x06, 0x04, 0x01, 0x1E, 0x19, 0x12, 0x1D,
+    0x05, 0x1C, 0x1A, 0x1B, 0x1A, 0x02, 0x18, 0x10, 0x1E, 0x2E,
+};
@@ -0,0 +1,235 @@
+/**
+ * @file animation.c
+ * @brief Flash animation player: decodes palette frames into the draw buffer.
+ */
+
+#include "animation.h"
+#include "board.h"
+#include "common_functions.h"
+#include "SysTick_Delay.h"
+
+static uint16_t read16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint16_t frameDuration(const uint8_t *record) {
+    return read16(record + 1);
+}
+
+static uint16_t frameLength(const uint8_t *record) {
+    return read16(record + 3);
+}
+
+static const uint8_t *nextRecord(const uint8_t *record) {
+    return record + ANIM_FRAME_HEADER_SIZE + frameLength(record);
+}
+
+static uint8_t isKeyframe(const uint8_t *record) {
+    return record[0] == ANIM_FRAME_KEY_RAW || record[0] == ANIM_FRAME_KEY_RLE;
+}
+
+// Check that a frame payload only touches real LEDs and palette entries
+static int frameValid(const uint8_t *record, uint16_t paletteSize) {
+    const uint8_t *payload = record + ANIM_FRAME_HEADER_SIZE;
+    uint16_t length = frameLength(record);
+    uint16_t pos = 0;
+    uint16_t leds = 0;
+
+    switch (record[0]) {
+        case ANIM_FRAME_KEY_RAW:
+            if (length != NUM_LEDS) return 0;
+            for (uint16_t i = 0; i < length; i++) {
+                if (payload[i] >= paletteSize) return 0;
+            }
+            return 1;
+
+        case ANIM_FRAME_KEY_RLE:
+            while (pos < length) {
+                if (length - pos < 2 || payload[pos] == 0 || payload[pos + 1] >= paletteSize) return 0;
+                leds += payload[pos];
+                if (leds > NUM_LEDS) return 0;
+                pos += 2;
+            }
+            return leds == NUM_LEDS;
+
+        case ANIM_FRAME_DELTA_SPANS:
+            while (pos < length) {
+                if (length - pos < 3) return 0;
+                uint16_t start = read16(&payload[pos]);
+                uint8_t count = payload[pos + 2];
+                pos += 3;
+                if (count == 0 || start + count > NUM_LEDS || length - pos < count) return 0;
+                for (uint8_t i = 0; i < count; i++) {
+                    if (payload[pos + i] >= paletteSize) return 0;
+                }
+                pos += count;
+            }
+            return 1;
+    }
+    return 0;
+}
+
+static void writeLed(const animation_player_t *player, uint16_t led, uint8_t index) {
+    const uint8_t *entry = &player->palette[index * 3];
+    rgb_t color;
+    color.g = entry[0];
+    color.r = entry[1];
+    color.b = entry[2];
+    setBufferColor(led, scaleBrightness(color, player->brightness));
+}
+
+// Decode one frame record over the draw buffer
+static void applyFrame(const animation_player_t *player, const uint8_t *record) {
+    const uint8_t *payload = record + ANIM_FRAME_HEADER_SIZE;
+    uint16_t length = frameLength(record);
+    uint16_t pos = 0;
+    uint16_t led = 0;
+
+    switch (record[0]) {
+        case ANIM_FRAME_KEY_RAW:
+            for (led = 0; led < NUM_LEDS; led++) {
+                writeLed(player, led, payload[led]);
+            }
+            break;
+
+        case ANIM_FRAME_KEY_RLE:
+            while (pos < length) {
+                uint8_t count = payload[pos];
+                uint8_t index = payload[pos + 1];
+                for (uint8_t i = 0; i < count; i++) {
+                    writeLed(player, led++, index);
+                }
+                pos += 2;
+            }
+            break;
+
+        case ANIM_FRAME_DELTA_SPANS:
+            while (pos < length) {
+                led = read16(&payload[pos]);
+                uint8_t count = payload[pos + 2];
+                pos += 3;
+                for (uint8_t i = 0; i < count; i++) {
+                    writeLed(player, led++, payload[pos++]);
+                }
+            }
+            break;
+    }
+}
+
+static void seekFirst(animation_player_t *player) {
+    player->frame = 0;
+    player->record = player->frames;
+    player->keyFrame = 0;
+    player->keyRecord = player->frames;
+}
+
+// Step to the next frame, drawing it if the buffer holds the current one
+static void stepFrame(animation_player_t *player, uint8_t draw) {
+    if (player->frame + 1 >= player->frameCount) {
+        if (!(player->flags & ANIM_FLAG_LOOP)) {
+            return; // Hold the last frame
+        }
+        seekFirst(player);
+    } else {
+        player->frame++;
+        player->record = nextRecord(player->record);
+        if (isKeyframe(player->record)) {
+            player->keyFrame = player->frame;
+            player->keyRecord = player->record;
+        }
+    }
+    if (draw) {
+        applyFrame(player, player->record);
+    }
+}
+
+// Rebuild the current frame from scratch: its keyframe, then every delta since
+static void replayFromKey(animation_player_t *player) {
+    const uint8_t *record = player->keyRecord;
+    for (uint16_t f = player->keyFrame; f <= player->frame; f++) {
+        applyFrame(player, record);
+        record = nextRecord(record);
+    }
+}
+
+int Animation_Open(animation_player_t *player, const uint8_t *data) {
+    if (data[0] != 'A' || data[1] != 'N' || data[2] != 'I' || data[3] != 'M') {
+        return 0;
+    }
+
+    uint16_t frameCount = read16(&data[4]);
+    uint16_t ledCount = read16(&data[6]);
+    uint16_t paletteSize = read16(&data[8]);
+    if (frameCount == 0 || ledCount != NUM_LEDS ||
+        paletteSize == 0 || paletteSize > ANIM_PALETTE_MAX) {
+        return 0;
+    }
+
+    const uint8_t *frames = data + ANIM_HEADER_SIZE + paletteSize * 3;
+    const uint8_t *record = frames;
+    if (!isKeyframe(frames)) {
+        return 0;
+    }
+    for (uint16_t f = 0; f < frameCount; f++) {
+        if (!frameValid(record, paletteSize)) {
+            return 0;
+        }
+        record = nextRecord(record);
+    }
+
+    player->data = data;
+    player->palette = data + ANIM_HEADER_SIZE;
+    player->frames = frames;
+    player->frameCount = frameCount;
+    player->paletteSize = paletteSize;
+    player->flags = data[10];
+    player->frame = frameCount; // Nothing drawn yet
+    player->record = frames;
+    player->keyFrame = 0;
+    player->keyRecord = frames;
+    player->frameStartMs = 0;
+    player->generation = 0;
+    player->brightness = 0.0f;
+    return 1;
+}
+
+void Animation_Draw(animation_player_t *player, float brightness) {
+    uint32_t now = SysTick_GetMs();
+    uint8_t replay = player->frame >= player->frameCount ||
+                     brightness != player->brightness ||
+                     drawBufferGeneration() != player->generation;
+
+    player->brightness = brightness;
+
+    if (player->frame >= player->frameCount) {
+        seekFirst(player);
+        player->frameStartMs = now;
+    } else if (frameDuration(player->record) == 0) {
+        stepFrame(player, !replay);
+        player->frameStartMs = now;
+    } else {
+        // Catch up on every frame that has run out, but never spin for
+        // more than one pass through the animation after a long stall
+        uint16_t steps = 0;
+        uint16_t duration = frameDuration(player->record);
+        while (duration != 0 && now - player->frameStartMs >= duration &&
+               !Animation_Finished(player)) {
+            if (++steps > player->frameCount) {
+                player->frameStartMs = now;
+                break;
+            }
+            player->frameStartMs += duration;
+            stepFrame(player, !replay);
+            duration = frameDuration(player->record);
+        }
+    }
+
+    if (replay) {
+        replayFromKey(player);
+    }
+    player->generation = drawBufferGeneration();
+}
+
+uint8_t Animation_Finished(const animation_player_t *player) {
+    return !(player->flags & ANIM_FLAG_LOOP) && player->frame + 1 == player->frameCount;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file animation.h
+ * @brief Playback of precomputed animations stored in flash.
+ *
+ * An animation is one const byte array, laid out little-endian as
+ *
+ *   "ANIM" | frameCount (2) | ledCount (2) | paletteSize (2) | flags | reserved
+ *   paletteSize * GRB
+ *   frameCount * { type | durationMs (2) | length (2) | payload }
+ *
+ * Pixels are palette indices, one byte each, in LED buffer order
+ * (0..NUM_LEDS-1, the same order as testBuffer). Frame 0 must be a
+ * keyframe. Keyframes describe a whole frame; delta frames only list the
+ * LEDs that changed since the frame before.
+ *
+ *   KEY_RAW      NUM_LEDS * index
+ *   KEY_RLE      { count(1..255), index } ... covering exactly NUM_LEDS LEDs
+ *   DELTA_SPANS  { start(2, LE), count(1..255), count * index } ...
+ *
+ * The player decodes from flash into the draw buffer, with the palette
+ * color scaled by the current brightness. The animation is never copied
+ * to RAM, but each frame is held in the draw buffer like a drawn one: it
+ * is not a frame source the device reads as it sends (frame_source.h),
+ * because a delta only lists the LEDs that changed and the frame before
+ * it has to be kept somewhere. The draw buffer is the frame-sized buffer
+ * that already exists, and transitions and the refresh resend from it.
+ * A delta is applied on top of what the buffer holds; if anything else
+ * has drawn since (another pattern, a cleared buffer) or the brightness
+ * changed, the player replays from the last keyframe, which costs up to
+ * the key interval (pack_anim -k) in decoded frames. Animations are
+ * built with anim_pack.h.
+ */
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <stdint.h>
+#include "cube_config.h"
+
+#define ANIM_HEADER_SIZE       12
+#define ANIM_FRAME_HEADER_SIZE 5     // Type, duration, length
+#define ANIM_PALETTE_MAX       256
+#define ANIM_RUN_MAX           255
+
+// Header flags
+#define ANIM_FLAG_LOOP         0x01  // Restart after the last frame (else hold it)
+
+// Frame types
+#define ANIM_FRAME_KEY_RAW     0x01  // Keyframe: one index per LED
+#define ANIM_FRAME_KEY_RLE     0x02  // Keyframe: runs of one index
+#define ANIM_FRAME_DELTA_SPANS 0x03  // Delta: runs of changed LEDs
+
+typedef struct {
+    const uint8_t *data;        // Start of the container
+    const uint8_t *palette;     // paletteSize * GRB
+    const uint8_t *frames;      // First frame record
+    uint16_t frameCount;
+    uint16_t paletteSize;
+    uint8_t flags;
+
+    uint16_t frame;             // Frame in the draw buffer (frameCount = none yet)
+    const uint8_t *record;      // Record of that frame
+    uint16_t keyFrame;          // Last keyframe at or before it
+    const uint8_t *keyRecord;
+    uint32_t frameStartMs;      // When the current frame went up
+    uint32_t generation;        // drawBufferGeneration() after the last draw
+    float brightness;           // Brightness the buffer was drawn with
+} animation_player_t;
+
+/**
+ * @brief Check a container and reset a player to its first frame.
+ * @return 1 if the container is valid for this cube, 0 otherwise.
+ */
+int Animation_Open(animation_player_t *player, const uint8_t *data);
+
+/**
+ * @brief Bring the draw buffer up to the frame due now.
+ *
+ * Advances by each frame's duration; a frame with duration 0 lasts one
+ * call. Only LEDs that change are written unless the player has to
+ * replay from a keyframe.
+ */
+void Animation_Draw(animation_player_t *player, float brightness);
+
+/**
+ * @brief Whether a non-looping animation has reached its last frame.
+ */
+uint8_t Animation_Finished(const animation_player_t *player);
+
+#endif // ANIMATION_H
@@ -5,21 +5,24 @@
  * Centralizes all low-level bring-up:
  *   - System clock (80MHz PLL)
  *   - SysTick delays
- *   - WS2812 data-out pin (SSI0)
+ *   - LED output (SSI0: WS2812 data, or APA102 clock + data)
  *   - User buttons (PF4, PF0)
  *   - Potentiometer analog input (PE3 & AIN0)
+ *   - UART0 frame streaming (PA0/PA1, uDMA)
  *
  * Call Board_Init() once at the start of main().
  */
 
 #include "board.h"
 #include "SysTick_Delay.h"
-#include "WS2812.h"
+#include "led_output.h"
 #include "GPIO.h"
 #include "ADC.h"
 #include <stdint.h>
 #include "TM4C123GH6PM.h"
 #include "Timers.h"
+#include "profiler.h"
+#include "stream.h"
 
 /***************************************************************************
  * PLL_Init  set system clock to 80 MHz using the main 16 MHz crystal
@@ -59,14 +62,20 @@ void Board_Init(void)
     //SysTick for s/ms delays
     SysTick_Init();
 
-    //WS2812 driver (enables SSI0 and PA5)
-		WS2812_Init();
+    //DWT cycle counter for profiling
+    Profiler_Init();
+
+    //LED driver (enables SSI0 and PA5, plus PA2 for APA102)
+		LedOutput_Init();
 
     //Buttons & potentiometer GPIO
     GPIO_Init_ButtonsAndPot();
 
     //ADC sequencer for POT on AIN0
     ADC_Init();
+
+    //UART0 receiver for frames streamed from a PC
+    Stream_Init();
 		
 
 		SYSCTL->RCGCGPIO |= 0x20;  // Enable clock to GPIO Port F (bit 5)
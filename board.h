@@ -6,6 +6,7 @@
 #define BOARD_H
 
 #include "TM4C123GH6PM.h"
+#include "cube_config.h"
 
 // CPU 
 #define SYS_CLOCK      80000000U
@@ -20,10 +21,31 @@
 #define GPIO_PIN_6     (1U<<6)
 #define GPIO_PIN_7     (1U<<7)
 
+// LED chipset the cube is built with
+#define LED_CHIPSET_WS2812   0       // One data line
+#define LED_CHIPSET_APA102   1       // Clock + data (APA102, SK9822)
+#ifndef LED_CHIPSET
+#define LED_CHIPSET    LED_CHIPSET_WS2812
+#endif
+
+// Channel order of one-wire LEDs on the wire. Frame buffers stay GRB; the
+// WS2812 encoders reorder (and split off white) as they build the symbols.
+#define LED_PIXEL_GRB    0       // WS2812, WS2812B
+#define LED_PIXEL_RGB    1       // WS2811 and some clones
+#define LED_PIXEL_GRBW   2       // SK6812 RGBW
+#ifndef LED_PIXEL_FORMAT
+#define LED_PIXEL_FORMAT LED_PIXEL_GRB
+#endif
+#define LED_PIXEL_CHANNELS ((LED_PIXEL_FORMAT == LED_PIXEL_GRBW) ? 4 : 3)
+
 // WS2812 data out (PA5 -> SSI0TX)
 #define WS2812_PORT    GPIO_PORTA_BASE
 #define WS2812_PIN     GPIO_PIN_5
 
+// APA102 clock and data (PA2 -> SSI0Clk, PA5 -> SSI0TX)
+#define APA102_CLK_PIN   GPIO_PIN_2
+#define APA102_DATA_PIN  GPIO_PIN_5
+
 // User buttons on LaunchPad
 #define BUTTON1_PORT   GPIO_PORTF_BASE
 #define BUTTON1_PIN    GPIO_PIN_4    // SW1, active-low
@@ -34,10 +56,6 @@
 #define POT_PORT       GPIO_PORTE_BASE
 #define POT_PIN        GPIO_PIN_3    // AIN0
 
-// Cube dimensions
-#define CUBE_SIZE      7
-#define NUM_LEDS       (CUBE_SIZE * CUBE_SIZE * CUBE_SIZE)
-
 // Prototype for Board_Init if youre using it
 void Board_Init(void);
 
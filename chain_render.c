@@ -0,0 +1,75 @@
+/**
+ * @file chain_render.c
+ * @brief Layer-at-a-time frame source and its fallback into the draw buffer.
+ */
+
+#include "chain_render.h"
+#include "board.h"
+#include "common_functions.h"
+#include <stddef.h>  // For NULL definition
+
+#define LAYER_LEDS  (CUBE_SIZE * CUBE_SIZE)
+
+// The layer the chain is in, filled by the frame's layer function
+static uint8_t slice[LAYER_LEDS * 3];
+static int16_t sliceLayer = -1;     // Chain layer held in slice (-1 = none)
+
+static frame_slice_fn_t pendingSlice = NULL;
+
+static const uint8_t off[3] = {0, 0, 0};
+
+void ChainRender_BeginFrame(frame_slice_fn_t fn) {
+    pendingSlice = fn;
+}
+
+uint8_t ChainRender_FramePending(void) {
+    return pendingSlice != NULL;
+}
+
+frame_slice_fn_t ChainRender_TakeFrame(void) {
+    frame_slice_fn_t fn = pendingSlice;
+    pendingSlice = NULL;
+    return fn;
+}
+
+const uint8_t *ChainRender_Led(const frame_source_t *src, int led) {
+    if (led == 0) {
+        sliceLayer = -1;  // New frame
+    }
+    int16_t chain = bufferLedIndex((uint16_t)led);
+    if (chain < 0) {
+        return off;
+    }
+
+    // Undo LED_MAP_ENTRY: each wiring flag mirrors one coordinate, and a
+    // mirror is its own inverse
+    uint8_t layer = (uint8_t)(chain / LAYER_LEDS);
+    uint8_t row = (uint8_t)((chain / CUBE_SIZE) % CUBE_SIZE);
+    uint8_t run = (uint8_t)(chain % CUBE_SIZE);
+    uint8_t y = LED_MAP_ROW(row);
+    uint8_t z = LED_MAP_RUN(y, run);
+
+    if (layer != sliceLayer) {
+        src->slice(LED_MAP_LAYER(layer), slice);
+        sliceLayer = layer;
+    }
+    return &slice[(y * CUBE_SIZE + z) * 3];
+}
+
+void ChainRender_Resolve(void) {
+    if (pendingSlice == NULL) {
+        return;
+    }
+    frame_slice_fn_t fn = ChainRender_TakeFrame();
+    clearAllLeds(); // Marks the buffer as overwritten for incremental drawers
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        fn(x, slice);
+        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+                const uint8_t *grb = &slice[(y * CUBE_SIZE + z) * 3];
+                setVoxel(x, y, z, (rgb_t){grb[0], grb[1], grb[2]});
+            }
+        }
+    }
+    sliceLayer = -1;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file chain_render.h
+ * @brief Frames computed one x layer at a time, in LED chain order, as they go out.
+ *
+ * The data chain runs through the cube one x layer at a time (led_cube.h),
+ * so a pattern that can work out any voxel on its own (plasma, color
+ * fields) needs no framebuffer. Instead of drawing, it calls
+ * ChainRender_BeginFrame() with a layer function, and the output device
+ * calls that function each time the chain enters a new layer, just before
+ * the layer's LEDs are encoded. Only one layer (CUBE_SIZE^2 GRB values) is
+ * held whatever the cube size, and the first LEDs go out one layer after
+ * the frame starts instead of one whole frame.
+ *
+ * A layer function gets the layer's x and fills its slice with
+ * ChainRender_SetVoxel(); anything that stays the same for the frame
+ * (time step, brightness) is set up in the pattern's update. Devices that
+ * cannot wait while a layer is computed (see led_output_device_t.slices),
+ * transitions and the pattern check get the frame drawn into the draw
+ * buffer by ChainRender_Resolve().
+ */
+#ifndef CHAIN_RENDER_H
+#define CHAIN_RENDER_H
+
+#include <stdint.h>
+#include "led_cube.h"
+#include "frame_source.h"
+
+/**
+ * @brief Make the current frame a computed one (replaces any drawing).
+ * @param slice Function that fills one x layer.
+ */
+void ChainRender_BeginFrame(frame_slice_fn_t slice);
+
+/**
+ * @brief Set voxel (x, y, z) of the layer a slice function is filling.
+ */
+static inline void ChainRender_SetVoxel(uint8_t *slice, uint8_t y, uint8_t z, rgb_t color) {
+    uint8_t *grb = &slice[(y * CUBE_SIZE + z) * 3];
+    grb[0] = color.g;
+    grb[1] = color.r;
+    grb[2] = color.b;
+}
+
+/**
+ * @brief Whether a computed frame has been set up and not yet output.
+ */
+uint8_t ChainRender_FramePending(void);
+
+/**
+ * @brief Hand the pending frame to the output stage.
+ * @return Its layer function.
+ */
+frame_slice_fn_t ChainRender_TakeFrame(void);
+
+/**
+ * @brief Compute a pending frame into the current draw buffer.
+ *
+ * Does nothing if the frame was drawn.
+ */
+void ChainRender_Resolve(void);
+
+#endif // CHAIN_RENDER_H
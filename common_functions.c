@@ -6,19 +6,31 @@
 #include "common_functions.h"
 #include "board.h"
 #include "ADC.h"
+#include "framebuffer.h"
 #include <stdlib.h>
 
-// External declarations for led_map
-extern const uint16_t led_map[CUBE_SIZE][CUBE_SIZE][CUBE_SIZE];
-
 // Global variables
-uint8_t testBuffer[NUM_LEDS * 3] = {0};
+uint8_t testBuffer[NUM_LEDS * 3] __attribute__((aligned(4))) = {0};
 uint8_t currentPattern = 0;
 uint8_t currentPosition = 0;
 
-// Known dead LEDs (0-based buffer indices)
+// Buffer that clearAllLeds/setVoxel draw into (testBuffer unless redirected)
+static uint8_t *drawBuffer = testBuffer;
+
+// Bumped whenever the draw buffer is cleared or swapped
+static uint32_t drawGeneration = 0;
+
+// State of patternRand(); 1 is what rand() starts from without srand()
+static uint32_t patternRandState = 1;
+
+// Known dead LEDs (0-based buffer indices) on the 7x7x7 build
+#if CUBE_SIZE == 7
 static const uint16_t mainDeadLEDs[] = {0, 108, 156, 157, 206, 213, 221};
 static const uint8_t mainNumDeadLEDs = 7;
+#else
+static const uint16_t mainDeadLEDs[] = {0};
+static const uint8_t mainNumDeadLEDs = 0;
+#endif
 
 // Function to check if an LED is in the dead LED list
 static int mainIsDeadLED(uint16_t ledNum) {
@@ -43,8 +55,8 @@ static int countDeadLEDsBefore(uint16_t ledIndex) {
 
 // Read and update brightness from potentiometer
 float updateBrightness(void) {
-    // Read the ADC value from the potentiometer
-    uint16_t rawValue = ADC0_ReadChannel(0);
+    // Filtered pot value kept up to date by the ADC interrupt
+    uint16_t rawValue = ADC_GetPotLevel();
     
     // Convert to a 0.0-1.0 range
     float globalBrightness = (float)rawValue / 4095.0f;
@@ -58,11 +70,28 @@ float updateBrightness(void) {
     return globalBrightness;
 }
 
+// Redirect pattern drawing to another NUM_LEDS * 3 buffer (NULL restores testBuffer)
+void setDrawBuffer(uint8_t *buffer) {
+    drawBuffer = (buffer != NULL) ? buffer : testBuffer;
+    drawGeneration++;
+}
+
+// Lets incremental drawers tell whether the buffer still holds their last frame
+uint32_t drawBufferGeneration(void) {
+    return drawGeneration;
+}
+
 // Set all LEDs to OFF
 void clearAllLeds(void) {
-    for (uint16_t i = 0; i < NUM_LEDS * 3; i++) {
-        testBuffer[i] = 0;
-    }
+    Framebuffer_Clear(drawBuffer, NUM_LEDS * 3);
+    drawGeneration++;
+}
+
+// Dim the previous frame instead of clearing it, so whatever a pattern drew
+// leaves a fading trail (keep = share of each channel kept, of 256)
+void fadeAllLeds(uint8_t keep) {
+    Framebuffer_Scale(drawBuffer, NUM_LEDS * 3, keep);
+    drawGeneration++;
 }
 
 // Set a specific LED to a color - accounting for dead LED shifts
@@ -81,16 +110,59 @@ void setLedColor(uint16_t targetIndex, rgb_t color) {
     uint16_t actualBufferIdx = targetIndex - deadBefore;
     
     if (actualBufferIdx < NUM_LEDS) {
-        testBuffer[actualBufferIdx * 3 + 0] = color.g;  // WS2812 order is GRB
-        testBuffer[actualBufferIdx * 3 + 1] = color.r;
-        testBuffer[actualBufferIdx * 3 + 2] = color.b;
+        drawBuffer[actualBufferIdx * 3 + 0] = color.g;  // WS2812 order is GRB
+        drawBuffer[actualBufferIdx * 3 + 1] = color.r;
+        drawBuffer[actualBufferIdx * 3 + 2] = color.b;
+    }
+}
+
+// Write a color straight into a buffer slot from voxelBufferIndex()
+void setBufferColor(uint16_t bufferIndex, rgb_t color) {
+    if (bufferIndex < NUM_LEDS) {
+        drawBuffer[bufferIndex * 3 + 0] = color.g;
+        drawBuffer[bufferIndex * 3 + 1] = color.r;
+        drawBuffer[bufferIndex * 3 + 2] = color.b;
+    }
+}
+
+// Buffer slot (LED index after dead-LED shift) of a voxel, or -1 if it has none
+int16_t voxelBufferIndex(uint8_t x, uint8_t y, uint8_t z) {
+    if (x >= CUBE_SIZE || y >= CUBE_SIZE || z >= CUBE_SIZE) {
+        return -1;
     }
+    uint16_t led_idx = ledMapIndex(x, y, z);
+    if (led_idx == 0 || led_idx > NUM_LEDS || mainIsDeadLED(led_idx - 1)) {
+        return -1;
+    }
+    return (int16_t)(led_idx - 1 - countDeadLEDsBefore(led_idx - 1));
+}
+
+// Chain position (0-based LED index) of a buffer slot, or -1 if the slot
+// is past the last working LED; the inverse of the dead-LED shift
+int16_t bufferLedIndex(uint16_t bufferIndex) {
+    uint16_t ledIndex = bufferIndex;
+    for (uint8_t i = 0; i < mainNumDeadLEDs; i++) {  // List is in ascending order
+        if (mainDeadLEDs[i] <= ledIndex) {
+            ledIndex++;
+        }
+    }
+    return (ledIndex < NUM_LEDS) ? (int16_t)ledIndex : -1;
+}
+
+void seedPatternRand(uint32_t seed) {
+    patternRandState = seed;
+}
+
+// The LCG of the C standard's sample rand(): 0..PATTERN_RAND_MAX
+uint16_t patternRand(void) {
+    patternRandState = patternRandState * 1103515245U + 12345U;
+    return (uint16_t)((patternRandState >> 16) & PATTERN_RAND_MAX);
 }
 
 // Helper function to set a voxel by coordinates
 void setVoxel(uint8_t x, uint8_t y, uint8_t z, rgb_t color) {
     if (x < CUBE_SIZE && y < CUBE_SIZE && z < CUBE_SIZE) {
-        uint16_t led_idx = led_map[x][y][z];
+        uint16_t led_idx = ledMapIndex(x, y, z);
         if (led_idx > 0 && led_idx <= NUM_LEDS) {
             setLedColor(led_idx - 1, color);  // Convert 1-based to 0-based index
         }
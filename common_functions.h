@@ -21,9 +21,22 @@ extern uint8_t currentPosition;
 
 // Helper functions
 void clearAllLeds(void);
+void fadeAllLeds(uint8_t keep);
 void setVoxel(uint8_t x, uint8_t y, uint8_t z, rgb_t color);
 rgb_t scaleBrightness(rgb_t color, float brightness);
 float updateBrightness(void);
 void setLedColor(uint16_t targetIndex, rgb_t color);
+void setDrawBuffer(uint8_t *buffer);
+uint32_t drawBufferGeneration(void);
+int16_t voxelBufferIndex(uint8_t x, uint8_t y, uint8_t z);
+int16_t bufferLedIndex(uint16_t bufferIndex);
+void setBufferColor(uint16_t bufferIndex, rgb_t color);
+
+// Random numbers for the patterns. Unlike rand(), the sequence is the same
+// with every C library, so a seeded run renders the same frames on the
+// cube and in a host build (see pattern_check.h)
+#define PATTERN_RAND_MAX 0x7FFF
+void seedPatternRand(uint32_t seed);
+uint16_t patternRand(void);
 
 #endif // COMMON_FUNCTIONS_H
\ No newline at end of file
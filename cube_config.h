@@ -0,0 +1,19 @@
+/**
+ * @file cube_config.h
+ * @brief Cube dimensions, shared by the firmware and PC tools.
+ *
+ * Kept free of device headers so that wire and container formats sized
+ * by the cube (stream_protocol.h, animation.h) build on a PC as well.
+ */
+#ifndef CUBE_CONFIG_H
+#define CUBE_CONFIG_H
+
+// Cube dimensions. Patterns scale with CUBE_SIZE; the per-LED buffers
+// (framebuffers, output history, rotation tables) fit 32 KB up to 8.
+#ifndef CUBE_SIZE
+#define CUBE_SIZE      7
+#endif
+#define NUM_LEDS       (CUBE_SIZE * CUBE_SIZE * CUBE_SIZE)
+#define CUBE_CENTER    ((CUBE_SIZE - 1) / 2.0f)   // Middle coordinate on each axis
+
+#endif // CUBE_CONFIG_H
@@ -0,0 +1,30 @@
+/**
+ * @file font5x7.h
+ * @brief 5x7 ASCII bitmap font used by the text scroller.
+ */
+#ifndef FONT5X7_H
+#define FONT5X7_H
+#include <stdint.h>
+
+#define FONT_FIRST_CHAR   32    // ' '
+#define FONT_LAST_CHAR    126   // '~'
+#define FONT_NUM_GLYPHS   (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+#define FONT_WIDTH        5     // columns per glyph
+#define FONT_HEIGHT       7     // rows per glyph
+#define FONT_ADVANCE      (FONT_WIDTH + 1)   // glyph plus one blank column
+
+/**
+ * Glyphs are stored column-major: one byte per column, bit 0 is the top
+ * row and bit 6 the bottom row. Lives in flash.
+ */
+extern const uint8_t font5x7[FONT_NUM_GLYPHS][FONT_WIDTH];
+
+/**
+ * @brief Get one column bitmask of a character.
+ * @param c   ASCII character; anything outside 32..126 renders as a space.
+ * @param col Column 0..FONT_WIDTH-1; FONT_WIDTH is the blank spacing column.
+ * @return 7-bit column mask (bit 0 = top row).
+ */
+uint8_t Font_Column(char c, uint8_t col);
+
+#endif // FONT5X7_H
@@ -0,0 +1,66 @@
+/**
+ * @file frame_source.h
+ * @brief Where an LED driver reads a frame's GRB values from.
+ *
+ * A frame is a plain GRB buffer, a per-LED blend of two GRB buffers
+ * (transitions), palette indices with a GRB palette, or a function that
+ * computes one x layer of the cube at a time (chain_render.h). The drivers
+ * read one LED at a time while they encode, so blended, indexed and
+ * computed frames are never expanded into a buffer of their own.
+ */
+#ifndef FRAME_SOURCE_H
+#define FRAME_SOURCE_H
+
+#include <stdint.h>
+
+#define FRAME_SOURCE_GRB      0   // GRB buffer
+#define FRAME_SOURCE_BLEND    1   // Per-LED mix of two GRB buffers
+#define FRAME_SOURCE_INDEXED  2   // Palette indices and a GRB palette
+#define FRAME_SOURCE_SLICES   3   // Layers computed as the chain reaches them
+
+// Fill slice[(y * CUBE_SIZE + z) * 3] with the GRB values of layer x
+typedef void (*frame_slice_fn_t)(uint8_t x, uint8_t *slice);
+
+typedef struct {
+    uint8_t kind;           // FRAME_SOURCE_*
+    const uint8_t *frame;   // GRB buffer, blend "from" or palette indices
+    const uint8_t *other;   // Blend "to" or the palette
+    const uint8_t *alpha;   // Blend weights
+    frame_slice_fn_t slice; // Layer function
+} frame_source_t;
+
+/**
+ * @brief GRB values of one LED of a FRAME_SOURCE_SLICES frame (chain_render.c).
+ *
+ * LEDs must be read in order from 0; a new layer is computed when the
+ * chain enters it.
+ */
+const uint8_t *ChainRender_Led(const frame_source_t *src, int led);
+
+/**
+ * @brief GRB values of one LED.
+ * @param mixed Scratch for a blended LED's values (3 bytes).
+ * @return Pointer to the LED's three channels.
+ */
+static inline const uint8_t *FrameSource_Led(const frame_source_t *src, int led, uint8_t *mixed) {
+    switch (src->kind) {
+        case FRAME_SOURCE_BLEND: {
+            // Map 0..255 onto 0..256 so alpha 255 gives exactly "to"
+            uint16_t a = src->alpha[led] + (src->alpha[led] >> 7);
+            const uint8_t *from = &src->frame[led * 3];
+            const uint8_t *to = &src->other[led * 3];
+            for (int c = 0; c < 3; ++c) {
+                mixed[c] = (uint8_t)((uint16_t)(from[c] * (256 - a) + to[c] * a) >> 8);
+            }
+            return mixed;
+        }
+        case FRAME_SOURCE_INDEXED:
+            return &src->other[src->frame[led] * 3];
+        case FRAME_SOURCE_SLICES:
+            return ChainRender_Led(src, led);
+        default:
+            return &src->frame[led * 3];
+    }
+}
+
+#endif // FRAME_SOURCE_H
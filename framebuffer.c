@@ -0,0 +1,254 @@
+/**
+ * @file framebuffer.c
+ * @brief Word-wide DSP framebuffer kernels with plain byte-loop fallbacks.
+ */
+
+#include "framebuffer.h"
+#include "board.h"
+#include <stddef.h>  // For NULL definition
+#if FRAMEBUFFER_SIMD
+#include "TM4C123GH6PM.h"  // CMSIS SIMD intrinsics
+#endif
+#if FRAMEBUFFER_BENCHMARK
+#include "profiler.h"
+#endif
+
+// Channels 0 and 2 of a word, one per 16-bit lane
+#define LANE_MASK  0x00FF00FFU
+
+#define WORD_ALIGNED(p)  ((((uintptr_t)(p)) & 3U) == 0)
+
+// ---- Plain byte loops (fallback, word-path tails and benchmark reference) ----
+
+static void clearBytes(uint8_t *buf, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = 0;
+    }
+}
+
+static void fillBytes(uint8_t *buf, uint16_t leds, rgb_t color) {
+    for (uint16_t i = 0; i < leds; i++) {
+        buf[i * 3 + 0] = color.g;
+        buf[i * 3 + 1] = color.r;
+        buf[i * 3 + 2] = color.b;
+    }
+}
+
+static void addBytes(uint8_t *dst, const uint8_t *src, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        uint16_t sum = dst[i] + src[i];
+        dst[i] = (sum > 255) ? 255 : (uint8_t)sum;
+    }
+}
+
+static void scaleBytes(uint8_t *buf, uint16_t len, uint16_t scale) {
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)((buf[i] * scale) >> 8);
+    }
+}
+
+static void lerpBytes(uint8_t *dst, const uint8_t *from, const uint8_t *to, uint16_t len, uint16_t t) {
+    for (uint16_t i = 0; i < len; i++) {
+        dst[i] = (uint8_t)((from[i] * (256 - t) + to[i] * t) >> 8);
+    }
+}
+
+static void decayBytes(uint8_t *buf, uint16_t len, uint8_t amount) {
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = (buf[i] > amount) ? buf[i] - amount : 0;
+    }
+}
+
+// ---- Word-wide kernels ----
+// Each handles len / 4 whole words and returns the bytes it covered.
+
+#if FRAMEBUFFER_SIMD
+static uint16_t clearWords(uint8_t *buf, uint16_t len) {
+    uint32_t *w = (uint32_t *)buf;
+    uint16_t words = len >> 2;
+    for (uint16_t i = 0; i < words; i++) {
+        w[i] = 0;
+    }
+    return words << 2;
+}
+
+// Four LEDs are exactly three words, so the color repeats every 12 bytes
+static uint16_t fillWords(uint8_t *buf, uint16_t leds, rgb_t color) {
+    uint8_t pattern[12];
+    fillBytes(pattern, 4, color);
+    uint32_t w0 = pattern[0] | (pattern[1] << 8) | (pattern[2] << 16) | ((uint32_t)pattern[3] << 24);
+    uint32_t w1 = pattern[4] | (pattern[5] << 8) | (pattern[6] << 16) | ((uint32_t)pattern[7] << 24);
+    uint32_t w2 = pattern[8] | (pattern[9] << 8) | (pattern[10] << 16) | ((uint32_t)pattern[11] << 24);
+
+    uint32_t *w = (uint32_t *)buf;
+    uint16_t groups = leds >> 2;
+    for (uint16_t i = 0; i < groups; i++) {
+        *w++ = w0;
+        *w++ = w1;
+        *w++ = w2;
+    }
+    return groups << 2;  // LEDs covered
+}
+
+static uint16_t addWords(uint8_t *dst, const uint8_t *src, uint16_t len) {
+    uint32_t *d = (uint32_t *)dst;
+    const uint32_t *s = (const uint32_t *)src;
+    uint16_t words = len >> 2;
+    for (uint16_t i = 0; i < words; i++) {
+        d[i] = __UQADD8(d[i], s[i]);
+    }
+    return words << 2;
+}
+
+// Two channels per multiply: 255 * 256 still fits a 16-bit lane
+static uint16_t scaleWords(uint8_t *buf, uint16_t len, uint16_t scale) {
+    uint32_t *w = (uint32_t *)buf;
+    uint16_t words = len >> 2;
+    for (uint16_t i = 0; i < words; i++) {
+        uint32_t v = w[i];
+        uint32_t even = (((v & LANE_MASK) * scale) >> 8) & LANE_MASK;
+        uint32_t odd = (((v >> 8) & LANE_MASK) * scale) & ~LANE_MASK;
+        w[i] = even | odd;
+    }
+    return words << 2;
+}
+
+static uint16_t lerpWords(uint8_t *dst, const uint8_t *from, const uint8_t *to, uint16_t len, uint16_t t) {
+    uint32_t *d = (uint32_t *)dst;
+    const uint32_t *a = (const uint32_t *)from;
+    const uint32_t *b = (const uint32_t *)to;
+    uint16_t words = len >> 2;
+
+    if (t == 128) {
+        // Halfway is a plain per-byte average
+        for (uint16_t i = 0; i < words; i++) {
+            d[i] = __UHADD8(a[i], b[i]);
+        }
+        return words << 2;
+    }
+
+    uint32_t it = 256 - t;
+    for (uint16_t i = 0; i < words; i++) {
+        uint32_t va = a[i];
+        uint32_t vb = b[i];
+        uint32_t even = (((va & LANE_MASK) * it + (vb & LANE_MASK) * t) >> 8) & LANE_MASK;
+        uint32_t odd = (((va >> 8) & LANE_MASK) * it + ((vb >> 8) & LANE_MASK) * t) & ~LANE_MASK;
+        d[i] = even | odd;
+    }
+    return words << 2;
+}
+
+static uint16_t decayWords(uint8_t *buf, uint16_t len, uint8_t amount) {
+    uint32_t *w = (uint32_t *)buf;
+    uint32_t amounts = amount * 0x01010101U;
+    uint16_t words = len >> 2;
+    for (uint16_t i = 0; i < words; i++) {
+        w[i] = __UQSUB8(w[i], amounts);
+    }
+    return words << 2;
+}
+#endif
+
+// ---- Public kernels ----
+
+void Framebuffer_Clear(uint8_t *buf, uint16_t len) {
+    uint16_t done = 0;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(buf)) {
+        done = clearWords(buf, len);
+    }
+#endif
+    clearBytes(buf + done, len - done);
+}
+
+void Framebuffer_Fill(uint8_t *buf, uint16_t leds, rgb_t color) {
+    uint16_t done = 0;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(buf)) {
+        done = fillWords(buf, leds, color);
+    }
+#endif
+    fillBytes(buf + done * 3, leds - done, color);
+}
+
+void Framebuffer_AddSaturate(uint8_t *dst, const uint8_t *src, uint16_t len) {
+    uint16_t done = 0;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(dst) && WORD_ALIGNED(src)) {
+        done = addWords(dst, src, len);
+    }
+#endif
+    addBytes(dst + done, src + done, len - done);
+}
+
+void Framebuffer_Scale(uint8_t *buf, uint16_t len, uint16_t scale) {
+    uint16_t done = 0;
+    if (scale > 256) scale = 256;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(buf)) {
+        done = scaleWords(buf, len, scale);
+    }
+#endif
+    scaleBytes(buf + done, len - done, scale);
+}
+
+void Framebuffer_Lerp(uint8_t *dst, const uint8_t *from, const uint8_t *to, uint16_t len, uint16_t t) {
+    uint16_t done = 0;
+    if (t > 256) t = 256;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(dst) && WORD_ALIGNED(from) && WORD_ALIGNED(to)) {
+        done = lerpWords(dst, from, to, len, t);
+    }
+#endif
+    lerpBytes(dst + done, from + done, to + done, len - done, t);
+}
+
+void Framebuffer_Decay(uint8_t *buf, uint16_t len, uint8_t amount) {
+    uint16_t done = 0;
+#if FRAMEBUFFER_SIMD
+    if (WORD_ALIGNED(buf)) {
+        done = decayWords(buf, len, amount);
+    }
+#endif
+    decayBytes(buf + done, len - done, amount);
+}
+
+#if FRAMEBUFFER_BENCHMARK
+framebuffer_bench_t framebufferBench[FB_BENCH_COUNT];
+
+static uint8_t benchA[NUM_LEDS * 3] __attribute__((aligned(4)));
+static uint8_t benchB[NUM_LEDS * 3] __attribute__((aligned(4)));
+
+static void benchFill(uint8_t *buf, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(i * 37);
+    }
+}
+
+void Framebuffer_Benchmark(void) {
+    const uint16_t len = NUM_LEDS * 3;
+    const rgb_t color = {20, 30, 40};
+    uint32_t start;
+
+    benchFill(benchB, len);
+
+#define BENCH(slot, wordCall, byteCall)                            \
+    benchFill(benchA, len);                                        \
+    start = Profiler_Cycles();                                     \
+    wordCall;                                                      \
+    framebufferBench[slot].wordCycles = Profiler_Cycles() - start; \
+    benchFill(benchA, len);                                        \
+    start = Profiler_Cycles();                                     \
+    byteCall;                                                      \
+    framebufferBench[slot].byteCycles = Profiler_Cycles() - start;
+
+    BENCH(FB_BENCH_CLEAR, Framebuffer_Clear(benchA, len), clearBytes(benchA, len));
+    BENCH(FB_BENCH_FILL, Framebuffer_Fill(benchA, NUM_LEDS, color), fillBytes(benchA, NUM_LEDS, color));
+    BENCH(FB_BENCH_ADD, Framebuffer_AddSaturate(benchA, benchB, len), addBytes(benchA, benchB, len));
+    BENCH(FB_BENCH_SCALE, Framebuffer_Scale(benchA, len, 100), scaleBytes(benchA, len, 100));
+    BENCH(FB_BENCH_LERP, Framebuffer_Lerp(benchA, benchA, benchB, len, 100), lerpBytes(benchA, benchA, benchB, len, 100));
+    BENCH(FB_BENCH_DECAY, Framebuffer_Decay(benchA, len, 3), decayBytes(benchA, len, 3));
+
+#undef BENCH
+}
+#endif
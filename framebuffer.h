@@ -0,0 +1,86 @@
+/**
+ * @file framebuffer.h
+ * @brief Whole-buffer kernels for GRB framebuffers (clear, fill, add, scale, lerp, decay).
+ *
+ * On the Cortex-M4 the kernels work a word (4 channels) at a time with the
+ * DSP extension's packed-byte instructions (__UQADD8, __UQSUB8, __UHADD8)
+ * and packed-halfword multiplies; elsewhere, e.g. a host build, they fall
+ * back to plain byte loops with identical results. The word paths need
+ * 4-byte aligned buffers and fall back to bytes otherwise.
+ */
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include "led_cube.h"
+
+// Use the word-wide DSP kernels (on by default when the compiler targets them)
+#ifndef FRAMEBUFFER_SIMD
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define FRAMEBUFFER_SIMD 1
+#else
+#define FRAMEBUFFER_SIMD 0
+#endif
+#endif
+
+// Set to 1 to time every kernel both ways at boot (results in framebufferBench)
+#ifndef FRAMEBUFFER_BENCHMARK
+#define FRAMEBUFFER_BENCHMARK 0
+#endif
+
+/**
+ * @brief Set len bytes to zero.
+ */
+void Framebuffer_Clear(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief Set the first @p leds LEDs of a GRB buffer to one color.
+ */
+void Framebuffer_Fill(uint8_t *buf, uint16_t leds, rgb_t color);
+
+/**
+ * @brief dst = min(dst + src, 255) per channel.
+ */
+void Framebuffer_AddSaturate(uint8_t *dst, const uint8_t *src, uint16_t len);
+
+/**
+ * @brief buf = buf * scale / 256 per channel.
+ * @param scale 0 (off) .. 256 (unchanged).
+ */
+void Framebuffer_Scale(uint8_t *buf, uint16_t len, uint16_t scale);
+
+/**
+ * @brief dst = (from * (256 - t) + to * t) / 256 per channel.
+ * @param t 0 (all @p from) .. 256 (all @p to). @p dst may be @p from or @p to.
+ */
+void Framebuffer_Lerp(uint8_t *dst, const uint8_t *from, const uint8_t *to, uint16_t len, uint16_t t);
+
+/**
+ * @brief buf = max(buf - amount, 0) per channel (linear fade toward off).
+ */
+void Framebuffer_Decay(uint8_t *buf, uint16_t len, uint8_t amount);
+
+#if FRAMEBUFFER_BENCHMARK
+// Kernel indices into framebufferBench
+#define FB_BENCH_CLEAR     0
+#define FB_BENCH_FILL      1
+#define FB_BENCH_ADD       2
+#define FB_BENCH_SCALE     3
+#define FB_BENCH_LERP      4
+#define FB_BENCH_DECAY     5
+#define FB_BENCH_COUNT     6
+
+typedef struct {
+    uint32_t wordCycles;    // Kernel as built (word/DSP path when FRAMEBUFFER_SIMD)
+    uint32_t byteCycles;    // Plain byte loop
+} framebuffer_bench_t;
+
+extern framebuffer_bench_t framebufferBench[FB_BENCH_COUNT];
+
+/**
+ * @brief Time every kernel over a NUM_LEDS * 3 buffer both ways.
+ */
+void Framebuffer_Benchmark(void);
+#endif
+
+#endif // FRAMEBUFFER_H
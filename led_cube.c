@@ -4,84 +4,86 @@
  */
 
 #include "led_cube.h"
-#include "WS2812.h"
 #include "ADC.h"
+#include "framebuffer.h"
 #include <stdbool.h>  // For bool type
 
-// External declaration of ADC0_ReadChannel
-uint16_t ADC0_ReadChannel(uint8_t channel);
-
-const uint16_t led_map[7][7][7] = {
-  {
-    { 7, 6, 5, 4, 3, 2, 1 },
-    { 8, 9, 10, 11, 12, 13, 14 },
-    { 21, 20, 19, 18, 17, 16, 15 },
-    { 22, 23, 24, 25, 26, 27, 28 },
-    { 35, 34, 33, 32, 31, 30, 29 },
-    { 36, 37, 38, 39, 40, 41, 42 },
-    { 49, 48, 47, 46, 45, 44, 43 },
-  },
-  {
-    { 56, 55, 54, 53, 52, 51, 50 },
-    { 57, 58, 59, 60, 61, 62, 63 },
-    { 70, 69, 68, 67, 66, 65, 64 },
-    { 71, 72, 73, 74, 75, 76, 77 },
-    { 84, 83, 82, 81, 80, 79, 78 },
-    { 85, 86, 87, 88, 89, 90, 91 },
-    { 98, 97, 96, 95, 94, 93, 92 },
-  },
-  {
-    { 105, 104, 103, 102, 101, 100, 99 },
-    { 106, 107, 108, 109, 110, 111, 112 },
-    { 119, 118, 117, 116, 115, 114, 113 },
-    { 120, 121, 122, 123, 124, 125, 126 },
-    { 133, 132, 131, 130, 129, 128, 127 },
-    { 134, 135, 136, 137, 138, 139, 140 },
-    { 147, 146, 145, 144, 143, 142, 141 },
-  },
-  {
-    { 154, 153, 152, 151, 150, 149, 148 },
-    { 155, 156, 157, 158, 159, 160, 161 },
-    { 168, 167, 166, 165, 164, 163, 162 },
-    { 169, 170, 171, 172, 173, 174, 175 },
-    { 182, 181, 180, 179, 178, 177, 176 },
-    { 183, 184, 185, 186, 187, 188, 189 },
-    { 196, 195, 194, 193, 192, 191, 190 },
-  },
-  {
-    { 203, 202, 201, 200, 199, 198, 197 },
-    { 204, 205, 206, 207, 208, 209, 210 },
-    { 217, 216, 215, 214, 213, 212, 211 },
-    { 218, 219, 220, 221, 222, 223, 224 },
-    { 231, 230, 229, 228, 227, 226, 225 },
-    { 232, 233, 234, 235, 236, 237, 238 },
-    { 245, 244, 243, 242, 241, 240, 239 },
-  },
-  {
-    { 252, 251, 250, 249, 248, 247, 246 },
-    { 253, 254, 255, 256, 257, 258, 259 },
-    { 266, 265, 264, 263, 262, 261, 260 },
-    { 267, 268, 269, 270, 271, 272, 273 },
-    { 280, 279, 278, 277, 276, 275, 274 },
-    { 281, 282, 283, 284, 285, 286, 287 },
-    { 294, 293, 292, 291, 290, 289, 288 },
-  },
-  {
-    { 301, 300, 299, 298, 297, 296, 295 },
-    { 302, 303, 304, 305, 306, 307, 308 },
-    { 315, 314, 313, 312, 311, 310, 309 },
-    { 316, 317, 318, 319, 320, 321, 322 },
-    { 329, 328, 327, 326, 325, 324, 323 },
-    { 330, 331, 332, 333, 334, 335, 336 },
-    { 343, 342, 341, 340, 339, 338, 337 },
-  },
-};
+// led_map is built by the preprocessor: CUBE_SIZE layers of CUBE_SIZE
+// rows of CUBE_SIZE LED_MAP_ENTRY values, so the table follows the wiring
+// settings and cube size without any boot-time code. A macro cannot
+// expand inside itself, so each level has its own repeat and paste macros.
+#if CUBE_SIZE > 16
+#error "led_map generation supports CUBE_SIZE up to 16"
+#endif
+
+#define MAP_PASTE(a, b)   a##b
+#define MAP_YPASTE(a, b)  a##b
+#define MAP_XPASTE(a, b)  a##b
+#define MAP_Z(n)          MAP_PASTE(MAP_Z_, n)
+#define MAP_Y(n)          MAP_YPASTE(MAP_Y_, n)
+#define MAP_X(n)          MAP_XPASTE(MAP_X_, n)
+
+// Entries z = 0 .. n-1 of row (x, y)
+#define MAP_Z_1(x, y)     LED_MAP_ENTRY(x, y, 0)
+#define MAP_Z_2(x, y)     MAP_Z_1(x, y), LED_MAP_ENTRY(x, y, 1)
+#define MAP_Z_3(x, y)     MAP_Z_2(x, y), LED_MAP_ENTRY(x, y, 2)
+#define MAP_Z_4(x, y)     MAP_Z_3(x, y), LED_MAP_ENTRY(x, y, 3)
+#define MAP_Z_5(x, y)     MAP_Z_4(x, y), LED_MAP_ENTRY(x, y, 4)
+#define MAP_Z_6(x, y)     MAP_Z_5(x, y), LED_MAP_ENTRY(x, y, 5)
+#define MAP_Z_7(x, y)     MAP_Z_6(x, y), LED_MAP_ENTRY(x, y, 6)
+#define MAP_Z_8(x, y)     MAP_Z_7(x, y), LED_MAP_ENTRY(x, y, 7)
+#define MAP_Z_9(x, y)     MAP_Z_8(x, y), LED_MAP_ENTRY(x, y, 8)
+#define MAP_Z_10(x, y)    MAP_Z_9(x, y), LED_MAP_ENTRY(x, y, 9)
+#define MAP_Z_11(x, y)    MAP_Z_10(x, y), LED_MAP_ENTRY(x, y, 10)
+#define MAP_Z_12(x, y)    MAP_Z_11(x, y), LED_MAP_ENTRY(x, y, 11)
+#define MAP_Z_13(x, y)    MAP_Z_12(x, y), LED_MAP_ENTRY(x, y, 12)
+#define MAP_Z_14(x, y)    MAP_Z_13(x, y), LED_MAP_ENTRY(x, y, 13)
+#define MAP_Z_15(x, y)    MAP_Z_14(x, y), LED_MAP_ENTRY(x, y, 14)
+#define MAP_Z_16(x, y)    MAP_Z_15(x, y), LED_MAP_ENTRY(x, y, 15)
+
+// Rows y = 0 .. n-1 of layer x
+#define MAP_Y_1(x)        { MAP_Z(CUBE_SIZE)(x, 0) }
+#define MAP_Y_2(x)        MAP_Y_1(x), { MAP_Z(CUBE_SIZE)(x, 1) }
+#define MAP_Y_3(x)        MAP_Y_2(x), { MAP_Z(CUBE_SIZE)(x, 2) }
+#define MAP_Y_4(x)        MAP_Y_3(x), { MAP_Z(CUBE_SIZE)(x, 3) }
+#define MAP_Y_5(x)        MAP_Y_4(x), { MAP_Z(CUBE_SIZE)(x, 4) }
+#define MAP_Y_6(x)        MAP_Y_5(x), { MAP_Z(CUBE_SIZE)(x, 5) }
+#define MAP_Y_7(x)        MAP_Y_6(x), { MAP_Z(CUBE_SIZE)(x, 6) }
+#define MAP_Y_8(x)        MAP_Y_7(x), { MAP_Z(CUBE_SIZE)(x, 7) }
+#define MAP_Y_9(x)        MAP_Y_8(x), { MAP_Z(CUBE_SIZE)(x, 8) }
+#define MAP_Y_10(x)       MAP_Y_9(x), { MAP_Z(CUBE_SIZE)(x, 9) }
+#define MAP_Y_11(x)       MAP_Y_10(x), { MAP_Z(CUBE_SIZE)(x, 10) }
+#define MAP_Y_12(x)       MAP_Y_11(x), { MAP_Z(CUBE_SIZE)(x, 11) }
+#define MAP_Y_13(x)       MAP_Y_12(x), { MAP_Z(CUBE_SIZE)(x, 12) }
+#define MAP_Y_14(x)       MAP_Y_13(x), { MAP_Z(CUBE_SIZE)(x, 13) }
+#define MAP_Y_15(x)       MAP_Y_14(x), { MAP_Z(CUBE_SIZE)(x, 14) }
+#define MAP_Y_16(x)       MAP_Y_15(x), { MAP_Z(CUBE_SIZE)(x, 15) }
+
+// Layers x = 0 .. n-1
+#define MAP_X_1           { MAP_Y(CUBE_SIZE)(0) }
+#define MAP_X_2           MAP_X_1, { MAP_Y(CUBE_SIZE)(1) }
+#define MAP_X_3           MAP_X_2, { MAP_Y(CUBE_SIZE)(2) }
+#define MAP_X_4           MAP_X_3, { MAP_Y(CUBE_SIZE)(3) }
+#define MAP_X_5           MAP_X_4, { MAP_Y(CUBE_SIZE)(4) }
+#define MAP_X_6           MAP_X_5, { MAP_Y(CUBE_SIZE)(5) }
+#define MAP_X_7           MAP_X_6, { MAP_Y(CUBE_SIZE)(6) }
+#define MAP_X_8           MAP_X_7, { MAP_Y(CUBE_SIZE)(7) }
+#define MAP_X_9           MAP_X_8, { MAP_Y(CUBE_SIZE)(8) }
+#define MAP_X_10          MAP_X_9, { MAP_Y(CUBE_SIZE)(9) }
+#define MAP_X_11          MAP_X_10, { MAP_Y(CUBE_SIZE)(10) }
+#define MAP_X_12          MAP_X_11, { MAP_Y(CUBE_SIZE)(11) }
+#define MAP_X_13          MAP_X_12, { MAP_Y(CUBE_SIZE)(12) }
+#define MAP_X_14          MAP_X_13, { MAP_Y(CUBE_SIZE)(13) }
+#define MAP_X_15          MAP_X_14, { MAP_Y(CUBE_SIZE)(14) }
+#define MAP_X_16          MAP_X_15, { MAP_Y(CUBE_SIZE)(15) }
+
+const uint16_t led_map[CUBE_SIZE][CUBE_SIZE][CUBE_SIZE] = { MAP_X(CUBE_SIZE) };
 
 // 3D framebuffer
 static rgb_t frame[CUBE_SIZE][CUBE_SIZE][CUBE_SIZE];
 
 // Render buffer
-static uint8_t ledBuffer[NUM_LEDS * 3];
+static uint8_t ledBuffer[NUM_LEDS * 3] __attribute__((aligned(4)));
 
 void Cube_Init(void) {
     Cube_Clear();
@@ -94,9 +96,7 @@ void Cube_Clear(void) {
                 frame[x][y][z] = (rgb_t){0, 0, 0};
                 
     // Also clear the buffer
-    for (int i = 0; i < NUM_LEDS * 3; i++) {
-        ledBuffer[i] = 0;
-    }
+    Framebuffer_Clear(ledBuffer, NUM_LEDS * 3);
 }
 
 void Cube_SetPixel(uint8_t x, uint8_t y, uint8_t z, rgb_t color) {
@@ -104,8 +104,13 @@ void Cube_SetPixel(uint8_t x, uint8_t y, uint8_t z, rgb_t color) {
         frame[x][y][z] = color;
 }
 
+#if CUBE_SIZE == 7
 static const uint16_t deadLEDs[] = {0, 108, 156, 157, 206, 213, 221};
 static const uint8_t numDeadLEDs = 7;
+#else
+static const uint16_t deadLEDs[] = {0};
+static const uint8_t numDeadLEDs = 0;
+#endif
 
 static int isDeadLED(uint16_t ledNum) {
     for (uint8_t i = 0; i < numDeadLEDs; i++) {
@@ -126,7 +131,7 @@ uint8_t* Cube_RenderFrame(void) {
     for (uint8_t z = 0; z < CUBE_SIZE; z++) {
         for (uint8_t y = 0; y < CUBE_SIZE; y++) {
             for (uint8_t x = 0; x < CUBE_SIZE; x++) {
-                uint16_t led_idx = led_map[x][y][z];
+                uint16_t led_idx = ledMapIndex(x, y, z);
                 
                 // Skip dead LEDs and ensure valid range
                 if (led_idx > 0 && led_idx <= NUM_LEDS && !isDeadLED(led_idx-1)) {
@@ -146,6 +151,6 @@ uint8_t* Cube_RenderFrame(void) {
 
 float Potentiometer_GetScale(void)
 {
-    uint16_t raw = ADC0_ReadChannel(0);
+    uint16_t raw = ADC_GetPotLevel();
     return (float)raw / 4095.0f; // 12-bit scale
 }
\ No newline at end of file
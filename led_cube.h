@@ -1,14 +1,50 @@
 /**
  * @file led_cube.h
- * @brief Framebuffer and render API for 777 cube.
+ * @brief Framebuffer and render API for the CUBE_SIZE cube.
  */
 #ifndef LED_CUBE_H
 #define LED_CUBE_H
 #include <stdint.h>
 #include "board.h"
 
+// ---- LED chain wiring ----
+// The data chain fills the cube one x layer at a time, each layer one
+// y row at a time, each row along z. These settings describe where it
+// starts and which way it runs; led_map and ledMapIndex() are derived
+// from them, so a cube of another size or wiring needs no hand-made table.
+#define LED_WIRING_LAYER_REVERSED  0   // 1: chain starts in layer x = CUBE_SIZE-1
+#define LED_WIRING_ROW_REVERSED    0   // 1: each layer starts at row y = CUBE_SIZE-1
+#define LED_WIRING_RUN_REVERSED    1   // 1: a layer's first row runs from z = CUBE_SIZE-1 to 0
+#define LED_WIRING_SNAKE           1   // 1: rows alternate direction (serpentine)
+
+// Set to 1 to look voxels up in led_map instead of computing their index
+#ifndef LED_MAP_TABLE
+#define LED_MAP_TABLE 0
+#endif
+
+// 1-based chain position of voxel (x, y, z); a constant expression when
+// the coordinates are
+#define LED_MAP_LAYER(x)     (LED_WIRING_LAYER_REVERSED ? (CUBE_SIZE - 1 - (x)) : (x))
+#define LED_MAP_ROW(y)       (LED_WIRING_ROW_REVERSED ? (CUBE_SIZE - 1 - (y)) : (y))
+#define LED_MAP_RUN(y, z)    ((LED_WIRING_RUN_REVERSED ^ (LED_WIRING_SNAKE & LED_MAP_ROW(y) & 1)) \
+                              ? (CUBE_SIZE - 1 - (z)) : (z))
+#define LED_MAP_ENTRY(x, y, z) \
+    ((LED_MAP_LAYER(x) * CUBE_SIZE + LED_MAP_ROW(y)) * CUBE_SIZE + LED_MAP_RUN(y, z) + 1)
+
+// The same mapping as a table in flash, generated from LED_MAP_ENTRY
 extern const uint16_t led_map[CUBE_SIZE][CUBE_SIZE][CUBE_SIZE];
 
+/**
+ * @brief 1-based chain position of a voxel (coordinates must be in range).
+ */
+static inline uint16_t ledMapIndex(uint8_t x, uint8_t y, uint8_t z) {
+#if LED_MAP_TABLE
+    return led_map[x][y][z];
+#else
+    return (uint16_t)LED_MAP_ENTRY(x, y, z);
+#endif
+}
+
 typedef struct { uint8_t g, r, b; } rgb_t;
 float Potentiometer_GetScale(void);
 void Cube_Init(void);
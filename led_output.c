@@ -0,0 +1,100 @@
+/**
+ * @file led_output.c
+ * @brief Output device selection and the frame calls that go through it.
+ */
+
+#include "led_output.h"
+#include "board.h"
+#include "WS2812.h"
+#include "APA102.h"
+#include <stddef.h>  // For NULL definition
+
+#if LED_CHIPSET == LED_CHIPSET_APA102
+#define DEFAULT_DEVICE  (&apa102Device)
+#elif WS2812_DMA
+#define DEFAULT_DEVICE  (&ws2812DmaDevice)
+#else
+#define DEFAULT_DEVICE  (&ws2812Device)
+#endif
+
+static const led_output_device_t *device = DEFAULT_DEVICE;
+static frame_source_t lastSource;       // Last frame shown, for LedOutput_Refresh
+static int lastCount = 0;
+
+void LedOutput_Init(void) {
+    device = DEFAULT_DEVICE;
+    device->init();
+}
+
+void LedOutput_Select(const led_output_device_t *next) {
+    if (next == NULL) {
+        return;
+    }
+    device->wait();
+    device = next;
+    device->init();
+    lastCount = 0;
+}
+
+const led_output_device_t *LedOutput_Device(void) {
+    return device;
+}
+
+static int show(const frame_source_t *src, int count) {
+    if (count <= 0 || count > NUM_LEDS) {
+        return LED_OUTPUT_ERROR;
+    }
+    device->beginFrame();
+    lastSource = *src;
+    lastCount = count;
+    return device->submit(src, count);
+}
+
+int LedOutput_Show(const uint8_t *grb, int count) {
+    if (grb == NULL) {
+        return LED_OUTPUT_ERROR;
+    }
+    frame_source_t src = {FRAME_SOURCE_GRB, grb, NULL, NULL, NULL};
+    return show(&src, count);
+}
+
+int LedOutput_ShowBlend(const uint8_t *from, const uint8_t *to, const uint8_t *alpha, int count) {
+    if (from == NULL || to == NULL || alpha == NULL) {
+        return LED_OUTPUT_ERROR;
+    }
+    frame_source_t src = {FRAME_SOURCE_BLEND, from, to, alpha, NULL};
+    return show(&src, count);
+}
+
+int LedOutput_ShowIndexed(const uint8_t *indices, const uint8_t *palette, int count) {
+    if (indices == NULL || palette == NULL) {
+        return LED_OUTPUT_ERROR;
+    }
+    frame_source_t src = {FRAME_SOURCE_INDEXED, indices, palette, NULL, NULL};
+    return show(&src, count);
+}
+
+int LedOutput_ShowSlices(frame_slice_fn_t slice, int count) {
+    if (slice == NULL || !device->slices) {
+        return LED_OUTPUT_ERROR;
+    }
+    frame_source_t src = {FRAME_SOURCE_SLICES, NULL, NULL, NULL, slice};
+    return show(&src, count);
+}
+
+int LedOutput_Refresh(void) {
+    // A computed frame can't be computed again once its pattern has moved on
+    if (lastCount == 0 || lastSource.kind == FRAME_SOURCE_SLICES) {
+        return LED_OUTPUT_SKIPPED;
+    }
+    device->beginFrame();
+    return device->submit(&lastSource, lastCount);
+}
+
+int LedOutput_Wait(void) {
+    return device->wait();
+}
+
+void LedOutput_GetStats(led_output_stats_t *stats) {
+    device->stats(stats);
+}
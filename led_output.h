@@ -0,0 +1,125 @@
+/**
+ * @file led_output.h
+ * @brief Output devices that put frames on the LEDs, and the calls that use them.
+ *
+ * Everything above the drivers sends frames through LedOutput_*, which
+ * wraps the buffers in a frame_source_t and hands them to the selected
+ * led_output_device_t. A device only has to:
+ *
+ *   init        claim its pins and peripherals
+ *   beginFrame  wait until it can take a new frame (e.g. a DMA buffer is free)
+ *   submit      post-process, encode and send the frame, or start sending it
+ *   wait        wait until the last frame is completely out
+ *   stats       report its counters
+ *
+ * Blocking devices send the whole frame inside submit; DMA devices return
+ * as soon as the transfer is running, leaving the CPU to the scheduler.
+ * Devices that set slices also take FRAME_SOURCE_SLICES frames, whose
+ * layers are computed while earlier ones are already going out; callers
+ * resolve such frames into a buffer for the others (chain_render.h).
+ * The default device follows LED_CHIPSET (and WS2812_DMA); host tests
+ * and benchmarks can select ledSinkDevice (led_sink.h) instead.
+ */
+#ifndef LED_OUTPUT_H
+#define LED_OUTPUT_H
+
+#include <stdint.h>
+#include "frame_source.h"
+
+// Show/submit results
+#define LED_OUTPUT_ERROR    0   // Timed out; the next frame is always sent
+#define LED_OUTPUT_SENT     1   // Sent, or for a DMA device, sending
+#define LED_OUTPUT_SKIPPED  2   // Matched the last frame sent and was not retransmitted
+
+typedef struct {
+    uint32_t frames;        // Frames submitted
+    uint32_t sent;          // Frames transmitted
+    uint32_t skipped;       // Frames not transmitted because they were unchanged
+    uint32_t errors;        // Frames lost to a bus timeout
+    uint32_t frameUs;       // Bus time of one full NUM_LEDS frame
+} led_output_stats_t;
+
+typedef struct {
+    const char *name;
+    void (*init)(void);
+    void (*beginFrame)(void);
+    int (*submit)(const frame_source_t *src, int count);  // LED_OUTPUT_* result
+    int (*wait)(void);                                    // 1 if the last frame went out, 0 on timeout
+    void (*stats)(led_output_stats_t *stats);
+    uint8_t slices;         // 1 if a pause while a layer is computed does no harm
+} led_output_device_t;
+
+/**
+ * @brief Initialize and select the default output device.
+ */
+void LedOutput_Init(void);
+
+/**
+ * @brief Finish the current device's frame, then initialize and select another.
+ */
+void LedOutput_Select(const led_output_device_t *device);
+
+/**
+ * @brief Currently selected device.
+ */
+const led_output_device_t *LedOutput_Device(void);
+
+/**
+ * @brief Send a GRB buffer.
+ * @param grb   Pointer to GRB byte array (length = count*3).
+ * @param count Number of LEDs.
+ * @return LED_OUTPUT_SENT, LED_OUTPUT_SKIPPED or LED_OUTPUT_ERROR.
+ */
+int LedOutput_Show(const uint8_t *grb, int count);
+
+/**
+ * @brief Send a per-LED mix of two GRB buffers, blended during encoding.
+ * @param from  GRB buffer shown at alpha 0.
+ * @param to    GRB buffer shown at alpha 255.
+ * @param alpha Per-LED weight of @p to (length = count).
+ * @param count Number of LEDs.
+ * @return As LedOutput_Show().
+ */
+int LedOutput_ShowBlend(const uint8_t *from, const uint8_t *to, const uint8_t *alpha, int count);
+
+/**
+ * @brief Send a palette-indexed frame, expanded to GRB during encoding.
+ * @param indices Palette index per LED (length = count).
+ * @param palette GRB triplet per palette entry.
+ * @param count   Number of LEDs.
+ * @return As LedOutput_Show().
+ */
+int LedOutput_ShowIndexed(const uint8_t *indices, const uint8_t *palette, int count);
+
+/**
+ * @brief Send a frame computed one x layer at a time in chain order.
+ *
+ * Only for devices with slices set (see ChainRender_Resolve otherwise).
+ * @param slice Layer function (chain_render.h).
+ * @param count Number of LEDs.
+ * @return As LedOutput_Show().
+ */
+int LedOutput_ShowSlices(frame_slice_fn_t slice, int count);
+
+/**
+ * @brief Send the last frame shown again, from the same buffers.
+ *
+ * For output stages that change a frame each time it goes out (dither).
+ * The buffers passed to the last LedOutput_Show* call must still hold
+ * that frame. Slice frames are not sent again.
+ * @return As LedOutput_Show(); LED_OUTPUT_SKIPPED if there is nothing to send.
+ */
+int LedOutput_Refresh(void);
+
+/**
+ * @brief Wait until the last frame is completely out.
+ * @return 1 if it went out, 0 on timeout.
+ */
+int LedOutput_Wait(void);
+
+/**
+ * @brief Counters of the selected device.
+ */
+void LedOutput_GetStats(led_output_stats_t *stats);
+
+#endif // LED_OUTPUT_H
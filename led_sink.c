@@ -0,0 +1,64 @@
+/**
+ * @file led_sink.c
+ * @brief Frame sink output device.
+ */
+
+#include "led_sink.h"
+#include "board.h"
+#include "output.h"
+#include <stddef.h>  // For NULL definition
+
+static led_sink_writer_t sinkWriter = NULL;
+static uint8_t sinkFrame[NUM_LEDS * 3];
+static led_output_stats_t stats;
+
+void LedSink_SetWriter(led_sink_writer_t writer) {
+    sinkWriter = writer;
+}
+
+static void sinkInit(void) {
+}
+
+static void sinkBeginFrame(void) {
+}
+
+static int sinkSubmit(const frame_source_t *src, int count) {
+    uint8_t post = Output_Stages() != 0;
+    if (post) {
+        Output_BeginFrame(src, count);
+    }
+    for (int led = 0; led < count; ++led) {
+        uint8_t mixed[3];
+        const uint8_t *grb = FrameSource_Led(src, led, mixed);
+        uint8_t *out = &sinkFrame[led * 3];
+        out[0] = grb[0];
+        out[1] = grb[1];
+        out[2] = grb[2];
+        if (post) {
+            Output_ProcessLed((uint16_t)led, out);
+        }
+    }
+    if (post) {
+        Output_EndFrame();
+    }
+
+    stats.frames++;
+    stats.sent++;
+    if (sinkWriter != NULL) {
+        sinkWriter(sinkFrame, (uint16_t)(count * 3));
+    }
+    return LED_OUTPUT_SENT;
+}
+
+static int sinkWait(void) {
+    return 1;
+}
+
+static void sinkStats(led_output_stats_t *out) {
+    *out = stats;
+    out->frameUs = 0;  // No bus
+}
+
+const led_output_device_t ledSinkDevice = {
+    "sink", sinkInit, sinkBeginFrame, sinkSubmit, sinkWait, sinkStats, 1
+};
@@ -0,0 +1,26 @@
+/**
+ * @file led_sink.h
+ * @brief Output device that hands finished frames to a callback instead of LEDs.
+ *
+ * Plain C with no hardware access, for host builds and on-target checks.
+ * Each frame goes through the output chain as it would on the wire and is
+ * passed to the writer as GRB bytes in LED buffer order, so a PC build can
+ * write every frame to a file for regression tests and benchmarks. Frames
+ * are never skipped.
+ */
+#ifndef LED_SINK_H
+#define LED_SINK_H
+
+#include <stdint.h>
+#include "led_output.h"
+
+typedef void (*led_sink_writer_t)(const uint8_t *grb, uint16_t bytes);
+
+/**
+ * @brief Set where finished frames go (NULL = drop them).
+ */
+void LedSink_SetWriter(led_sink_writer_t writer);
+
+extern const led_output_device_t ledSinkDevice;
+
+#endif // LED_SINK_H
@@ -6,16 +6,26 @@
 #include "board.h"
 #include "GPIO.h"
 #include "SysTick_Delay.h"
-#include "WS2812.h"
+#include "led_output.h"
 #include "TM4C123GH6PM.h"
 #include "ADC.h"
 #include "led_cube.h"
 #include "new_patterns.h"
 #include "common_functions.h"
 #include <stddef.h>
-#include <stdlib.h>
 #include <math.h>
 #include "pattern_functions.h"
+#include "transition.h"
+#include "scene.h"
+#include "profiler.h"
+#include "rotation_tables.h"
+#include "pattern_check.h"
+#include "stream.h"
+#include "palette.h"
+#include "framebuffer.h"
+#include "output.h"
+#include "scheduler.h"
+#include "telemetry.h"
 
 /**
  * @file corrected_patterns.c
@@ -28,10 +38,14 @@
  * - Countdown: Digits need to be sideways with bottom of number at right side
  */
 
+// Palette entry used by the plane patterns
+#define PLANE_INDEX 1
+
 // X Planes pattern - planes moving left to right
 // RED planes in your orientation
 void updateXPlanes(uint8_t position, float brightness) {
-    clearAllLeds();
+    (void)brightness;  // Applied to the palette at output
+    Palette_BeginFrame();
     
     // Current x plane (0-6)
     uint8_t x = position % CUBE_SIZE;
@@ -39,13 +53,13 @@ void updateXPlanes(uint8_t position, float brightness) {
     // Color for this pattern (red)
     rgb_t planeColor = {40, 0, 0};
     
-    // Scale the color based on current brightness
-    planeColor = scaleBrightness(planeColor, brightness);
+    // One palette entry; brightness is applied to it at output
+    Palette_SetEntry(PLANE_INDEX, planeColor);
     
     // Set all LEDs in this X plane
     for (uint8_t y = 0; y < CUBE_SIZE; y++) {
         for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-            setVoxel(x, y, z, planeColor);
+            Palette_SetVoxel(x, y, z, PLANE_INDEX);
         }
     }
 }
@@ -53,7 +67,8 @@ void updateXPlanes(uint8_t position, float brightness) {
 // Y Planes pattern - planes moving front to back
 // GREEN planes in your orientation
 void updateYPlanes(uint8_t position, float brightness) {
-    clearAllLeds();
+    (void)brightness;  // Applied to the palette at output
+    Palette_BeginFrame();
     
     // Current y plane (0-6)
     uint8_t y = position % CUBE_SIZE;
@@ -61,13 +76,13 @@ void updateYPlanes(uint8_t position, float brightness) {
     // Color for this pattern (green)
     rgb_t planeColor = {0, 40, 0};
     
-    // Scale the color based on current brightness
-    planeColor = scaleBrightness(planeColor, brightness);
+    // One palette entry; brightness is applied to it at output
+    Palette_SetEntry(PLANE_INDEX, planeColor);
     
     // Set all LEDs in this Y plane
     for (uint8_t x = 0; x < CUBE_SIZE; x++) {
         for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-            setVoxel(x, y, z, planeColor);
+            Palette_SetVoxel(x, y, z, PLANE_INDEX);
         }
     }
 }
@@ -75,7 +90,8 @@ void updateYPlanes(uint8_t position, float brightness) {
 // Z Planes pattern - planes moving bottom to top
 // BLUE planes in your orientation
 void updateZPlanes(uint8_t position, float brightness) {
-    clearAllLeds();
+    (void)brightness;  // Applied to the palette at output
+    Palette_BeginFrame();
     
     // Current z plane (0-6)
     uint8_t z = position % CUBE_SIZE;
@@ -83,13 +99,13 @@ void updateZPlanes(uint8_t position, float brightness) {
     // Color for this pattern (blue)
     rgb_t planeColor = {0, 0, 40};
     
-    // Scale the color based on current brightness
-    planeColor = scaleBrightness(planeColor, brightness);
+    // One palette entry; brightness is applied to it at output
+    Palette_SetEntry(PLANE_INDEX, planeColor);
     
     // Set all LEDs in this Z plane
     for (uint8_t x = 0; x < CUBE_SIZE; x++) {
         for (uint8_t y = 0; y < CUBE_SIZE; y++) {
-            setVoxel(x, y, z, planeColor);
+            Palette_SetVoxel(x, y, z, PLANE_INDEX);
         }
     }
 }
@@ -123,15 +139,16 @@ void updateZPlanes(uint8_t position, float brightness) {
 
 // Global variables for the countdown pattern
 static uint8_t countdownValue = 9;
-static uint8_t countdownChanged = 0;  // Flag to detect button presses
 static uint32_t countdownTimer = 0;   // Timer for countdown
+
+#define DIGIT_SIZE 7   // Rows and columns of a digit glyph
  
 // Helper function to draw a digit in the cube
 // Using full 7x7 grid with extra space filled with 0s
 void drawDigit(uint8_t digit, rgb_t color) {
 
 // Define numbers using full 7x7 grid (all 49 positions defined)
-static const uint8_t digitPatterns[10][7][7] = {
+static const uint8_t digitPatterns[10][DIGIT_SIZE][DIGIT_SIZE] = {
     { // 0
         {0, 0, 0, 0, 0, 0, 0},
         {0, 1, 1, 1, 1, 1, 0},
@@ -224,15 +241,15 @@ static const uint8_t digitPatterns[10][7][7] = {
     }
 };
     
-    // Starting position and thickness
-    uint8_t x_start = 0;         // Start at X=0
+    // Starting position and thickness; the glyph is centered on larger cubes
+    uint8_t x_start = (CUBE_SIZE > DIGIT_SIZE) ? (CUBE_SIZE - DIGIT_SIZE) / 2 : 0;
     uint8_t y_start = 0;         // Start at front of cube (Y=0)
-    uint8_t y_thickness = 7;     // Thickness of 4 layers
-    uint8_t z_start = 0;         // Start at bottom (Z=0)
+    uint8_t y_thickness = CUBE_SIZE;  // Extrude through the whole depth
+    uint8_t z_start = (CUBE_SIZE > DIGIT_SIZE) ? (CUBE_SIZE - DIGIT_SIZE) / 2 : 0;
     
     // Draw the current digit pattern
-    for (uint8_t row = 0; row < 7; row++) {
-        for (uint8_t col = 0; col < 7; col++) {
+    for (uint8_t row = 0; row < DIGIT_SIZE; row++) {
+        for (uint8_t col = 0; col < DIGIT_SIZE; col++) {
             // Check if this position is lit (1) or not (0)
             if (digitPatterns[digit][row][col] == 1) {
                 // Calculate actual position
@@ -248,23 +265,17 @@ static const uint8_t digitPatterns[10][7][7] = {
     }
 }
 
+// Step the countdown by one (SW2 press while the countdown is shown)
+void countdownStepDown(void) {
+    if (countdownValue > 0) {
+        countdownValue--;
+    } else {
+        countdownValue = 9; // Reset to 9 after reaching 0
+    }
+}
+
 // Countdown pattern - displays numbers counting down
 void updateCountdownPattern(uint8_t position, float brightness) {
-    // Check if button 2 is pressed and wasn't pressed before
-    if (GPIO_Button2Pressed() && !countdownChanged) {
-        // Button just pressed - decrement the value
-        if (countdownValue > 0) {
-            countdownValue--;
-        } else {
-            countdownValue = 9; // Reset to 9 after reaching 0
-        }
-        countdownChanged = 1;  // Set flag to prevent multiple decrements per press
-    }
-    else if (!GPIO_Button2Pressed()) {
-        // Button released - clear the flag
-        countdownChanged = 0;
-    }
-    
     // Count frames for exactly 1 second timing
     countdownTimer++;
     if (countdownTimer >= 100) {  // 100 * 10ms = 1 second precisely
@@ -321,18 +332,21 @@ typedef struct {
 } raindrop_t;
 static raindrop_t raindrops[MAX_DROPS];
 
+// Share of the last frame kept, so each drop leaves a fading trail
+#define RAIN_TRAIL_KEEP 64
+
 // Rain pattern - drops falling from top to bottom
 void updateRainPattern(uint8_t position, float brightness) {
-    clearAllLeds();
+    fadeAllLeds(RAIN_TRAIL_KEEP);
     
     // Create new drops randomly
     if (position % 5 == 0) {
         for (int i = 0; i < MAX_DROPS; i++) {
             if (!raindrops[i].active) {
                 // 30% chance to create a new drop
-                if ((rand() % 10) < 3) {
-                    raindrops[i].x = rand() % CUBE_SIZE;
-                    raindrops[i].y = rand() % CUBE_SIZE;
+                if ((patternRand() % 10) < 3) {
+                    raindrops[i].x = patternRand() % CUBE_SIZE;
+                    raindrops[i].y = patternRand() % CUBE_SIZE;
                     raindrops[i].z = CUBE_SIZE - 1; // Start at the top
                     raindrops[i].active = 1;
                     break; // Only create one new drop per iteration
@@ -352,7 +366,7 @@ void updateRainPattern(uint8_t position, float brightness) {
                 raindrops[i].z--;
             }
             
-            // Draw the active drops with blue color
+            // Draw the head of each active drop; the fade leaves the trail
             if (raindrops[i].active) {
                 rgb_t dropColor;
                 
@@ -362,15 +376,6 @@ void updateRainPattern(uint8_t position, float brightness) {
                 dropColor.b = 40;
                 dropColor = scaleBrightness(dropColor, brightness * 1.2f);
                 setVoxel(raindrops[i].x, raindrops[i].y, raindrops[i].z, dropColor);
-                
-                // Dimmer blue behind (trail)
-                if (raindrops[i].z < CUBE_SIZE - 1) {
-                    dropColor.r = 0;
-                    dropColor.g = 0;
-                    dropColor.b = 20;
-                    dropColor = scaleBrightness(dropColor, brightness * 0.6f);
-                    setVoxel(raindrops[i].x, raindrops[i].y, raindrops[i].z + 1, dropColor);
-                }
             }
         }
     }
@@ -439,16 +444,15 @@ void updateSpherePattern(uint8_t position, float brightness) {
     // Apply brightness scaling
     sphereColor = scaleBrightness(sphereColor, brightness);
     
-    // Draw the sphere
-    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
-        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
-            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-                if (isPointOnSphere(x, y, z, centerX, centerY, centerZ, sphereRadius, 1)) {
-                    setVoxel(x, y, z, sphereColor);
-                }
-            }
-        }
+    // Draw the sphere (re-rasterized only when the radius changes)
+    static scene_handle_t sphereShape = -1;
+    if (sphereShape < 0) {
+        sphereShape = Scene_AddSphere(1, SCENE_SPHERE_VOXELS);
     }
+    scene_transform_t sphereTransform = {centerX, centerY, centerZ, sphereRadius, 0.0f};
+    Scene_SetTransform(sphereShape, &sphereTransform);
+    Scene_SetColor(sphereShape, 0, sphereColor);
+    Scene_Draw(sphereShape);
 }
 
 // Spiral pattern state
@@ -503,13 +507,179 @@ void updateSpiralPattern(uint8_t position, float brightness) {
         }
     }
 }
+
+// Render steps spent at currentPosition
+static uint32_t positionSteps = 0;
+
+// Switch to another pattern, fading out of the current one
+static void selectPattern(uint8_t pattern) {
+    Transition_Start(currentPattern, currentPosition, positionSteps);
+    currentPattern = pattern;
+    currentPosition = 0;  // Reset position when changing patterns
+    
+    // Handle pattern-specific initialization when changing patterns
+    switch (currentPattern) {
+        case PATTERN_GAME_OF_LIFE_3D:
+            resetGameOfLife3D(); // Function call instead of direct variable access
+            break;
+        case PATTERN_SNAKE_3D:
+            resetSnake3D(); // Function call instead of direct variable access
+            break;
+    }
+}
+
+// ---- Scheduled tasks ----
+
+// Render step period: one frame transmit plus a 10 ms pause, the pace the
+// pattern speeds and the position/pattern step counts were tuned at
+#define RENDER_PERIOD_MS     95U
+#define INPUT_PERIOD_MS      10U     // Button queue poll (long presses need polling)
+#define ADC_PERIOD_MS        20U     // Brightness from the filtered pot level
+#define STREAM_POLL_MS       2U      // Check for a complete streamed frame
+#define REFRESH_PERIOD_MS    12U     // Resend while dithering (~80 fps, a 7x7x7 frame takes ~10.6 ms)
+#define OUTPUT_RETRY_MS      500U    // Pause after a failed transmission
+
+#define PATTERN_STEPS        1500U   // Render steps per pattern in auto cycle
+
+// Task budgets in core cycles
+#define MS_CYCLES(ms)        ((ms) * (SYS_CLOCK / 1000U))
+#define INPUT_BUDGET         MS_CYCLES(1U)
+#define ADC_BUDGET           MS_CYCLES(1U)
+#define STREAM_BUDGET        MS_CYCLES(90U)   // One frame transmit
+#define RENDER_BUDGET        MS_CYCLES(20U)
+#define PRESENT_BUDGET       MS_CYCLES(90U)   // One frame transmit (two patterns during a transition)
+#define TELEMETRY_BUDGET     MS_CYCLES(3U)
+#define REFRESH_BUDGET       MS_CYCLES(11U)   // One plain frame transmit
+
+static uint8_t presentTask = SCHEDULER_NO_TASK;
+static float brightness = 0.5f;
+static uint8_t autoCycle = 1;
+static uint8_t transitionType = TRANSITION_CROSSFADE;
+static uint32_t patternSteps = 0;
+static uint32_t outputHoldUntil = 0;
+
+// Drain debounced button events queued by the Port F interrupt
+static void inputStep(void) {
+    button_event_t buttonEvent;
+    while (GPIO_GetButtonEvent(&buttonEvent)) {
+        if (buttonEvent.button == BUTTON_SW1) {
+            if (buttonEvent.type == BUTTON_EVENT_PRESS) {
+                // Next pattern
+                selectPattern((currentPattern + 1) % PATTERN_COUNT);
+                patternSteps = 0;
+            } else if (buttonEvent.type == BUTTON_EVENT_LONG_PRESS) {
+                // Hold SW1 to pause/resume the automatic pattern cycle
+                autoCycle = !autoCycle;
+                patternSteps = 0;
+            }
+        } else if (handlePatternButton(currentPattern, &buttonEvent)) {
+            // Consumed by the running pattern
+        } else if (buttonEvent.type == BUTTON_EVENT_PRESS) {
+            // Manually advance position
+            currentPosition = (currentPosition + 1) % (CUBE_SIZE * 2);
+        } else if (buttonEvent.type == BUTTON_EVENT_LONG_PRESS) {
+            // Hold SW2 to try the next transition kernel
+            transitionType = (transitionType + 1) % (TRANSITION_DISSOLVE + 1);
+            Transition_Configure(transitionType, TRANSITION_DEFAULT_FRAMES);
+        }
+    }
+}
+
+// Update brightness from potentiometer
+static void adcStep(void) {
+    brightness = updateBrightness();
+    if (Output_Stages() & OUTPUT_STAGE_BRIGHTNESS) {
+        // The output stage scales (and can dither) instead; patterns draw at full
+        Output_SetBrightness(brightness);
+        brightness = 1.0f;
+    }
+}
+
+// Frames streamed from a PC take over the cube; the patterns
+// resume STREAM_HOLD_MS after the host stops sending
+static void streamStep(void) {
+    const uint8_t *streamFrame = Stream_NextFrame();
+    if (streamFrame != NULL && Stream_Active()) {
+        uint32_t streamStart = Profiler_Cycles();
+        LedOutput_Show(streamFrame, NUM_LEDS);
+        Profiler_Record(PROFILE_SLOT_OUTPUT, Profiler_Cycles() - streamStart);
+    }
+}
+
+static void renderStep(void) {
+    if (Stream_Active() || (int32_t)(SysTick_GetMs() - outputHoldUntil) < 0) {
+        return;
+    }
+    
+    // Advance the position every POSITION_STEPS renders
+    currentPosition = advancePosition(currentPosition, &positionSteps);
+    
+    // Advance the pattern every PATTERN_STEPS renders
+    if (!autoCycle) {
+        patternSteps = 0;
+    } else if (patternSteps >= PATTERN_STEPS) {
+        patternSteps = 0;
+        selectPattern((currentPattern + 1) % PATTERN_COUNT);
+    } else {
+        patternSteps++;
+    }
+    
+    // Update the current pattern (cycles per step land in profileSlots)
+    uint32_t stepStart = Profiler_Cycles();
+    updatePattern(currentPattern, currentPosition, brightness);
+    Profiler_Record(PROFILE_SLOT_PATTERN(currentPattern), Profiler_Cycles() - stepStart);
+    
+    // Show selected pattern on board LED
+    showSelectedPattern(currentPattern);
+    
+    Scheduler_Signal(presentTask);
+}
+
+// Send data to LEDs (blended with the outgoing pattern while a transition runs)
+static void presentStep(void) {
+    uint32_t outputStart = Profiler_Cycles();
+    int updateStatus = Transition_Show(testBuffer, brightness);
+    Profiler_Record(PROFILE_SLOT_OUTPUT, Profiler_Cycles() - outputStart);
+    
+    // If update failed, wait a bit before trying again
+    if (updateStatus == STATUS_ERROR) {
+        outputHoldUntil = SysTick_GetMs() + OUTPUT_RETRY_MS;
+        clearAllLeds();
+    }
+}
+
+// Frames come from render at RENDER_PERIOD_MS, but the dither stage only
+// averages out at the full frame rate, so keep sending the current frame
+// in between (each send carries the residual on). Afterglow decays per
+// frame sent, so it fades faster while this runs
+static void refreshStep(void) {
+    if (!(Output_Stages() & OUTPUT_STAGE_DITHER) || Stream_Active() ||
+        (int32_t)(SysTick_GetMs() - outputHoldUntil) < 0) {
+        return;
+    }
+    uint32_t outputStart = Profiler_Cycles();
+    LedOutput_Refresh();
+    Profiler_Record(PROFILE_SLOT_OUTPUT, Profiler_Cycles() - outputStart);
+}
+
+static uint32_t cycleCount(void) {
+    return Profiler_Cycles();
+}
+
+// SysTick wakes the core every millisecond, so no release is late by more.
+// Sleep is timed with SysTick because the DWT counter stops in WFI
+static void waitForInterrupt(void) {
+    uint32_t sleepStart = SysTick_GetCycles();
+    __WFI();
+    Profiler_Record(PROFILE_SLOT_IDLE, SysTick_GetCycles() - sleepStart);
+}
+
+static const scheduler_clock_t cubeClock = {SysTick_GetMs, cycleCount, waitForInterrupt};
+
 int main(void) {
     // Initialize system
     Board_Init();
     
-    // Initialize ADC for potentiometer
-    ADC_Init();
-    
     // Initialize LED cube
     Cube_Init();
     
@@ -517,104 +687,46 @@ int main(void) {
     initRainPattern();
     initRainRGBPattern();
     initFireworksPattern();
+    RotationTables_Init();
+    
+#if FRAMEBUFFER_BENCHMARK
+    // Time the framebuffer kernels once; read framebufferBench in the debugger
+    Framebuffer_Benchmark();
+#endif
     
-    // Main loop variables
-    int updateStatus = STATUS_OK;
-    uint32_t positionChangeTime = 0;
-    uint32_t patternChangeTime = 0;
-    uint8_t buttonState = 0;
-    float brightness = 0.5f;
+#if PATTERN_CHECK_MODE != PATTERN_CHECK_OFF
+    // Regression build: render every pattern off-screen, show the verdict on
+    // the board LED (blue = recorded/measured, green = all pass, red = failures) and stop
+    uint8_t checkFailures = PatternCheck_RunAll();
+    GPIOF->DATA = (GPIOF->DATA & ~0x0E) |
+                  (PATTERN_CHECK_MODE != PATTERN_CHECK_VERIFY ? 0x04 : (checkFailures ? 0x02 : 0x08));
+    while (1) {}
+#endif
     
-    // Updated number of patterns
-    #define PATTERN_COUNT 17
+    // Fade between patterns instead of cutting to a cleared buffer
+    Transition_Configure(transitionType, TRANSITION_DEFAULT_FRAMES);
     
     // Create a brief flash to indicate system start
     clearAllLeds();
     for (int i = 0; i < CUBE_SIZE; i++) {
         for (int j = 0; j < CUBE_SIZE; j++) {
-            setVoxel(i, j, 3, (rgb_t){20, 20, 20}); // White flash at middle layer
+            setVoxel(i, j, CUBE_SIZE / 2, (rgb_t){20, 20, 20}); // White flash at middle layer
         }
     }
-    WS2812_Show(testBuffer, NUM_LEDS);
+    LedOutput_Show(testBuffer, NUM_LEDS);
     SysTick_Delay(500);
     
-    while (1) {
-        // Update brightness from potentiometer
-        brightness = updateBrightness();
-        
-        // Handle button 1 (SW1) to change pattern
-        if (GPIO_Button1Pressed()) {
-            if (buttonState == 0 || buttonState == 2) {
-                // Button just pressed
-                buttonState = 1;
-                currentPattern = (currentPattern + 1) % PATTERN_COUNT;
-                currentPosition = 0;  // Reset position when changing patterns
-                
-                // Handle pattern-specific initialization when changing patterns
-								switch (currentPattern) {
-										case PATTERN_GAME_OF_LIFE_3D:
-												resetGameOfLife3D(); // Function call instead of direct variable access
-												break;
-										case PATTERN_SNAKE_3D:
-												resetSnake3D(); // Function call instead of direct variable access
-												break;
-								}
-							}
-        } else if (GPIO_Button2Pressed()) {
-            if (buttonState == 0 || buttonState == 1) {
-                // Button just pressed
-                buttonState = 2;
-                // Manually advance position
-                currentPosition = (currentPosition + 1) % (CUBE_SIZE * 2);
-            }
-        } else {
-            // Both buttons released
-            buttonState = 0;
-        }
-        
-        // Auto change position every 1 second
-        if (positionChangeTime >= 100) {  // 100 * 10ms = 1 second
-            positionChangeTime = 0;
-            currentPosition = (currentPosition + 1) % (CUBE_SIZE * 10); // Extended range for more animation frames
-        } else {
-            positionChangeTime++;
-        }
-        
-        // Auto change pattern every 15 seconds
-        if (patternChangeTime >= 1500) {  // 1500 * 10ms = 15 seconds
-            patternChangeTime = 0;
-            currentPattern = (currentPattern + 1) % PATTERN_COUNT;
-            currentPosition = 0;  // Reset position when changing patterns
-            
-            // Handle pattern-specific initialization when auto-changing patterns
-            switch (currentPattern) {
-										case PATTERN_GAME_OF_LIFE_3D:
-												resetGameOfLife3D(); // Function call instead of direct variable access
-												break;
-										case PATTERN_SNAKE_3D:
-												resetSnake3D(); // Function call instead of direct variable access
-												break;
-								}
-        } else {
-            patternChangeTime++;
-        }
-        
-        // Update the current pattern
-        updatePattern(currentPattern, currentPosition, brightness);
-        
-        // Show selected pattern on board LED
-        showSelectedPattern(currentPattern);
-        
-        // Send data to LEDs
-        updateStatus = WS2812_Show(testBuffer, NUM_LEDS);
-        
-        // If update failed, wait a bit before trying again
-        if (updateStatus == STATUS_ERROR) {
-            SysTick_Delay(500);
-            clearAllLeds();
-        }
-        
-        // Delay to control animation speed
-        SysTick_Delay(10);
-    }
+    // Highest priority first: input and brightness are cheap, a streamed
+    // frame beats a pattern step, present runs right after render and
+    // refreshes fill the time left over
+    Scheduler_Init(&cubeClock);
+    Scheduler_AddTask("input", inputStep, INPUT_PERIOD_MS, INPUT_BUDGET);
+    Scheduler_AddTask("adc", adcStep, ADC_PERIOD_MS, ADC_BUDGET);
+    Scheduler_AddTask("stream", streamStep, STREAM_POLL_MS, STREAM_BUDGET);
+    Scheduler_AddTask("render", renderStep, RENDER_PERIOD_MS, RENDER_BUDGET);
+    presentTask = Scheduler_AddTask("present", presentStep, SCHEDULER_EVENT, PRESENT_BUDGET);
+    Scheduler_AddTask("telemetry", Telemetry_Send, TELEMETRY_PERIOD_MS, TELEMETRY_BUDGET);
+    Scheduler_AddTask("refresh", refreshStep, REFRESH_PERIOD_MS, REFRESH_BUDGET);
+    
+    Scheduler_Run();
 }
@@ -6,7 +6,9 @@
 #define NEW_PATTERNS_H
 
 #include <stdint.h>
+#include "board.h"
 #include "led_cube.h"
+#include "WS2812.h"
 #include "pattern_functions.h"  // To get the basic pattern definitions
 
 // Pattern indices (adding to existing patterns in pattern_functions.h)
@@ -30,6 +32,7 @@ void updateRainPattern(uint8_t position, float brightness);
 
 // Pattern 5: Sphere
 void updateSpherePattern(uint8_t position, float brightness);
+int isPointOnSphere(int x, int y, int z, int centerX, int centerY, int centerZ, int radius, int thickness);
 
 // Pattern 6: Spiral
 void updateSpiralPattern(uint8_t position, float brightness);
@@ -69,8 +72,20 @@ void resetSnake3D(void);  // Add this function
 
 // Pattern 15: Text Scroller
 void updateTextScrollerPattern(uint8_t position, float brightness);
+void setTextScrollerMessage(const char *text);  // string is referenced, not copied
 
 // Pattern 16: 3D Plasma
+// Computed a layer at a time as the chain reaches it (chain_render.h) on
+// devices that take slice frames (the uDMA WS2812 and the APA102), so the
+// first LEDs go out one layer after the frame starts. The FIFO WS2812
+// would only resolve that frame into the buffer first, so there it plays
+// the baked loop in anim_plasma.c instead, which costs no sines. The loop
+// is baked for 7x7x7 by make anim_plasma in test/; other sizes compute.
+#ifndef PLASMA_FROM_FLASH
+#define PLASMA_FROM_FLASH (CUBE_SIZE == 7 && LED_CHIPSET == LED_CHIPSET_WS2812 && !WS2812_DMA)
+#endif
+
 void updatePlasmaPattern(uint8_t position, float brightness);
+extern const uint8_t plasmaAnimation[];
 
 #endif // NEW_PATTERNS_H
\ No newline at end of file
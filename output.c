@@ -0,0 +1,296 @@
+/**
+ * @file output.c
+ * @brief Afterglow, gamma, gains, power limit and dithering for the encode pass.
+ */
+
+#include <stddef.h>
+#include "output.h"
+#include "board.h"
+
+// Gains are 4.12 fixed point (4096 = unchanged)
+#define GAIN_ONE  4096U
+
+// (i / 255)^2.2 * 255 in 8.8 fixed point
+static const uint16_t gammaTable[256] = {
+        0,     0,     2,     4,     7,    11,    17,    24,
+       32,    42,    53,    65,    78,    94,   110,   128,
+      148,   169,   191,   216,   241,   269,   298,   328,
+      360,   394,   430,   467,   506,   547,   589,   633,
+      679,   726,   776,   827,   880,   934,   991,  1049,
+     1109,  1171,  1235,  1300,  1368,  1437,  1508,  1581,
+     1656,  1733,  1812,  1893,  1975,  2060,  2146,  2235,
+     2325,  2417,  2512,  2608,  2706,  2806,  2908,  3013,
+     3119,  3227,  3337,  3450,  3564,  3680,  3798,  3919,
+     4041,  4166,  4292,  4421,  4552,  4685,  4819,  4956,
+     5096,  5237,  5380,  5525,  5673,  5823,  5974,  6128,
+     6284,  6442,  6603,  6765,  6930,  7097,  7266,  7437,
+     7610,  7786,  7963,  8143,  8325,  8509,  8696,  8885,
+     9075,  9268,  9464,  9661,  9861, 10063, 10267, 10474,
+    10682, 10893, 11107, 11322, 11540, 11760, 11982, 12207,
+    12433, 12663, 12894, 13128, 13363, 13602, 13842, 14085,
+    14330, 14578, 14827, 15080, 15334, 15591, 15850, 16111,
+    16375, 16641, 16909, 17180, 17453, 17729, 18006, 18287,
+    18569, 18854, 19141, 19431, 19723, 20017, 20314, 20613,
+    20915, 21218, 21525, 21833, 22144, 22458, 22774, 23092,
+    23413, 23736, 24062, 24390, 24720, 25053, 25388, 25726,
+    26066, 26408, 26753, 27101, 27451, 27803, 28158, 28515,
+    28875, 29237, 29602, 29969, 30338, 30710, 31085, 31462,
+    31841, 32223, 32608, 32995, 33384, 33776, 34170, 34567,
+    34967, 35369, 35773, 36180, 36589, 37001, 37416, 37833,
+    38252, 38674, 39099, 39526, 39956, 40388, 40823, 41260,
+    41700, 42142, 42587, 43034, 43484, 43937, 44392, 44849,
+    45310, 45772, 46238, 46706, 47176, 47649, 48125, 48603,
+    49084, 49567, 50053, 50542, 51033, 51526, 52023, 52522,
+    53023, 53527, 54034, 54543, 55055, 55570, 56087, 56607,
+    57129, 57654, 58182, 58712, 59245, 59780, 60318, 60859,
+    61402, 61948, 62497, 63048, 63602, 64159, 64718, 65280,
+};
+
+static uint8_t stages = OUTPUT_DEFAULT_STAGES;
+static float brightness = 1.0f;
+static uint8_t afterglowDecay = OUTPUT_AFTERGLOW_DEFAULT;
+static uint16_t whiteBalance[3] = {256, 256, 256};   // G, R, B
+static const uint8_t *ledBalance = NULL; // Per-LED G, R, B gains (255 = unchanged)
+static uint32_t powerBudget = (OUTPUT_POWER_BUDGET_MA * 255U) / OUTPUT_MA_PER_CHANNEL;
+static uint8_t hardwareLevels = 0;       // LED brightness field steps (0 = none)
+
+// Per-LED state, one entry per channel in buffer order
+static uint8_t afterglow[NUM_LEDS * 3];  // Last value after the afterglow stage
+static uint8_t afterglowLit = 0;         // OR of afterglow[] as of the last frame
+static uint8_t residual[NUM_LEDS * 3];   // Dither fraction carried to the next frame
+
+// Folded for the current frame
+static uint32_t gain[3];
+static uint32_t unlimitedGain[3];        // gain[] without the power limit
+static uint8_t gainActive = 0;
+static const uint8_t *balance = NULL;    // ledBalance if white balance is on
+static uint32_t powerScale = GAIN_ONE;   // Power limit share of gain[]
+static uint8_t powerMeasured = 0;        // powerScale comes from a frame sent under this budget
+static uint32_t channelTotal[3];         // Sum of 8.8 values before the gains
+static uint32_t frameBudget;             // Power budget in sent channel units
+static uint32_t drawn;                   // Sent so far this frame, same units
+static uint8_t hardwareLevel = 0;        // Brightness field value for this frame
+static uint8_t glowLit;                  // OR of the afterglow history written this frame
+static uint32_t generation = 0;          // Bumped when the mapping of input to output changes
+
+void Output_SetStages(uint8_t enabled) {
+    if ((enabled & ~stages) & OUTPUT_STAGE_POWER_LIMIT) {
+        powerMeasured = 0;
+    }
+    if (enabled != stages) {
+        stages = enabled;
+        generation++;
+    }
+}
+
+uint8_t Output_Stages(void) {
+    return stages;
+}
+
+void Output_SetBrightness(float value) {
+    if (value < 0.0f) value = 0.0f;
+    if (value > 1.0f) value = 1.0f;
+    if (value != brightness) {
+        brightness = value;
+        generation++;
+    }
+}
+
+void Output_SetAfterglow(uint8_t decay) {
+    afterglowDecay = decay;
+    generation++;
+}
+
+void Output_SetWhiteBalance(uint16_t g, uint16_t r, uint16_t b) {
+    whiteBalance[0] = (g > 256) ? 256 : g;
+    whiteBalance[1] = (r > 256) ? 256 : r;
+    whiteBalance[2] = (b > 256) ? 256 : b;
+    generation++;
+}
+
+void Output_SetLedBalance(const uint8_t *gains) {
+    ledBalance = gains;
+    generation++;
+}
+
+void Output_SetPowerBudget(uint32_t milliamps) {
+    powerBudget = (milliamps * 255U) / OUTPUT_MA_PER_CHANNEL;
+    powerMeasured = 0;
+    generation++;
+}
+
+void Output_SetHardwareLevels(uint8_t levels) {
+    hardwareLevels = levels;
+    generation++;
+}
+
+uint8_t Output_HardwareLevel(void) {
+    return hardwareLevel;
+}
+
+uint8_t Output_Stateful(void) {
+    return (stages & (OUTPUT_STAGE_AFTERGLOW | OUTPUT_STAGE_DITHER)) != 0;
+}
+
+uint32_t Output_Generation(void) {
+    return generation;
+}
+
+uint8_t Output_FrameBlank(uint8_t inputLit) {
+    // With no gain left every channel rounds to 0, dither residual included
+    if ((stages & OUTPUT_STAGE_BRIGHTNESS) && brightness == 0.0f) {
+        return 1;
+    }
+    if ((stages & OUTPUT_STAGE_WHITE_BALANCE) && (whiteBalance[0] | whiteBalance[1] | whiteBalance[2]) == 0) {
+        return 1;
+    }
+    // An off input stays off unless an afterglow is still fading out
+    return !inputLit && !((stages & OUTPUT_STAGE_AFTERGLOW) && afterglowLit);
+}
+
+// 8.8 value of one channel after afterglow, gamma and the LED's own
+// balance. The afterglow history is only written when update is set
+static inline uint32_t channelLevel(uint16_t index, uint8_t value, uint8_t update) {
+    if (stages & OUTPUT_STAGE_AFTERGLOW) {
+        uint8_t faded = (uint8_t)((afterglow[index] * afterglowDecay) >> 8);
+        if (faded > value) value = faded;
+        if (update) {
+            afterglow[index] = value;
+            glowLit |= value;
+        }
+    }
+
+    // 8.8 fixed point from here on
+    uint32_t fixed = (stages & OUTPUT_STAGE_GAMMA) ? gammaTable[value] : ((uint32_t)value << 8);
+    if (balance != NULL) {
+        fixed = (fixed * (balance[index] + 1U)) >> 8;
+    }
+    return fixed;
+}
+
+// Power limit scale for the totals in channelTotal[]
+static void updatePowerScale(void) {
+    // What the frame draws without the limit, in channel units
+    uint32_t unlimited = 0;
+    for (uint8_t c = 0; c < 3; c++) {
+        unlimited += ((channelTotal[c] >> 8) * unlimitedGain[c]) >> 12;
+    }
+    if (hardwareLevels != 0) {
+        unlimited = (unlimited * hardwareLevel) / hardwareLevels;
+    }
+    uint32_t scale = GAIN_ONE;
+    if (unlimited > powerBudget) {
+        scale = (powerBudget * GAIN_ONE) / unlimited;
+    }
+    if (scale != powerScale) {
+        powerScale = scale;
+        generation++;
+    }
+}
+
+void Output_BeginFrame(const frame_source_t *src, int count) {
+    float common = (stages & OUTPUT_STAGE_BRIGHTNESS) ? brightness : 1.0f;
+    hardwareLevel = hardwareLevels;
+    if (hardwareLevels != 0 && (stages & OUTPUT_STAGE_BRIGHTNESS)) {
+        // Smallest hardware level at or above the brightness; the channel
+        // gain makes up the rest and stays close to 1 above the first level
+        float exact = common * hardwareLevels;
+        hardwareLevel = (uint8_t)exact;
+        if (hardwareLevel < exact) hardwareLevel++;
+        common = (hardwareLevel != 0) ? exact / hardwareLevel : 0.0f;
+    }
+    balance = (stages & OUTPUT_STAGE_WHITE_BALANCE) ? ledBalance : NULL;
+
+    for (uint8_t c = 0; c < 3; c++) {
+        float channel = common;
+        if (stages & OUTPUT_STAGE_WHITE_BALANCE) {
+            channel *= whiteBalance[c] / 256.0f;
+        }
+        unlimitedGain[c] = (uint32_t)(channel * GAIN_ONE);
+        channelTotal[c] = 0;
+    }
+
+    if (!(stages & OUTPUT_STAGE_POWER_LIMIT)) {
+        powerScale = GAIN_ONE;
+#if OUTPUT_POWER_READ_AHEAD
+    } else if (src->kind != FRAME_SOURCE_SLICES) {
+        // Measure the frame before any of it goes out, so the limit holds
+        // on the frame that goes over. Layers computed as the chain reaches
+        // them can't be read ahead; those keep the last frame's scale and
+        // rely on the clamp in Output_ProcessLed
+        for (int led = 0; led < count; ++led) {
+            uint8_t mixed[3];
+            const uint8_t *grb = FrameSource_Led(src, led, mixed);
+            for (uint8_t c = 0; c < 3; c++) {
+                channelTotal[c] += channelLevel((uint16_t)(led * 3 + c), grb[c], 0);
+            }
+        }
+        updatePowerScale();
+        channelTotal[0] = channelTotal[1] = channelTotal[2] = 0;
+#endif
+    } else if (!powerMeasured) {
+        // Nothing sent under this budget yet: scale as if every LED were
+        // full white, which no frame can go over
+        channelTotal[0] = channelTotal[1] = channelTotal[2] = (uint32_t)count * (255U << 8);
+        updatePowerScale();
+        channelTotal[0] = channelTotal[1] = channelTotal[2] = 0;
+    }
+
+    for (uint8_t c = 0; c < 3; c++) {
+        gain[c] = (unlimitedGain[c] * powerScale) >> 12;
+    }
+    gainActive = (stages & (OUTPUT_STAGE_WHITE_BALANCE | OUTPUT_STAGE_BRIGHTNESS |
+                            OUTPUT_STAGE_POWER_LIMIT)) != 0;
+
+    // The same budget in the values sent, which the hardware level scales
+    frameBudget = powerBudget;
+    if (hardwareLevels != 0) {
+        frameBudget = (hardwareLevel != 0) ? (powerBudget * hardwareLevels) / hardwareLevel : UINT32_MAX;
+    }
+    drawn = 0;
+    glowLit = 0;
+}
+
+void Output_ProcessLed(uint16_t led, uint8_t *grb) {
+    uint16_t base = led * 3;
+
+    for (uint8_t c = 0; c < 3; c++) {
+        uint32_t fixed = channelLevel(base + c, grb[c], 1);
+        channelTotal[c] += fixed;
+        if (gainActive) {
+            fixed = (fixed * gain[c]) >> 12;
+        }
+
+        if (stages & OUTPUT_STAGE_DITHER) {
+            fixed += residual[base + c];
+            residual[base + c] = (uint8_t)(fixed & 0xFF);
+        }
+        grb[c] = (uint8_t)(fixed >> 8);
+    }
+
+    if (stages & OUTPUT_STAGE_POWER_LIMIT) {
+        // Hard stop at the budget within the frame: catches dither
+        // rounding and slice frames brighter than the one before
+        uint32_t sum = (uint32_t)grb[0] + grb[1] + grb[2];
+        if (sum > frameBudget - drawn) {
+            uint32_t left = frameBudget - drawn;
+            for (uint8_t c = 0; c < 3; c++) {
+                grb[c] = (uint8_t)((grb[c] * left) / sum);
+            }
+            sum = (uint32_t)grb[0] + grb[1] + grb[2];
+        }
+        drawn += sum;
+    }
+}
+
+void Output_EndFrame(void) {
+    // The next frame is scaled for this one's total unless it is measured
+    // ahead
+    if (stages & OUTPUT_STAGE_POWER_LIMIT) {
+        updatePowerScale();
+        powerMeasured = 1;
+    }
+    if (stages & OUTPUT_STAGE_AFTERGLOW) {
+        afterglowLit = glowLit;
+    }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file output.h
+ * @brief Post-processing chain run per LED inside the WS2812 encode pass.
+ *
+ * Enabled stages run in this order, each on the result of the one before:
+ *
+ *   AFTERGLOW      max(new value, last value * decay), so LEDs fade out
+ *   GAMMA          2.2 curve from the 8-bit value to 8.8 fixed point
+ *   WHITE_BALANCE  per-channel gain, then the LED's own gains if a
+ *                  calibration table is set (Output_SetLedBalance)
+ *   BRIGHTNESS     global brightness (patterns then draw at 1.0)
+ *   POWER_LIMIT    scale the frame down to the current budget
+ *   DITHER         carry the fraction into the next frame instead of dropping it
+ *
+ * White balance, brightness and the power limit are folded into one gain
+ * per channel at the start of each frame, so a channel costs one multiply
+ * (two with a per-LED balance table). Drivers for LEDs with their own
+ * brightness field can take the coarse part of the brightness in hardware
+ * (Output_SetHardwareLevels). Each LED's afterglow history and dither
+ * residual are touched once, in the loop that builds the SPI symbols.
+ * With no stage enabled the encoders skip the chain.
+ *
+ * The power limit totals each frame in the encode pass and scales the
+ * next frame by it, so every LED is still touched once. A frame that
+ * jumps over the budget (dark to full white) is stopped by a clamp in the
+ * encode pass instead: the far end of the chain goes dark for that one
+ * frame rather than the whole frame dimming. The first frame after the
+ * limit is set up has no total to go by and is scaled for full white.
+ * With OUTPUT_POWER_READ_AHEAD, Output_BeginFrame reads stored frames
+ * once more before sending them, so they dim evenly on the frame that
+ * goes over, at the cost of a second read (and blend) of every LED.
+ * Slice frames are computed as they go out and are never read ahead.
+ *
+ * RGBW LEDs get their white channel from Output_ExtractWhite after the
+ * chain, so the power limit counts white as its three channels (an upper
+ * bound on the real current).
+ */
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdint.h>
+#include "frame_source.h"
+
+// Stage bits for Output_SetStages()
+#define OUTPUT_STAGE_AFTERGLOW      0x01
+#define OUTPUT_STAGE_GAMMA          0x02
+#define OUTPUT_STAGE_WHITE_BALANCE  0x04
+#define OUTPUT_STAGE_BRIGHTNESS     0x08
+#define OUTPUT_STAGE_POWER_LIMIT    0x10
+#define OUTPUT_STAGE_DITHER         0x20
+
+// Stages enabled at boot. Dithering only looks smooth once frames go out
+// at ~100 fps, so while it is on main.c resends the current frame between
+// pattern steps (REFRESH_PERIOD_MS, ~80 fps at 7x7x7 over WS2812).
+// The cost of a set of stages is measured on the cube: enc= on the
+// telemetry line is the encode pass in CPU cycles, chain included.
+#ifndef OUTPUT_DEFAULT_STAGES
+#define OUTPUT_DEFAULT_STAGES       0
+#endif
+
+// 1: measure stored frames before sending them (see above)
+#ifndef OUTPUT_POWER_READ_AHEAD
+#define OUTPUT_POWER_READ_AHEAD     0
+#endif
+
+#define OUTPUT_AFTERGLOW_DEFAULT    192     // Share of last frame kept (of 256)
+#define OUTPUT_POWER_BUDGET_MA      2000U   // Default LED current budget
+#define OUTPUT_MA_PER_CHANNEL       20U     // WS2812 channel current at 255
+
+/**
+ * @brief Enable a set of OUTPUT_STAGE_* bits (0 = send frames unchanged).
+ */
+void Output_SetStages(uint8_t stages);
+
+/**
+ * @brief Currently enabled OUTPUT_STAGE_* bits.
+ */
+uint8_t Output_Stages(void);
+
+/**
+ * @brief Brightness used by OUTPUT_STAGE_BRIGHTNESS (0.0 - 1.0).
+ */
+void Output_SetBrightness(float brightness);
+
+/**
+ * @brief Share of the previous value an LED keeps each frame (0 - 255 of 256).
+ */
+void Output_SetAfterglow(uint8_t decay);
+
+/**
+ * @brief Per-channel gains for OUTPUT_STAGE_WHITE_BALANCE (256 = unchanged).
+ */
+void Output_SetWhiteBalance(uint16_t g, uint16_t r, uint16_t b);
+
+/**
+ * @brief Per-LED gains for OUTPUT_STAGE_WHITE_BALANCE, applied after the
+ *        per-channel ones (for LEDs from different bins).
+ * @param gains G, R, B per LED in buffer order (255 = unchanged), usually a
+ *        const calibration table in flash; NULL for none. Not copied.
+ */
+void Output_SetLedBalance(const uint8_t *gains);
+
+/**
+ * @brief LED current budget for OUTPUT_STAGE_POWER_LIMIT.
+ */
+void Output_SetPowerBudget(uint32_t milliamps);
+
+/**
+ * @brief Let OUTPUT_STAGE_BRIGHTNESS dim partly in the LEDs themselves.
+ *
+ * For LEDs with a global brightness field (APA102: 31 levels). Each frame
+ * the brightness is rounded up to the next hardware level and only the
+ * remainder is applied to the channels, so dim frames keep all 8 bits of
+ * color resolution instead of a few.
+ * @param levels Number of hardware levels, 0 to dim only in the channels.
+ */
+void Output_SetHardwareLevels(uint8_t levels);
+
+/**
+ * @brief Hardware brightness level chosen for the current frame
+ *        (the full level count when hardware dimming is not in use).
+ */
+uint8_t Output_HardwareLevel(void);
+
+/**
+ * @brief Whether an enabled stage keeps per-LED history (afterglow, dither),
+ *        so the same input can give a different output next frame.
+ */
+uint8_t Output_Stateful(void);
+
+/**
+ * @brief Changes whenever the stages or gains change what a given input
+ *        becomes (settings, or the power limit reacting to a frame).
+ */
+uint32_t Output_Generation(void);
+
+/**
+ * @brief Whether the next frame comes out all off, known without running it:
+ *        the gains are at 0, or the input is off and no afterglow is left.
+ * @param inputLit OR of the frame's input values (0 = all off).
+ */
+uint8_t Output_FrameBlank(uint8_t inputLit);
+
+/**
+ * @brief Fold the per-frame gains; called by the encoder before the first LED.
+ * @param src The frame about to be sent, measured for the power limit
+ *        with OUTPUT_POWER_READ_AHEAD.
+ * @param count Number of LEDs in the frame.
+ */
+void Output_BeginFrame(const frame_source_t *src, int count);
+
+/**
+ * @brief Run one LED through the enabled stages in place.
+ * @param led LED buffer index (selects the afterglow and dither state).
+ * @param grb The LED's three channels, replaced by the values to send.
+ */
+void Output_ProcessLed(uint16_t led, uint8_t *grb);
+
+/**
+ * @brief Close the frame; its scale carries to the next frame if that one
+ *        can't be measured ahead.
+ */
+void Output_EndFrame(void);
+
+/**
+ * @brief Move the part of an LED common to all three channels to white.
+ * @param grb The LED's processed channels.
+ * @param grbw Receives G, R, B less the white, then W (may be the same buffer).
+ */
+static inline void Output_ExtractWhite(const uint8_t *grb, uint8_t *grbw) {
+    uint8_t w = grb[0];
+    if (grb[1] < w) w = grb[1];
+    if (grb[2] < w) w = grb[2];
+    grbw[0] = (uint8_t)(grb[0] - w);
+    grbw[1] = (uint8_t)(grb[1] - w);
+    grbw[2] = (uint8_t)(grb[2] - w);
+    grbw[3] = w;
+}
+
+#endif // OUTPUT_H
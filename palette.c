@@ -0,0 +1,100 @@
+/**
+ * @file palette.c
+ * @brief Indexed framebuffer, palette and its brightness-scaled copy.
+ */
+
+#include "palette.h"
+#include "board.h"
+#include "common_functions.h"
+#include "framebuffer.h"
+
+static uint8_t indexBuffer[NUM_LEDS] __attribute__((aligned(4)));
+static rgb_t entries[PALETTE_ENTRIES];
+
+// entries[] scaled by scaledBrightness, GRB order as sent to the LEDs
+static uint8_t scaled[PALETTE_ENTRIES * 3];
+static float scaledBrightness = -1.0f;
+static uint16_t scaledCount = 0;   // Entries valid in scaled[]
+static uint16_t usedCount = 1;     // Highest entry ever set + 1
+static uint8_t dirty = 1;
+
+static uint8_t pending = 0;
+
+void Palette_BeginFrame(void) {
+    Framebuffer_Clear(indexBuffer, NUM_LEDS);  // PALETTE_OFF is 0
+    pending = 1;
+}
+
+void Palette_SetEntry(uint8_t index, rgb_t color) {
+    if (index == PALETTE_OFF) {
+        return;
+    }
+    rgb_t *entry = &entries[index];
+    if (entry->r != color.r || entry->g != color.g || entry->b != color.b) {
+        *entry = color;
+        dirty = 1;
+    }
+    if (index >= usedCount) {
+        usedCount = index + 1;
+    }
+}
+
+void Palette_Rotate(uint8_t first, uint8_t count) {
+    if (first == PALETTE_OFF || count < 2 || first + count > PALETTE_ENTRIES) {
+        return;
+    }
+    rgb_t wrapped = entries[first];
+    for (uint16_t i = first; i < first + count - 1; i++) {
+        entries[i] = entries[i + 1];
+    }
+    entries[first + count - 1] = wrapped;
+    if (first + count > usedCount) {
+        usedCount = first + count;
+    }
+    dirty = 1;
+}
+
+void Palette_SetVoxel(uint8_t x, uint8_t y, uint8_t z, uint8_t index) {
+    int16_t slot = voxelBufferIndex(x, y, z);
+    if (slot >= 0) {
+        indexBuffer[slot] = index;
+    }
+}
+
+uint8_t Palette_FramePending(void) {
+    return pending;
+}
+
+const uint8_t *Palette_TakeFrame(void) {
+    pending = 0;
+    return indexBuffer;
+}
+
+const uint8_t *Palette_Prepare(float brightness) {
+    if (dirty || brightness != scaledBrightness || scaledCount != usedCount) {
+        // Entries past usedCount were never set and stay black
+        for (uint16_t i = 0; i < usedCount; i++) {
+            rgb_t color = scaleBrightness(entries[i], brightness);
+            scaled[i * 3 + 0] = color.g;
+            scaled[i * 3 + 1] = color.r;
+            scaled[i * 3 + 2] = color.b;
+        }
+        scaledBrightness = brightness;
+        scaledCount = usedCount;
+        dirty = 0;
+    }
+    return scaled;
+}
+
+void Palette_Resolve(float brightness) {
+    if (!pending) {
+        return;
+    }
+    const uint8_t *table = Palette_Prepare(brightness);
+    const uint8_t *indices = Palette_TakeFrame();
+    clearAllLeds(); // Marks the buffer as overwritten for incremental drawers
+    for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        const uint8_t *grb = &table[indices[i] * 3];
+        setBufferColor(i, (rgb_t){grb[0], grb[1], grb[2]});
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file palette.h
+ * @brief Optional 8-bit indexed framebuffer with a 256-entry palette.
+ *
+ * A pattern that only needs a few colors can draw palette indices (one
+ * byte per LED) instead of GRB triplets. It calls Palette_BeginFrame(),
+ * sets the palette entries it uses to their full-brightness colors and
+ * draws with Palette_SetVoxel(). Brightness is applied once per palette
+ * entry when the frame is output, and the indices are expanded to GRB in
+ * the WS2812 encode pass, so testBuffer is never written. Changing an
+ * entry recolors every LED that uses it without touching the indices,
+ * which makes color cycling free.
+ *
+ * Index 0 is off and cannot be changed. Frames that need GRB (transitions,
+ * the pattern check) are expanded into the draw buffer by Palette_Resolve().
+ */
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <stdint.h>
+#include "led_cube.h"
+
+#define PALETTE_ENTRIES  256
+#define PALETTE_OFF      0     // Index every LED starts a frame with
+
+/**
+ * @brief Switch the current frame to indexed mode and set every LED to PALETTE_OFF.
+ */
+void Palette_BeginFrame(void);
+
+/**
+ * @brief Set a palette entry to its full-brightness color (index 0 is ignored).
+ */
+void Palette_SetEntry(uint8_t index, rgb_t color);
+
+/**
+ * @brief Rotate entries first..first+count-1 by one step (entry first takes
+ *        the color of first+1, the last takes the old first).
+ */
+void Palette_Rotate(uint8_t first, uint8_t count);
+
+/**
+ * @brief Set the palette index of one voxel.
+ */
+void Palette_SetVoxel(uint8_t x, uint8_t y, uint8_t z, uint8_t index);
+
+/**
+ * @brief Whether an indexed frame has been drawn and not yet output.
+ */
+uint8_t Palette_FramePending(void);
+
+/**
+ * @brief Hand the pending frame to the output stage.
+ * @return NUM_LEDS palette indices in LED buffer order.
+ */
+const uint8_t *Palette_TakeFrame(void);
+
+/**
+ * @brief GRB table for the current entries at a brightness.
+ *
+ * Entries are only rescaled when the brightness or the palette changed.
+ * @return PALETTE_ENTRIES * GRB bytes.
+ */
+const uint8_t *Palette_Prepare(float brightness);
+
+/**
+ * @brief Expand a pending indexed frame into the current draw buffer.
+ *
+ * Does nothing if the frame was drawn in GRB.
+ */
+void Palette_Resolve(float brightness);
+
+#endif // PALETTE_H
@@ -0,0 +1,145 @@
+/**
+ * @file pattern_check.c
+ * @brief Seeded pattern runs hashed frame by frame and compared with goldens.
+ */
+
+#include "pattern_check.h"
+#include "board.h"
+#include "common_functions.h"
+#include "palette.h"
+#include "chain_render.h"
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_STREAM
+#include "stream_encoder.h"
+#endif
+
+#define FNV_OFFSET_BASIS  2166136261U
+#define FNV_PRIME         16777619U
+
+pattern_check_result_t patternCheckResults[PATTERN_COUNT];
+
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_RECORD
+uint32_t patternCheckHashes[PATTERN_COUNT][PATTERN_CHECK_FRAMES];
+#endif
+
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_STREAM
+pattern_stream_size_t patternStreamSizes[PATTERN_COUNT];
+#endif
+
+uint32_t PatternCheck_HashFrame(const uint8_t *frame) {
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (uint16_t i = 0; i < NUM_LEDS * 3; i++) {
+        hash = (hash ^ frame[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// Position advances the same way for every pattern so runs are comparable
+uint32_t PatternCheck_RenderFrame(uint8_t pattern, uint16_t frame) {
+    uint8_t position = (uint8_t)((frame / PATTERN_CHECK_FRAMES_PER_STEP) % 70);
+    updatePattern(pattern, position, PATTERN_CHECK_BRIGHTNESS);
+    Palette_Resolve(PATTERN_CHECK_BRIGHTNESS);
+    ChainRender_Resolve();
+    return PatternCheck_HashFrame(testBuffer);
+}
+
+void PatternCheck_Render(uint8_t pattern, uint32_t *hashes) {
+    seedPatternRand(PATTERN_CHECK_SEED);
+    for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+        hashes[f] = PatternCheck_RenderFrame(pattern, f);
+    }
+}
+
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_STREAM
+static stream_encoder_t encoder;
+static uint8_t packet[STREAM_MAX_PACKET];
+
+// Encode one pattern's run the way a PC sender would stream it
+static void measureStream(uint8_t pattern, pattern_stream_size_t *size) {
+    StreamEncoder_Init(&encoder, PATTERN_CHECK_KEY_INTERVAL);
+    seedPatternRand(PATTERN_CHECK_SEED);
+    for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+        PatternCheck_RenderFrame(pattern, f);
+        uint16_t bytes = StreamEncoder_Encode(&encoder, testBuffer, packet);
+        size->totalBytes += bytes;
+        if (bytes > size->maxBytes) size->maxBytes = bytes;
+        size->packets[packet[2]]++;
+    }
+}
+#endif
+
+uint8_t PatternCheck_CompareFrames(const uint8_t *expected, const uint8_t *actual,
+                                   pattern_check_result_t *result) {
+    result->voxelKnown = 0;
+    for (uint16_t slot = 0; slot < NUM_LEDS; slot++) {
+        const uint8_t *e = &expected[slot * 3];
+        const uint8_t *a = &actual[slot * 3];
+        if (e[0] == a[0] && e[1] == a[1] && e[2] == a[2]) {
+            continue;
+        }
+        int16_t chain = bufferLedIndex(slot);
+        if (chain < 0) {
+            continue;  // Past the last working LED; never shown
+        }
+        // Undo LED_MAP_ENTRY, as ChainRender_Led() does
+        uint8_t row = (uint8_t)((chain / CUBE_SIZE) % CUBE_SIZE);
+        result->x = LED_MAP_LAYER(chain / (CUBE_SIZE * CUBE_SIZE));
+        result->y = LED_MAP_ROW(row);
+        result->z = LED_MAP_RUN(result->y, chain % CUBE_SIZE);
+        result->expectedColor = (rgb_t){e[0], e[1], e[2]};
+        result->actualColor = (rgb_t){a[0], a[1], a[2]};
+        result->voxelKnown = 1;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t PatternCheck_Verify(uint8_t pattern, pattern_check_result_t *result) {
+    const uint32_t *golden = patternGolden[pattern];
+    uint8_t recorded = 0;
+
+    for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+        if (golden[f] != 0) {
+            recorded = 1;
+            break;
+        }
+    }
+
+    result->status = recorded ? PATTERN_CHECK_PASS : PATTERN_CHECK_UNRECORDED;
+    result->frame = 0;
+    result->expected = 0;
+    result->actual = 0;
+    result->voxelKnown = 0;
+
+    // Always render the full run so later patterns see the same state
+    seedPatternRand(PATTERN_CHECK_SEED);
+    for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+        uint32_t hash = PatternCheck_RenderFrame(pattern, f);
+        if (result->status == PATTERN_CHECK_PASS && hash != golden[f]) {
+            result->status = PATTERN_CHECK_FAIL;
+            result->frame = f;
+            result->expected = golden[f];
+            result->actual = hash;
+        }
+    }
+    return result->status;
+}
+
+uint8_t PatternCheck_RunAll(void) {
+    uint8_t failures = 0;
+
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_RECORD
+        PatternCheck_Render(p, patternCheckHashes[p]);
+        patternCheckResults[p].status = PATTERN_CHECK_PASS;
+#elif PATTERN_CHECK_MODE == PATTERN_CHECK_STREAM
+        measureStream(p, &patternStreamSizes[p]);
+        patternCheckResults[p].status = PATTERN_CHECK_PASS;
+#else
+        if (PatternCheck_Verify(p, &patternCheckResults[p]) != PATTERN_CHECK_PASS) {
+            failures++;
+        }
+#endif
+    }
+    clearAllLeds();
+    return failures;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file pattern_check.h
+ * @brief Golden-frame regression check for the patterns.
+ *
+ * Every pattern is run for PATTERN_CHECK_FRAMES frames from a fixed
+ * patternRand() seed and each rendered frame is reduced to a 32-bit hash.
+ * The goldens in pattern_golden.c are recorded by the host build in test/,
+ * which also keeps the golden frames themselves and so can name the first
+ * voxel that differs; on the cube only the hashes fit, so a verify build
+ * reports the first frame that differs. A pattern without goldens fails.
+ * A record build stores the hashes in RAM so they can be dumped with the
+ * debugger, e.g. to compare a toolchain whose libm rounds differently. A
+ * stream build instead runs every frame through the stream encoder and
+ * records the packet sizes. The check only renders into the frame buffer;
+ * nothing is sent to the cube.
+ */
+#ifndef PATTERN_CHECK_H
+#define PATTERN_CHECK_H
+
+#include <stdint.h>
+#include "pattern_functions.h"
+
+// Build modes
+#define PATTERN_CHECK_OFF      0
+#define PATTERN_CHECK_RECORD   1
+#define PATTERN_CHECK_VERIFY   2
+#define PATTERN_CHECK_STREAM   3   // Measure stream packet sizes
+
+#ifndef PATTERN_CHECK_MODE
+#define PATTERN_CHECK_MODE     PATTERN_CHECK_OFF
+#endif
+
+#define PATTERN_CHECK_FRAMES          64
+#define PATTERN_CHECK_SEED            1234
+#define PATTERN_CHECK_FRAMES_PER_STEP 10    // Frames between position changes
+#define PATTERN_CHECK_BRIGHTNESS      0.5f
+#define PATTERN_CHECK_KEY_INTERVAL    30    // Stream keyframe spacing in stream mode
+
+// Result status
+#define PATTERN_CHECK_PASS        0
+#define PATTERN_CHECK_FAIL        1
+#define PATTERN_CHECK_UNRECORDED  2   // No golden for this pattern (counts as a failure)
+
+typedef struct {
+    uint8_t status;
+    uint16_t frame;      // First diverging frame (FAIL only)
+    uint32_t expected;   // Golden hash of that frame
+    uint32_t actual;     // Hash that was rendered
+    // First differing voxel of that frame; only known where the golden
+    // frame itself is at hand (PatternCheck_CompareFrames)
+    uint8_t voxelKnown;
+    uint8_t x, y, z;
+    rgb_t expectedColor;
+    rgb_t actualColor;
+} pattern_check_result_t;
+
+// Golden hashes, all zero for a pattern that has not been recorded
+extern const uint32_t patternGolden[PATTERN_COUNT][PATTERN_CHECK_FRAMES];
+
+// Per-pattern outcome of the last PatternCheck_RunAll()
+extern pattern_check_result_t patternCheckResults[PATTERN_COUNT];
+
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_RECORD
+// Hashes captured by a record run, laid out like patternGolden
+extern uint32_t patternCheckHashes[PATTERN_COUNT][PATTERN_CHECK_FRAMES];
+#endif
+
+#if PATTERN_CHECK_MODE == PATTERN_CHECK_STREAM
+typedef struct {
+    uint32_t totalBytes;                // Sum of packet sizes (avg = total / FRAMES)
+    uint16_t maxBytes;
+    uint16_t packets[5];                // Packets of each STREAM_TYPE_* (index = type)
+} pattern_stream_size_t;
+
+extern pattern_stream_size_t patternStreamSizes[PATTERN_COUNT];
+#endif
+
+/**
+ * @brief FNV-1a hash of one GRB frame buffer (NUM_LEDS * 3 bytes).
+ */
+uint32_t PatternCheck_HashFrame(const uint8_t *frame);
+
+/**
+ * @brief Render frame @p frame of a run into testBuffer and hash it.
+ *
+ * Frames must be rendered in order, after seedPatternRand(PATTERN_CHECK_SEED)
+ * for frame 0; the check functions below do this themselves.
+ */
+uint32_t PatternCheck_RenderFrame(uint8_t pattern, uint16_t frame);
+
+/**
+ * @brief Render one pattern from the fixed seed and hash every frame.
+ * @param hashes Receives PATTERN_CHECK_FRAMES hashes.
+ */
+void PatternCheck_Render(uint8_t pattern, uint32_t *hashes);
+
+/**
+ * @brief Re-render one pattern and compare it with its golden hashes.
+ * @return PATTERN_CHECK_PASS, PATTERN_CHECK_FAIL or PATTERN_CHECK_UNRECORDED.
+ */
+uint8_t PatternCheck_Verify(uint8_t pattern, pattern_check_result_t *result);
+
+/**
+ * @brief Find the first voxel where two GRB frames differ.
+ *
+ * Fills the voxel fields of @p result (voxelKnown = 0 if the frames match).
+ * @return 1 if the frames differ.
+ */
+uint8_t PatternCheck_CompareFrames(const uint8_t *expected, const uint8_t *actual,
+                                   pattern_check_result_t *result);
+
+/**
+ * @brief Record, verify or measure every pattern, depending on PATTERN_CHECK_MODE.
+ *
+ * Pattern state carries over between patterns, so this must run once,
+ * straight after boot, for the hashes to be reproducible.
+ * @return Number of patterns that failed verification or have no goldens.
+ */
+uint8_t PatternCheck_RunAll(void);
+
+#endif // PATTERN_CHECK_H
@@ -20,6 +20,7 @@ void updateXPlanes(uint8_t position, float brightness);
 void updateYPlanes(uint8_t position, float brightness);
 void updateZPlanes(uint8_t position, float brightness);
 void updateCountdownPattern(uint8_t position, float brightness);
+void countdownStepDown(void);
 
 // Update the current pattern based on selection
 void updatePattern(uint8_t pattern, uint8_t position, float brightness) {
@@ -81,6 +82,30 @@ void updatePattern(uint8_t pattern, uint8_t position, float brightness) {
     }
 }
 
+// Position for the next render step: a new one every POSITION_STEPS steps
+uint8_t advancePosition(uint8_t position, uint32_t *steps) {
+    if (*steps >= POSITION_STEPS) {
+        *steps = 0;
+        return (uint8_t)((position + 1) % POSITION_RANGE); // Extended range for more animation frames
+    }
+    (*steps)++;
+    return position;
+}
+
+// Give the running pattern first look at an SW2 event
+// Returns 1 if the pattern used the event, 0 to fall back to the default action
+uint8_t handlePatternButton(uint8_t pattern, const button_event_t *event) {
+    switch (pattern) {
+        case PATTERN_COUNTDOWN:
+            if (event->type == BUTTON_EVENT_PRESS) {
+                countdownStepDown();
+                return 1;
+            }
+            break;
+    }
+    return 0;
+}
+
 // Display the selected pattern on the onboard RGB LED
 void showSelectedPattern(uint8_t pattern) {
     // Define the GPIO port F data register for direct access to the RGB LED
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include "led_cube.h"
+#include "GPIO.h"
 
 // Pattern types - basic patterns
 #define PATTERN_PLANES_X     0  // Planes moving along X axis (left to right)
@@ -14,15 +15,25 @@
 #define PATTERN_PLANES_Z     2  // Planes moving along Z axis (bottom to top)
 #define PATTERN_COUNTDOWN    3  // Countdown from 9 to 0
 
+// Total number of patterns in the updatePattern() switch
+#define PATTERN_COUNT        17
+
+// Render steps per position, and the number of positions before wrapping
+#define POSITION_STEPS       100U
+#define POSITION_RANGE       (CUBE_SIZE * 10)
+
 // Pattern functions
 void updatePattern(uint8_t pattern, uint8_t position, float brightness);
+uint8_t advancePosition(uint8_t position, uint32_t *steps);
 void showSelectedPattern(uint8_t pattern);
+uint8_t handlePatternButton(uint8_t pattern, const button_event_t *event);
 
 // Basic plane patterns (implemented in main.c)
 void updateXPlanes(uint8_t position, float brightness);
 void updateYPlanes(uint8_t position, float brightness);
 void updateZPlanes(uint8_t position, float brightness);
 void updateCountdownPattern(uint8_t position, float brightness);
+void countdownStepDown(void);
 
 // Functions to reset complex pattern states
 void resetGameOfLife3D(void);
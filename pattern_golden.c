@@ -0,0 +1,235 @@
+/**
+ * @file pattern_golden.c
+ * @brief Golden frame hashes for the pattern regression check.
+ *
+ * Recorded for CUBE_SIZE 7 by the host build with `make goldens` in
+ * test/, which also writes the frames to test/patterns.golden. Re-record
+ * only after a change that is meant to alter what a pattern shows.
+ * Do not edit by hand.
+ */
+
+#include "pattern_check.h"
+
+const uint32_t patternGolden[PATTERN_COUNT][PATTERN_CHECK_FRAMES] = {
+    {   // Pattern 0
+        0x3274904FU, 0x3274904FU, 0x3274904FU, 0x3274904FU, 0x3274904FU, 0x3274904FU,
+        0x3274904FU, 0x3274904FU, 0x3274904FU, 0x3274904FU, 0x8957AB73U, 0x8957AB73U,
+        0x8957AB73U, 0x8957AB73U, 0x8957AB73U, 0x8957AB73U, 0x8957AB73U, 0x8957AB73U,
+        0x8957AB73U, 0x8957AB73U, 0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU,
+        0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU, 0xA3C25BCFU,
+        0x738224F3U, 0x738224F3U, 0x738224F3U, 0x738224F3U, 0x738224F3U, 0x738224F3U,
+        0x738224F3U, 0x738224F3U, 0x738224F3U, 0x738224F3U, 0x92E067D7U, 0x92E067D7U,
+        0x92E067D7U, 0x92E067D7U, 0x92E067D7U, 0x92E067D7U, 0x92E067D7U, 0x92E067D7U,
+        0x92E067D7U, 0x92E067D7U, 0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U,
+        0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U, 0xE30A2C53U,
+        0x92EB225BU, 0x92EB225BU, 0x92EB225BU, 0x92EB225BU,
+    },
+    {   // Pattern 1
+        0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU,
+        0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU, 0xC8B08B9FU, 0x21E9E52BU, 0x21E9E52BU,
+        0x21E9E52BU, 0x21E9E52BU, 0x21E9E52BU, 0x21E9E52BU, 0x21E9E52BU, 0x21E9E52BU,
+        0x21E9E52BU, 0x21E9E52BU, 0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU,
+        0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU, 0x26C7ED2FU,
+        0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU,
+        0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU, 0xD2FF1E7FU, 0x126018A3U, 0x126018A3U,
+        0x126018A3U, 0x126018A3U, 0x126018A3U, 0x126018A3U, 0x126018A3U, 0x126018A3U,
+        0x126018A3U, 0x126018A3U, 0x70433B2BU, 0x70433B2BU, 0x70433B2BU, 0x70433B2BU,
+        0x70433B2BU, 0x70433B2BU, 0x70433B2BU, 0x70433B2BU, 0x70433B2BU, 0x70433B2BU,
+        0xD44A1263U, 0xD44A1263U, 0xD44A1263U, 0xD44A1263U,
+    },
+    {   // Pattern 2
+        0xE225411BU, 0xE225411BU, 0xE225411BU, 0xE225411BU, 0xE225411BU, 0xE225411BU,
+        0xE225411BU, 0xE225411BU, 0xE225411BU, 0xE225411BU, 0x45A04933U, 0x45A04933U,
+        0x45A04933U, 0x45A04933U, 0x45A04933U, 0x45A04933U, 0x45A04933U, 0x45A04933U,
+        0x45A04933U, 0x45A04933U, 0x28069DB7U, 0x28069DB7U, 0x28069DB7U, 0x28069DB7U,
+        0x28069DB7U, 0x28069DB7U, 0x28069DB7U, 0x28069DB7U, 0x28069DB7U, 0x28069DB7U,
+        0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU,
+        0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU, 0x3D8C87BBU, 0x5B7257F7U, 0x5B7257F7U,
+        0x5B7257F7U, 0x5B7257F7U, 0x5B7257F7U, 0x5B7257F7U, 0x5B7257F7U, 0x5B7257F7U,
+        0x5B7257F7U, 0x5B7257F7U, 0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U,
+        0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U, 0xEB1EBC83U,
+        0x55FC921FU, 0x55FC921FU, 0x55FC921FU, 0x55FC921FU,
+    },
+    {   // Pattern 3
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+        0x75029651U, 0x75029651U, 0x75029651U, 0x75029651U,
+    },
+    {   // Pattern 4
+        0x49DBB187U, 0x784252FBU, 0x90D92602U, 0x8CD14739U, 0xAD441892U, 0x5C93EDC3U,
+        0x8EBAC987U, 0xB91F0B7DU, 0xEC30F6DFU, 0x9D1B7F07U, 0x317ABA53U, 0x3D301FFAU,
+        0x0BB2A803U, 0xE559D28AU, 0xA81C5F99U, 0xAF0C693CU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xAB7EF167U, 0x6898C9B9U, 0x8F25B4CEU, 0xE2D8BAF5U,
+        0x7FBEA9A6U, 0x3B54FA2BU, 0x8716049AU, 0x7AF6F84FU, 0xB905825BU, 0xA47B91D5U,
+        0xAC576793U, 0x1580C901U, 0x518D4228U, 0x7812BE23U,
+    },
+    {   // Pattern 5
+        0xDC581058U, 0xA116190EU, 0xEFD2E1EFU, 0xA1D45757U, 0x9AD60A3FU, 0x6BC51DFBU,
+        0xBF2F88B3U, 0x62CA571FU, 0x083F7907U, 0x6019380FU, 0x6019380FU, 0x6019380FU,
+        0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU,
+        0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU,
+        0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU, 0x6019380FU,
+        0xFE16D8C8U, 0x95A802C6U, 0xF93B400FU, 0xF93B400FU, 0xDC581058U, 0xA116190EU,
+        0xEFD2E1EFU, 0xA1D45757U, 0x9AD60A3FU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU,
+        0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU,
+        0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU,
+        0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU, 0x6BC51DFBU,
+        0xBF2F88B3U, 0x62CA571FU, 0x083F7907U, 0x6019380FU,
+    },
+    {   // Pattern 6
+        0x8253D8ADU, 0x8E933911U, 0x8E933911U, 0x85B478FDU, 0x4B3D4A1BU, 0x4B3D4A1BU,
+        0x32AFF68BU, 0x32AFF68BU, 0x27237F85U, 0xF1FBDEB8U, 0xF1FBDEB8U, 0xF1FBDEB8U,
+        0xF1FBDEB8U, 0xF1FBDEB8U, 0x47A1EBD7U, 0xB5ABF37BU, 0xDFCA41F3U, 0xDFCA41F3U,
+        0xDFCA41F3U, 0xE2AFAC50U, 0xE2AFAC50U, 0x303F47C9U, 0x303F47C9U, 0x303F47C9U,
+        0x303F47C9U, 0x303F47C9U, 0xA6264E18U, 0xA843B336U, 0xA843B336U, 0x551DDB5DU,
+        0x60587B4EU, 0x60587B4EU, 0xD2664F8CU, 0x31066C8EU, 0x31066C8EU, 0x7BE0A6AFU,
+        0x7BE0A6AFU, 0x7BE0A6AFU, 0x7BE0A6AFU, 0x7BE0A6AFU, 0xCD390599U, 0xCD390599U,
+        0xCD390599U, 0xCD390599U, 0xE612DE57U, 0xF1FBDEB8U, 0xF1FBDEB8U, 0xF1FBDEB8U,
+        0xF1FBDEB8U, 0xF1FBDEB8U, 0x47A1EBD7U, 0xB5ABF37BU, 0xDFCA41F3U, 0xDFCA41F3U,
+        0xDFCA41F3U, 0xE2AFAC50U, 0xE2AFAC50U, 0x303F47C9U, 0x303F47C9U, 0x303F47C9U,
+        0x303F47C9U, 0x303F47C9U, 0xA6264E18U, 0xA843B336U,
+    },
+    {   // Pattern 7
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xBACDA307U, 0x9DF1A5D6U, 0xC6A86D73U, 0xC6A86D73U, 0x606FD053U,
+        0xAC516A37U, 0x0D01D614U, 0x4EFA13C8U, 0xF085C89CU, 0x8CF455E0U, 0x2346A1ADU,
+        0x19A7F7F2U, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0x24B1C1D0U, 0xF2D131D7U, 0x0290B124U,
+        0x39A2F37BU, 0xE34CE924U, 0x04F74889U, 0xDD10540EU, 0x0C4AD5C7U, 0x2CD54E4DU,
+        0x415DF8DAU, 0xE85646BBU, 0x6A8E6407U, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0x3E2EDB44U,
+        0x9CBE7B2DU, 0x8C79B2D5U, 0xB357177BU, 0xDB3E0BF6U,
+    },
+    {   // Pattern 8
+        0x91E7C908U, 0x36347717U, 0x37315DB4U, 0xF8B65F1AU, 0xB5DD3955U, 0x3945B6DBU,
+        0xCE4EBBB0U, 0xBA979971U, 0x15AD8239U, 0x4F6FA886U, 0x348BCF2BU, 0xBFCB4742U,
+        0x7975D98EU, 0x71DF8A4CU, 0x288E8C53U, 0x3D0C4618U, 0xDB29CDA2U, 0x460FFAB4U,
+        0x0B7A08DFU, 0xD21B3811U, 0xC26D78DBU, 0xA29D98BDU, 0x1F279D4CU, 0x0A0E5951U,
+        0x2BA6518FU, 0xEE3E679FU, 0x11FD04D0U, 0x744B34E5U, 0x7C7A1B88U, 0x7E7E7A69U,
+        0xFC2794DAU, 0x1C3033D7U, 0x57A81EE9U, 0xB64F4D48U, 0x416A7251U, 0x0B1B42FFU,
+        0x780D4CE6U, 0x7C2D0DE5U, 0x8DB87DD2U, 0xD7615D2CU, 0xBEB61EE1U, 0x9C8980F5U,
+        0xB08AEEF8U, 0x27581D70U, 0xF8EA46E2U, 0x8C5F5E31U, 0xA70DB6C4U, 0x8C0EF234U,
+        0x0D5A8E8CU, 0x84142337U, 0x4D5F65A5U, 0x52D89B86U, 0x4CFDB1AFU, 0x68F5F193U,
+        0x798F3C41U, 0x97B255AEU, 0x585D0705U, 0xB21F2290U, 0x088D24EBU, 0x46128D93U,
+        0xC0B9DDC7U, 0x46179769U, 0x79EB407CU, 0x6E771DFBU,
+    },
+    {   // Pattern 9
+        0x77E08DC3U, 0x0DD55183U, 0x95928117U, 0x1F02A2FFU, 0x4A19B5FEU, 0x7E3D1E05U,
+        0xC317F7B9U, 0x8174AB4FU, 0x5520A687U, 0x3B68BDC9U, 0x3A5C16FAU, 0xDC6A2F87U,
+        0x97F13453U, 0x6B5D7DEFU, 0x27CDDB5FU, 0x8712E822U, 0x07989D23U, 0xD69FE198U,
+        0x0693042BU, 0xC2973D3AU, 0x865A20DBU, 0x80D5DECFU, 0x9012A47FU, 0x3AD7937FU,
+        0x87CFF34FU, 0x59666245U, 0x1F7D7AC7U, 0x64E41DBFU, 0xF5DF8DF8U, 0xA7F5D4FDU,
+        0xB88E3061U, 0x87706E3FU, 0x669B2367U, 0xF1F3EBA3U, 0x02044BE3U, 0xFBD7D62FU,
+        0xBE28D12FU, 0x0533F167U, 0xB6FD495FU, 0x24C5ED53U, 0xAB2B4876U, 0x549B19B1U,
+        0x6644B7EDU, 0x977CDB21U, 0xA208C917U, 0xA80DDD75U, 0x1347548BU, 0x244D10BBU,
+        0xB4E97656U, 0x25952117U, 0x52B5572FU, 0xCBD5A491U, 0x7FB44306U, 0xF1A87BF6U,
+        0x64E343F6U, 0xC9138031U, 0x71954D63U, 0x4965CDD5U, 0xCD7B787FU, 0x1FCF1FFFU,
+        0x75AE121FU, 0xDAA8D1EBU, 0x4A07CFA7U, 0x715BE71DU,
+    },
+    {   // Pattern 10
+        0x84AEA61FU, 0x3058891CU, 0x05A1BE13U, 0x761AD933U, 0x60C1D0B9U, 0x2BC1E31DU,
+        0x43F073CFU, 0x0FDF4FE2U, 0x28AE262FU, 0x960020ECU, 0x08BAFCFEU, 0x14C818E0U,
+        0x7AF90444U, 0x23A27BDEU, 0xA53B158AU, 0xFF68DD37U, 0xD2AB0861U, 0xA65167FAU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU, 0xF93B400FU,
+        0xF93B400FU, 0xF93B400FU, 0x48867614U, 0xF79B2AB7U, 0x1FF41C49U, 0x7DD8A8DFU,
+        0x6A076B13U, 0x0A8D9522U, 0x8E6BAC62U, 0x77451212U, 0x26793814U, 0x43D26EBCU,
+        0x6A3B93EDU, 0xF766827DU, 0x66FBA0BDU, 0xFA413273U,
+    },
+    {   // Pattern 11
+        0x485D1647U, 0x2DECB90BU, 0xEA173DF7U, 0x3604298BU, 0xC5D655BBU, 0xD51B944BU,
+        0x93B01707U, 0x03F3FCE7U, 0xD1AB14F3U, 0xEDF597E7U, 0x95F86533U, 0x2077A007U,
+        0x6055E43BU, 0xF8560C53U, 0x65ED6977U, 0xF28754C3U, 0x58893BF3U, 0xC74ABF53U,
+        0x61A1FF47U, 0x09D9306BU, 0x14675F77U, 0x725374CBU, 0x200FCE9BU, 0x86C36DABU,
+        0xD11952E7U, 0x83D4B127U, 0xA03C7293U, 0xDF9990C7U, 0x2822B1F3U, 0x1ED5DD47U,
+        0xAF421DDBU, 0x53AD4093U, 0x82AB9A77U, 0x791998E3U, 0x499DD7B3U, 0xE8AA0893U,
+        0x485D1647U, 0x2DECB90BU, 0xEA173DF7U, 0x3604298BU, 0xC5D655BBU, 0xD51B944BU,
+        0x93B01707U, 0x03F3FCE7U, 0xD1AB14F3U, 0xEDF597E7U, 0x95F86533U, 0x2077A007U,
+        0x6055E43BU, 0xF8560C53U, 0x65ED6977U, 0xF28754C3U, 0x58893BF3U, 0xC74ABF53U,
+        0x61A1FF47U, 0x09D9306BU, 0x14675F77U, 0x725374CBU, 0x200FCE9BU, 0x86C36DABU,
+        0xD11952E7U, 0x83D4B127U, 0xA03C7293U, 0xDF9990C7U,
+    },
+    {   // Pattern 12
+        0x9AD63CA3U, 0xF2CD43A0U, 0x438A287AU, 0xBC15A383U, 0x3628669CU, 0xF1CF3890U,
+        0xDF40FEA5U, 0x5AD67C7DU, 0x16CE512AU, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+        0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U, 0x9E2C7725U,
+    },
+    {   // Pattern 13
+        0x078C928FU, 0xE49F263FU, 0x040FBC7FU, 0x186F707FU, 0xBCEA88CFU, 0x798F996FU,
+        0x4603912FU, 0xB8D9916FU, 0x285E5671U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U, 0xB50A5873U,
+        0xB50A5873U, 0xB50A5873U, 0x285E5671U, 0xB8D9916FU, 0x4603912FU, 0x798F996FU,
+        0xBCEA88CFU, 0x186F707FU, 0x040FBC7FU, 0xE49F263FU, 0x078C928FU, 0xAD2A9ECFU,
+        0xAD2A9ECFU, 0xAD2A9ECFU, 0xAD2A9ECFU, 0xAD2A9ECFU,
+    },
+    {   // Pattern 14
+        0x2D95288AU, 0xDC164578U, 0xC6100B78U, 0xC9B905D6U, 0xB59CA6B6U, 0x9D73481EU,
+        0xB6B14DAEU, 0xA051A44EU, 0x6F2F22D6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U,
+        0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U,
+        0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U,
+        0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U, 0x22F4A5B6U,
+        0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U,
+        0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U,
+        0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U, 0xD3CA7193U,
+        0xD3CA7193U, 0xD3CA7193U, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU,
+        0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU,
+        0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU, 0x5E33C9BCU,
+    },
+    {   // Pattern 15
+        0xF93B400FU, 0xF93B400FU, 0xF626DA37U, 0xF626DA37U, 0xF626DA37U, 0xA26A457FU,
+        0xA26A457FU, 0xA26A457FU, 0x7C107E6FU, 0x7C107E6FU, 0x7C107E6FU, 0x7299C8CFU,
+        0x7299C8CFU, 0x7299C8CFU, 0x0E4E7467U, 0x0E4E7467U, 0x0E4E7467U, 0xFC6B4BE7U,
+        0xFC6B4BE7U, 0xFC6B4BE7U, 0x5E58D08FU, 0x5E58D08FU, 0x5E58D08FU, 0x42879217U,
+        0x42879217U, 0x42879217U, 0x6C41690FU, 0x6C41690FU, 0x6C41690FU, 0x2DAACCDFU,
+        0x2DAACCDFU, 0x2DAACCDFU, 0x3AC551CFU, 0x3AC551CFU, 0x3AC551CFU, 0x974A9B2FU,
+        0x974A9B2FU, 0x974A9B2FU, 0x9349F38FU, 0x9349F38FU, 0x9349F38FU, 0xD47384B7U,
+        0xD47384B7U, 0xD47384B7U, 0x663C9407U, 0x663C9407U, 0x663C9407U, 0xAF677C6FU,
+        0xAF677C6FU, 0xAF677C6FU, 0x2EFB5547U, 0x2EFB5547U, 0x2EFB5547U, 0x57CB0607U,
+        0x57CB0607U, 0x57CB0607U, 0x4D423E77U, 0x4D423E77U, 0x4D423E77U, 0x101F28EFU,
+        0x101F28EFU, 0x101F28EFU, 0xC57417C7U, 0xC57417C7U,
+    },
+    {   // Pattern 16
+        0x3D56C9EBU, 0xEA60D88DU, 0x63123543U, 0xB8F3E165U, 0x34F9D229U, 0x360F01ADU,
+        0x7C1B53A3U, 0x4C948D1DU, 0x60711B27U, 0x354C06F1U, 0x0A0E281FU, 0x29501AB1U,
+        0xA9A5A64DU, 0xFF72993FU, 0xDDAE3FD2U, 0x1C948BEDU, 0x70809AB0U, 0x2AA912FBU,
+        0x8E87F789U, 0xCF735F53U, 0xD2AE236DU, 0x3E13C341U, 0x0A42F946U, 0x90C10FBBU,
+        0x31B6A80FU, 0x298194B4U, 0x6D4269C3U, 0xB835618DU, 0x5A748DDAU, 0xDB77D517U,
+        0x62856027U, 0xD824C5A7U, 0x6772D051U, 0xD0C2023BU, 0xAEB7DA50U, 0x05747E29U,
+        0xDB870BF2U, 0xD5D53891U, 0x0D4408AFU, 0xC0E33309U, 0xF130DBE3U, 0x78E54D19U,
+        0x249450E4U, 0xF59B886BU, 0x5D60BF67U, 0x4C56C4A3U, 0xAB8F03D6U, 0x93411722U,
+        0x1BD27E3FU, 0x8559A78CU, 0x59DFA4EDU, 0x3768C455U, 0x488C42EFU, 0x09B90A20U,
+        0x62A63A90U, 0xAD856CDCU, 0xBE9A8C22U, 0x8E70ADB2U, 0x6D227EB4U, 0xE08EDF16U,
+        0x2DEDF623U, 0x25B8AC18U, 0x43FEEE2FU, 0xA7CD720AU,
+    },
+};
@@ -4,6 +4,7 @@
  */
 #include "patterns.h"
 #include "led_cube.h"   // Cube_SetPixel, Cube_Clear
+#include "chain_render.h"
 #include "SysTick_Delay.h"
 /* ===========================================================
    Rainbow  hue shifts along x,y,z every frame
@@ -13,18 +14,28 @@ void Pattern_Rainbow_Init(void)
     Cube_Clear();
 }
 
+static uint32_t rainbowTime = 0;
+
+// One x layer of the rainbow, computed as the LED chain reaches it
+static void rainbowSlice(uint8_t x, uint8_t *slice)
+{
+    for (uint8_t y = 0; y < CUBE_SIZE; y++)
+        for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+            rgb_t c = {
+                (uint8_t)((x * 32 + rainbowTime) & 0xFF),
+                (uint8_t)((y * 32 + rainbowTime) & 0xFF),
+                (uint8_t)((z * 32 + rainbowTime) & 0xFF)
+            };
+            ChainRender_SetVoxel(slice, y, z, c);
+        }
+}
+
+// Every voxel is a function of its position, so no framebuffer is drawn:
+// the frame goes out through chain_render.h as the chain reaches each layer
 void Pattern_Rainbow_Step(uint32_t t)
 {
-    for (uint8_t x = 0; x < CUBE_SIZE; x++)
-        for (uint8_t y = 0; y < CUBE_SIZE; y++)
-            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
-                rgb_t c = {
-                    (uint8_t)((x * 32 + t) & 0xFF),
-                    (uint8_t)((y * 32 + t) & 0xFF),
-                    (uint8_t)((z * 32 + t) & 0xFF)
-                };
-                Cube_SetPixel(x, y, z, c);
-            }
+    rainbowTime = t;
+    ChainRender_BeginFrame(rainbowSlice);
 }
 
 /* ===========================================================
@@ -11,6 +11,8 @@
 
 /* -------- pattern prototypes -------- */
 void Pattern_Rainbow_Init(void);
+// Computed in chain order (chain_render.h) rather than drawn with
+// Cube_SetPixel: show it with Transition_Show or ChainRender_Resolve()
 void Pattern_Rainbow_Step(uint32_t t);
 
 void Pattern_ColumnPulse_Init(void);
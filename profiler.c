@@ -0,0 +1,52 @@
+/**
+ * @file profiler.c
+ * @brief DWT cycle counter setup and per-slot statistics.
+ */
+
+#include "profiler.h"
+
+volatile profile_slot_t profileSlots[PROFILE_SLOT_COUNT];
+volatile uint16_t profileIdlePermille = 0;
+
+static uint64_t idleWindowStart = 0;   // PROFILE_SLOT_IDLE total at the last window
+
+void Profiler_Init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // Enable trace/DWT block
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;             // Start the cycle counter
+
+    for (uint8_t i = 0; i < PROFILE_SLOT_COUNT; i++) {
+        profileSlots[i].count = 0;
+        profileSlots[i].lastCycles = 0;
+        profileSlots[i].maxCycles = 0;
+        profileSlots[i].totalCycles = 0;
+    }
+    idleWindowStart = 0;
+}
+
+void Profiler_Record(uint8_t slot, uint32_t cycles) {
+    if (slot >= PROFILE_SLOT_COUNT) {
+        return;
+    }
+    volatile profile_slot_t *s = &profileSlots[slot];
+    s->count++;
+    s->lastCycles = cycles;
+    s->totalCycles += cycles;
+    if (cycles > s->maxCycles) {
+        s->maxCycles = cycles;
+    }
+}
+
+uint16_t Profiler_IdleDuty(uint32_t elapsedCycles) {
+    uint64_t total = profileSlots[PROFILE_SLOT_IDLE].totalCycles;
+    uint64_t idle = total - idleWindowStart;
+    idleWindowStart = total;
+    if (elapsedCycles == 0) {
+        return profileIdlePermille;
+    }
+    if (idle > elapsedCycles) {
+        idle = elapsedCycles;
+    }
+    profileIdlePermille = (uint16_t)((idle * 1000U) / elapsedCycles);
+    return profileIdlePermille;
+}
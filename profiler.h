@@ -0,0 +1,60 @@
+/**
+ * @file profiler.h
+ * @brief Cycle-count profiling with the Cortex-M4 DWT counter.
+ *
+ * Results accumulate in profileSlots[] and are read from the debugger
+ * watch window (avg = totalCycles / count).
+ */
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+
+// Slot assignments
+#define PROFILE_SLOT_OUTPUT      0                 // Encode + transmit of one frame
+#define PROFILE_SLOT_ENCODE      1                 // WS2812 encode pass alone (incl. post-processing)
+#define PROFILE_SLOT_IDLE        2                 // One WFI sleep (SysTick cycles)
+#define PROFILE_SLOT_FIRST_LIGHT 3                 // Frame start to its first LED byte going out
+#define PROFILE_SLOT_PATTERN(p)  (4 + (p))         // One step of pattern p
+#define PROFILE_SLOT_COUNT       24
+
+typedef struct {
+    uint32_t count;        // Number of samples
+    uint32_t lastCycles;   // Most recent sample
+    uint32_t maxCycles;    // Worst sample
+    uint64_t totalCycles;  // Sum of all samples
+} profile_slot_t;
+
+extern volatile profile_slot_t profileSlots[PROFILE_SLOT_COUNT];
+
+// Idle duty cycle over the last Profiler_IdleDuty() window, in 1/1000
+extern volatile uint16_t profileIdlePermille;
+
+/**
+ * @brief Enable the DWT cycle counter and clear all slots.
+ */
+void Profiler_Init(void);
+
+/**
+ * @brief Current core cycle count (wraps every ~53 s at 80 MHz).
+ */
+static inline uint32_t Profiler_Cycles(void) {
+    return DWT->CYCCNT;
+}
+
+/**
+ * @brief Add one measurement to a slot.
+ * @param slot   PROFILE_SLOT_* index.
+ * @param cycles Elapsed cycles (end - start).
+ */
+void Profiler_Record(uint8_t slot, uint32_t cycles);
+
+/**
+ * @brief Close an idle duty window: PROFILE_SLOT_IDLE cycles recorded
+ *        since the last call as a share of @p elapsedCycles.
+ * @return The share in 1/1000 (also left in profileIdlePermille).
+ */
+uint16_t Profiler_IdleDuty(uint32_t elapsedCycles);
+
+#endif // PROFILER_H
@@ -0,0 +1,96 @@
+/**
+ * @file rotation_tables.c
+ * @brief Boot-time generation of the spinning plane and helix tables.
+ */
+
+#include "rotation_tables.h"
+#include "board.h"
+#include <math.h>
+
+// A plane through the center crosses at most two columns per row
+#define PLANE_COLUMN_POOL  (PLANE_STEPS * CUBE_SIZE * 2)
+
+static uint8_t planeColumns[PLANE_COLUMN_POOL];
+static uint16_t planeFirst[PLANE_STEPS + 1];   // Offset of each step's columns
+static rgb_t planeColors[PLANE_STEPS];
+static helix_step_t helixSteps[HELIX_STEPS];
+
+static uint8_t packPoint(int x, int y) {
+    if (x < 0 || x >= CUBE_SIZE || y < 0 || y >= CUBE_SIZE) {
+        return ROTATION_NO_POINT;
+    }
+    return (uint8_t)((x << 4) | y);
+}
+
+static void buildPlane(void) {
+    float centerX = (CUBE_SIZE - 1) / 2.0f;
+    float centerY = (CUBE_SIZE - 1) / 2.0f;
+    uint16_t used = 0;
+
+    for (uint8_t step = 0; step < PLANE_STEPS; step++) {
+        float angle = step * 0.0872665f; // 5 degrees in radians
+        float c = cosf(angle);
+        float s = sinf(angle);
+
+        planeFirst[step] = used;
+        for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+            for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+                // Rotated Y close to 0 means the column is on the plane
+                float rotY = (x - centerX) * s + (y - centerY) * c;
+                if (fabsf(rotY) < 0.5f && used < PLANE_COLUMN_POOL) {
+                    planeColumns[used++] = packPoint(x, y);
+                }
+            }
+        }
+
+        // Hue cycles once per revolution, channels 120 degrees apart
+        float colorFactor = (float)step / PLANE_STEPS;
+        planeColors[step].r = (uint8_t)(40.0f * sinf(colorFactor * 6.28f));
+        planeColors[step].g = (uint8_t)(40.0f * sinf(colorFactor * 6.28f + 2.09f));
+        planeColors[step].b = (uint8_t)(40.0f * sinf(colorFactor * 6.28f + 4.19f));
+    }
+    planeFirst[PLANE_STEPS] = used;
+}
+
+static void buildHelix(void) {
+    float centerX = (CUBE_SIZE - 1) / 2.0f;
+    float centerY = (CUBE_SIZE - 1) / 2.0f;
+
+    for (uint8_t step = 0; step < HELIX_STEPS; step++) {
+        float rad1 = (step * 10.0f) * 0.0174533f;
+        float rad2 = (step * 10.0f + 180.0f) * 0.0174533f;
+
+        int x1 = (int)(centerX + HELIX_RADIUS * cosf(rad1));
+        int y1 = (int)(centerY + HELIX_RADIUS * sinf(rad1));
+        int x2 = (int)(centerX + HELIX_RADIUS * cosf(rad2));
+        int y2 = (int)(centerY + HELIX_RADIUS * sinf(rad2));
+
+        helixSteps[step].strandA = packPoint(x1, y1);
+        helixSteps[step].strandB = packPoint(x2, y2);
+
+        float f = 0.1f;
+        for (uint8_t i = 0; i < HELIX_BASE_POINTS; i++, f += 0.2f) {
+            helixSteps[step].basePairs[i] = packPoint((int)(x1 * (1 - f) + x2 * f),
+                                                      (int)(y1 * (1 - f) + y2 * f));
+        }
+    }
+}
+
+void RotationTables_Init(void) {
+    buildPlane();
+    buildHelix();
+}
+
+const uint8_t *RotationTables_PlaneColumns(uint8_t step, uint8_t *count) {
+    step %= PLANE_STEPS;
+    *count = (uint8_t)(planeFirst[step + 1] - planeFirst[step]);
+    return &planeColumns[planeFirst[step]];
+}
+
+rgb_t RotationTables_PlaneColor(uint8_t step) {
+    return planeColors[step % PLANE_STEPS];
+}
+
+const helix_step_t *RotationTables_Helix(uint8_t step) {
+    return &helixSteps[step % HELIX_STEPS];
+}
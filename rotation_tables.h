@@ -0,0 +1,60 @@
+/**
+ * @file rotation_tables.h
+ * @brief Angle-keyed lookup tables for the rotating patterns.
+ *
+ * The spinning plane and the DNA helix only ever visit a fixed set of
+ * rotation steps, so their geometry is computed once at boot and each
+ * frame just walks the table for the current step.
+ */
+#ifndef ROTATION_TABLES_H
+#define ROTATION_TABLES_H
+
+#include <stdint.h>
+#include "led_cube.h"
+
+#define PLANE_STEPS        72     // 5-degree increments
+#define HELIX_STEPS        36     // 10-degree increments
+#define HELIX_RADIUS       (CUBE_SIZE * 1.5f / 7.0f)
+#define HELIX_BASE_POINTS  4      // Points drawn between the strands
+
+// Columns and helix points are packed as (x << 4) | y. On a 16-wide cube
+// the corner (15, 15) packs to ROTATION_NO_POINT, which is only checked
+// for helix points and those stay near the middle.
+#define ROTATION_POINT_X(p)   ((uint8_t)((p) >> 4))
+#define ROTATION_POINT_Y(p)   ((uint8_t)((p) & 0x0F))
+#define ROTATION_NO_POINT     0xFF
+
+#if CUBE_SIZE > 16
+#error "Rotation table points hold 4-bit coordinates"
+#endif
+
+typedef struct {
+    uint8_t strandA;                        // First strand at this angle
+    uint8_t strandB;                        // Opposite strand (180 degrees)
+    uint8_t basePairs[HELIX_BASE_POINTS];   // Rung between the two strands
+} helix_step_t;
+
+/**
+ * @brief Build all tables. Call once at startup before the patterns run.
+ */
+void RotationTables_Init(void);
+
+/**
+ * @brief Get the (x, y) columns lit by the spinning plane at one step.
+ * @param step  Rotation step 0..PLANE_STEPS-1.
+ * @param count Receives the number of columns.
+ * @return Packed column list.
+ */
+const uint8_t *RotationTables_PlaneColumns(uint8_t step, uint8_t *count);
+
+/**
+ * @brief Get the spinning plane's unscaled color at one step.
+ */
+rgb_t RotationTables_PlaneColor(uint8_t step);
+
+/**
+ * @brief Get the helix cross-section at one step (step 0..HELIX_STEPS-1).
+ */
+const helix_step_t *RotationTables_Helix(uint8_t step);
+
+#endif // ROTATION_TABLES_H
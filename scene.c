@@ -0,0 +1,219 @@
+/**
+ * @file scene.c
+ * @brief Retained shapes with cached rasterization and dirty tracking.
+ */
+
+#include "scene.h"
+#include "board.h"
+#include "common_functions.h"
+#include "new_patterns.h"
+#include <math.h>
+
+// Cached voxel encoding: buffer slot in the low 12 bits, color slot above
+#define VOXEL_SLOT_SHIFT  12
+#define VOXEL_INDEX_MASK  0x0FFF
+#if NUM_LEDS > VOXEL_INDEX_MASK + 1
+#error "Cached voxel entries hold 12-bit buffer slots"
+#endif
+
+typedef struct {
+    uint8_t type;
+    uint8_t dirty;
+    uint8_t thickness;                 // Sphere shell thickness
+    float start[3], end[3];            // Line end points (local)
+    scene_transform_t transform;
+    rgb_t colors[SCENE_COLOR_SLOTS];
+    uint16_t first;                    // Offset of the cache in voxelPool
+    uint16_t capacity;
+    uint16_t count;
+} scene_shape_t;
+
+static scene_shape_t shapes[SCENE_MAX_SHAPES];
+static uint8_t shapeCount = 0;
+
+static uint16_t voxelPool[SCENE_VOXEL_POOL];
+static uint16_t poolUsed = 0;
+
+// Shape being rasterized and the LED slots it already covers
+static scene_shape_t *rasterShape;
+static uint8_t rasterSeen[(NUM_LEDS + 7) / 8];
+
+static scene_handle_t addShape(uint8_t type, uint16_t capacity) {
+    if (shapeCount >= SCENE_MAX_SHAPES || poolUsed + capacity > SCENE_VOXEL_POOL) {
+        return -1;
+    }
+    scene_shape_t *s = &shapes[shapeCount];
+    s->type = type;
+    s->dirty = 1;
+    s->first = poolUsed;
+    s->capacity = capacity;
+    s->count = 0;
+    poolUsed += capacity;
+    return (scene_handle_t)shapeCount++;
+}
+
+scene_handle_t Scene_AddBox(uint16_t capacity) {
+    return addShape(SHAPE_BOX, capacity);
+}
+
+scene_handle_t Scene_AddLine(const float start[3], const float end[3], uint16_t capacity) {
+    scene_handle_t h = addShape(SHAPE_LINE, capacity);
+    if (h >= 0) {
+        for (uint8_t i = 0; i < 3; i++) {
+            shapes[h].start[i] = start[i];
+            shapes[h].end[i] = end[i];
+        }
+    }
+    return h;
+}
+
+scene_handle_t Scene_AddSphere(uint8_t thickness, uint16_t capacity) {
+    scene_handle_t h = addShape(SHAPE_SPHERE, capacity);
+    if (h >= 0) {
+        shapes[h].thickness = thickness;
+    }
+    return h;
+}
+
+void Scene_SetTransform(scene_handle_t shape, const scene_transform_t *t) {
+    if (shape < 0 || shape >= shapeCount) return;
+    scene_transform_t *cur = &shapes[shape].transform;
+    if (cur->x != t->x || cur->y != t->y || cur->z != t->z ||
+        cur->scale != t->scale || cur->angle != t->angle) {
+        *cur = *t;
+        shapes[shape].dirty = 1;
+    }
+}
+
+void Scene_SetColor(scene_handle_t shape, uint8_t slot, rgb_t color) {
+    if (shape < 0 || shape >= shapeCount || slot >= SCENE_COLOR_SLOTS) return;
+    shapes[shape].colors[slot] = color;
+}
+
+// Add a voxel to the shape being rasterized; a later write wins, as with setVoxel
+static void emitVoxel(int x, int y, int z, uint8_t slot) {
+    if (x < 0 || y < 0 || z < 0) return;
+    int16_t idx = voxelBufferIndex((uint8_t)x, (uint8_t)y, (uint8_t)z);
+    if (idx < 0) return;
+
+    uint16_t *cache = &voxelPool[rasterShape->first];
+    uint16_t entry = (uint16_t)idx | ((uint16_t)slot << VOXEL_SLOT_SHIFT);
+
+    if (rasterSeen[idx >> 3] & (1U << (idx & 7))) {
+        for (uint16_t i = 0; i < rasterShape->count; i++) {
+            if ((cache[i] & VOXEL_INDEX_MASK) == (uint16_t)idx) {
+                cache[i] = entry;
+                return;
+            }
+        }
+        return;
+    }
+    if (rasterShape->count < rasterShape->capacity) {
+        rasterSeen[idx >> 3] |= (1U << (idx & 7));
+        cache[rasterShape->count++] = entry;
+    }
+}
+
+// Same sampling as drawLine3D: 11 points, truncated to voxel coordinates
+static void rasterLine(const float start[3], const float end[3], uint8_t slot) {
+    int steps = 10;
+    for (int i = 0; i <= steps; i++) {
+        float t = (float)i / steps;
+        float x = start[0] + (end[0] - start[0]) * t;
+        float y = start[1] + (end[1] - start[1]) * t;
+        float z = start[2] + (end[2] - start[2]) * t;
+        if (x >= 0 && x < CUBE_SIZE && y >= 0 && y < CUBE_SIZE && z >= 0 && z < CUBE_SIZE) {
+            emitVoxel((int)x, (int)y, (int)z, slot);
+        }
+    }
+}
+
+// Rotate a local point about Z, scale it and move it to the shape origin
+static void toWorld(const scene_transform_t *t, float c, float s, const float local[3], float out[3]) {
+    out[0] = t->x + t->scale * (local[0] * c - local[1] * s);
+    out[1] = t->y + t->scale * (local[0] * s + local[1] * c);
+    out[2] = t->z + t->scale * local[2];
+}
+
+static void rasterBox(const scene_transform_t *t) {
+    static const int8_t unitCorners[8][3] = {
+        {-1, -1, -1}, {1, -1, -1}, {-1, 1, -1}, {1, 1, -1},
+        {-1, -1,  1}, {1, -1,  1}, {-1, 1,  1}, {1, 1,  1}
+    };
+    // Bottom face, top face, then vertical edges
+    static const uint8_t edges[12][2] = {
+        {0, 1}, {1, 3}, {3, 2}, {2, 0},
+        {4, 5}, {5, 7}, {7, 6}, {6, 4},
+        {0, 4}, {1, 5}, {2, 6}, {3, 7}
+    };
+    float c = cosf(t->angle * 0.0174533f);
+    float s = sinf(t->angle * 0.0174533f);
+    float corners[8][3];
+
+    for (uint8_t i = 0; i < 8; i++) {
+        float local[3] = {unitCorners[i][0], unitCorners[i][1], unitCorners[i][2]};
+        toWorld(t, c, s, local, corners[i]);
+    }
+    for (uint8_t e = 0; e < 12; e++) {
+        rasterLine(corners[edges[e][0]], corners[edges[e][1]], 0);
+    }
+}
+
+static void rasterSphere(const scene_shape_t *shape) {
+    int cx = (int)shape->transform.x;
+    int cy = (int)shape->transform.y;
+    int cz = (int)shape->transform.z;
+    int radius = (int)shape->transform.scale;
+
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+                if (isPointOnSphere(x, y, z, cx, cy, cz, radius, shape->thickness)) {
+                    emitVoxel(x, y, z, 0);
+                }
+            }
+        }
+    }
+}
+
+static void rasterize(scene_shape_t *shape) {
+    rasterShape = shape;
+    shape->count = 0;
+    for (uint16_t i = 0; i < sizeof(rasterSeen); i++) {
+        rasterSeen[i] = 0;
+    }
+
+    switch (shape->type) {
+        case SHAPE_BOX:
+            rasterBox(&shape->transform);
+            break;
+        case SHAPE_LINE: {
+            const scene_transform_t *t = &shape->transform;
+            float c = cosf(t->angle * 0.0174533f);
+            float s = sinf(t->angle * 0.0174533f);
+            float start[3], end[3];
+            toWorld(t, c, s, shape->start, start);
+            toWorld(t, c, s, shape->end, end);
+            rasterLine(start, end, 0);
+            break;
+        }
+        case SHAPE_SPHERE:
+            rasterSphere(shape);
+            break;
+    }
+    shape->dirty = 0;
+}
+
+void Scene_Draw(scene_handle_t shape) {
+    if (shape < 0 || shape >= shapeCount) return;
+    scene_shape_t *s = &shapes[shape];
+
+    if (s->dirty || SCENE_ALWAYS_RASTERIZE) {
+        rasterize(s);
+    }
+
+    const uint16_t *cache = &voxelPool[s->first];
+    for (uint16_t i = 0; i < s->count; i++) {
+        setBufferColor(cache[i] & VOXEL_INDEX_MASK, s->colors[cache[i] >> VOXEL_SLOT_SHIFT]);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file scene.h
+ * @brief Retained-mode shapes for the geometric patterns.
+ *
+ * A pattern registers its shapes once and then only updates their
+ * transforms and colors. A shape is rasterized into a cached list of LED
+ * buffer slots when its geometry changes; on every other frame the cached
+ * slots are simply re-written with the current colors.
+ */
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stdint.h>
+#include "led_cube.h"
+#include "board.h"
+
+// Shape types
+#define SHAPE_BOX      1  // Wireframe cube, half-width = scale
+#define SHAPE_LINE     2  // Segment between two local points
+#define SHAPE_SPHERE   3  // Spherical shell, radius = scale
+
+// Color slots (a shape uses up to SCENE_COLOR_SLOTS colors)
+#define SCENE_COLOR_SLOTS   4
+
+#define SCENE_MAX_SHAPES    6
+
+// Cache capacity the patterns register their shapes with: a box's 12
+// edges of 11 samples each, and a sphere shell up to half the cube
+#define SCENE_BOX_VOXELS    (12 * 11)
+#define SCENE_SPHERE_VOXELS (NUM_LEDS / 2)
+
+// Cached voxels shared by all shapes, enough for every shape registered
+// at any CUBE_SIZE
+#define SCENE_VOXEL_POOL    (SCENE_BOX_VOXELS + SCENE_SPHERE_VOXELS)
+
+// Set to 1 to rasterize every frame (immediate mode) for profiling comparisons
+#ifndef SCENE_ALWAYS_RASTERIZE
+#define SCENE_ALWAYS_RASTERIZE 0
+#endif
+
+typedef struct {
+    float x, y, z;   // Shape origin in voxel units
+    float scale;     // Size (see shape types)
+    float angle;     // Rotation about Z in degrees
+} scene_transform_t;
+
+typedef int8_t scene_handle_t;   // -1 = not registered
+
+/**
+ * @brief Register a wireframe box.
+ * @return Shape handle, or -1 if the scene is full.
+ */
+scene_handle_t Scene_AddBox(uint16_t capacity);
+
+/**
+ * @brief Register a line between two points given in shape-local units.
+ */
+scene_handle_t Scene_AddLine(const float start[3], const float end[3], uint16_t capacity);
+
+/**
+ * @brief Register a spherical shell of the given thickness (voxels).
+ */
+scene_handle_t Scene_AddSphere(uint8_t thickness, uint16_t capacity);
+
+/**
+ * @brief Move/resize a shape; marks it dirty only if the transform changed.
+ */
+void Scene_SetTransform(scene_handle_t shape, const scene_transform_t *t);
+
+/**
+ * @brief Set one of the shape's colors (no re-rasterization needed).
+ */
+void Scene_SetColor(scene_handle_t shape, uint8_t slot, rgb_t color);
+
+/**
+ * @brief Draw a shape into the current draw buffer, rasterizing only if dirty.
+ */
+void Scene_Draw(scene_handle_t shape);
+
+#endif // SCENE_H
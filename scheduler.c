@@ -0,0 +1,99 @@
+/**
+ * @file scheduler.c
+ * @brief Run-to-completion task scheduler.
+ */
+
+#include "scheduler.h"
+#include <stddef.h>  // For NULL definition
+
+scheduler_task_t schedulerTasks[SCHEDULER_MAX_TASKS];
+
+static const scheduler_clock_t *clock = NULL;
+static uint8_t taskCount = 0;
+
+void Scheduler_Init(const scheduler_clock_t *timebase) {
+    clock = timebase;
+    taskCount = 0;
+}
+
+uint8_t Scheduler_AddTask(const char *name, scheduler_fn_t run, uint32_t periodMs, uint32_t budgetCycles) {
+    if (taskCount >= SCHEDULER_MAX_TASKS || run == NULL) {
+        return SCHEDULER_NO_TASK;
+    }
+    scheduler_task_t *task = &schedulerTasks[taskCount];
+    task->name = name;
+    task->run = run;
+    task->periodMs = periodMs;
+    task->budgetCycles = budgetCycles;
+    task->nextMs = clock->nowMs();
+    task->signalled = 0;
+    task->runs = 0;
+    task->overruns = 0;
+    task->missed = 0;
+    task->lastCycles = 0;
+    task->maxCycles = 0;
+    return taskCount++;
+}
+
+void Scheduler_Signal(uint8_t task) {
+    if (task < taskCount) {
+        schedulerTasks[task].signalled = 1;
+    }
+}
+
+uint8_t Scheduler_TaskCount(void) {
+    return taskCount;
+}
+
+// Whether a task should run now; moves a periodic task to its next release
+static uint8_t takeRelease(scheduler_task_t *task, uint32_t now) {
+    if (task->signalled) {
+        task->signalled = 0;
+        return 1;
+    }
+    if (task->periodMs == SCHEDULER_EVENT || (int32_t)(now - task->nextMs) < 0) {
+        return 0;
+    }
+    // Stay on the original phase, counting the releases that were missed
+    uint32_t late = now - task->nextMs;
+    if (late >= task->periodMs) {
+        uint32_t skipped = late / task->periodMs;
+        task->missed += skipped;
+        task->nextMs += skipped * task->periodMs;
+    }
+    task->nextMs += task->periodMs;
+    return 1;
+}
+
+uint8_t Scheduler_RunPending(void) {
+    uint8_t ran = 0;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        scheduler_task_t *task = &schedulerTasks[i];
+        if (!takeRelease(task, clock->nowMs())) {
+            continue;
+        }
+
+        uint32_t start = clock->cycles();
+        task->run();
+        uint32_t elapsed = clock->cycles() - start;
+
+        task->runs++;
+        task->lastCycles = elapsed;
+        if (elapsed > task->maxCycles) {
+            task->maxCycles = elapsed;
+        }
+        if (task->budgetCycles != 0 && elapsed > task->budgetCycles) {
+            task->overruns++;
+        }
+        ran++;
+    }
+    return ran;
+}
+
+void Scheduler_Run(void) {
+    while (1) {
+        if (Scheduler_RunPending() == 0) {
+            clock->idle();
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * @file scheduler.h
+ * @brief Run-to-completion scheduler for periodic and signalled tasks.
+ *
+ * Tasks are plain functions that return when their step is done. A
+ * periodic task runs whenever its next release time has passed; a task
+ * added with period SCHEDULER_EVENT only runs after Scheduler_Signal().
+ * Tasks are checked in the order they were added, so earlier tasks have
+ * priority and a task signalled by an earlier one runs in the same pass.
+ *
+ * Time comes from a scheduler_clock_t, so the same code runs on the cube
+ * (SysTick milliseconds, DWT cycles, WFI when idle) or against a simulated
+ * clock in a host build, where idle() simply advances the clock.
+ *
+ * Every run is timed: runs over the task's cycle budget count as
+ * overruns, and periods that passed before the task got to run count as
+ * missed. Results are in schedulerTasks[] for the debugger watch window.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#define SCHEDULER_MAX_TASKS  8
+#define SCHEDULER_EVENT      0     // Period of a task that only runs when signalled
+#define SCHEDULER_NO_TASK    0xFF  // Scheduler_AddTask() result when the table is full
+
+typedef void (*scheduler_fn_t)(void);
+
+typedef struct {
+    uint32_t (*nowMs)(void);   // Millisecond timebase
+    uint32_t (*cycles)(void);  // Free-running cycle counter for budgets
+    void (*idle)(void);        // Called when no task is due (e.g. WFI)
+} scheduler_clock_t;
+
+typedef struct {
+    const char *name;
+    scheduler_fn_t run;
+    uint32_t periodMs;         // SCHEDULER_EVENT = signalled only
+    uint32_t budgetCycles;     // Longer runs count as overruns (0 = no budget)
+    uint32_t nextMs;           // Next release of a periodic task
+    volatile uint8_t signalled;
+    uint32_t runs;
+    uint32_t overruns;         // Runs longer than budgetCycles
+    uint32_t missed;           // Periods skipped because the task started late
+    uint32_t lastCycles;
+    uint32_t maxCycles;
+} scheduler_task_t;
+
+extern scheduler_task_t schedulerTasks[SCHEDULER_MAX_TASKS];
+
+/**
+ * @brief Remove all tasks and select the timebase.
+ */
+void Scheduler_Init(const scheduler_clock_t *clock);
+
+/**
+ * @brief Add a task; tasks added earlier have priority.
+ * @param name         Label for telemetry.
+ * @param run          Task step.
+ * @param periodMs     Release period, or SCHEDULER_EVENT.
+ * @param budgetCycles Expected worst-case run time (0 = unchecked).
+ * @return Task id for Scheduler_Signal(), or SCHEDULER_NO_TASK.
+ */
+uint8_t Scheduler_AddTask(const char *name, scheduler_fn_t run, uint32_t periodMs, uint32_t budgetCycles);
+
+/**
+ * @brief Make a task run on the next pass (safe from interrupts).
+ */
+void Scheduler_Signal(uint8_t task);
+
+/**
+ * @brief Number of tasks added.
+ */
+uint8_t Scheduler_TaskCount(void);
+
+/**
+ * @brief Run every task that is due once, in priority order.
+ * @return Number of tasks run.
+ */
+uint8_t Scheduler_RunPending(void);
+
+/**
+ * @brief Run tasks forever, calling the clock's idle() whenever none is due.
+ */
+void Scheduler_Run(void) __attribute__((noreturn));
+
+#endif // SCHEDULER_H
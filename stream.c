@@ -0,0 +1,327 @@
+/**
+ * @file stream.c
+ * @brief UART0 packet receiver with uDMA payload transfer and triple buffering.
+ */
+
+#include "TM4C123GH6PM.h"
+#include "stream.h"
+#include "board.h"
+#include "UDMA.h"
+#include "SysTick_Delay.h"
+#include <stddef.h>  // For NULL definition
+
+// UART register bits
+#define UART_CTL_ENABLE   0x301          // UARTEN | TXE | RXE
+#define UART_LCRH_8N1     0x70           // 8 data bits, FIFOs enabled
+#define UART_IFLS_RX_HALF (2U << 3)      // RX interrupt / burst at 8 bytes
+#define UART_INT_RX       (1U << 4)
+#define UART_INT_RT       (1U << 6)
+#define UART_INT_OE       (1U << 10)
+#define UART_FR_RXFE      (1U << 4)
+#define UART_DMA_RXDMAE   (1U << 0)
+
+#define STREAM_BUFFERS    3
+
+// Receiver states
+#define RX_SYNC0    0
+#define RX_SYNC1    1
+#define RX_TYPE     2
+#define RX_SEQ      3
+#define RX_LEN0     4
+#define RX_LEN1     5
+#define RX_PAYLOAD  6   // uDMA owns the UART
+#define RX_CRC0     7
+#define RX_CRC1     8
+
+// Header fields covered by the CRC
+#define HDR_TYPE    0
+#define HDR_SEQ     1
+#define HDR_LEN0    2
+#define HDR_LEN1    3
+
+typedef struct {
+    uint8_t header[4];
+    uint16_t length;
+    uint16_t crc;
+} frame_meta_t;
+
+volatile stream_stats_t streamStats;
+
+static uint8_t frames[STREAM_BUFFERS][STREAM_FRAME_BYTES];
+static frame_meta_t meta[STREAM_BUFFERS];
+
+// Buffer roles; the indices are always distinct (ready and main may be -1)
+static volatile int8_t backIndex = 0;     // Receiving (uDMA target)
+static volatile int8_t readyIndex = -1;   // Newest complete packet
+static volatile int8_t mainIndex = -1;    // Packet the main loop is checking/decoding
+static volatile int8_t frontIndex = 2;    // Frame last handed to the output
+
+// Packet being received
+static volatile uint8_t rxState = RX_SYNC0;
+static volatile uint32_t packetStartMs;
+static uint8_t rxHeader[4];
+static uint16_t rxLength;
+static uint16_t rxCrc;
+static uint16_t payloadOffset;
+static uint16_t chunkLength;
+
+// Presentation bookkeeping (main loop only)
+static uint8_t frontValid = 0;   // Front holds the frame with seq lastSeq
+static uint8_t haveSeq = 0;
+static uint8_t lastSeq;
+static uint32_t lastFrameMs;
+static uint32_t fpsWindowStart;
+static uint16_t fpsWindowFrames;
+
+// Move the next piece of the payload (at most one uDMA transfer)
+static void startChunk(void) {
+    chunkLength = rxLength - payloadOffset;
+    if (chunkLength > UDMA_MAX_TRANSFER) {
+        chunkLength = UDMA_MAX_TRANSFER;
+    }
+    UDMA_StartTransfer(UDMA_CH_UART0RX,
+                       UDMA_SRC_INC_NONE | UDMA_SRC_SIZE_8 | UDMA_DST_INC_8 | UDMA_DST_SIZE_8 | UDMA_ARB_8,
+                       &UART0->DR, &frames[backIndex][payloadOffset], chunkLength);
+}
+
+static void startPayload(void) {
+    payloadOffset = 0;
+    rxState = RX_PAYLOAD;
+    UART0->IM &= ~(UART_INT_RX | UART_INT_RT);   // Bytes go to the uDMA now
+    UART0->DMACTL |= UART_DMA_RXDMAE;
+    startChunk();
+}
+
+static void endPayload(void) {
+    UART0->DMACTL &= ~UART_DMA_RXDMAE;
+    UART0->IM |= UART_INT_RX | UART_INT_RT;
+}
+
+// Hand the filled back buffer over as the ready frame
+static void completeFrame(void) {
+    int8_t done = backIndex;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        meta[done].header[i] = rxHeader[i];
+    }
+    meta[done].length = rxLength;
+    meta[done].crc = rxCrc;
+    streamStats.framesReceived++;
+
+    if (readyIndex >= 0) {
+        // The previous packet was never taken; receive into it next
+        streamStats.framesOverwritten++;
+        backIndex = readyIndex;
+        readyIndex = done;
+        return;
+    }
+    for (int8_t i = 0; i < STREAM_BUFFERS; i++) {
+        if (i != frontIndex && i != mainIndex && i != done) {
+            backIndex = i;
+            readyIndex = done;
+            return;
+        }
+    }
+    // Every buffer is busy: drop this packet and reuse its buffer
+    streamStats.framesOverwritten++;
+}
+
+static void receiveByte(uint8_t byte) {
+    switch (rxState) {
+        case RX_SYNC0:
+            if (byte == STREAM_SYNC0) {
+                rxState = RX_SYNC1;
+                packetStartMs = SysTick_GetMs();
+            }
+            break;
+        case RX_SYNC1:
+            if (byte == STREAM_SYNC1) {
+                rxState = RX_TYPE;
+            } else if (byte != STREAM_SYNC0) {
+                rxState = RX_SYNC0;
+            }
+            break;
+        case RX_TYPE:
+            rxHeader[HDR_TYPE] = byte;
+            rxState = RX_SEQ;
+            break;
+        case RX_SEQ:
+            rxHeader[HDR_SEQ] = byte;
+            rxState = RX_LEN0;
+            break;
+        case RX_LEN0:
+            rxHeader[HDR_LEN0] = byte;
+            rxState = RX_LEN1;
+            break;
+        case RX_LEN1:
+            rxHeader[HDR_LEN1] = byte;
+            rxLength = (uint16_t)(rxHeader[HDR_LEN0] | (rxHeader[HDR_LEN1] << 8));
+            if (!StreamProtocol_LengthValid(rxHeader[HDR_TYPE], rxLength)) {
+                streamStats.headerErrors++;
+                rxState = RX_SYNC0;
+            } else if (rxLength == 0) {
+                rxState = RX_CRC0;   // Empty delta: nothing changed
+            } else {
+                startPayload();
+            }
+            break;
+        case RX_PAYLOAD:
+            break;
+        case RX_CRC0:
+            rxCrc = byte;
+            rxState = RX_CRC1;
+            break;
+        case RX_CRC1:
+            rxCrc |= (uint16_t)(byte << 8);
+            completeFrame();
+            rxState = RX_SYNC0;
+            break;
+    }
+}
+
+void Stream_Init(void) {
+    SYSCTL->RCGCUART |= 0x01;                  // Enable UART0 clock
+    SYSCTL->RCGCGPIO |= 0x01;                  // Enable Port A clock
+    while ((SYSCTL->PRUART & 0x01) == 0);      // Wait until ready
+
+    // PA0 = U0RX, PA1 = U0TX (ICDI virtual COM port)
+    GPIOA->AFSEL |= 0x03;
+    GPIOA->PCTL = (GPIOA->PCTL & ~0x000000FF) | 0x00000011;
+    GPIOA->AMSEL &= ~0x03;
+    GPIOA->DEN |= 0x03;
+
+    UART0->CTL &= ~0x01;                       // Disable during setup
+
+    // Baud divisor in 1/64ths, rounded: SYS_CLOCK / (16 * baud)
+    uint32_t divisor = (SYS_CLOCK * 8U / STREAM_BAUD + 1U) / 2U;
+    UART0->IBRD = divisor >> 6;
+    UART0->FBRD = divisor & 0x3F;
+
+    UART0->LCRH = UART_LCRH_8N1;
+    UART0->IFLS = (UART0->IFLS & ~0x38) | UART_IFLS_RX_HALF;
+    UART0->ICR = 0x7FF;                        // Clear stale flags
+    UART0->IM = UART_INT_RX | UART_INT_RT | UART_INT_OE;
+    UART0->CTL = UART_CTL_ENABLE;
+
+    UDMA_Init();
+    NVIC_EnableIRQ(UART0_IRQn);
+}
+
+// Header and CRC bytes arrive here; the uDMA completion interrupt of the
+// UART0 RX channel is also delivered on this vector
+void UART0_Handler(void) {
+    uint32_t status = UART0->MIS;
+    UART0->ICR = status;
+
+    if (status & UART_INT_OE) {
+        streamStats.overruns++;
+    }
+
+    if (rxState == RX_PAYLOAD && UDMA_TransferDone(UDMA_CH_UART0RX)) {
+        payloadOffset += chunkLength;
+        if (payloadOffset < rxLength) {
+            startChunk();
+        } else {
+            endPayload();
+            rxState = RX_CRC0;
+        }
+    }
+
+    while (rxState != RX_PAYLOAD && !(UART0->FR & UART_FR_RXFE)) {
+        receiveByte((uint8_t)UART0->DR);
+    }
+}
+
+// Check a received packet and turn it into the front frame
+static const uint8_t *presentPacket(int8_t index, uint32_t now) {
+    const frame_meta_t *m = &meta[index];
+    uint16_t crc = StreamProtocol_Crc16(STREAM_CRC_INIT, m->header, 4);
+    crc = StreamProtocol_Crc16(crc, frames[index], m->length);
+    if (crc != m->crc) {
+        streamStats.crcErrors++;
+        return NULL;
+    }
+
+    uint8_t type = m->header[HDR_TYPE];
+    uint8_t seq = m->header[HDR_SEQ];
+    uint8_t inSequence = haveSeq && now - lastFrameMs < STREAM_HOLD_MS;
+    uint8_t ahead = (uint8_t)(seq - lastSeq);
+    if (inSequence && (ahead == 0 || ahead > 127)) {
+        // A repeat or a late arrival; the front frame is already newer
+        streamStats.duplicates++;
+        return NULL;
+    }
+    uint8_t follows = inSequence && ahead == 1;
+    if (inSequence) {
+        streamStats.framesDropped += (uint8_t)(ahead - 1);
+    }
+    haveSeq = 1;
+    lastSeq = seq;
+
+    if (type == STREAM_TYPE_RAW) {
+        // Shown straight from the receive buffer
+        frontIndex = index;
+    } else if (StreamProtocol_IsKeyframe(type) || (frontValid && follows)) {
+        // Expand or patch in place on top of the previous frame
+        if (!StreamProtocol_Decode(type, frames[index], m->length, frames[frontIndex])) {
+            streamStats.decodeErrors++;
+            frontValid = 0;
+            return NULL;
+        }
+    } else {
+        // A delta against a frame we never got; wait for the next keyframe
+        streamStats.deltasSkipped++;
+        frontValid = 0;
+        return NULL;
+    }
+
+    frontValid = 1;
+    streamStats.framesPresented++;
+    fpsWindowFrames++;
+    lastFrameMs = now;
+    return frames[frontIndex];
+}
+
+const uint8_t *Stream_NextFrame(void) {
+    uint32_t now = SysTick_GetMs();
+    int8_t claimed;
+
+    NVIC_DisableIRQ(UART0_IRQn);
+
+    // Drop a packet whose sender went quiet part way through
+    if (rxState != RX_SYNC0 && now - packetStartMs > STREAM_PACKET_TIMEOUT_MS) {
+        if (rxState == RX_PAYLOAD) {
+            UDMA_StopChannel(UDMA_CH_UART0RX);
+            endPayload();
+        }
+        rxState = RX_SYNC0;
+        streamStats.timeouts++;
+    }
+
+    // Take the newest packet; the receiver keeps away from it until we are done
+    claimed = readyIndex;
+    if (claimed >= 0) {
+        readyIndex = -1;
+        mainIndex = claimed;
+    }
+
+    NVIC_EnableIRQ(UART0_IRQn);
+
+    if (now - fpsWindowStart >= 1000U) {
+        streamStats.fps = fpsWindowFrames;
+        fpsWindowFrames = 0;
+        fpsWindowStart = now;
+    }
+
+    if (claimed < 0) {
+        return NULL;
+    }
+
+    const uint8_t *frame = presentPacket(claimed, now);
+    mainIndex = -1;
+    return frame;
+}
+
+uint8_t Stream_Active(void) {
+    return streamStats.framesPresented > 0 && SysTick_GetMs() - lastFrameMs < STREAM_HOLD_MS;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file stream.h
+ * @brief Live frames from a PC over UART0 (LaunchPad virtual COM port).
+ *
+ * The packet header is parsed in the UART interrupt; the payload is then
+ * moved by uDMA straight into a free buffer. Three buffers rotate between
+ * the receiver (back), the newest complete packet (ready) and the frame
+ * being sent to the LEDs (front), so reception never waits on the ~80 ms
+ * WS2812 output. Raw keyframes are shown straight from their buffer;
+ * RLE keyframes and deltas are decoded in place into the front frame.
+ * Deltas only work if every packet is shown, so a sender using them
+ * should not outpace the cube. See stream_protocol.h for the format.
+ */
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+#include "stream_protocol.h"
+
+#define STREAM_BAUD               921600U
+#define STREAM_HOLD_MS            2000U   // Stay in streaming mode this long after the last frame
+#define STREAM_PACKET_TIMEOUT_MS  100U    // Abandon a packet that stalls this long
+
+typedef struct {
+    uint32_t framesReceived;     // Packets received in full
+    uint32_t framesPresented;    // Frames that passed the CRC and were handed out
+    uint32_t framesOverwritten;  // Complete frames replaced before they were shown
+    uint32_t framesDropped;      // Gaps in seq when presenting (lost, corrupt or overwritten)
+    uint32_t crcErrors;
+    uint32_t headerErrors;       // Unknown type or bad length
+    uint32_t decodeErrors;       // Malformed compressed payloads
+    uint32_t deltasSkipped;      // Deltas ignored while waiting for a keyframe
+    uint32_t duplicates;         // Repeated or out of order seq numbers ignored
+    uint32_t overruns;           // UART receive FIFO overruns
+    uint32_t timeouts;           // Packets abandoned part way through
+    uint16_t fps;                // Frames presented during the last full second
+} stream_stats_t;
+
+extern volatile stream_stats_t streamStats;
+
+/**
+ * @brief Configure UART0 at STREAM_BAUD and start listening for packets.
+ */
+void Stream_Init(void);
+
+/**
+ * @brief Take the newest complete frame, if any, after checking its CRC.
+ * @return GRB frame in LED buffer order, valid until the next call, or NULL.
+ */
+const uint8_t *Stream_NextFrame(void);
+
+/**
+ * @brief Whether a host has sent a frame within the last STREAM_HOLD_MS.
+ */
+uint8_t Stream_Active(void);
+
+#endif // STREAM_H
@@ -0,0 +1,165 @@
+/**
+ * @file stream_encoder.c
+ * @brief Keyframe/delta packet encoder for the UART stream.
+ */
+
+#include "stream_encoder.h"
+#include <stddef.h>  // For NULL definition
+
+static uint8_t ledChanged(const stream_encoder_t *enc, const uint8_t *frame, uint16_t led) {
+    const uint8_t *a = &enc->reference[led * 3];
+    const uint8_t *b = &frame[led * 3];
+    return a[0] != b[0] || a[1] != b[1] || a[2] != b[2];
+}
+
+static uint8_t sameColor(const uint8_t *frame, uint16_t a, uint16_t b) {
+    return frame[a * 3] == frame[b * 3] &&
+           frame[a * 3 + 1] == frame[b * 3 + 1] &&
+           frame[a * 3 + 2] == frame[b * 3 + 2];
+}
+
+// Each writer returns the payload size; with out == NULL it only measures
+
+static uint16_t writeRle(const uint8_t *frame, uint8_t *out) {
+    uint16_t length = 0;
+    uint16_t led = 0;
+
+    while (led < NUM_LEDS) {
+        uint16_t end = led + 1;
+        while (end < NUM_LEDS && end - led < STREAM_RUN_MAX && sameColor(frame, led, end)) {
+            end++;
+        }
+        if (out != NULL) {
+            out[length]     = (uint8_t)(end - led);
+            out[length + 1] = frame[led * 3];
+            out[length + 2] = frame[led * 3 + 1];
+            out[length + 3] = frame[led * 3 + 2];
+        }
+        length += 4;
+        led = end;
+    }
+    return length;
+}
+
+static uint16_t writeSpans(const stream_encoder_t *enc, const uint8_t *frame, uint8_t *out) {
+    uint16_t length = 0;
+    uint16_t led = 0;
+
+    while (led < NUM_LEDS) {
+        if (!ledChanged(enc, frame, led)) {
+            led++;
+            continue;
+        }
+        uint16_t end = led + 1;
+        while (end < NUM_LEDS && end - led < STREAM_RUN_MAX && ledChanged(enc, frame, end)) {
+            end++;
+        }
+        uint16_t bytes = (end - led) * 3;
+        if (out != NULL) {
+            out[length]     = (uint8_t)(led & 0xFF);
+            out[length + 1] = (uint8_t)(led >> 8);
+            out[length + 2] = (uint8_t)(end - led);
+            for (uint16_t b = 0; b < bytes; b++) {
+                out[length + 3 + b] = frame[led * 3 + b];
+            }
+        }
+        length += 3 + bytes;
+        led = end;
+    }
+    return length;
+}
+
+static uint16_t writeBitmap(const stream_encoder_t *enc, const uint8_t *frame, uint8_t *out) {
+    uint16_t length = STREAM_BITMAP_BYTES;
+
+    if (out != NULL) {
+        for (uint16_t i = 0; i < STREAM_BITMAP_BYTES; i++) {
+            out[i] = 0;
+        }
+    }
+    for (uint16_t led = 0; led < NUM_LEDS; led++) {
+        if (!ledChanged(enc, frame, led)) {
+            continue;
+        }
+        if (out != NULL) {
+            out[led >> 3] |= (uint8_t)(1U << (led & 7));
+            out[length]     = frame[led * 3];
+            out[length + 1] = frame[led * 3 + 1];
+            out[length + 2] = frame[led * 3 + 2];
+        }
+        length += 3;
+    }
+    return length;
+}
+
+void StreamEncoder_Init(stream_encoder_t *enc, uint16_t keyInterval) {
+    enc->haveReference = 0;
+    enc->seq = 0;
+    enc->keyInterval = keyInterval;
+    enc->sinceKey = 0;
+}
+
+uint16_t StreamEncoder_Encode(stream_encoder_t *enc, const uint8_t *frame, uint8_t *packet) {
+    uint8_t *payload = packet + STREAM_HEADER_SIZE;
+    uint8_t keyDue = !enc->haveReference ||
+                     (enc->keyInterval != 0 && enc->sinceKey + 1 >= enc->keyInterval);
+    uint8_t type = STREAM_TYPE_RAW;
+    uint16_t size = STREAM_FRAME_BYTES;
+    uint16_t candidate;
+
+    // Measure every allowed encoding and keep the smallest
+    candidate = writeRle(frame, NULL);
+    if (candidate < size) {
+        type = STREAM_TYPE_RLE;
+        size = candidate;
+    }
+    if (!keyDue) {
+        candidate = writeSpans(enc, frame, NULL);
+        if (candidate < size) {
+            type = STREAM_TYPE_SPANS;
+            size = candidate;
+        }
+        candidate = writeBitmap(enc, frame, NULL);
+        if (candidate < size) {
+            type = STREAM_TYPE_BITMAP;
+            size = candidate;
+        }
+    }
+
+    switch (type) {
+        case STREAM_TYPE_RAW:
+            for (uint16_t i = 0; i < STREAM_FRAME_BYTES; i++) {
+                payload[i] = frame[i];
+            }
+            break;
+        case STREAM_TYPE_RLE:
+            writeRle(frame, payload);
+            break;
+        case STREAM_TYPE_SPANS:
+            writeSpans(enc, frame, payload);
+            break;
+        case STREAM_TYPE_BITMAP:
+            writeBitmap(enc, frame, payload);
+            break;
+    }
+
+    packet[0] = STREAM_SYNC0;
+    packet[1] = STREAM_SYNC1;
+    packet[2] = type;
+    packet[3] = enc->seq++;
+    packet[4] = (uint8_t)(size & 0xFF);
+    packet[5] = (uint8_t)(size >> 8);
+
+    uint16_t crc = StreamProtocol_Crc16(STREAM_CRC_INIT, &packet[2], STREAM_HEADER_SIZE - 2 + size);
+    packet[STREAM_HEADER_SIZE + size]     = (uint8_t)(crc & 0xFF);
+    packet[STREAM_HEADER_SIZE + size + 1] = (uint8_t)(crc >> 8);
+
+    // The receiver now holds this frame
+    for (uint16_t i = 0; i < STREAM_FRAME_BYTES; i++) {
+        enc->reference[i] = frame[i];
+    }
+    enc->haveReference = 1;
+    enc->sinceKey = StreamProtocol_IsKeyframe(type) ? 0 : enc->sinceKey + 1;
+
+    return STREAM_HEADER_SIZE + size + STREAM_CRC_SIZE;
+}
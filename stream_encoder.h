@@ -0,0 +1,35 @@
+/**
+ * @file stream_encoder.h
+ * @brief Sender side of the stream protocol: picks the smallest packet per frame.
+ *
+ * Plain C with no hardware access, for a PC sender or for measuring
+ * packet sizes on the target.
+ */
+#ifndef STREAM_ENCODER_H
+#define STREAM_ENCODER_H
+
+#include <stdint.h>
+#include "stream_protocol.h"
+
+typedef struct {
+    uint8_t reference[STREAM_FRAME_BYTES];  // What the receiver shows after the last packet
+    uint8_t haveReference;
+    uint8_t seq;
+    uint16_t keyInterval;   // Send a keyframe at least this often (0 = only the first)
+    uint16_t sinceKey;      // Packets since the last keyframe
+} stream_encoder_t;
+
+/**
+ * @brief Reset an encoder; the next packet will be a keyframe.
+ */
+void StreamEncoder_Init(stream_encoder_t *enc, uint16_t keyInterval);
+
+/**
+ * @brief Encode one frame as the smallest valid packet.
+ * @param frame  GRB frame in LED buffer order.
+ * @param packet Output, at least STREAM_MAX_PACKET bytes.
+ * @return Packet length in bytes; packet[2] holds the chosen type.
+ */
+uint16_t StreamEncoder_Encode(stream_encoder_t *enc, const uint8_t *frame, uint8_t *packet);
+
+#endif // STREAM_ENCODER_H
@@ -0,0 +1,114 @@
+/**
+ * @file stream_protocol.c
+ * @brief Packet CRC, length checks and RLE, span and bitmap decoders for the stream.
+ */
+
+#include "stream_protocol.h"
+
+// CRC-16/CCITT-FALSE remainders for one nibble
+static const uint16_t crcNibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t StreamProtocol_Crc16(uint16_t crc, const uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        crc = (uint16_t)(crc << 4) ^ crcNibble[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (uint16_t)(crc << 4) ^ crcNibble[(crc >> 12) ^ (data[i] & 0x0F)];
+    }
+    return crc;
+}
+
+uint8_t StreamProtocol_IsKeyframe(uint8_t type) {
+    return type == STREAM_TYPE_RAW || type == STREAM_TYPE_RLE;
+}
+
+uint8_t StreamProtocol_LengthValid(uint8_t type, uint16_t length) {
+    switch (type) {
+        case STREAM_TYPE_RAW:
+            return length == STREAM_FRAME_BYTES;
+        case STREAM_TYPE_RLE:
+            return length >= 4 && length <= STREAM_MAX_PAYLOAD;
+        case STREAM_TYPE_SPANS:
+            return length <= STREAM_MAX_PAYLOAD;
+        case STREAM_TYPE_BITMAP:
+            return length >= STREAM_BITMAP_BYTES && length <= STREAM_MAX_PAYLOAD;
+    }
+    return 0;
+}
+
+static int decodeRle(const uint8_t *payload, uint16_t length, uint8_t *frame) {
+    uint16_t led = 0;
+
+    for (uint16_t i = 0; i + 4 <= length; i += 4) {
+        uint8_t count = payload[i];
+        if (count == 0 || led + count > NUM_LEDS) {
+            return 0;
+        }
+        for (uint8_t n = 0; n < count; n++, led++) {
+            frame[led * 3]     = payload[i + 1];
+            frame[led * 3 + 1] = payload[i + 2];
+            frame[led * 3 + 2] = payload[i + 3];
+        }
+    }
+    return led == NUM_LEDS && (length % 4) == 0;
+}
+
+static int decodeSpans(const uint8_t *payload, uint16_t length, uint8_t *frame) {
+    uint16_t i = 0;
+
+    while (i < length) {
+        if (i + 3 > length) {
+            return 0;
+        }
+        uint16_t start = (uint16_t)(payload[i] | (payload[i + 1] << 8));
+        uint8_t count = payload[i + 2];
+        uint16_t bytes = count * 3;
+        i += 3;
+        if (count == 0 || start + count > NUM_LEDS || i + bytes > length) {
+            return 0;
+        }
+        for (uint16_t b = 0; b < bytes; b++) {
+            frame[start * 3 + b] = payload[i + b];
+        }
+        i += bytes;
+    }
+    return 1;
+}
+
+static int decodeBitmap(const uint8_t *payload, uint16_t length, uint8_t *frame) {
+    const uint8_t *color = payload + STREAM_BITMAP_BYTES;
+    const uint8_t *end = payload + length;
+
+    for (uint16_t led = 0; led < NUM_LEDS; led++) {
+        if (payload[led >> 3] & (1U << (led & 7))) {
+            if (color + 3 > end) {
+                return 0;
+            }
+            frame[led * 3]     = *color++;
+            frame[led * 3 + 1] = *color++;
+            frame[led * 3 + 2] = *color++;
+        }
+    }
+    return color == end;
+}
+
+int StreamProtocol_Decode(uint8_t type, const uint8_t *payload, uint16_t length, uint8_t *frame) {
+    if (!StreamProtocol_LengthValid(type, length)) {
+        return 0;
+    }
+    switch (type) {
+        case STREAM_TYPE_RAW:
+            for (uint16_t i = 0; i < STREAM_FRAME_BYTES; i++) {
+                frame[i] = payload[i];
+            }
+            return 1;
+        case STREAM_TYPE_RLE:
+            return decodeRle(payload, length, frame);
+        case STREAM_TYPE_SPANS:
+            return decodeSpans(payload, length, frame);
+        case STREAM_TYPE_BITMAP:
+            return decodeBitmap(payload, length, frame);
+    }
+    return 0;
+}
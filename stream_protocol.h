@@ -0,0 +1,73 @@
+/**
+ * @file stream_protocol.h
+ * @brief Wire format of frames streamed to the cube over UART.
+ *
+ * Every packet is
+ *
+ *   0xA5 0x5A | type | seq | length (2, LE) | payload | crc16 (2, LE)
+ *
+ * The CRC is CRC-16/CCITT-FALSE over type, seq, length and payload. seq
+ * counts up by one per frame sent so the receiver can count losses. This
+ * file has no hardware dependencies and can be shared with a PC sender.
+ *
+ * Keyframes (RAW, RLE) describe a whole frame. Delta frames (SPANS,
+ * BITMAP) only list the LEDs that changed since the frame with seq - 1,
+ * so after a lost packet the receiver ignores deltas until the next
+ * keyframe. LED indices are positions in the GRB buffer (0..NUM_LEDS-1).
+ *
+ *   RAW     NUM_LEDS * GRB
+ *   RLE     { count(1..255), GRB } ... covering exactly NUM_LEDS LEDs
+ *   SPANS   { start(2, LE), count(1..255), count * GRB } ...
+ *   BITMAP  (NUM_LEDS + 7) / 8 bytes, bit i set = LED i changed (LSB first),
+ *           then one GRB per set bit in index order
+ */
+#ifndef STREAM_PROTOCOL_H
+#define STREAM_PROTOCOL_H
+
+#include <stdint.h>
+#include "cube_config.h"
+
+#define STREAM_SYNC0           0xA5
+#define STREAM_SYNC1           0x5A
+#define STREAM_HEADER_SIZE     6     // Sync, type, seq, length
+#define STREAM_CRC_SIZE        2
+
+// Packet types
+#define STREAM_TYPE_RAW        0x01  // Keyframe: full GRB frame in LED buffer order
+#define STREAM_TYPE_RLE        0x02  // Keyframe: runs of one color
+#define STREAM_TYPE_SPANS      0x03  // Delta: runs of changed LEDs
+#define STREAM_TYPE_BITMAP     0x04  // Delta: changed-LED bitmap plus colors
+
+#define STREAM_FRAME_BYTES     (NUM_LEDS * 3)
+#define STREAM_BITMAP_BYTES    ((NUM_LEDS + 7) / 8)
+#define STREAM_MAX_PAYLOAD     STREAM_FRAME_BYTES   // Senders never need more than RAW
+#define STREAM_MAX_PACKET      (STREAM_HEADER_SIZE + STREAM_MAX_PAYLOAD + STREAM_CRC_SIZE)
+#define STREAM_RUN_MAX         255
+
+#define STREAM_CRC_INIT        0xFFFF
+
+/**
+ * @brief Continue a CRC-16/CCITT-FALSE (poly 0x1021) over more bytes.
+ * @param crc  STREAM_CRC_INIT for the first block, else the previous result.
+ */
+uint16_t StreamProtocol_Crc16(uint16_t crc, const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Whether a packet type describes a whole frame on its own.
+ */
+uint8_t StreamProtocol_IsKeyframe(uint8_t type);
+
+/**
+ * @brief Check that a payload length is possible for a packet type.
+ */
+uint8_t StreamProtocol_LengthValid(uint8_t type, uint16_t length);
+
+/**
+ * @brief Apply a packet payload to a frame in place.
+ *
+ * For delta types @p frame must hold the previous frame.
+ * @return 1 on success, 0 if the payload is malformed (frame may be partly written).
+ */
+int StreamProtocol_Decode(uint8_t type, const uint8_t *payload, uint16_t length, uint8_t *frame);
+
+#endif // STREAM_PROTOCOL_H
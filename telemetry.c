@@ -0,0 +1,98 @@
+/**
+ * @file telemetry.c
+ * @brief Status line writer for UART0 (configured by Stream_Init).
+ */
+
+#include "TM4C123GH6PM.h"
+#include "telemetry.h"
+#include "board.h"
+#include "scheduler.h"
+#include "stream.h"
+#include "led_output.h"
+#include "SysTick_Delay.h"
+#include "profiler.h"
+
+#define UART_FR_TXFF      (1U << 5)   // Transmit FIFO full
+#define MAX_WAIT          1000        // Loop iterations before giving up on a byte
+
+#define CYCLES_PER_US     (SYS_CLOCK / 1000000U)
+
+static uint32_t lastRuns[SCHEDULER_MAX_TASKS];
+static uint32_t lastCycles = 0;
+static uint32_t lastEncodes = 0;
+static uint64_t lastEncodeCycles = 0;
+
+static void putChar(char c) {
+    volatile uint32_t timeout = MAX_WAIT;
+    while ((UART0->FR & UART_FR_TXFF) && --timeout > 0);
+    if (timeout != 0) {
+        UART0->DR = (uint8_t)c;
+    }
+}
+
+static void putString(const char *s) {
+    while (*s) {
+        putChar(*s++);
+    }
+}
+
+static void putNumber(uint32_t value) {
+    char digits[10];
+    uint8_t n = 0;
+    do {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (n > 0) {
+        putChar(digits[--n]);
+    }
+}
+
+void Telemetry_Send(void) {
+#if TELEMETRY_ENABLE
+    putString("t=");
+    putNumber(SysTick_GetMs());
+    led_output_stats_t output;
+    LedOutput_GetStats(&output);
+    putString(" skip=");
+    putNumber(output.skipped);
+    putString(" err=");
+    putNumber(output.errors);
+    putString(" stream=");
+    putNumber(streamStats.fps);
+
+    // Average encode pass (post-processing included) of the frames sent since the last line
+    volatile profile_slot_t *encode = &profileSlots[PROFILE_SLOT_ENCODE];
+    uint32_t encodes = encode->count - lastEncodes;
+    putString(" enc=");
+    putNumber(encodes != 0 ? (uint32_t)((encode->totalCycles - lastEncodeCycles) / encodes) : 0);
+    putString("cyc");
+    lastEncodes = encode->count;
+    lastEncodeCycles = encode->totalCycles;
+
+    uint32_t now = SysTick_GetCycles();
+    uint16_t idle = Profiler_IdleDuty(now - lastCycles);
+    lastCycles = now;
+    putString(" idle=");
+    putNumber(idle / 10);
+    putChar('.');
+    putNumber(idle % 10);
+    putChar('%');
+
+    for (uint8_t i = 0; i < Scheduler_TaskCount(); i++) {
+        scheduler_task_t *task = &schedulerTasks[i];
+        putString(" | ");
+        putString(task->name);
+        putString(" r");
+        putNumber(task->runs - lastRuns[i]);
+        putChar(' ');
+        putNumber(task->maxCycles / CYCLES_PER_US);
+        putString("us o");
+        putNumber(task->overruns);
+        putString(" m");
+        putNumber(task->missed);
+        lastRuns[i] = task->runs;
+    }
+    putString("\r\n");
+#endif
+}
@@ -0,0 +1,31 @@
+/**
+ * @file telemetry.h
+ * @brief Periodic status line on the UART0 transmit side (virtual COM port).
+ *
+ * UART0 receives streamed frames (stream.h); its transmitter is otherwise
+ * idle, so a terminal on the same port sees one line per call:
+ *
+ *   t=12345 skip=17 err=0 stream=0 enc=41230cyc idle=87.5% | input r100 12us o0 m0 | ...
+ *
+ * with the uptime in ms, output frames skipped as unchanged and lost to
+ * bus timeouts, streamed frames per second, the average CPU cycles of one
+ * frame's encode pass (PROFILE_SLOT_ENCODE), the share of time asleep
+ * since the last line and, per scheduler task, its runs since the last
+ * line, worst run time, overruns and missed periods.
+ */
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#define TELEMETRY_PERIOD_MS  1000U
+
+// Set to 0 to keep the UART transmitter silent
+#ifndef TELEMETRY_ENABLE
+#define TELEMETRY_ENABLE 1
+#endif
+
+/**
+ * @brief Write one status line (about 1 ms at STREAM_BAUD).
+ */
+void Telemetry_Send(void);
+
+#endif // TELEMETRY_H
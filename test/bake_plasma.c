@@ -0,0 +1,39 @@
+/**
+ * @file bake_plasma.c
+ * @brief Renders the live plasma loop to raw GRB frames for pack_anim.
+ *
+ * Built against firmware with PLASMA_FROM_FLASH 0. Writes one NUM_LEDS * 3
+ * byte frame (testBuffer order) per plasma update at brightness 1.0, for
+ * the 100 updates the plasma takes to repeat.
+ *
+ *   bake_plasma FRAMES
+ */
+
+#include <stdio.h>
+#include "chain_render.h"
+#include "common_functions.h"
+#include "new_patterns.h"
+
+#define PLASMA_LOOP_FRAMES  100   // plasmaOffset runs 0..99
+
+#if PLASMA_FROM_FLASH
+#error "bake_plasma needs the live plasma (PLASMA_FROM_FLASH 0)"
+#endif
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: bake_plasma FRAMES\n");
+        return 2;
+    }
+    FILE *out = fopen(argv[1], "wb");
+    if (out == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    for (int f = 0; f < PLASMA_LOOP_FRAMES; f++) {
+        updatePlasmaPattern(0, 1.0f);
+        ChainRender_Resolve();
+        fwrite(testBuffer, 1, NUM_LEDS * 3, out);
+    }
+    return fclose(out) != 0;
+}
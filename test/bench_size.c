@@ -0,0 +1,65 @@
+/**
+ * @file bench_size.c
+ * @brief Frame cost against cube size.
+ *
+ * Built once per CUBE_SIZE (the size* variants in the Makefile). Renders
+ * each pattern's check run (pattern_check.h) and sends every frame through
+ * the output chain to the file sink (led_sink.h), timing both on the host.
+ * Prints one line per build: voxel count, average render and output
+ * time per frame, time per voxel, and the WS2812 wire time that caps the
+ * frame rate at that size. Host times only show how cost scales
+ * with the voxel count; the cube's own figures are on the telemetry line.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "pattern_check.h"
+#include "common_functions.h"
+#include "new_patterns.h"
+#include "rotation_tables.h"
+#include "led_output.h"
+#include "led_sink.h"
+#include "output.h"
+
+#define WS2812_LED_US  30U   // 24 bits at 1.25 us
+
+static double nowNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+int main(void) {
+    Cube_Init();
+    initRainPattern();
+    initRainRGBPattern();
+    initFireworksPattern();
+    RotationTables_Init();
+    LedOutput_Select(&ledSinkDevice);
+    Output_SetStages(OUTPUT_STAGE_GAMMA | OUTPUT_STAGE_BRIGHTNESS | OUTPUT_STAGE_POWER_LIMIT |
+                     OUTPUT_STAGE_DITHER);
+
+    double renderNs = 0;
+    double outputNs = 0;
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+        seedPatternRand(PATTERN_CHECK_SEED);
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            double start = nowNs();
+            PatternCheck_RenderFrame(p, f);
+            double rendered = nowNs();
+            LedOutput_Show(testBuffer, NUM_LEDS);
+            outputNs += nowNs() - rendered;
+            renderNs += rendered - start;
+        }
+    }
+
+    double frames = (double)PATTERN_COUNT * PATTERN_CHECK_FRAMES;
+    uint32_t wireUs = NUM_LEDS * WS2812_LED_US;
+    printf("size %2u: %4u voxels, render %8.2f us, output %7.2f us, %5.1f ns/voxel, "
+           "wire %5.2f ms (%u fps)\n",
+           (unsigned)CUBE_SIZE, (unsigned)NUM_LEDS,
+           renderNs / frames / 1000.0, outputNs / frames / 1000.0,
+           (renderNs + outputNs) / frames / NUM_LEDS, wireUs / 1000.0, (unsigned)(1000000U / wireUs));
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file bench_stream.c
+ * @brief Stream packet sizes for every built-in pattern.
+ *
+ * Encodes each pattern's check run (pattern_check.h: 64 frames, the same
+ * seed and brightness) the way a PC sender would stream it and reports
+ * the average and largest packet, the packet types chosen, the frame rate
+ * STREAM_BAUD allows at that size and the host time per encode. Every
+ * packet is decoded again on top of the previous frame and must give the
+ * frame that was encoded.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "pattern_check.h"
+#include "common_functions.h"
+#include "new_patterns.h"
+#include "rotation_tables.h"
+#include "stream.h"
+#include "stream_encoder.h"
+
+#define UART_BYTES_PER_S  (STREAM_BAUD / 10U)   // Start, 8 data, stop
+
+static stream_encoder_t encoder;
+static uint8_t packet[STREAM_MAX_PACKET];
+static uint8_t received[STREAM_FRAME_BYTES];
+
+static double nowNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+int main(void) {
+    Cube_Init();
+    initRainPattern();
+    initRainRGBPattern();
+    initFireworksPattern();
+    RotationTables_Init();
+
+    int failures = 0;
+    uint32_t allBytes = 0;
+    printf("pattern  avg B  max B   raw  rle spans bitmap  fps@%u  encode us\n", (unsigned)STREAM_BAUD);
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+        uint32_t total = 0;
+        uint16_t largest = 0;
+        uint16_t types[STREAM_TYPE_BITMAP + 1] = {0};
+        double encodeNs = 0;
+
+        StreamEncoder_Init(&encoder, PATTERN_CHECK_KEY_INTERVAL);
+        seedPatternRand(PATTERN_CHECK_SEED);
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            PatternCheck_RenderFrame(p, f);
+            double start = nowNs();
+            uint16_t bytes = StreamEncoder_Encode(&encoder, testBuffer, packet);
+            encodeNs += nowNs() - start;
+
+            uint8_t type = packet[2];
+            uint16_t length = (uint16_t)(packet[4] | (packet[5] << 8));
+            if (!StreamProtocol_Decode(type, packet + STREAM_HEADER_SIZE, length, received) ||
+                memcmp(received, testBuffer, STREAM_FRAME_BYTES) != 0) {
+                printf("pattern %2u: frame %u does not decode to what was encoded\n", p, f);
+                failures++;
+                break;
+            }
+            total += bytes;
+            if (bytes > largest) largest = bytes;
+            types[type]++;
+        }
+
+        uint32_t average = (total + PATTERN_CHECK_FRAMES / 2) / PATTERN_CHECK_FRAMES;
+        printf("%7u %6u %6u %5u %4u %5u %6u %7u %10.2f\n", p, (unsigned)average, largest,
+               types[STREAM_TYPE_RAW], types[STREAM_TYPE_RLE], types[STREAM_TYPE_SPANS],
+               types[STREAM_TYPE_BITMAP], (unsigned)(UART_BYTES_PER_S / average),
+               encodeNs / PATTERN_CHECK_FRAMES / 1000.0);
+        allBytes += total;
+    }
+    printf("all patterns: %u bytes per frame on average, raw is %u\n",
+           (unsigned)(allBytes / (PATTERN_COUNT * PATTERN_CHECK_FRAMES)),
+           (unsigned)(STREAM_HEADER_SIZE + STREAM_FRAME_BYTES + STREAM_CRC_SIZE));
+    return failures != 0;
+}
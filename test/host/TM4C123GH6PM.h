@@ -0,0 +1,142 @@
+/**
+ * @file TM4C123GH6PM.h
+ * @brief Host stand-in for the device header, for building the firmware on a PC.
+ *
+ * Peripheral registers are plain variables (host_device.c) that a test can
+ * preset and inspect; their reset values keep status polls from blocking
+ * (SSI transmit FIFO never full, UART receive FIFO empty, peripherals
+ * ready). The DWT cycle counter follows the host's monotonic clock at
+ * SYS_CLOCK, so waits on it finish and profiling reports host time in
+ * 80 MHz cycles. Interrupt control does nothing; a test raises an
+ * interrupt by calling its handler. Only what the firmware uses is here.
+ */
+#ifndef TM4C123GH6PM_H
+#define TM4C123GH6PM_H
+
+#include <stdint.h>
+
+#define __I   volatile const
+#define __O   volatile
+#define __IO  volatile
+
+typedef enum {
+    UART0_IRQn    = 5,
+    SSI0_IRQn     = 7,
+    ADC0SS3_IRQn  = 17,
+    GPIOF_IRQn    = 30
+} IRQn_Type;
+
+typedef struct {
+    __IO uint32_t DATA, DIR, IS, IBE, IEV, IM, RIS, MIS, ICR, AFSEL;
+    __IO uint32_t DR2R, DR4R, DR8R, ODR, PUR, PDR, SLR, DEN, LOCK, CR, AMSEL, PCTL;
+} GPIOA_Type;
+
+typedef struct {
+    __IO uint32_t CR0, CR1, DR, SR, CPSR, IM, RIS, MIS, ICR, DMACTL;
+} SSI0_Type;
+
+typedef struct {
+    __IO uint32_t DR, FR, IBRD, FBRD, LCRH, CTL, IFLS, IM, RIS, MIS, ICR, DMACTL;
+} UART0_Type;
+
+typedef struct {
+    __IO uint32_t ACTSS, RIS, IM, ISC, EMUX, PSSI, SAC;
+    __IO uint32_t SSMUX0, SSCTL0, SSFIFO0, SSMUX3, SSCTL3, SSFIFO3;
+} ADC0_Type;
+
+typedef struct {
+    __IO uint32_t CFG, TAMR, CTL, RIS, ICR, TAILR;
+} TIMER0_Type;
+
+typedef struct {
+    __IO uint32_t CFG, CTLBASE, ALTCLR, USEBURSTCLR, REQMASKCLR, ENASET, ENACLR, CHIS;
+} UDMA_Type;
+
+typedef struct {
+    __IO uint32_t RIS, RCC, RCC2;
+    __IO uint32_t RCGCGPIO, RCGCTIMER, RCGCUART, RCGCSSI, RCGCADC, RCGCDMA;
+    __IO uint32_t PRTIMER, PRUART, PRDMA;
+} SYSCTL_Type;
+
+typedef struct {
+    __IO uint32_t CTRL, LOAD, VAL, CALIB;
+} SysTick_Type;
+
+typedef struct {
+    __IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern GPIOA_Type hostGpioA, hostGpioE, hostGpioF;
+extern SSI0_Type hostSsi0;
+extern UART0_Type hostUart0;
+extern ADC0_Type hostAdc0;
+extern TIMER0_Type hostTimer0, hostTimer1, hostTimer2;
+extern UDMA_Type hostUdma;
+extern SYSCTL_Type hostSysctl;
+extern SysTick_Type hostSysTick;
+extern CoreDebug_Type hostCoreDebug;
+
+/**
+ * @brief DWT registers with CYCCNT brought up to the host clock.
+ */
+DWT_Type *hostDwt(void);
+
+#define GPIOA      (&hostGpioA)
+#define GPIOE      (&hostGpioE)
+#define GPIOF      (&hostGpioF)
+#define SSI0       (&hostSsi0)
+#define UART0      (&hostUart0)
+#define ADC0       (&hostAdc0)
+#define TIMER0     (&hostTimer0)
+#define TIMER1     (&hostTimer1)
+#define TIMER2     (&hostTimer2)
+#define UDMA       (&hostUdma)
+#define SYSCTL     (&hostSysctl)
+#define SysTick    (&hostSysTick)
+#define CoreDebug  (&hostCoreDebug)
+#define DWT        (hostDwt())
+
+#define GPIO_PORTA_BASE  0x40004000UL
+#define GPIO_PORTE_BASE  0x40024000UL
+#define GPIO_PORTF_BASE  0x40025000UL
+
+#define DWT_CTRL_CYCCNTENA_Msk       (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk   (1UL << 24)
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq) { (void)irq; }
+static inline void NVIC_DisableIRQ(IRQn_Type irq) { (void)irq; }
+static inline void __NOP(void) {}
+static inline void __WFI(void) {}
+
+// Packed-byte DSP instructions, lane by lane
+static inline uint32_t __UQADD8(uint32_t a, uint32_t b) {
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i += 8) {
+        uint32_t s = ((a >> i) & 0xFF) + ((b >> i) & 0xFF);
+        r |= (s > 0xFF ? 0xFF : s) << i;
+    }
+    return r;
+}
+
+static inline uint32_t __UQSUB8(uint32_t a, uint32_t b) {
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i += 8) {
+        uint32_t x = (a >> i) & 0xFF, y = (b >> i) & 0xFF;
+        r |= (x > y ? x - y : 0) << i;
+    }
+    return r;
+}
+
+static inline uint32_t __UHADD8(uint32_t a, uint32_t b) {
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i += 8) {
+        r |= ((((a >> i) & 0xFF) + ((b >> i) & 0xFF)) >> 1) << i;
+    }
+    return r;
+}
+
+#endif // TM4C123GH6PM_H
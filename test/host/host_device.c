@@ -0,0 +1,32 @@
+/**
+ * @file host_device.c
+ * @brief Register variables behind the host TM4C123GH6PM.h.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "TM4C123GH6PM.h"
+#include "board.h"
+#include <time.h>
+
+#define SSI_SR_TNF     (1U << 1)    // Transmit FIFO not full
+#define UART_FR_RXFE   (1U << 4)    // Receive FIFO empty
+
+GPIOA_Type hostGpioA, hostGpioE, hostGpioF;
+SSI0_Type hostSsi0 = { .SR = SSI_SR_TNF };
+UART0_Type hostUart0 = { .FR = UART_FR_RXFE };
+ADC0_Type hostAdc0;
+TIMER0_Type hostTimer0, hostTimer1, hostTimer2;
+UDMA_Type hostUdma;
+SYSCTL_Type hostSysctl = { .PRTIMER = 0xFFFFFFFFU, .PRUART = 0xFFFFFFFFU, .PRDMA = 0xFFFFFFFFU };
+SysTick_Type hostSysTick;
+CoreDebug_Type hostCoreDebug;
+
+static DWT_Type dwt;
+
+DWT_Type *hostDwt(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t ns = (uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec;
+    dwt.CYCCNT = (uint32_t)(ns * (SYS_CLOCK / 1000000U) / 1000U);
+    return &dwt;
+}
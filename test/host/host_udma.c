@@ -0,0 +1,74 @@
+/**
+ * @file host_udma.c
+ * @brief uDMA controller model for host builds.
+ */
+
+#include "host_udma.h"
+#include "TM4C123GH6PM.h"
+#include <stddef.h>  // For NULL definition
+
+#define CHANNELS 32
+
+typedef struct {
+    const volatile uint8_t *src;
+    volatile uint8_t *dst;
+    uint16_t count;
+    uint8_t srcFixed;    // Source is a peripheral data register
+    uint8_t dstFixed;    // Destination is a peripheral data register
+} transfer_t;
+
+static transfer_t transfers[CHANNELS];
+
+void UDMA_Init(void) {
+}
+
+void UDMA_StartTransfer(uint8_t channel, uint32_t control,
+                        const volatile void *src, volatile void *dst, uint16_t count) {
+    transfer_t *t = &transfers[channel];
+    t->src = (const volatile uint8_t *)src;
+    t->dst = (volatile uint8_t *)dst;
+    t->count = count;
+    t->srcFixed = (control & UDMA_SRC_INC_NONE) == UDMA_SRC_INC_NONE;
+    t->dstFixed = (control & UDMA_DST_INC_NONE) == UDMA_DST_INC_NONE;
+    UDMA->CHIS &= ~(1U << channel);
+}
+
+uint8_t UDMA_TransferDone(uint8_t channel) {
+    uint32_t bit = 1U << channel;
+    if (UDMA->CHIS & bit) {
+        UDMA->CHIS &= ~bit;
+        return 1;
+    }
+    return 0;
+}
+
+void UDMA_StopChannel(uint8_t channel) {
+    transfers[channel].count = 0;
+    UDMA->CHIS &= ~(1U << channel);
+}
+
+uint16_t HostUdma_Pending(uint8_t channel) {
+    return transfers[channel].count;
+}
+
+uint16_t HostUdma_Run(uint8_t channel, const uint8_t *in, uint8_t *out) {
+    transfer_t *t = &transfers[channel];
+    uint16_t count = t->count;
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t byte = t->srcFixed ? (in != NULL ? in[i] : *t->src) : t->src[i];
+        if (t->dstFixed) {
+            *t->dst = byte;
+            if (out != NULL) {
+                out[i] = byte;
+            }
+        } else {
+            t->dst[i] = byte;
+        }
+    }
+    t->count = 0;
+    if (count > 0) {
+        UDMA->CHIS |= 1U << channel;
+    }
+    return count;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file host_udma.h
+ * @brief uDMA controller model for host builds (replaces UDMA.c).
+ *
+ * Starting a transfer only records it. A test then carries it out with
+ * HostUdma_Run(), standing in for the peripheral's DMA requests, and calls
+ * the peripheral's interrupt handler as the hardware would on completion.
+ */
+#ifndef HOST_UDMA_H
+#define HOST_UDMA_H
+
+#include <stdint.h>
+#include "UDMA.h"
+
+/**
+ * @brief Items the channel's started transfer still has to move (0 = idle).
+ */
+uint16_t HostUdma_Pending(uint8_t channel);
+
+/**
+ * @brief Carry out a started transfer as if the peripheral requested every item.
+ * @param in  Bytes the peripheral supplies when the source does not
+ *            increment (a receive data register), else NULL.
+ * @param out Receives the bytes when the destination does not increment
+ *            (a transmit data register), else NULL.
+ * @return Items moved.
+ */
+uint16_t HostUdma_Run(uint8_t channel, const uint8_t *in, uint8_t *out);
+
+#endif // HOST_UDMA_H
@@ -0,0 +1,125 @@
+/**
+ * @file pack_anim.c
+ * @brief Packs raw GRB frames into a flash animation source file.
+ *
+ * Reads NUM_LEDS * 3 byte frames in testBuffer order, packs them with
+ * AnimPack (anim_pack.h) and writes a C file defining the animation as a
+ * const array, ready for Animation_Open(). Reports the size and ratio.
+ *
+ *   pack_anim [-k KEY_INTERVAL] [-l] [-t FRAME_MS] FRAMES NAME OUT.c BRIEF FROM
+ *
+ *   -k  keyframe at least every KEY_INTERVAL frames (default 0: only the first)
+ *   -l  set ANIM_FLAG_LOOP
+ *   -t  duration of every frame in ms (default 0: one frame per update)
+ *   BRIEF  the file's @brief line; FROM  what the frames were rendered from
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "anim_pack.h"
+
+#define MAX_FRAMES  1000
+#define TEXT_WIDTH  72    // Comment text columns after " * "
+
+static uint8_t frame[NUM_LEDS * 3];
+static uint8_t packed[MAX_FRAMES * (ANIM_FRAME_HEADER_SIZE + NUM_LEDS) + ANIM_HEADER_SIZE + ANIM_PALETTE_MAX * 3];
+static anim_packer_t packer;
+
+// Word-wrapped comment lines
+static void writeComment(FILE *out, const char *text) {
+    while (*text != '\0') {
+        size_t length = strlen(text);
+        if (length > TEXT_WIDTH) {
+            length = TEXT_WIDTH;
+            while (length > 0 && text[length] != ' ') {
+                length--;
+            }
+        }
+        fprintf(out, " * %.*s\n", (int)length, text);
+        text += length;
+        while (*text == ' ') {
+            text++;
+        }
+    }
+}
+
+static int writeSource(const char *path, const char *name, const char *brief, const char *from,
+                       uint16_t keyInterval, uint8_t flags, uint32_t size, uint32_t ratioX100) {
+    FILE *out = fopen(path, "w");
+    if (out == NULL) {
+        perror(path);
+        return 1;
+    }
+    const char *file = strrchr(path, '/');
+    file = (file != NULL) ? file + 1 : path;
+
+    char text[1024];
+    snprintf(text, sizeof(text),
+             "Generated with AnimPack (anim_pack.h, key interval %u%s) from %s. "
+             "%u bytes, %u palette entries, %u.%02ux smaller than the raw GRB frames. "
+             "Do not edit by hand.",
+             keyInterval, (flags & ANIM_FLAG_LOOP) ? ", ANIM_FLAG_LOOP" : "", from,
+             (unsigned)size, packer.paletteSize, (unsigned)(ratioX100 / 100), (unsigned)(ratioX100 % 100));
+
+    fprintf(out, "/**\n * @file %s\n * @brief %s\n *\n", file, brief);
+    writeComment(out, text);
+    fprintf(out, " */\n\n#include <stdint.h>\n\nconst uint8_t %s[] = {\n", name);
+    for (uint32_t i = 0; i < size; i++) {
+        fprintf(out, "%s0x%02X,%s", (i % 16 == 0) ? "    " : " ", packed[i],
+                (i % 16 == 15 || i == size - 1) ? "\n" : "");
+    }
+    fprintf(out, "};\n");
+    return fclose(out) != 0;
+}
+
+int main(int argc, char **argv) {
+    uint16_t keyInterval = 0;
+    uint16_t frameMs = 0;
+    uint8_t flags = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "k:lt:")) != -1) {
+        switch (opt) {
+            case 'k': keyInterval = (uint16_t)atoi(optarg); break;
+            case 'l': flags |= ANIM_FLAG_LOOP; break;
+            case 't': frameMs = (uint16_t)atoi(optarg); break;
+            default: return 2;
+        }
+    }
+    if (argc - optind != 5) {
+        fprintf(stderr, "usage: pack_anim [-k KEY_INTERVAL] [-l] [-t FRAME_MS] FRAMES NAME OUT.c BRIEF FROM\n");
+        return 2;
+    }
+    const char *framesPath = argv[optind];
+    FILE *in = fopen(framesPath, "rb");
+    if (in == NULL) {
+        perror(framesPath);
+        return 1;
+    }
+
+    AnimPack_Begin(&packer, packed, sizeof(packed), keyInterval, flags);
+    uint16_t frames = 0;
+    while (fread(frame, 1, sizeof(frame), in) == sizeof(frame)) {
+        if (frames == MAX_FRAMES || !AnimPack_AddFrame(&packer, frame, frameMs)) {
+            fprintf(stderr, "%s: frame %u does not fit (%s)\n", framesPath, frames,
+                    frames == MAX_FRAMES ? "too many frames" : "out of space or palette entries");
+            fclose(in);
+            return 1;
+        }
+        frames++;
+    }
+    fclose(in);
+
+    uint32_t size = AnimPack_Finish(&packer);
+    if (frames == 0 || size == 0) {
+        fprintf(stderr, "%s: no animation packed\n", framesPath);
+        return 1;
+    }
+    uint32_t ratio = AnimPack_RatioX100(&packer);
+    printf("%u frames, %u bytes, %u palette entries, %u.%02ux\n", frames, (unsigned)size,
+           packer.paletteSize, (unsigned)(ratio / 100), (unsigned)(ratio % 100));
+    return writeSource(argv[optind + 2], argv[optind + 1], argv[optind + 3], argv[optind + 4],
+                       keyInterval, flags, size, ratio);
+}
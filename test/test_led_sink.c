@@ -0,0 +1,199 @@
+/**
+ * @file test_led_sink.c
+ * @brief Output device interface through the file sink.
+ *
+ * Selects ledSinkDevice, writes every frame it is handed to a temporary
+ * file and reads the file back: each frame source (GRB, blend, indexed,
+ * slices, the Rainbow pattern's layers) must come out as the GRB values
+ * worked out here, the output chain must run as it does in the LED
+ * drivers, and the stats, refresh and argument checks of led_output.c
+ * must hold.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+#include "chain_render.h"
+#include "common_functions.h"
+#include "led_output.h"
+#include "led_sink.h"
+#include "output.h"
+#include "patterns.h"
+
+#define FRAME_BYTES  (NUM_LEDS * 3)
+#define RUNS         10
+
+static uint8_t frameA[FRAME_BYTES];
+static uint8_t frameB[FRAME_BYTES];
+static uint8_t alpha[NUM_LEDS];
+static uint8_t indices[NUM_LEDS];
+static uint8_t palette[256 * 3];
+static uint8_t expected[FRAME_BYTES];
+static uint8_t readBack[FRAME_BYTES];
+static uint8_t sliceSeed;
+
+static FILE *sinkFile;
+static uint32_t writes;
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } \
+    } while (0)
+
+static void writeFrame(const uint8_t *grb, uint16_t bytes) {
+    fwrite(grb, 1, bytes, sinkFile);
+    writes++;
+}
+
+static void randomize(uint8_t *buf, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+}
+
+static void testSlice(uint8_t x, uint8_t *slice) {
+    for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+        for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+            ChainRender_SetVoxel(slice, y, z, (rgb_t){(uint8_t)(x * 16 + sliceSeed), (uint8_t)(y * 16), (uint8_t)(z * 16)});
+        }
+    }
+}
+
+// The last bytes the sink wrote must be the start of expected[]
+static void checkBytes(const char *what, int result, uint16_t bytes) {
+    CHECK(result == LED_OUTPUT_SENT, "%s: submit returned %d", what, result);
+    long end = ftell(sinkFile);
+    CHECK(end >= bytes, "%s: nothing written", what);
+    fseek(sinkFile, end - bytes, SEEK_SET);
+    size_t got = fread(readBack, 1, bytes, sinkFile);
+    fseek(sinkFile, 0, SEEK_END);
+    if (got != bytes || memcmp(readBack, expected, bytes) != 0) {
+        uint16_t i = 0;
+        while (i < got && readBack[i] == expected[i]) i++;
+        CHECK(0, "%s: byte %u of the frame is %u, expected %u", what, i, readBack[i], expected[i]);
+    }
+}
+
+static void checkFrame(const char *what, int result) {
+    checkBytes(what, result, FRAME_BYTES);
+}
+
+static void testSources(void) {
+    srand(11);
+    for (int run = 0; run < RUNS; run++) {
+        randomize(frameA, sizeof(frameA));
+        randomize(frameB, sizeof(frameB));
+        randomize(alpha, sizeof(alpha));
+        randomize(indices, sizeof(indices));
+        randomize(palette, sizeof(palette));
+
+        memcpy(expected, frameA, FRAME_BYTES);
+        checkFrame("grb", LedOutput_Show(frameA, NUM_LEDS));
+
+        for (uint16_t led = 0; led < NUM_LEDS; led++) {
+            uint16_t a = alpha[led] + (alpha[led] >= 128);   // 255 gives exactly "to"
+            for (uint8_t c = 0; c < 3; c++) {
+                uint16_t i = led * 3 + c;
+                expected[i] = (uint8_t)((frameA[i] * (256 - a) + frameB[i] * a) >> 8);
+            }
+        }
+        checkFrame("blend", LedOutput_ShowBlend(frameA, frameB, alpha, NUM_LEDS));
+
+        for (uint16_t led = 0; led < NUM_LEDS; led++) {
+            memcpy(&expected[led * 3], &palette[indices[led] * 3], 3);
+        }
+        checkFrame("indexed", LedOutput_ShowIndexed(indices, palette, NUM_LEDS));
+
+        // The sink takes computed frames; they must match the resolved buffer
+        sliceSeed = (uint8_t)run;
+        ChainRender_BeginFrame(testSlice);
+        ChainRender_Resolve();
+        memcpy(expected, testBuffer, FRAME_BYTES);
+        checkFrame("slices", LedOutput_ShowSlices(testSlice, NUM_LEDS));
+    }
+
+    // Rainbow goes out in chain order with the colors it used to draw
+    clearAllLeds();
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+            for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+                setVoxel(x, y, z, (rgb_t){(uint8_t)(x * 32 + 77), (uint8_t)(y * 32 + 77), (uint8_t)(z * 32 + 77)});
+            }
+        }
+    }
+    memcpy(expected, testBuffer, FRAME_BYTES);
+    Pattern_Rainbow_Step(77);
+    checkFrame("rainbow", LedOutput_ShowSlices(ChainRender_TakeFrame(), NUM_LEDS));
+}
+
+static void testDevice(void) {
+    led_output_stats_t stats;
+    LedOutput_GetStats(&stats);
+    CHECK(stats.frames == RUNS * 4 + 1 && stats.sent == stats.frames && stats.skipped == 0 &&
+          stats.errors == 0 && stats.frameUs == 0,
+          "stats: %u frames, %u sent, %u skipped, %u errors, %u us",
+          (unsigned)stats.frames, (unsigned)stats.sent, (unsigned)stats.skipped,
+          (unsigned)stats.errors, (unsigned)stats.frameUs);
+    CHECK(writes == stats.sent, "%u writes for %u frames sent", (unsigned)writes, (unsigned)stats.sent);
+
+    // The sink never skips, so the same frame is written again
+    memcpy(expected, frameA, FRAME_BYTES);
+    checkFrame("repeat", LedOutput_Show(frameA, NUM_LEDS));
+    checkFrame("repeat", LedOutput_Show(frameA, NUM_LEDS));
+
+    // The output chain runs on the way out
+    Output_SetStages(OUTPUT_STAGE_BRIGHTNESS);
+    Output_SetBrightness(0.5f);
+    for (uint16_t i = 0; i < FRAME_BYTES; i++) {
+        expected[i] = (uint8_t)(frameA[i] >> 1);
+    }
+    checkFrame("brightness", LedOutput_Show(frameA, NUM_LEDS));
+    Output_SetStages(0);
+
+    // A refresh sends the last frame from its buffers; a computed frame is not sent again
+    memcpy(expected, frameB, FRAME_BYTES);
+    checkFrame("before refresh", LedOutput_Show(frameB, NUM_LEDS));
+    checkFrame("refresh", LedOutput_Refresh());
+    ChainRender_BeginFrame(testSlice);
+    ChainRender_TakeFrame();
+    LedOutput_ShowSlices(testSlice, NUM_LEDS);
+    uint32_t before = writes;
+    CHECK(LedOutput_Refresh() == LED_OUTPUT_SKIPPED && writes == before, "refresh sent a computed frame again");
+
+    // Bad arguments never reach the device
+    CHECK(LedOutput_Show(frameA, 0) == LED_OUTPUT_ERROR, "zero LEDs accepted");
+    CHECK(LedOutput_Show(frameA, NUM_LEDS + 1) == LED_OUTPUT_ERROR, "too many LEDs accepted");
+    CHECK(LedOutput_Show(NULL, NUM_LEDS) == LED_OUTPUT_ERROR, "NULL frame accepted");
+    CHECK(LedOutput_ShowBlend(frameA, NULL, alpha, NUM_LEDS) == LED_OUTPUT_ERROR, "blend without a target accepted");
+    CHECK(writes == before, "a rejected frame was written");
+
+    // Part of the chain, and no writer at all
+    memcpy(expected, frameB, 30);
+    checkBytes("short", LedOutput_Show(frameB, 10), 30);
+    LedSink_SetWriter(NULL);
+    CHECK(LedOutput_Show(frameA, NUM_LEDS) == LED_OUTPUT_SENT && writes == before + 1, "wrote without a writer");
+
+    // Selecting a device drops the frame a refresh would send
+    LedOutput_Select(NULL);
+    CHECK(LedOutput_Device() == &ledSinkDevice, "NULL device selected");
+    LedOutput_Select(&ledSinkDevice);
+    CHECK(LedOutput_Refresh() == LED_OUTPUT_SKIPPED, "refresh after select sent a frame");
+}
+
+int main(void) {
+    sinkFile = tmpfile();
+    if (sinkFile == NULL) {
+        perror("tmpfile");
+        return 1;
+    }
+    LedOutput_Select(&ledSinkDevice);
+    LedSink_SetWriter(writeFrame);
+
+    testSources();
+    testDevice();
+
+    fclose(sinkFile);
+    printf("%s: %d failure(s)\n", ledSinkDevice.name, failures);
+    return failures != 0;
+}
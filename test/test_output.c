@@ -0,0 +1,151 @@
+/**
+ * @file test_output.c
+ * @brief Post-processing chain checks: power limit, per-LED balance and
+ *        knowing an off frame ahead.
+ *
+ * The power limit has to hold on the frame that goes over: a full-white
+ * frame straight after a dark one, random frames with gamma and dither,
+ * hardware dimming and slice frames (which the chain never reads ahead and
+ * only the in-pass clamp limits). Built with and without
+ * OUTPUT_POWER_READ_AHEAD; see the Makefile. Frames are run through the
+ * chain the way the encoders do, one LED at a time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+#include "output.h"
+
+#define BUDGET_MA    500U
+#define BUDGET       ((BUDGET_MA * 255U) / OUTPUT_MA_PER_CHANNEL)
+#define RANDOM_RUNS  50
+
+static uint8_t frame[NUM_LEDS * 3];
+static uint8_t sent[NUM_LEDS * 3];
+static uint8_t balance[NUM_LEDS * 3];
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } \
+    } while (0)
+
+// Send one frame through the chain; returns its current in channel units
+static uint32_t runFrame(uint8_t kind) {
+    frame_source_t src = {kind, frame, NULL, NULL, NULL};
+    Output_BeginFrame(&src, NUM_LEDS);
+    uint32_t total = 0;
+    for (uint16_t led = 0; led < NUM_LEDS; led++) {
+        // Slice frames are fed by hand; the chain never reads them ahead
+        memcpy(&sent[led * 3], &frame[led * 3], 3);
+        Output_ProcessLed(led, &sent[led * 3]);
+        total += sent[led * 3] + sent[led * 3 + 1] + sent[led * 3 + 2];
+    }
+    Output_EndFrame();
+    return total;
+}
+
+static void darkThenWhite(const char *what, uint8_t kind) {
+    memset(frame, 0, sizeof(frame));
+    for (int i = 0; i < 3; i++) {
+        runFrame(kind);
+    }
+    memset(frame, 255, sizeof(frame));
+    uint32_t total = runFrame(kind);
+    CHECK(total <= BUDGET, "%s: white frame drew %u, budget %u", what, (unsigned)total, (unsigned)BUDGET);
+    CHECK(total >= BUDGET * 9 / 10, "%s: white frame only drew %u of %u", what, (unsigned)total, (unsigned)BUDGET);
+}
+
+// The frame just sent was dimmed evenly rather than cut off
+static void checkEven(const char *what) {
+    uint8_t low = 255, high = 0;
+    for (uint16_t i = 0; i < NUM_LEDS * 3; i++) {
+        if (sent[i] < low) low = sent[i];
+        if (sent[i] > high) high = sent[i];
+    }
+    CHECK(high - low <= 1, "%s: white frame sent %u to %u, not one level", what, low, high);
+}
+
+int main(void) {
+    Output_SetPowerBudget(BUDGET_MA);
+
+    // Measured ahead, the white frame is scaled evenly. Otherwise the clamp
+    // stops it at the budget and the frame after it is scaled evenly
+    Output_SetStages(OUTPUT_STAGE_POWER_LIMIT);
+    darkThenWhite("grb", FRAME_SOURCE_GRB);
+#if !OUTPUT_POWER_READ_AHEAD
+    runFrame(FRAME_SOURCE_GRB);
+#endif
+    checkEven("grb");
+
+    // Never measured ahead, the clamp stops the frame at the budget
+    darkThenWhite("slices", FRAME_SOURCE_SLICES);
+
+    // Nothing sent under a new budget yet: the first frame is scaled for full white
+    memset(frame, 0, sizeof(frame));
+    runFrame(FRAME_SOURCE_SLICES);
+    Output_SetPowerBudget(BUDGET_MA);
+    memset(frame, 255, sizeof(frame));
+    uint32_t first = runFrame(FRAME_SOURCE_SLICES);
+    CHECK(first <= BUDGET && first >= BUDGET * 9 / 10, "first frame: drew %u, budget %u",
+          (unsigned)first, (unsigned)BUDGET);
+    checkEven("first frame");
+
+    // Dither rounding can't push a frame over
+    Output_SetStages(OUTPUT_STAGE_GAMMA | OUTPUT_STAGE_POWER_LIMIT | OUTPUT_STAGE_DITHER);
+    srand(5);
+    for (int run = 0; run < RANDOM_RUNS; run++) {
+        uint8_t level = (uint8_t)rand();
+        for (uint16_t i = 0; i < NUM_LEDS * 3; i++) {
+            frame[i] = (uint8_t)(rand() % (level + 1));
+        }
+        uint32_t total = runFrame(FRAME_SOURCE_GRB);
+        CHECK(total <= BUDGET, "dither run %d: drew %u, budget %u", run, (unsigned)total, (unsigned)BUDGET);
+    }
+
+    // With hardware dimming the current is the sent values times the level
+    Output_SetStages(OUTPUT_STAGE_BRIGHTNESS | OUTPUT_STAGE_POWER_LIMIT);
+    Output_SetHardwareLevels(31);
+    Output_SetBrightness(0.5f);
+    memset(frame, 255, sizeof(frame));
+    uint32_t total = runFrame(FRAME_SOURCE_GRB) * Output_HardwareLevel() / 31;
+    CHECK(total <= BUDGET, "hardware levels: drew %u, budget %u", (unsigned)total, (unsigned)BUDGET);
+    Output_SetHardwareLevels(0);
+    Output_SetBrightness(1.0f);
+
+    // Per-LED balance on top of the per-channel gains
+    memset(balance, 255, sizeof(balance));
+    balance[7 * 3 + 1] = 127;
+    Output_SetLedBalance(balance);
+    Output_SetWhiteBalance(256, 256, 128);
+    Output_SetStages(OUTPUT_STAGE_WHITE_BALANCE);
+    memset(frame, 200, sizeof(frame));
+    runFrame(FRAME_SOURCE_GRB);
+    CHECK(sent[0] == 200 && sent[1] == 200 && sent[2] == 100, "balance: LED 0 sent %u %u %u",
+          sent[0], sent[1], sent[2]);
+    CHECK(sent[7 * 3 + 1] == 100, "balance: LED 7 red sent %u, expected 100", sent[7 * 3 + 1]);
+    Output_SetLedBalance(NULL);
+    runFrame(FRAME_SOURCE_GRB);
+    CHECK(sent[7 * 3 + 1] == 200, "balance: LED 7 red sent %u with no table", sent[7 * 3 + 1]);
+
+    // Off frames are known as such before they are run
+    Output_SetStages(OUTPUT_STAGE_BRIGHTNESS | OUTPUT_STAGE_AFTERGLOW);
+    CHECK(Output_FrameBlank(0) && !Output_FrameBlank(1), "blank: wrong answer at brightness 1");
+    Output_SetBrightness(0.0f);
+    CHECK(Output_FrameBlank(1), "blank: a lit input at brightness 0 is not off");
+    Output_SetBrightness(1.0f);
+    memset(frame, 255, sizeof(frame));
+    runFrame(FRAME_SOURCE_GRB);
+    memset(frame, 0, sizeof(frame));
+    int fading = 0;
+    while (!Output_FrameBlank(0) && fading < 100) {
+        runFrame(FRAME_SOURCE_GRB);
+        fading++;
+    }
+    CHECK(fading > 1 && fading < 100, "blank: afterglow faded out after %d frames", fading);
+    CHECK(runFrame(FRAME_SOURCE_GRB) == 0, "blank: frame after the afterglow is lit");
+    Output_SetStages(0);
+
+    printf("output: %d failure(s)\n", failures);
+    return failures != 0;
+}
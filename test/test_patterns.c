@@ -0,0 +1,183 @@
+/**
+ * @file test_patterns.c
+ * @brief Golden-frame regression test for every pattern.
+ *
+ * Runs the pattern check sequence (pattern_check.h) straight after the
+ * same initialisation as main() and compares each frame's hash with
+ * pattern_golden.c, the table the cube's verify build uses. The frames
+ * themselves are kept in patterns.golden as stream packets (keyframe plus
+ * deltas per pattern), so a failure names the first differing voxel.
+ *
+ *   test_patterns                         check (exit status 1 on failure)
+ *   test_patterns record FRAMES GOLDEN_C  re-record both files
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pattern_check.h"
+#include "common_functions.h"
+#include "new_patterns.h"
+#include "rotation_tables.h"
+#include "stream_encoder.h"
+
+#define FRAMES_FILE "patterns.golden"
+
+static uint8_t packet[STREAM_MAX_PACKET];
+static uint8_t golden[STREAM_FRAME_BYTES];
+static uint32_t hashes[PATTERN_COUNT][PATTERN_CHECK_FRAMES];
+
+// The state main() leaves the patterns in before PatternCheck_RunAll()
+static void boot(void) {
+    Cube_Init();
+    initRainPattern();
+    initRainRGBPattern();
+    initFireworksPattern();
+    RotationTables_Init();
+}
+
+// Next packet of the frames file applied to golden[]; 0 at the end or on a bad packet
+static int readGoldenFrame(FILE *in) {
+    if (fread(packet, 1, STREAM_HEADER_SIZE, in) != STREAM_HEADER_SIZE ||
+        packet[0] != STREAM_SYNC0 || packet[1] != STREAM_SYNC1) {
+        return 0;
+    }
+    uint16_t length = (uint16_t)(packet[4] | (packet[5] << 8));
+    if (!StreamProtocol_LengthValid(packet[2], length) ||
+        fread(packet + STREAM_HEADER_SIZE, 1, length + STREAM_CRC_SIZE, in) != length + STREAM_CRC_SIZE) {
+        return 0;
+    }
+    const uint8_t *payload = packet + STREAM_HEADER_SIZE;
+    uint16_t crc = StreamProtocol_Crc16(STREAM_CRC_INIT, packet + 2, 4);
+    crc = StreamProtocol_Crc16(crc, payload, length);
+    if (crc != (uint16_t)(payload[length] | (payload[length + 1] << 8))) {
+        return 0;
+    }
+    return StreamProtocol_Decode(packet[2], payload, length, golden);
+}
+
+static int check(void) {
+    FILE *in = fopen(FRAMES_FILE, "rb");
+    if (in == NULL) {
+        perror(FRAMES_FILE);
+        return 1;
+    }
+
+    int failures = 0;
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+        pattern_check_result_t result = {PATTERN_CHECK_UNRECORDED, 0, 0, 0, 0, 0, 0, 0, {0, 0, 0}, {0, 0, 0}};
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            if (patternGolden[p][f] != 0) {
+                result.status = PATTERN_CHECK_PASS;
+            }
+        }
+
+        // Render the whole run, as the cube does, so later patterns start alike
+        seedPatternRand(PATTERN_CHECK_SEED);
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            uint32_t hash = PatternCheck_RenderFrame(p, f);
+            int haveFrame = readGoldenFrame(in);
+            if (result.status != PATTERN_CHECK_PASS) {
+                continue;
+            }
+            if (!haveFrame || PatternCheck_HashFrame(golden) != patternGolden[p][f]) {
+                printf("pattern %2u: %s does not match pattern_golden.c at frame %u; re-record\n",
+                       p, FRAMES_FILE, f);
+                fclose(in);
+                return 1;
+            }
+            if (hash != patternGolden[p][f]) {
+                result.status = PATTERN_CHECK_FAIL;
+                result.frame = f;
+                result.expected = patternGolden[p][f];
+                result.actual = hash;
+                PatternCheck_CompareFrames(golden, testBuffer, &result);
+            }
+        }
+
+        if (result.status == PATTERN_CHECK_UNRECORDED) {
+            printf("pattern %2u: no goldens recorded\n", p);
+            failures++;
+        } else if (result.status == PATTERN_CHECK_FAIL) {
+            printf("pattern %2u: FAIL at frame %u (hash %08X, golden %08X)", p,
+                   result.frame, (unsigned)result.actual, (unsigned)result.expected);
+            if (result.voxelKnown) {
+                printf(", first voxel (%u,%u,%u) GRB %02X%02X%02X, golden %02X%02X%02X",
+                       result.x, result.y, result.z,
+                       result.actualColor.g, result.actualColor.r, result.actualColor.b,
+                       result.expectedColor.g, result.expectedColor.r, result.expectedColor.b);
+            }
+            printf("\n");
+            failures++;
+        } else {
+            printf("pattern %2u: pass\n", p);
+        }
+    }
+    fclose(in);
+    printf("%d of %d patterns failed\n", failures, PATTERN_COUNT);
+    return failures != 0;
+}
+
+static int writeGoldenSource(const char *path) {
+    FILE *out = fopen(path, "w");
+    if (out == NULL) {
+        perror(path);
+        return 1;
+    }
+    fprintf(out,
+            "/**\n"
+            " * @file pattern_golden.c\n"
+            " * @brief Golden frame hashes for the pattern regression check.\n"
+            " *\n"
+            " * Recorded for CUBE_SIZE %d by the host build with `make goldens` in\n"
+            " * test/, which also writes the frames to test/" FRAMES_FILE ". Re-record\n"
+            " * only after a change that is meant to alter what a pattern shows.\n"
+            " * Do not edit by hand.\n"
+            " */\n"
+            "\n"
+            "#include \"pattern_check.h\"\n"
+            "\n"
+            "const uint32_t patternGolden[PATTERN_COUNT][PATTERN_CHECK_FRAMES] = {\n", CUBE_SIZE);
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+        fprintf(out, "    {   // Pattern %u\n", p);
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            fprintf(out, "%s0x%08XU,%s", (f % 6 == 0) ? "        " : " ", (unsigned)hashes[p][f],
+                    (f % 6 == 5 || f == PATTERN_CHECK_FRAMES - 1) ? "\n" : "");
+        }
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n");
+    return fclose(out) != 0;
+}
+
+static int record(const char *framesPath, const char *sourcePath) {
+    static stream_encoder_t encoder;
+    FILE *out = fopen(framesPath, "wb");
+    if (out == NULL) {
+        perror(framesPath);
+        return 1;
+    }
+    long total = 0;
+    for (uint8_t p = 0; p < PATTERN_COUNT; p++) {
+        StreamEncoder_Init(&encoder, PATTERN_CHECK_KEY_INTERVAL);
+        seedPatternRand(PATTERN_CHECK_SEED);
+        for (uint16_t f = 0; f < PATTERN_CHECK_FRAMES; f++) {
+            hashes[p][f] = PatternCheck_RenderFrame(p, f);
+            uint16_t bytes = StreamEncoder_Encode(&encoder, testBuffer, packet);
+            fwrite(packet, 1, bytes, out);
+            total += bytes;
+        }
+    }
+    if (fclose(out) != 0 || writeGoldenSource(sourcePath) != 0) {
+        return 1;
+    }
+    printf("recorded %d patterns x %d frames, %ld bytes\n", PATTERN_COUNT, PATTERN_CHECK_FRAMES, total);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    boot();
+    if (argc == 4 && strcmp(argv[1], "record") == 0) {
+        return record(argv[2], argv[3]);
+    }
+    return check();
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_scheduler.c
+ * @brief Scheduler releases, priorities and counters against a simulated clock.
+ *
+ * Time only moves when a task says it took time or the scheduler goes
+ * idle, which advances the clock by a millisecond as the SysTick wake-up
+ * would on the cube. The last part runs the cube's task set (render every
+ * 95 ms signalling present, a dither refresh every 12 ms, each send
+ * ~10.6 ms) and checks the refresh reaches the LEDs at ~80 fps while
+ * render keeps its period.
+ */
+
+#include <stdio.h>
+#include "scheduler.h"
+
+#define CYCLES_PER_MS  80000U
+#define SEND_US        10600U   // One 7x7x7 WS2812 frame plus latch
+
+static uint64_t simUs;
+static uint32_t msBase;     // Millisecond count at simUs 0
+static uint32_t idles;
+static int failures = 0;
+
+#define CHECK(cond, ...) do { \
+        if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } \
+    } while (0)
+
+static uint32_t simMs(void) {
+    return msBase + (uint32_t)(simUs / 1000U);
+}
+
+static uint32_t simCycles(void) {
+    return (uint32_t)(simUs * (CYCLES_PER_MS / 1000U));
+}
+
+static void simIdle(void) {
+    idles++;
+    simUs = (simUs / 1000U + 1U) * 1000U;
+}
+
+static const scheduler_clock_t simClock = {simMs, simCycles, simIdle};
+
+// Run the scheduler until the clock reaches endMs
+static void runUntil(uint32_t endMs) {
+    while ((int32_t)(simMs() - endMs) < 0) {
+        if (Scheduler_RunPending() == 0) {
+            simClock.idle();
+        }
+    }
+}
+
+// ---- Task bodies ----
+
+static char order[16];
+static uint8_t orderLength;
+static uint8_t eventTask;
+static uint32_t workUs;
+
+static void logA(void) {
+    if (orderLength < sizeof(order) - 1) order[orderLength++] = 'a';
+}
+
+static void logB(void) {
+    if (orderLength < sizeof(order) - 1) order[orderLength++] = 'b';
+    Scheduler_Signal(eventTask);
+}
+
+static void logEvent(void) {
+    if (orderLength < sizeof(order) - 1) order[orderLength++] = 'e';
+}
+
+static void work(void) {
+    simUs += workUs;
+}
+
+static void nothing(void) {
+}
+
+// Cube task set
+static uint8_t presentTask;
+static uint32_t renders, presents, refreshes;
+
+static void render(void) {
+    renders++;
+    simUs += 2000U;
+    Scheduler_Signal(presentTask);
+}
+
+static void present(void) {
+    presents++;
+    simUs += SEND_US;
+}
+
+static void refresh(void) {
+    refreshes++;
+    simUs += SEND_US;
+}
+
+int main(void) {
+    // Periodic releases, and a 1 s run with nothing to do mostly idles
+    simUs = 0;
+    idles = 0;
+    Scheduler_Init(&simClock);
+    uint8_t fast = Scheduler_AddTask("fast", nothing, 10, 0);
+    uint8_t slow = Scheduler_AddTask("slow", nothing, 95, 0);
+    runUntil(1000);
+    CHECK(schedulerTasks[fast].runs == 100, "10 ms task ran %u times in 1 s", (unsigned)schedulerTasks[fast].runs);
+    CHECK(schedulerTasks[slow].runs == 11, "95 ms task ran %u times in 1 s", (unsigned)schedulerTasks[slow].runs);
+    CHECK(schedulerTasks[fast].missed == 0 && schedulerTasks[slow].missed == 0, "missed releases while idle");
+    CHECK(idles == 1000, "idled %u times in 1000 ms", (unsigned)idles);
+
+    // Priority order, and an event signalled by an earlier task runs in the same pass
+    Scheduler_Init(&simClock);
+    eventTask = Scheduler_AddTask("event", logEvent, SCHEDULER_EVENT, 0);
+    Scheduler_AddTask("a", logA, 5, 0);
+    Scheduler_AddTask("b", logB, 5, 0);
+    orderLength = 0;
+    Scheduler_RunPending();
+    order[orderLength] = '\0';
+    CHECK(orderLength == 2 && order[0] == 'a' && order[1] == 'b', "first pass ran \"%s\", expected \"ab\"", order);
+    orderLength = 0;
+    Scheduler_RunPending();
+    order[orderLength] = '\0';
+    CHECK(orderLength == 1 && order[0] == 'e', "second pass ran \"%s\", expected \"e\"", order);
+    orderLength = 0;
+    Scheduler_RunPending();
+    CHECK(orderLength == 0, "an event task ran without a signal");
+
+    // A late start skips whole periods and keeps the phase; the budget counts overruns
+    simUs = 500U;
+    Scheduler_Init(&simClock);
+    uint8_t worker = Scheduler_AddTask("work", work, 10, 3U * CYCLES_PER_MS);
+    workUs = 2000U;
+    Scheduler_RunPending();
+    workUs = 35000U;
+    simUs = 10000U;
+    Scheduler_RunPending();
+    CHECK(schedulerTasks[worker].overruns == 1, "%u overruns, expected 1", (unsigned)schedulerTasks[worker].overruns);
+    CHECK(schedulerTasks[worker].maxCycles == 35U * CYCLES_PER_MS, "max %u cycles", (unsigned)schedulerTasks[worker].maxCycles);
+    workUs = 0;
+    Scheduler_RunPending();
+    CHECK(schedulerTasks[worker].missed == 2, "%u missed, expected 2", (unsigned)schedulerTasks[worker].missed);
+    CHECK(schedulerTasks[worker].nextMs == 50, "next release at %u ms, expected 50", (unsigned)schedulerTasks[worker].nextMs);
+
+    // Releases carry on across the millisecond counter wrapping
+    simUs = 0;
+    msBase = 0xFFFFFFFFU - 20U;
+    Scheduler_Init(&simClock);
+    worker = Scheduler_AddTask("wrap", nothing, 10, 0);
+    runUntil(msBase + 100U);
+    CHECK(schedulerTasks[worker].runs == 10 && schedulerTasks[worker].missed == 0,
+          "across the wrap: %u runs, %u missed, expected 10 and 0",
+          (unsigned)schedulerTasks[worker].runs, (unsigned)schedulerTasks[worker].missed);
+    msBase = 0;
+
+    // A full table refuses more tasks
+    Scheduler_Init(&simClock);
+    for (uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        Scheduler_AddTask("fill", nothing, 10, 0);
+    }
+    CHECK(Scheduler_AddTask("extra", nothing, 10, 0) == SCHEDULER_NO_TASK, "a full table took another task");
+    CHECK(Scheduler_TaskCount() == SCHEDULER_MAX_TASKS, "%u tasks", Scheduler_TaskCount());
+
+    // The cube's set: the refresh fills the time between pattern steps
+    simUs = 0;
+    Scheduler_Init(&simClock);
+    Scheduler_AddTask("input", nothing, 10, 0);
+    Scheduler_AddTask("render", render, 95, 0);
+    presentTask = Scheduler_AddTask("present", present, SCHEDULER_EVENT, 0);
+    uint8_t refreshTask = Scheduler_AddTask("refresh", refresh, 12, 0);
+    runUntil(10000);
+    uint32_t fps = (presents + refreshes) / 10U;
+    printf("scheduler: %u renders, %u frames sent in 10 s (%u fps)\n", (unsigned)renders,
+           (unsigned)(presents + refreshes), (unsigned)fps);
+    CHECK(renders >= 105 && renders <= 106, "%u renders in 10 s at 95 ms", (unsigned)renders);
+    CHECK(presents == renders, "%u presents for %u renders", (unsigned)presents, (unsigned)renders);
+    CHECK(fps >= 75, "only %u fps with the refresh", (unsigned)fps);
+    CHECK(schedulerTasks[refreshTask].missed < refreshes / 10, "refresh missed %u of %u releases",
+          (unsigned)schedulerTasks[refreshTask].missed, (unsigned)refreshes);
+
+    printf("scheduler: %d failure(s)\n", failures);
+    return failures != 0;
+}
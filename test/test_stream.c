@@ -0,0 +1,249 @@
+/**
+ * @file test_stream.c
+ * @brief UART stream round trip through a pseudo-terminal.
+ *
+ * A child process plays the PC: it opens the slave side of a pty in raw
+ * mode, as it would the LaunchPad's virtual COM port, and writes a run of
+ * encoded frames with one packet left out, one corrupted and one sent
+ * twice. The parent is the cube: every byte read from the master side
+ * goes to the stream receiver as UART0 would deliver it, header bytes
+ * through the receive interrupt and payloads through the host uDMA model.
+ * Time is simulated at the UART byte rate, so the frame rate reported is
+ * what the link sustains at STREAM_BAUD; the wall-clock rate through the
+ * pty is printed alongside.
+ *
+ * Every presented frame must equal the frame sent with its seq number,
+ * and the error counters must account for exactly the faults injected.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "stream_encoder.h"
+#include "host_udma.h"
+
+// termios.h names the carriage return delays after SSI0 registers
+#undef CR0
+#undef CR1
+
+// The receiver's state machine is static, so the test builds it in
+#include "../stream.c"
+
+#define FRAMES          600
+#define KEY_INTERVAL    30
+#define DROP_FRAME      50      // Encoded but never sent
+#define CORRUPT_FRAME   120     // Sent with one payload byte flipped
+#define REPEAT_FRAME    200     // Sent twice
+#define BYTE_NS         ((uint32_t)(10ULL * 1000000000U / STREAM_BAUD))   // Start, 8 data, stop
+
+void SysTick_Handler(void);
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                  \
+    do {                                                  \
+        if (!(cond)) {                                    \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);   \
+            printf(__VA_ARGS__);                          \
+            printf("\n");                                 \
+            failures++;                                   \
+        }                                                 \
+    } while (0)
+
+// Frame f: a soft band sweeping through the cube over a slow background,
+// so consecutive frames share most LEDs and deltas are worth sending
+static void makeFrame(uint16_t f, uint8_t *grb) {
+    for (uint16_t led = 0; led < NUM_LEDS; led++) {
+        uint8_t band = (uint8_t)((led + f * 3) % NUM_LEDS < CUBE_SIZE * CUBE_SIZE);
+        grb[led * 3 + 0] = band ? 200 : (uint8_t)(f / 8);
+        grb[led * 3 + 1] = band ? (uint8_t)(f * 5) : 10;
+        grb[led * 3 + 2] = (uint8_t)((led % 4 == 0) ? f : 0);
+    }
+}
+
+// ---- PC side ----
+
+static void sendAll(int fd, const uint8_t *data, uint16_t length) {
+    while (length > 0) {
+        ssize_t n = write(fd, data, length);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            perror("pty write");
+            _exit(1);
+        }
+        data += n;
+        length = (uint16_t)(length - n);
+    }
+}
+
+static void pcSender(const char *port) {
+    static stream_encoder_t encoder;
+    static uint8_t frame[STREAM_FRAME_BYTES];
+    static uint8_t packet[STREAM_MAX_PACKET];
+
+    int fd = open(port, O_WRONLY | O_NOCTTY);
+    struct termios tio;
+    if (fd < 0 || tcgetattr(fd, &tio) != 0) {
+        perror(port);
+        _exit(1);
+    }
+    cfmakeraw(&tio);
+    cfsetospeed(&tio, B921600);
+    tcsetattr(fd, TCSANOW, &tio);
+
+    StreamEncoder_Init(&encoder, KEY_INTERVAL);
+    for (uint16_t f = 0; f < FRAMES; f++) {
+        makeFrame(f, frame);
+        uint16_t bytes = StreamEncoder_Encode(&encoder, frame, packet);
+        if (f == DROP_FRAME) {
+            continue;
+        }
+        if (f == CORRUPT_FRAME) {
+            packet[STREAM_HEADER_SIZE] ^= 0x10;
+        }
+        sendAll(fd, packet, bytes);
+        if (f == REPEAT_FRAME) {
+            sendAll(fd, packet, bytes);
+        }
+    }
+    tcdrain(fd);
+    close(fd);
+    _exit(0);
+}
+
+// ---- Cube side ----
+
+static uint8_t payload[UDMA_MAX_TRANSFER];
+static uint16_t payloadBytes;
+static uint32_t simNs;
+static uint16_t nextFrame;   // Index of the frame the next seq number maps to
+
+static void tick(void) {
+    simNs += BYTE_NS;
+    while (simNs >= 1000000U) {
+        simNs -= 1000000U;
+        SysTick_Handler();
+    }
+}
+
+// The main loop keeps up with the link, so each packet is taken as it completes
+static void poll(void) {
+    static uint8_t expected[STREAM_FRAME_BYTES];
+    if (readyIndex < 0) {
+        return;
+    }
+    const uint8_t *frame = Stream_NextFrame();
+    if (frame == NULL) {
+        return;
+    }
+    uint16_t f = (uint16_t)(nextFrame + (uint8_t)(lastSeq - nextFrame));
+    makeFrame(f, expected);
+    static uint8_t reported = 0;
+    if (!reported && memcmp(frame, expected, STREAM_FRAME_BYTES) != 0) {
+        CHECK(0, "frame %u presented wrong", f);   // Later frames usually follow it
+        reported = 1;
+    }
+    nextFrame = (uint16_t)(f + 1);
+}
+
+// One byte off the wire, delivered as UART0 and the uDMA would
+static void uartReceive(uint8_t byte) {
+    tick();
+    if (rxState != RX_PAYLOAD) {
+        receiveByte(byte);
+        poll();
+        return;
+    }
+    payload[payloadBytes++] = byte;
+    if (payloadBytes == HostUdma_Pending(UDMA_CH_UART0RX)) {
+        HostUdma_Run(UDMA_CH_UART0RX, payload, NULL);
+        payloadBytes = 0;
+        UART0_Handler();
+    }
+}
+
+static double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+int main(void) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("pty");
+        return 1;
+    }
+    const char *port = ptsname(master);
+    // Held open until the sender has it, so the master reads EIO only at the end
+    int slave = open(port, O_RDWR | O_NOCTTY);
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+
+    double start = seconds();
+    pid_t pc = fork();
+    if (pc == 0) {
+        close(master);
+        pcSender(port);
+    }
+    close(slave);
+
+    Stream_Init();
+    static uint8_t buf[4096];
+    uint32_t wireBytes = 0;
+    for (;;) {
+        ssize_t n = read(master, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;   // EIO once the sender has closed the port
+        }
+        for (ssize_t i = 0; i < n; i++) {
+            uartReceive(buf[i]);
+        }
+        wireBytes += (uint32_t)n;
+    }
+    double elapsed = seconds() - start;
+    int status;
+    waitpid(pc, &status, 0);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0, "sender failed");
+
+    volatile stream_stats_t *s = &streamStats;
+    uint32_t simMs = SysTick_GetMs();
+    printf("%u bytes, %u packets received, %u presented\n", (unsigned)wireBytes,
+           (unsigned)s->framesReceived, (unsigned)s->framesPresented);
+    printf("dropped %u crc %u duplicates %u deltas skipped %u overwritten %u header %u decode %u timeouts %u\n",
+           (unsigned)s->framesDropped, (unsigned)s->crcErrors, (unsigned)s->duplicates,
+           (unsigned)s->deltasSkipped, (unsigned)s->framesOverwritten, (unsigned)s->headerErrors,
+           (unsigned)s->decodeErrors, (unsigned)s->timeouts);
+    printf("%.1f fps sustained at %u baud (%u ms of line time), %.0f fps through the pty\n",
+           s->framesPresented * 1000.0 / simMs, (unsigned)STREAM_BAUD, (unsigned)simMs,
+           s->framesPresented / elapsed);
+
+    // The drop and the corruption each leave one gap, and the deltas after
+    // them wait for the next keyframe (at most KEY_INTERVAL packets away)
+    CHECK(nextFrame == FRAMES, "last frame presented was %u", nextFrame - 1);
+    CHECK(s->framesReceived == FRAMES, "%u packets received", (unsigned)s->framesReceived);
+    CHECK(s->crcErrors == 1 && s->duplicates == 1 && s->framesDropped == 2,
+          "fault counters do not match the faults sent");
+    CHECK(s->framesPresented + s->deltasSkipped == FRAMES - 2, "%u frames unaccounted for",
+          (unsigned)(FRAMES - 2 - s->framesPresented - s->deltasSkipped));
+    CHECK(s->deltasSkipped < 2 * KEY_INTERVAL, "%u deltas skipped", (unsigned)s->deltasSkipped);
+    CHECK(s->headerErrors == 0 && s->decodeErrors == 0 && s->overruns == 0 &&
+          s->timeouts == 0 && s->framesOverwritten == 0, "unexpected receive errors");
+
+    printf("stream: %d failure(s)\n", failures);
+    return failures != 0;
+}
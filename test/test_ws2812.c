@@ -0,0 +1,243 @@
+/**
+ * @file test_ws2812.c
+ * @brief WS2812 decoder checks and encoder round trips through the decoder.
+ *
+ * The decoder is first checked against streams built here, then every
+ * frame source is sent through the WS2812 device of this build (padded,
+ * packed or uDMA symbols, any LED_PIXEL_FORMAT) and the waveform decoded
+ * back: it must meet the datasheet timing and carry exactly the GRB values
+ * of the source. Built once per encoder variant; see the Makefile.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WS2812.h"
+#include "WS2812_Decoder.h"
+#include "board.h"
+#include "chain_render.h"
+#include "common_functions.h"
+#include "output.h"
+#if WS2812_DMA
+#include "host_udma.h"
+
+void SSI0_Handler(void);
+#endif
+
+#define SPI_HZ    (SYS_CLOCK / 34U)      // Bit clock the driver sets up (CPSDVSR 34)
+#define LATCH_NS  150000U
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                  \
+    do {                                                  \
+        if (!(cond)) {                                    \
+            printf("FAIL %s:%d: ", __FILE__, __LINE__);   \
+            printf(__VA_ARGS__);                          \
+            printf("\n");                                 \
+            failures++;                                   \
+        }                                                 \
+    } while (0)
+
+static uint8_t decoded[NUM_LEDS * LED_PIXEL_CHANNELS];
+static uint8_t expected[NUM_LEDS * LED_PIXEL_CHANNELS];
+
+// ---- Decoder against hand-built streams ----
+
+// One '110' / '100' symbol byte per bit with two zero bytes of padding
+static uint16_t paddedStream(const uint8_t *grb, uint16_t bytes, uint8_t *out) {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < bytes; i++) {
+        for (int bit = 7; bit >= 0; bit--) {
+            out[n++] = (grb[i] & (1 << bit)) ? 0x6 : 0x4;
+            out[n++] = 0;
+            out[n++] = 0;
+        }
+    }
+    return n;
+}
+
+static int decode(const uint8_t *stream, uint16_t length, uint32_t spiHz, uint32_t idleNs,
+                  ws2812_decoder_t *dec) {
+    WS2812Decoder_Init(dec, spiHz, decoded, sizeof(decoded));
+    for (uint16_t i = 0; i < length; i++) {
+        WS2812Decoder_PushByte(dec, stream[i]);
+    }
+    return WS2812Decoder_Finish(dec, idleNs);
+}
+
+static void testDecoder(void) {
+    static uint8_t stream[16 * 24 + 400];
+    const uint8_t grb[6] = {0x00, 0xFF, 0xA5, 0x5A, 0x01, 0x80};
+    ws2812_decoder_t dec;
+
+    uint16_t length = paddedStream(grb, sizeof(grb), stream);
+    CHECK(decode(stream, length, SPI_HZ, LATCH_NS, &dec), "in-spec stream failed timing");
+    CHECK(dec.outBytes == sizeof(grb) && memcmp(decoded, grb, sizeof(grb)) == 0,
+          "in-spec stream decoded to the wrong bytes");
+    CHECK(dec.minHighNs[1] >= WS2812_T1H_MIN_NS && dec.maxHighNs[0] <= WS2812_T0H_MAX_NS,
+          "pulse widths %u..%u ns (0) and %u..%u ns (1)", (unsigned)dec.minHighNs[0],
+          (unsigned)dec.maxHighNs[0], (unsigned)dec.minHighNs[1], (unsigned)dec.maxHighNs[1]);
+
+    // At 1.6 MHz a '100' high lasts 625 ns: between the 0 and 1 windows
+    CHECK(!decode(stream, length, 1600000U, LATCH_NS, &dec) && dec.highErrors > 0,
+          "slow clock passed timing");
+
+    // The chain only latches after 50 us low
+    CHECK(!decode(stream, length, SPI_HZ, 20000U, &dec), "short latch passed");
+
+    // A long gap mid-frame latches early
+    uint16_t half = paddedStream(grb, 3, stream);
+    memset(stream + half, 0, 200);  // 200 bytes * 8 bits at 425 ns = 680 us
+    length = (uint16_t)(half + 200 + paddedStream(grb + 3, 3, stream + half + 200));
+    CHECK(!decode(stream, length, SPI_HZ, LATCH_NS, &dec) && dec.midFrameResets == 1,
+          "mid-frame reset not reported");
+}
+
+// ---- Encoder round trips ----
+
+static uint8_t frameA[NUM_LEDS * 3] __attribute__((aligned(4)));
+static uint8_t frameB[NUM_LEDS * 3] __attribute__((aligned(4)));
+static uint8_t alpha[NUM_LEDS];
+static uint8_t indices[NUM_LEDS];
+static uint8_t palette[256 * 3];
+static uint8_t sliceSeed;
+#if WS2812_DMA
+static uint8_t layersBeforeLight;     // Layers computed before the frame started going out
+#endif
+
+static void randomize(uint8_t *buf, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+}
+
+static void testSlice(uint8_t x, uint8_t *slice) {
+#if WS2812_DMA
+    if (HostUdma_Pending(UDMA_CH_SSI0TX) == 0) {
+        layersBeforeLight++;
+    }
+#endif
+    for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+        for (uint8_t z = 0; z < CUBE_SIZE; z++) {
+            ChainRender_SetVoxel(slice, y, z, (rgb_t){(uint8_t)(x * 16 + sliceSeed), (uint8_t)(y * 16), (uint8_t)(z * 16)});
+        }
+    }
+}
+
+// Wire bytes for the source's GRB values, as the LEDs of this build expect them
+static void expectSource(const frame_source_t *src) {
+    for (int led = 0; led < NUM_LEDS; led++) {
+        uint8_t mixed[3];
+        const uint8_t *grb = FrameSource_Led(src, led, mixed);
+        uint8_t *wire = &expected[led * LED_PIXEL_CHANNELS];
+#if LED_PIXEL_FORMAT == LED_PIXEL_RGB
+        wire[0] = grb[1];
+        wire[1] = grb[0];
+        wire[2] = grb[2];
+#elif LED_PIXEL_FORMAT == LED_PIXEL_GRBW
+        Output_ExtractWhite(grb, wire);
+#else
+        memcpy(wire, grb, 3);
+#endif
+    }
+}
+
+// Run the frame out and check what the line carried
+static void checkSent(const char *what, int result) {
+    CHECK(result == LED_OUTPUT_SENT, "%s: submit returned %d", what, result);
+#if WS2812_DMA
+    // Play the uDMA: each segment ends in the SSI0 interrupt, which starts the next
+    static uint8_t wire[NUM_LEDS * LED_PIXEL_CHANNELS * 3];
+    uint32_t length = 0;
+    while (HostUdma_Pending(UDMA_CH_SSI0TX) > 0) {
+        length += HostUdma_Run(UDMA_CH_SSI0TX, NULL, wire + length);
+        SSI0_Handler();
+    }
+    CHECK(LedOutput_Wait() == 1, "%s: frame did not finish", what);
+    ws2812_decoder_t dec;
+    CHECK(decode(wire, (uint16_t)length, SPI_HZ, LATCH_NS, &dec), "%s: timing failed", what);
+    const ws2812_decoder_t *last = &dec;
+#else
+    const ws2812_decoder_t *last = &ws2812Validation.last;
+    memcpy(decoded, ws2812Validation.last.out, ws2812Validation.last.outBytes);
+    CHECK(ws2812Validation.timingFailures == 0, "%s: timing failed", what);
+#endif
+    CHECK(last->outBytes == sizeof(expected) && memcmp(decoded, expected, sizeof(expected)) == 0,
+          "%s: decoded %u bytes that differ from the source", what, last->outBytes);
+    CHECK(last->highErrors == 0 && last->lowErrors == 0,
+          "%s: %u bad pulses, %u short gaps", what, (unsigned)last->highErrors, (unsigned)last->lowErrors);
+}
+
+static void testEncoder(void) {
+    led_output_stats_t stats;
+    frame_source_t src = {FRAME_SOURCE_GRB, frameA, NULL, NULL, NULL};
+
+    LedOutput_Init();
+    srand(7);
+    for (int i = 0; i < 10; i++) {
+        randomize(frameA, sizeof(frameA));
+        randomize(frameB, sizeof(frameB));
+        randomize(alpha, sizeof(alpha));
+        randomize(indices, sizeof(indices));
+        randomize(palette, sizeof(palette));
+
+        src = (frame_source_t){FRAME_SOURCE_GRB, frameA, NULL, NULL, NULL};
+        expectSource(&src);
+        checkSent("grb", LedOutput_Show(frameA, NUM_LEDS));
+
+        src = (frame_source_t){FRAME_SOURCE_BLEND, frameA, frameB, alpha, NULL};
+        expectSource(&src);
+        checkSent("blend", LedOutput_ShowBlend(frameA, frameB, alpha, NUM_LEDS));
+
+        src = (frame_source_t){FRAME_SOURCE_INDEXED, indices, palette, NULL, NULL};
+        expectSource(&src);
+        checkSent("indexed", LedOutput_ShowIndexed(indices, palette, NUM_LEDS));
+
+#if WS2812_DMA
+        // Computed frames start going out while their later layers are computed
+        sliceSeed = (uint8_t)i;
+        ChainRender_BeginFrame(testSlice);
+        ChainRender_Resolve();
+        src = (frame_source_t){FRAME_SOURCE_GRB, testBuffer, NULL, NULL, NULL};
+        expectSource(&src);
+        layersBeforeLight = 0;
+        checkSent("slices", LedOutput_ShowSlices(testSlice, NUM_LEDS));
+        // The lead is one layer; dead LEDs can push its end into the next
+        CHECK(layersBeforeLight <= 2, "slices: %u of %u layers computed before the first LED went out",
+              layersBeforeLight, CUBE_SIZE);
+#else
+        CHECK(LedOutput_ShowSlices(testSlice, NUM_LEDS) == LED_OUTPUT_ERROR,
+              "blocking device accepted a computed frame");
+#endif
+    }
+
+    // An unchanged frame is not sent again
+    LedOutput_GetStats(&stats);
+    uint32_t sent = stats.sent;
+    src = (frame_source_t){FRAME_SOURCE_GRB, frameA, NULL, NULL, NULL};
+    expectSource(&src);
+    checkSent("repeat", LedOutput_Show(frameA, NUM_LEDS));
+    CHECK(LedOutput_Show(frameA, NUM_LEDS) == LED_OUTPUT_SKIPPED, "unchanged frame was resent");
+    LedOutput_GetStats(&stats);
+    CHECK(stats.sent == sent + 1 && stats.errors == 0, "sent %u errors %u",
+          (unsigned)(stats.sent - sent), (unsigned)stats.errors);
+
+    // A lit frame the chain turns off is sent once and then held, dither or not
+    Output_SetStages(OUTPUT_STAGE_BRIGHTNESS | OUTPUT_STAGE_DITHER);
+    Output_SetBrightness(0.0f);
+    memset(expected, 0, sizeof(expected));
+    checkSent("brightness 0", LedOutput_Show(frameA, NUM_LEDS));
+    CHECK(LedOutput_Show(frameB, NUM_LEDS) == LED_OUTPUT_SKIPPED, "a frame at brightness 0 was sent again");
+    Output_SetBrightness(1.0f);
+    expectSource(&src);
+    checkSent("brightness 1", LedOutput_Show(frameA, NUM_LEDS));
+    Output_SetStages(0);
+}
+
+int main(void) {
+    testDecoder();
+    testEncoder();
+    printf("%s: %d failure(s)\n", LedOutput_Device()->name, failures);
+    return failures != 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file transition.c
+ * @brief Cross-fade, wipe and dissolve transitions between patterns.
+ */
+
+#include "transition.h"
+#include "board.h"
+#include "led_output.h"
+#include "common_functions.h"
+#include "pattern_functions.h"
+#include "palette.h"
+#include "chain_render.h"
+#include <stddef.h>
+#include <string.h>
+
+// Multiplier that scatters voxel numbers 0..NUM_LEDS-1 into a permutation.
+// It must be coprime with NUM_LEDS = CUBE_SIZE^3; a prime is whenever it
+// does not divide CUBE_SIZE
+#define DISSOLVE_STRIDE  167
+#if CUBE_SIZE % DISSOLVE_STRIDE == 0
+#error "DISSOLVE_STRIDE must be coprime with NUM_LEDS"
+#endif
+// Width of the soft edge in dissolve order units
+#define DISSOLVE_SOFTNESS 8
+
+// Framebuffer the outgoing pattern keeps drawing into
+static uint8_t outgoingBuffer[NUM_LEDS * 3] __attribute__((aligned(4)));
+
+// Per-LED weight of the incoming pattern, rebuilt every frame
+static uint8_t alpha[NUM_LEDS];
+
+static uint8_t transitionType = TRANSITION_CROSSFADE;
+static uint16_t transitionFrames = TRANSITION_DEFAULT_FRAMES;
+
+static uint8_t active = 0;
+static uint16_t frame = 0;
+static uint8_t outgoingPattern = 0;
+static uint8_t outgoingPosition = 0;
+static uint32_t outgoingSteps = 0;
+
+void Transition_Configure(uint8_t type, uint16_t frames) {
+    transitionType = type;
+    transitionFrames = frames;
+}
+
+void Transition_Start(uint8_t fromPattern, uint8_t fromPosition, uint32_t fromSteps) {
+    if (transitionType == TRANSITION_CUT || transitionFrames == 0) {
+        active = 0;
+        return;
+    }
+    outgoingPattern = fromPattern;
+    outgoingPosition = fromPosition;
+    outgoingSteps = fromSteps;
+    // Start from the last frame shown so patterns that fade their previous
+    // frame (trails) carry on instead of restarting from black
+    memcpy(outgoingBuffer, testBuffer, sizeof(outgoingBuffer));
+    frame = 0;
+    active = 1;
+}
+
+uint8_t Transition_Active(void) {
+    return active;
+}
+
+static uint8_t clampAlpha(int32_t value) {
+    if (value < 0) return 0;
+    if (value > 255) return 255;
+    return (uint8_t)value;
+}
+
+// Fill alpha[] for a progress value of 0..256
+static void buildAlpha(uint16_t progress) {
+    // Leading edge of a wipe in 8.8 voxel units, one voxel of softness
+    int32_t edge = (int32_t)progress * (CUBE_SIZE + 1);
+    // Dissolve threshold in voxel-order units
+    int32_t threshold = ((int32_t)progress * (NUM_LEDS + DISSOLVE_SOFTNESS)) >> 8;
+    uint16_t voxel = 0;
+
+    for (uint8_t x = 0; x < CUBE_SIZE; x++) {
+        for (uint8_t y = 0; y < CUBE_SIZE; y++) {
+            for (uint8_t z = 0; z < CUBE_SIZE; z++, voxel++) {
+                int16_t idx = voxelBufferIndex(x, y, z);
+                if (idx < 0) continue;
+
+                uint8_t a;
+                switch (transitionType) {
+                    case TRANSITION_WIPE_X:
+                        a = clampAlpha(edge - ((int32_t)x << 8));
+                        break;
+                    case TRANSITION_WIPE_Y:
+                        a = clampAlpha(edge - ((int32_t)y << 8));
+                        break;
+                    case TRANSITION_WIPE_Z:
+                        a = clampAlpha(edge - ((int32_t)z << 8));
+                        break;
+                    case TRANSITION_DISSOLVE: {
+                        int32_t order = (voxel * DISSOLVE_STRIDE) % NUM_LEDS;
+                        a = clampAlpha((threshold - order) * (256 / DISSOLVE_SOFTNESS));
+                        break;
+                    }
+                    case TRANSITION_CROSSFADE:
+                    default:
+                        a = clampAlpha(progress);
+                        break;
+                }
+                alpha[idx] = a;
+            }
+        }
+    }
+}
+
+int Transition_Show(const uint8_t *incoming, float brightness) {
+    if (!active) {
+        if (Palette_FramePending()) {
+            return LedOutput_ShowIndexed(Palette_TakeFrame(), Palette_Prepare(brightness), NUM_LEDS);
+        }
+        if (ChainRender_FramePending()) {
+            if (LedOutput_Device()->slices) {
+                return LedOutput_ShowSlices(ChainRender_TakeFrame(), NUM_LEDS);
+            }
+            ChainRender_Resolve();
+        }
+        return LedOutput_Show(incoming, NUM_LEDS);
+    }
+
+    // Blending needs GRB, so expand an indexed or computed incoming frame first
+    Palette_Resolve(brightness);
+    ChainRender_Resolve();
+
+    // Keep the outgoing pattern animating in its own framebuffer, its
+    // position moving on as it would have without the switch
+    outgoingPosition = advancePosition(outgoingPosition, &outgoingSteps);
+    setDrawBuffer(outgoingBuffer);
+    updatePattern(outgoingPattern, outgoingPosition, brightness);
+    Palette_Resolve(brightness);
+    ChainRender_Resolve();
+    setDrawBuffer(NULL);
+
+    buildAlpha((uint16_t)(((uint32_t)frame << 8) / transitionFrames));
+
+    if (++frame >= transitionFrames) {
+        active = 0;
+    }
+
+    return LedOutput_ShowBlend(outgoingBuffer, incoming, alpha, NUM_LEDS);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file transition.h
+ * @brief Blended transitions between two patterns.
+ *
+ * While a transition runs, the outgoing pattern keeps animating into a
+ * second framebuffer and the incoming pattern draws into testBuffer as usual.
+ * Both are mixed per LED inside the LED driver's encode pass. Indexed frames
+ * (palette.h) are expanded to GRB first while a transition runs.
+ */
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <stdint.h>
+
+// Transition kernels
+#define TRANSITION_CUT        0  // No blending, switch immediately
+#define TRANSITION_CROSSFADE  1  // Uniform fade from old to new
+#define TRANSITION_WIPE_X     2  // Soft edge sweeping left to right
+#define TRANSITION_WIPE_Y     3  // Soft edge sweeping front to back
+#define TRANSITION_WIPE_Z     4  // Soft edge sweeping bottom to top
+#define TRANSITION_DISSOLVE   5  // Voxels switch over in a scrambled order
+
+#define TRANSITION_DEFAULT_FRAMES 20
+
+/**
+ * @brief Select the kernel and length used by following transitions.
+ * @param type   One of the TRANSITION_* kernels.
+ * @param frames Duration in frames (0 behaves like TRANSITION_CUT).
+ */
+void Transition_Configure(uint8_t type, uint16_t frames);
+
+/**
+ * @brief Begin a transition away from the pattern that was just shown.
+ * @param fromPattern  Outgoing pattern index.
+ * @param fromPosition Position the outgoing pattern was running at.
+ * @param fromSteps    Render steps it has spent at that position.
+ */
+void Transition_Start(uint8_t fromPattern, uint8_t fromPosition, uint32_t fromSteps);
+
+/**
+ * @brief Check whether a transition is in progress.
+ */
+uint8_t Transition_Active(void);
+
+/**
+ * @brief Step the outgoing pattern and send the blended frame.
+ * @param incoming   GRB buffer of the incoming pattern (already drawn),
+ *                   unused if it drew an indexed frame, and the buffer a
+ *                   computed frame is resolved into if the device needs one.
+ * @param brightness Brightness passed to the outgoing pattern and applied
+ *                   to the palette of indexed frames.
+ * @return LED driver status (1 success, 0 error).
+ */
+int Transition_Show(const uint8_t *incoming, float brightness);
+
+#endif // TRANSITION_H